@@ -2,6 +2,7 @@
  * Header file for audio drivers
  */
 #include "ntp_types.h"
+#include "ntp_fp.h"
 
 #define MAXGAIN		255	/* max codec gain */
 #define	MONGAIN		127	/* codec monitor gain */
@@ -11,4 +12,7 @@
  */
 int	audio_init		(const char *, int, int);
 int	audio_gain		(int, int, int);
+int	audio_decompand		(const u_char *, int, const double *, double,
+				 double *);
 void	audio_show		(void);
+void	audio_stamp		(int, l_fp *, int);
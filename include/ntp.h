@@ -14,6 +14,7 @@
 #include <ntp_crypto.h>
 #include <ntp_random.h>
 #include <ntp_net.h>
+#include <ntp_counters.h>
 
 #include <isc/boolean.h>
 
@@ -189,8 +190,8 @@ struct interface {
 	u_int32		addr_refid;	/* IPv4 addr or IPv6 hash */
 	int		num_mcast;	/* mcast addrs enabled */
 	u_long		starttime;	/* current_time at creation */
-	volatile long	received;	/* number of incoming packets */
-	long		sent;		/* number of outgoing packets */
+	ctr_obj		received;	/* number of incoming packets */
+	ctr_obj		sent;		/* number of outgoing packets */
 	long		notsent;	/* number of send failures */
 	u_int		ifindex;	/* for IPV6_MULTICAST_IF */
 	isc_boolean_t	ignore_packets; /* listen-read-drop this? */
@@ -245,97 +246,66 @@ struct interface {
  * The peer structure. Holds state information relating to the guys
  * we are peering with. Most of this stuff is from section 3.2 of the
  * spec.
+ *
+ * The layout is not arbitrary.  With thousands of associations the
+ * peer list walk in timer() and clock_select() and the hash probes
+ * in findpeer() are dominated by cache misses, so the members they
+ * touch are packed at the front: first what the list and hash walks
+ * need, then what peer_unfit() and root_distance() need.  Everything
+ * only used once a packet has been matched to the association, or
+ * only by ntpq/ntpdc and the crypto code, comes after that.  Keep it
+ * that way when adding members.
  */
 struct peer {
+	/*
+	 * Hot: list and hash walks
+	 */
 	struct peer *p_link;	/* link pointer in free & peer lists */
 	struct peer *adr_link;	/* link pointer in address hash */
 	struct peer *aid_link;	/* link pointer in associd hash */
-	struct peer *ilink;	/* list of peers for interface */
-	sockaddr_u srcadr;	/* address of remote host */
-	char *	hostname;	/* if non-NULL, remote name */
-	struct addrinfo *addrs;	/* hostname query result */
-	struct addrinfo *ai;	/* position within addrs */
 	endpt *	dstadr;		/* local address */
+	sockaddr_u srcadr;	/* address of remote host */
+	u_int	flags;		/* association flags */
 	associd_t associd;	/* association ID */
-	u_char	version;	/* version number */
 	u_char	hmode;		/* local association mode */
-	u_char	hpoll;		/* local poll interval */
-	u_char	minpoll;	/* min poll interval */
-	u_char	maxpoll;	/* max poll interval */
-	u_int	flags;		/* association flags */
 	u_char	cast_flags;	/* additional flags */
-	u_char	last_event;	/* last peer error code */
-	u_char	num_events;	/* number of error events */
-	u_int32	ttl;		/* ttl/refclock mode */
-	char	*ident;		/* group identifier name */
-
-	/*
-	 * Variables used by reference clock support
-	 */
-#ifdef REFCLOCK
-	struct refclockproc *procptr; /* refclock structure pointer */
-	u_char	refclktype;	/* reference clock type */
-	u_char	refclkunit;	/* reference clock unit number */
-	u_char	sstclktype;	/* clock type for system status word */
-#endif /* REFCLOCK */
+	u_long	nextdate;	/* send time next packet */
+	int	throttle;	/* rate control */
 
 	/*
-	 * Variables set by received packet
+	 * Warm: selection and distance.  The variables set by received
+	 * packets come first, the ephemeral state variables open the
+	 * clear-to-zero area below.
 	 */
 	u_char	leap;		/* local leap indicator */
 	u_char	pmode;		/* remote association mode */
 	u_char	stratum;	/* remote stratum */
 	u_char	ppoll;		/* remote poll interval */
 	s_char	precision;	/* remote clock precision */
+	u_char	hpoll;		/* local poll interval */
+	u_char	minpoll;	/* min poll interval */
+	u_char	maxpoll;	/* max poll interval */
+	u_int32	refid;		/* remote reference ID */
 	double	rootdelay;	/* roundtrip delay to primary source */
 	double	rootdisp;	/* dispersion to primary source */
-	u_int32	refid;		/* remote reference ID */
-	l_fp	reftime;	/* update epoch */
-
-	/*
-	 * Variables used by authenticated client
-	 */
-	keyid_t keyid;		/* current key ID */
-#ifdef AUTOKEY
-#define clear_to_zero opcode
-	u_int32	opcode;		/* last request opcode */
-	associd_t assoc;	/* peer association ID */
-	u_int32	crypto;		/* peer status word */
-	EVP_PKEY *pkey;		/* public key */
-	const EVP_MD *digest;	/* message digest algorithm */
-	char	*subject;	/* certificate subject name */
-	char	*issuer;	/* certificate issuer name */
-	struct cert_info *xinfo; /* issuer certificate */
-	keyid_t	pkeyid;		/* previous key ID */
-	keyid_t	hcookie;	/* host cookie */
-	keyid_t	pcookie;	/* peer cookie */
-	const struct pkey_info *ident_pkey; /* identity key */
-	BIGNUM	*iffval;	/* identity challenge (IFF, GQ, MV) */
-	const BIGNUM *grpkey;	/* identity challenge key (GQ) */
-	struct value cookval;	/* receive cookie values */
-	struct value recval;	/* receive autokey values */
-	struct exten *cmmd;	/* extension pointer */
-	u_long	refresh;	/* next refresh epoch */
+	u_long	update;		/* receive epoch */
 
-	/*
-	 * Variables used by authenticated server
-	 */
-	keyid_t	*keylist;	/* session key ID list */
-	int	keynumber;	/* current key number */
-	struct value encrypt;	/* send encrypt values */
-	struct value sndval;	/* send autokey values */
-#else	/* !AUTOKEY follows */
 #define clear_to_zero status
-#endif	/* !AUTOKEY */
-
-	/*
-	 * Ephemeral state variables
-	 */
 	u_char	status;		/* peer status */
 	u_char	new_status;	/* under-construction status */
 	u_char	reach;		/* reachability register */
 	int	flash;		/* protocol error test tally bits */
 	u_long	epoch;		/* reference epoch */
+	double	offset;		/* peer clock offset */
+	double	delay;		/* peer roundtrip delay */
+	double	jitter;		/* peer jitter (squares) */
+	double	disp;		/* peer dispersion */
+
+	/*
+	 * Cold: everything else.  The rest of the ephemeral state
+	 * variables, filter registers (kept as parallel arrays so
+	 * clock_filter() scans them linearly) and packet timestamps.
+	 */
 	int	burst;		/* packets remaining in burst */
 	int	retry;		/* retry counter */
 	int	flip;		/* interleave mode control */
@@ -351,10 +321,6 @@ struct peer {
 	l_fp	aorg;		/* origin timestamp */
 	l_fp	borg;		/* alternate origin timestamp */
 	l_fp	bxmt;		/* most recent broadcast transmit timestamp */
-	double	offset;		/* peer clock offset */
-	double	delay;		/* peer roundtrip delay */
-	double	jitter;		/* peer jitter (squares) */
-	double	disp;		/* peer dispersion */
 	double	xleave;		/* interleave delay */
 	double	bias;		/* programmed offset bias */
 
@@ -369,15 +335,66 @@ struct peer {
 	int	t34_bytes;	/* inbound packet length */
 	double	r34;		/* inbound data rate */
 
+#ifdef AUTOKEY
+	/*
+	 * Variables used by authenticated client
+	 */
+	u_int32	opcode;		/* last request opcode */
+	associd_t assoc;	/* peer association ID */
+	u_int32	crypto;		/* peer status word */
+	EVP_PKEY *pkey;		/* public key */
+	const EVP_MD *digest;	/* message digest algorithm */
+	char	*subject;	/* certificate subject name */
+	char	*issuer;	/* certificate issuer name */
+	struct cert_info *xinfo; /* issuer certificate */
+	keyid_t	pkeyid;		/* previous key ID */
+	keyid_t	hcookie;	/* host cookie */
+	keyid_t	pcookie;	/* peer cookie */
+	const struct pkey_info *ident_pkey; /* identity key */
+	BIGNUM	*iffval;	/* identity challenge (IFF, GQ, MV) */
+	const BIGNUM *grpkey;	/* identity challenge key (GQ) */
+	struct value cookval;	/* receive cookie values */
+	struct value recval;	/* receive autokey values */
+	struct exten *cmmd;	/* extension pointer */
+	u_long	refresh;	/* next refresh epoch */
+
+	/*
+	 * Variables used by authenticated server
+	 */
+	keyid_t	*keylist;	/* session key ID list */
+	int	keynumber;	/* current key number */
+	struct value encrypt;	/* send encrypt values */
+	struct value sndval;	/* send autokey values */
+#endif	/* AUTOKEY */
+
 	/*
 	 * End of clear-to-zero area
 	 */
-	u_long	update;		/* receive epoch */
-#define end_clear_to_zero update
 	int	unreach;	/* watchdog counter */
-	int	throttle;	/* rate control */
+#define end_clear_to_zero unreach
+	keyid_t keyid;		/* current key ID */
 	u_long	outdate;	/* send time last packet */
-	u_long	nextdate;	/* send time next packet */
+	l_fp	reftime;	/* update epoch */
+	u_int32	ttl;		/* ttl/refclock mode */
+	u_char	version;	/* version number */
+	u_char	last_event;	/* last peer error code */
+	u_char	num_events;	/* number of error events */
+	u_long	ctl_stamp;	/* see ctl_peer_changed() */
+	struct peer *ilink;	/* list of peers for interface */
+	char *	hostname;	/* if non-NULL, remote name */
+	struct addrinfo *addrs;	/* hostname query result */
+	struct addrinfo *ai;	/* position within addrs */
+	char	*ident;		/* group identifier name */
+
+	/*
+	 * Variables used by reference clock support
+	 */
+#ifdef REFCLOCK
+	struct refclockproc *procptr; /* refclock structure pointer */
+	u_char	refclktype;	/* reference clock type */
+	u_char	refclkunit;	/* reference clock unit number */
+	u_char	sstclktype;	/* clock type for system status word */
+#endif /* REFCLOCK */
 
 	/*
 	 * Statistic counters
@@ -764,6 +781,8 @@ struct mon_data {
 	u_char		vn_mode;	/* packet mode & version */
 	u_char		cast_flags;	/* flags MDF_?CAST */
 	sockaddr_u	rmtadr;		/* address of remote host */
+	l_fp		xleave_rec;	/* receive time in last reply */
+	l_fp		xleave_xmt;	/* its transmit time after send */
 };
 
 /*
@@ -812,7 +831,7 @@ typedef struct res_addr6_tag {
 typedef struct restrict_u_tag	restrict_u;
 struct restrict_u_tag {
 	restrict_u *		link;	/* link to next entry */
-	u_int32			count;	/* number of packets matched */
+	ctr_obj			count;	/* number of packets matched */
 	u_short			flags;	/* accesslist flags */
 	u_short			mflags;	/* match flags */
 	u_long			expire;	/* valid until time */
@@ -900,4 +919,6 @@ struct endpoint {
 #define MRU_ROW_LIMIT	256
 /* similar datagrams per response limit for ntpd */
 #define MRU_FRAGS_LIMIT	128
+/* ntpq -c peers datagrams per CTL_OP_READ_PEERS response limit */
+#define READ_PEERS_FRAGS_LIMIT	24
 #endif /* NTP_H */
@@ -63,6 +63,8 @@ struct ntp_control {
 #define CTL_OP_READ_MRU		10	/* retrieve MRU (mrulist) */
 #define CTL_OP_READ_ORDLIST_A	11	/* ordered list req. auth. */
 #define CTL_OP_REQ_NONCE	12	/* request a client nonce */
+#define CTL_OP_READ_PEERS	13	/* read vars of many associations */
+#define CTL_OP_TRACE		14	/* packet trace control */
 #define	CTL_OP_UNSETTRAP	31	/* unset trap */
 
 /*
@@ -0,0 +1,77 @@
+/*
+ * ntp_counters.h - packet counters of ntpd kept per thread
+ *
+ * The counters below are bumped for nearly every packet.  Each thread
+ * that counts has a shard of its own which no other thread writes, so
+ * counting needs neither a lock nor an atomic operation and the cache
+ * line does not move between processors.  The main thread counts in
+ * shard 0; any other thread calls ctr_thread_init() before it counts.
+ * ctr_read() adds up the shards.  While other threads count it may miss
+ * the increments in flight, as reading the plain counters did.
+ *
+ * Without thread-local storage (NTP_THREAD_LOCAL from configure) every
+ * thread counts in shard 0.
+ */
+#ifndef NTP_COUNTERS_H
+#define NTP_COUNTERS_H
+
+#include "ntp_types.h"
+
+typedef enum {
+	CTR_PACKETS_RECEIVED,	/* packets received */
+	CTR_PACKETS_SENT,	/* packets sent */
+	CTR_HANDLER_PKTS,	/* packets received by the I/O handler */
+	CTR_SYS_RECEIVED,	/* packets received by receive() */
+	CTR_SYS_PROCESSED,	/* packets for this host */
+	CTR_SYS_RESTRICTED,	/* access denied */
+	CTR_RES_FOUND,		/* restrict list lookups with a match */
+	CTR_COUNT
+} ctr_id;
+
+#define CTR_SHARDS	8	/* shards, the first for the main thread */
+#define CTR_LINE	64	/* bytes in a cache line, at least */
+
+/*
+ * A shard is padded by a whole cache line beyond its counters, so the
+ * counters of two shards never share a line, however the array of
+ * shards is aligned.
+ */
+#define CTR_SHARD_SIZE	\
+	((CTR_COUNT * sizeof(u_long) / CTR_LINE + 2) * CTR_LINE)
+
+typedef union ctr_shard_tag {
+	volatile u_long	ctr[CTR_COUNT];
+	char		pad[CTR_SHARD_SIZE];
+} ctr_shard;
+
+extern ctr_shard	ctr_shards[CTR_SHARDS];
+
+#ifdef NTP_THREAD_LOCAL
+extern NTP_THREAD_LOCAL u_int ctr_self;	/* shard of this thread */
+# define CTR_INC(id)	(ctr_shards[ctr_self].ctr[id]++)
+#else
+# define CTR_INC(id)	(ctr_shards[0].ctr[id]++)
+#endif
+
+/*
+ * The counters of one endpoint or restrict entry have a shard per
+ * thread too, indexed by ctr_self.  They are not padded, to keep the
+ * objects small: threads counting for the same object still share a
+ * cache line, but none loses the increments of another.
+ */
+typedef struct ctr_obj_tag {
+	volatile u_long	n[CTR_SHARDS];
+} ctr_obj;
+
+#ifdef NTP_THREAD_LOCAL
+# define CTR_OBJ_INC(c)	((c).n[ctr_self]++)
+#else
+# define CTR_OBJ_INC(c)	((c).n[0]++)
+#endif
+
+extern	void	ctr_thread_init	(void);
+extern	u_long	ctr_read	(ctr_id);
+extern	void	ctr_clear	(ctr_id);
+extern	u_long	ctr_obj_read	(const ctr_obj *);
+
+#endif	/* NTP_COUNTERS_H */
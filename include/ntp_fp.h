@@ -115,10 +115,119 @@ typedef u_int32 u_fp;
 #define MINLFP(v) ((v)->l_ui = 0x80000000u, (v)->l_uf = 0u)
 
 /*
- * Primitive operations on long fixed point values.  If these are
- * reminiscent of assembler op codes it's only because some may
+ * Primitive operations on long fixed point values.
+ *
+ * There are two implementations of these.  The default one works on
+ * the two 32 bit halves and propagates carries by hand, which runs
+ * anywhere.  If NTP_LFP_NATIVE64 is defined (configure with
+ * --enable-lfp-native64) and we have a 64 bit scalar, the halves are
+ * joined into a u_int64, the operation is done with one native
+ * instruction, and the result is split again.  The storage layout of
+ * an l_fp is the same for both, so objects built either way can be
+ * freely mixed.
+ */
+#if defined(NTP_LFP_NATIVE64) && defined(HAVE_U_INT64)
+
+#define LFP_SIGNBIT	((u_int64)1 << 63)
+
+static inline u_int64
+lfp_mjoin(
+	u_int32	v_i,
+	u_int32	v_f
+	)
+{
+	return ((u_int64)v_i << 32) | v_f;
+}
+
+#define M_SPLIT(q, v_i, v_f)		/* v = q */ \
+	do { \
+		u_int64 split_t = (q); \
+		(v_i) = (u_int32)(split_t >> 32); \
+		(v_f) = (u_int32)split_t; \
+	} while (FALSE)
+
+#define	M_NEG(v_i, v_f)		/* v = -v */ \
+	M_SPLIT(~lfp_mjoin((v_i), (v_f)) + 1u, (v_i), (v_f))
+
+#define	M_NEGM(r_i, r_f, a_i, a_f)	/* r = -a */ \
+	M_SPLIT(~lfp_mjoin((a_i), (a_f)) + 1u, (r_i), (r_f))
+
+#define M_ADD(r_i, r_f, a_i, a_f)	/* r += a */ \
+	M_SPLIT(lfp_mjoin((r_i), (r_f)) + lfp_mjoin((a_i), (a_f)), \
+		(r_i), (r_f))
+
+#define M_ADD3(r_o, r_i, r_f, a_o, a_i, a_f) /* r += a, three word */ \
+	do { \
+		u_int64 add_t, add_s; \
+		add_t = lfp_mjoin((r_i), (r_f)); \
+		add_s = add_t + lfp_mjoin((a_i), (a_f)); \
+		(r_o) += (a_o) + (add_s < add_t); \
+		M_SPLIT(add_s, (r_i), (r_f)); \
+	} while (FALSE)
+
+#define M_SUB(r_i, r_f, a_i, a_f)	/* r -= a */ \
+	M_SPLIT(lfp_mjoin((r_i), (r_f)) - lfp_mjoin((a_i), (a_f)), \
+		(r_i), (r_f))
+
+#define	M_RSHIFTU(v_i, v_f)		/* v >>= 1, v is unsigned */ \
+	M_SPLIT(lfp_mjoin((v_i), (v_f)) >> 1, (v_i), (v_f))
+
+#define	M_RSHIFT(v_i, v_f)		/* v >>= 1, v is signed */ \
+	do { \
+		u_int64 shf_t = lfp_mjoin((v_i), (v_f)); \
+		M_SPLIT((shf_t >> 1) | (shf_t & LFP_SIGNBIT), (v_i), (v_f)); \
+	} while (FALSE)
+
+#define	M_LSHIFT(v_i, v_f)		/* v <<= 1 */ \
+	M_SPLIT(lfp_mjoin((v_i), (v_f)) << 1, (v_i), (v_f))
+
+#define	M_LSHIFT3(v_o, v_i, v_f)	/* v <<= 1, with overflow */ \
+	do { \
+		u_int64 shf_t = lfp_mjoin((v_i), (v_f)); \
+		(v_o) = ((u_int32)(v_o) << 1) | (u_int32)(shf_t >> 63); \
+		M_SPLIT(shf_t << 1, (v_i), (v_f)); \
+	} while (FALSE)
+
+#define	M_ADDUF(r_i, r_f, uf)		/* r += uf, uf is u_int32 fraction */ \
+	M_SPLIT(lfp_mjoin((r_i), (r_f)) + (u_int32)(uf), (r_i), (r_f))
+
+#define	M_SUBUF(r_i, r_f, uf)		/* r -= uf, uf is u_int32 fraction */ \
+	M_SPLIT(lfp_mjoin((r_i), (r_f)) - (u_int32)(uf), (r_i), (r_f))
+
+#define	M_ADDF(r_i, r_f, f)		/* r += f, f is a int32 fraction */ \
+	M_SPLIT(lfp_mjoin((r_i), (r_f)) + (u_int64)(int64)(int32)(f), \
+		(r_i), (r_f))
+
+#define	M_ISNEG(v_i)			/* v < 0 */ \
+	(((v_i) & 0x80000000) != 0)
+
+/*
+ * Flipping the sign bit maps the signed range onto the unsigned range
+ * in order, so signed compares are unsigned compares in disguise.
+ */
+#define	M_ISGT(a_i, a_f, b_i, b_f)	/* a > b signed */ \
+	((lfp_mjoin((a_i), (a_f)) ^ LFP_SIGNBIT) > \
+	 (lfp_mjoin((b_i), (b_f)) ^ LFP_SIGNBIT))
+
+#define	M_ISGTU(a_i, a_f, b_i, b_f)	/* a > b unsigned */ \
+	(lfp_mjoin((a_i), (a_f)) > lfp_mjoin((b_i), (b_f)))
+
+#define	M_ISHIS(a_i, a_f, b_i, b_f)	/* a >= b unsigned */ \
+	(lfp_mjoin((a_i), (a_f)) >= lfp_mjoin((b_i), (b_f)))
+
+#define	M_ISGEQ(a_i, a_f, b_i, b_f)	/* a >= b signed */ \
+	((lfp_mjoin((a_i), (a_f)) ^ LFP_SIGNBIT) >= \
+	 (lfp_mjoin((b_i), (b_f)) ^ LFP_SIGNBIT))
+
+#define	M_ISEQU(a_i, a_f, b_i, b_f)	/* a == b unsigned */ \
+	(lfp_mjoin((a_i), (a_f)) == lfp_mjoin((b_i), (b_f)))
+
+#else	/* !NTP_LFP_NATIVE64 follows */
+
+/*
+ * These are the (kind of inefficient) run-anywhere versions.  If they
+ * are reminiscent of assembler op codes it's only because some may
  * be replaced by inline assembler for particular machines someday.
- * These are the (kind of inefficient) run-anywhere versions.
  */
 #define	M_NEG(v_i, v_f)		/* v = -v */ \
 	do { \
@@ -222,6 +331,8 @@ typedef u_int32 u_fp;
 #define	M_ISEQU(a_i, a_f, b_i, b_f)	/* a == b unsigned */ \
 	((u_int32)(a_i) == (u_int32)(b_i) && (u_int32)(a_f) == (u_int32)(b_f))
 
+#endif	/* !NTP_LFP_NATIVE64 */
+
 /*
  * Operations on the long fp format
  */
@@ -267,7 +378,29 @@ typedef u_int32 u_fp;
  * XSCALE also generates bad code for these, at least with GCC 3.3.5.
  * This is unrelated to math.h, but the same solution applies.
  */
-#if defined(HAVE_U_INT64) && \
+#if defined(NTP_LFP_NATIVE64) && defined(HAVE_U_INT64)
+
+/*
+ * Multiplying by 2^32 is exact, so this matches the ldexp() version
+ * below without dragging in math.h.
+ */
+static inline u_int64
+lfp_dtoq(
+	double	d
+	)
+{
+	if (d < 0.)
+		return ~(u_int64)(-d * FRAC) + 1u;
+	return (u_int64)(d * FRAC);
+}
+
+#define M_DTOLFP(d, r_ui, r_uf)		/* double to l_fp */	\
+	M_SPLIT(lfp_dtoq(d), (r_ui), (r_uf))
+
+#define M_LFPTOD(r_ui, r_uf, d)		/* l_fp to double */	\
+	((d) = (double)(int64)lfp_mjoin((r_ui), (r_uf)) / FRAC)
+
+#elif defined(HAVE_U_INT64) && \
     !(defined(__SVR4) && defined(__sun) && \
       defined(sparc) && defined(__GNUC__) || \
       defined(__arm__) && defined(__XSCALE__) && defined(__GNUC__)) 
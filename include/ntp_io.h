@@ -82,6 +82,27 @@ typedef enum {
 } nic_rule_action;
 
 
+enum desc_type { FD_TYPE_SOCKET, FD_TYPE_FILE };
+
+#ifndef HAVE_IO_COMPLETION_PORT
+/*
+ * support for receiving data on fd that is not a refclock or a socket
+ * like e. g. routing sockets
+ */
+struct asyncio_reader {
+	struct asyncio_reader *link;		    /* the list this is being kept in */
+	SOCKET fd;				    /* fd to be read */
+	void  *data;				    /* possibly local data */
+	void (*receiver)(struct asyncio_reader *);  /* input handler */
+};
+
+extern	struct asyncio_reader *asyncio_reader_list;
+extern	struct asyncio_reader *new_asyncio_reader(void);
+extern	void	delete_asyncio_reader(struct asyncio_reader *);
+extern	void	add_asyncio_reader(struct asyncio_reader *, enum desc_type);
+extern	void	remove_asyncio_reader(struct asyncio_reader *);
+#endif
+
 extern int	qos;
 SOCKET		move_fd(SOCKET fd);
 isc_boolean_t	get_broadcastclient_flag(void);
@@ -91,8 +112,10 @@ extern void	add_nic_rule(nic_rule_match match_type,
 			     nic_rule_action action);
 #ifndef HAVE_IO_COMPLETION_PORT
 extern	void	maintain_activefds(int fd, int closing);
+extern	void	maintain_writefds(int fd, int pending);
 #else
 #define		maintain_activefds(f, c)	do {} while (0)
+#define		maintain_writefds(f, p)		do {} while (0)
 #endif
 
 
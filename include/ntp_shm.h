@@ -0,0 +1,130 @@
+/*
+ * ntp_shm.h - shared memory segment layouts of the SHM refclock
+ * (type 28) and of the time state shared between ntpds
+ *
+ * The layout of struct shmTime is shared with programs such as gpsd
+ * that keep their own copy of it.  Do not change its size or the
+ * order of its fields.
+ */
+#ifndef NTP_SHM_H
+#define NTP_SHM_H
+
+#include <sys/types.h>
+
+/*
+ * Key of unit 0, 0x4e545030 is NTP0.  Big units will give non-ascii
+ * but that's OK as long as everybody does it the same way.
+ */
+#define SHM_KEY_BASE	0x4e545030
+
+struct shmTime {
+	int    mode; /* 0 - if valid is set:
+		      *       use values,
+		      *       clear valid
+		      * 1 - if valid is set:
+		      *       if count before and after read of values is equal,
+		      *         use values
+		      *       clear valid
+		      */
+	volatile int    count;
+	time_t		clockTimeStampSec;
+	int		clockTimeStampUSec;
+	time_t		receiveTimeStampSec;
+	int		receiveTimeStampUSec;
+	int		leap;
+	int		precision;
+	int		nsamples;
+	volatile int    valid;
+	unsigned	clockTimeStampNSec;	/* Unsigned ns timestamps */
+	unsigned	receiveTimeStampNSec;	/* Unsigned ns timestamps */
+	int		dummy[8];
+};
+
+/*
+ * Sample ring.  A unit configured with mode bit SHM_MODE_RING maps a
+ * larger segment, struct shmRing, which starts with the classic
+ * struct shmTime so that producers which know nothing of the ring keep
+ * working.  A producer that wants to hand over more than one sample a
+ * second sets ring_magic and then, for sample number n (counting from
+ * 0):
+ *
+ *	s = &slot[n % SHM_RING_SLOTS];
+ *	s->seq = 2 * n + 1;		odd: being written
+ *	barrier
+ *	fill in the time stamps, leap and precision
+ *	barrier
+ *	s->seq = 2 * n + 2;		even: complete
+ *	barrier
+ *	head = n + 1;
+ *
+ * The reader copies a slot between two reads of seq and only uses it
+ * if both show the completed value for the sample it expects, so no
+ * locking is needed and a slow reader only loses the samples that
+ * were overwritten.
+ */
+#define SHM_RING_MAGIC	0x4e545252	/* NTRR */
+#define SHM_RING_SLOTS	128
+
+struct shmSample {
+	volatile unsigned	seq;
+	time_t			clockTimeStampSec;
+	unsigned		clockTimeStampNSec;
+	time_t			receiveTimeStampSec;
+	unsigned		receiveTimeStampNSec;
+	int			leap;
+	int			precision;
+};
+
+struct shmRing {
+	struct shmTime		legacy;		/* single sample interface */
+	volatile unsigned	ring_magic;	/* SHM_RING_MAGIC if in use */
+	unsigned		nslots;		/* SHM_RING_SLOTS */
+	volatile unsigned	head;		/* samples written so far */
+	unsigned		spare[5];
+	struct shmSample	slot[SHM_RING_SLOTS];
+};
+
+/*
+ * Time state segment.  An ntpd configured with "sharedstate publish"
+ * keeps in it what goes into its replies to clients, and ntpds
+ * configured with "sharedstate serve" answer their clients from it,
+ * see ntpd/ntp_shstate.c.  The publisher updates it at every clock
+ * update and once a second:
+ *
+ *	seq++;				odd: being written
+ *	barrier
+ *	fill in the state and beat
+ *	barrier
+ *	seq++;				even: complete
+ *
+ * A reader copies the segment between two reads of seq and only uses
+ * the copy if both show the same even value.  beat is the NTP time in
+ * seconds of the update, 0 after the publisher has exited.  version
+ * changes with the layout.
+ */
+#define SHSTATE_KEY_BASE	0x4e545330	/* NTS0, key of unit 0 */
+#define SHSTATE_MAGIC		0x4e545354	/* NTST */
+#define SHSTATE_VERSION		1
+
+struct shmState {
+	unsigned		magic;		/* SHSTATE_MAGIC */
+	unsigned		version;	/* SHSTATE_VERSION */
+	volatile unsigned	seq;		/* odd while being written */
+	int			pid;		/* of the publisher */
+	unsigned		beat;		/* NTP seconds of the update */
+	int			leap;		/* leap indicator */
+	int			xmt_leap;	/* leap indicator sent */
+	int			stratum;
+	int			precision;	/* log2 s */
+	unsigned		refid;		/* network byte order */
+	unsigned		reftime_ui;	/* reference time, l_fp */
+	unsigned		reftime_uf;
+	double			rootdelay;	/* s */
+	double			rootdisp;	/* s */
+	int			smear;		/* leap smear in progress */
+	unsigned		smear_ui;	/* leap smear offset, l_fp */
+	unsigned		smear_uf;
+	unsigned		spare[8];
+};
+
+#endif	/* NTP_SHM_H */
@@ -137,6 +137,38 @@ extern	char *	estrdup_impl(const char *, const char *, int);
 #define	estrdup(s) estrdup_impl((s), __FILE__, __LINE__)
 #endif
 
+/*
+ * Heap accounting by subsystem.  The _tag variants of the allocators
+ * above charge the allocation to one of the mem_tag subsystems, and
+ * efree_tag() must be given the size charged when releasing it.
+ */
+typedef enum mem_tag_tag {
+	MEM_MRU,		/* MRU list entries and hash table */
+	MEM_PEER,		/* struct peer */
+	MEM_RESTRICT,		/* restrict list entries */
+	MEM_RECVBUF,		/* receive buffers */
+	MEM_CONFIG,		/* configuration syntax trees */
+	MEM_TAGS
+} mem_tag;
+
+typedef struct mem_stat_tag {
+	u_long	bytes;		/* allocated now */
+	u_long	peak;		/* high-water mark of bytes */
+	u_long	allocs;		/* allocations */
+	u_long	frees;		/* frees */
+} mem_stat;
+
+extern	mem_stat	mem_tag_stats[MEM_TAGS];
+extern	const char * const mem_tag_name[MEM_TAGS];
+extern	void	mem_grow	(mem_tag, size_t, int);
+extern	void	mem_shrink	(mem_tag, size_t);
+extern	u_long	mem_total	(void);
+#define	emalloc_tag(t, n)	(mem_grow((t), (n), TRUE), emalloc(n))
+#define	emalloc_zero_tag(t, n)	(mem_grow((t), (n), TRUE), emalloc_zero(n))
+#define eallocarray_tag(t, n, s) (mem_grow((t), (n) * (s), TRUE), \
+				  eallocarray((n), (s)))
+#define efree_tag(t, p, n)	(mem_shrink((t), (n)), free(p))
+
 
 extern	int	atoint		(const char *, long *);
 extern	int	atouint		(const char *, u_long *);
@@ -163,6 +195,7 @@ extern	const char * sockporttoa(const sockaddr_u *);
 extern	u_short	sock_hash	(const sockaddr_u *);
 extern	int	sockaddr_masktoprefixlen(const sockaddr_u *);
 extern	const char * socktohost	(const sockaddr_u *);
+extern	int	socktohost_r	(const sockaddr_u *, char *, size_t);
 extern	int	octtoint	(const char *, u_long *);
 extern	u_long	ranp2		(int);
 extern	const char *refnumtoa	(sockaddr_u *);
@@ -0,0 +1,73 @@
+/*
+ * ntp_trace.h - binary packet trace ring of ntpd
+ *
+ * While the trace is running ntpd keeps a compact record of every
+ * packet receive() handles and every reply fast_xmit() sends, in a
+ * ring of fixed size.  The ring is written to a file on request, see
+ * ntpd/ntp_trace.c, and util/tracedump prints such a file.
+ *
+ * A trace file is a struct ptrace_hdr followed by 'count' records of
+ * 'reclen' octets each, oldest first.  Every multi-octet field in the
+ * file is in network byte order.
+ */
+#ifndef NTP_TRACE_H
+#define NTP_TRACE_H
+
+#include "ntp_types.h"
+
+#define PTRACE_MAGIC	0x4e545452	/* NTTR */
+#define PTRACE_VERSION	1
+
+#define PTRACE_DEFAULT	65536		/* default ring size, records */
+#define PTRACE_MAX	(1 << 24)	/* largest ring, records */
+
+/* dir */
+#define PT_RX		0	/* received, seen by receive() */
+#define PT_TX		1	/* sent by fast_xmit() */
+
+/*
+ * What became of a packet.  For a received packet this is the
+ * counter receive() bumped for it, for a sent one how it went out.
+ */
+#define PTV_ACCEPTED	0	/* passed the checks */
+#define PTV_RESTRICTED	1	/* refused by restrict */
+#define PTV_BADLENGTH	2	/* bad port, version, mode or length */
+#define PTV_DECLINED	3	/* no association wanted it */
+#define PTV_BADAUTH	4	/* authentication failed */
+#define PTV_LIMITED	5	/* rate limited */
+#define PTV_KOD		6	/* rate limited, KoD sent */
+#define PTV_PROCESSED	7	/* reached the clock filter */
+#define PTV_SENT	8	/* reply sent */
+#define PTV_SIGND	9	/* reply handed to ntp_signd */
+
+struct ptrace_hdr {
+	u_int32	magic;		/* PTRACE_MAGIC */
+	u_int32	version;	/* PTRACE_VERSION */
+	u_int32	reclen;		/* sizeof(struct ptrace_rec) */
+	u_int32	count;		/* records following */
+	u_int32	lost;		/* records overwritten before the dump */
+};
+
+struct ptrace_rec {
+	u_int32	ts_ui;		/* receive or send time, l_fp */
+	u_int32	ts_uf;
+	u_int32	wait;		/* receive time to processing or send */
+	u_int32	proc;		/* time in receive() (rx only) */
+	u_short	rflags;		/* restrict flags */
+	u_short	len;		/* packet length */
+	u_short	rport;		/* remote port */
+	u_short	lport;		/* local port */
+	u_char	family;		/* 4 or 6 */
+	u_char	dir;		/* PT_RX or PT_TX */
+	u_char	mode;		/* packet mode */
+	u_char	version;	/* packet version */
+	u_char	stratum;	/* packet stratum */
+	u_char	verdict;	/* PTV_ */
+	u_char	match;		/* receive()'s AM_ code (rx only) */
+	u_char	unused;
+	u_char	raddr[16];	/* remote address */
+	u_char	laddr[16];	/* local address */
+};
+/* wait and proc are in units of 2^-32 s, as the fraction of an l_fp */
+
+#endif	/* NTP_TRACE_H */
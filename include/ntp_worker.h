@@ -20,6 +20,7 @@
 typedef enum blocking_work_req_tag {
 	BLOCKING_GETNAMEINFO,
 	BLOCKING_GETADDRINFO,
+	BLOCKING_ECHO,		/* returns the payload, for timing */
 } blocking_work_req;
 
 typedef void (*blocking_work_callback)(blocking_work_req, void *, size_t, void *);
@@ -74,15 +75,39 @@ typedef struct blocking_child_tag {
 
 #elif defined(WORK_THREAD)
 
+/*
+ * Requests and responses travel between the parent and the worker
+ * thread in a pair of bounded single-producer, single-consumer rings.
+ * An item up to BLOCKING_SLOT_OCTETS long, header included, is copied
+ * into its slot and used in place by the consumer, which releases the
+ * slot when done with it.  Larger items are passed as a pointer to a
+ * heap copy in 'spill'.
+ */
+#define BLOCKING_RING_SLOTS	32	/* must be a power of 2 */
+#define BLOCKING_SLOT_OCTETS	512
+#define BLOCKING_CACHE_LINE	64
+
+typedef struct blocking_slot_tag {
+	blocking_pipe_header *	spill;	/* NULL if the item is in u */
+	union {
+		blocking_pipe_header	hdr;
+		char			octets[BLOCKING_SLOT_OCTETS];
+	} u;
+} blocking_slot;
+
+typedef struct blocking_ring_tag {
+	volatile size_t	head;		/* next slot to fill, producer */
+	char		head_pad[BLOCKING_CACHE_LINE - sizeof(size_t)];
+	volatile size_t	tail;		/* next slot to drain, consumer */
+	char		tail_pad[BLOCKING_CACHE_LINE - sizeof(size_t)];
+	blocking_slot	slot[BLOCKING_RING_SLOTS];
+} blocking_ring;
+
 typedef struct blocking_child_tag {
 	/*
-	 * blocking workitems and blocking_responses are
-	 * dynamically-sized one-dimensional arrays of pointers to
-	 * blocking worker requests and responses.
-	 *
-	 * IMPORTANT: This structure is shared between threads, and all
-	 * access that is not atomic (especially queue operations) must
-	 * hold the 'accesslock' semaphore to avoid data races.
+	 * IMPORTANT: This structure is shared between threads.  Each
+	 * ring index is written by one side only, and the slots are
+	 * handed over by the index updates, see work_thread.c.
 	 *
 	 * The resource management (thread/semaphore
 	 * creation/destruction) functions and functions just testing a
@@ -90,29 +115,27 @@ typedef struct blocking_child_tag {
 	 * thread when no worker is running on the same data structure.
 	 */
 	int			reusable;
-	sem_ref			accesslock;	/* shared access lock */
+	sem_ref			accesslock;	/* fence without atomics */
 	thr_ref			thread_ref;	/* thread 'handle' */
 
-	/* the reuest queue */
-	blocking_pipe_header ** volatile
-				workitems;
-	volatile size_t		workitems_alloc;
-	size_t			head_workitem;		/* parent */
-	size_t			tail_workitem;		/* child */
-	sem_ref			workitems_pending;	/* signalling */
-
-	/* the response queue */
-	blocking_pipe_header ** volatile
-				responses;
-	volatile size_t		responses_alloc;
-	size_t			head_response;		/* child */
-	size_t			tail_response;		/* parent */
+	/* the request ring and its overflow, parent -> child */
+	blocking_ring *		req_ring;
+	blocking_pipe_header **	backlog;	/* parent only */
+	size_t			backlog_count;
+	size_t			backlog_alloc;
+	sem_ref			workitems_pending;	/* ring was empty */
+
+	/* the response ring, child -> parent */
+	blocking_ring *		resp_ring;
+	sem_ref			responses_space;	/* ring was full */
 
 	/* event handles / sem_t pointers */
 	sem_ref			wake_scheduled_sleep;
 
-	/* some systems use a pipe for notification, others a semaphore.
-	 * Both employ the queue above for the actual data transfer.
+	/* Responses are signalled with an eventfd where available, in
+	 * which case both ends are the same descriptor, else a pipe or
+	 * on Windows a semaphore.  Only an item put into an empty ring
+	 * is signalled in either direction.
 	 */
 #ifdef WORK_PIPE
 	int			resp_read_pipe;		/* parent */
@@ -124,7 +147,7 @@ typedef struct blocking_child_tag {
 #endif
 	volatile u_int		resp_ready_seen;	/* signal/scan */
 	volatile u_int		resp_ready_done;	/* consumer/mainloop */
-	sema_type		sem_table[4];
+	sema_type		sem_table[5];
 	thread_type		thr_table[1];
 } blocking_child;
 
@@ -157,6 +180,10 @@ extern	blocking_pipe_header *
 		receive_blocking_req_internal(blocking_child *);
 extern	blocking_pipe_header *
 		receive_blocking_resp_internal(blocking_child *);
+extern	void	release_blocking_req_internal(blocking_child *,
+					      blocking_pipe_header *);
+extern	void	release_blocking_resp_internal(blocking_child *,
+					       blocking_pipe_header *);
 extern	int	blocking_child_common(blocking_child *);
 extern	void	exit_worker(int)
 			__attribute__ ((__noreturn__));
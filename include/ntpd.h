@@ -17,6 +17,8 @@
 #include "ntp_malloc.h"
 #include "ntp_refclock.h"
 #include "ntp_intres.h"
+#include "ntp_trace.h"
+#include "ntp_counters.h"
 #include "recvbuff.h"
 
 /*
@@ -64,8 +66,13 @@ extern	int	ctlclrtrap	(sockaddr_u *, struct interface *, int);
 extern	u_short ctlpeerstatus	(struct peer *);
 extern	int	ctlsettrap	(sockaddr_u *, struct interface *, int, int);
 extern	u_short ctlsysstatus	(void);
+extern	void	ctl_sys_changed	(void);
+extern	void	ctl_peer_changed(struct peer *);
 extern	void	init_control	(void);
 extern	void	process_control (struct recvbuf *, int);
+struct ctlsock_conn;
+extern	void	process_control_stream(struct recvbuf *,
+				       struct ctlsock_conn *);
 extern	void	report_event	(int, struct peer *, const char *);
 extern	int	mprintf_event	(int, struct peer *, const char *, ...)
 			NTP_PRINTF(3, 4);
@@ -128,6 +135,8 @@ extern	void	io_unsetbclient	(void);
 extern	void	io_multicast_add(sockaddr_u *);
 extern	void	io_multicast_del(sockaddr_u *);
 extern	void	sendpkt 	(sockaddr_u *, struct interface *, int, struct pkt *, int);
+extern	void	sendpkt_queued	(sockaddr_u *, struct interface *, struct pkt *, int, l_fp *);
+extern	void	sendpkt_forget	(const l_fp *);
 #ifdef DEBUG
 extern	void	collect_timing  (struct recvbuf *, const char *, int, l_fp *);
 #endif
@@ -278,6 +287,32 @@ extern	u_long	sys_revoke;	/* keys revoke timeout */
 extern	u_long	sys_automax;	/* session key timeout */
 #endif	/* AUTOKEY */
 
+/* ntp_trace.c */
+extern	int	ptrace_start	(u_int);
+extern	void	ptrace_stop	(void);
+extern	void	ptrace_status	(u_int *, u_long *);
+extern	int	ptrace_dump	(char *, size_t);
+extern	void	ptrace_signal	(void);
+extern	void	ptrace_recv_begin (struct recvbuf *);
+extern	void	ptrace_recv_end	(void);
+extern	void	ptrace_xmit	(struct recvbuf *, struct pkt *, size_t,
+				 int, int);
+/*
+ * PTRACE_RX() notes a field of the record of the packet receive() is
+ * working on, PTRACE_TX() records a reply.  Both cost one test while
+ * the trace is stopped.
+ */
+#define PTRACE_RX(field, val)					\
+	do {							\
+		if (ptrace_cur != NULL)				\
+			ptrace_cur->field = (val);		\
+	} while (0)
+#define PTRACE_TX(rb, xp, len, flags, verdict)			\
+	do {							\
+		if (ptrace_on)					\
+			ptrace_xmit(rb, xp, len, flags, verdict); \
+	} while (0)
+
 /* ntp_util.c */
 extern	void	init_util	(void);
 extern	void	write_stats	(void);
@@ -303,6 +338,12 @@ extern	void	parse_cmdline_opts(int *, char ***);
  */
 #define MOREDEBUGSIG	SIGUSR1
 #define LESSDEBUGSIG	SIGUSR2
+/*
+ * Signal which starts the packet trace, or stops and dumps it, where
+ * SIGWINCH exists.  ntpd has no terminal to be resized once it runs
+ * as a daemon.
+ */
+#define TRACESIG	SIGWINCH
 /*
  * Signals which terminate us gracefully.
  */
@@ -365,16 +406,14 @@ extern u_long	numctlbadop; 		/* bad op code found in packet */
 extern u_long	numasyncmsgs;		/* number of async messages we've sent */
 
 /*
- * Other statistics of possible interest
+ * Other statistics of possible interest; packets received and sent
+ * are in ntp_counters.h
  */
 extern volatile u_long packets_dropped;	/* total number of packets dropped on reception */
 extern volatile u_long packets_ignored;	/* packets received on wild card interface */
-extern volatile u_long packets_received;/* total number of packets received */
-extern u_long	packets_sent;		/* total number of packets sent */
 extern u_long	packets_notsent; 	/* total number of packets which couldn't be sent */
 
 extern volatile u_long handler_calls;	/* number of calls to interrupt handler */
-extern volatile u_long handler_pkts;	/* number of pkts received by handler */
 extern u_long	io_timereset;		/* time counters were reset */
 
 /* ntp_io.c */
@@ -430,6 +469,7 @@ extern double	sys_jitter;		/* system jitter (s) */
 extern u_char	mon_hash_bits;		/* log2 size of hash table */
 extern mon_entry ** mon_hash;		/* MRU hash table */
 extern mon_entry mon_mru_list;		/* mru listhead */
+extern mon_entry * mon_rx_entry;	/* entry of the last ntp_monitor() */
 extern u_int	mon_enabled;		/* MON_OFF (0) or other MON_* */
 extern u_int	mru_alloc;		/* mru list + free list count */
 extern u_int	mru_entries;		/* mru list count */
@@ -468,6 +508,7 @@ extern int	peer_preempt;		/* preemptable associations */
  * specification.
  */
 extern u_char	sys_leap;		/* system leap indicator */
+extern u_char	xmt_leap;		/* leap indicator sent to clients */
 extern u_char	sys_stratum;		/* system stratum */
 extern s_char	sys_precision;		/* local clock precision */
 extern double	sys_rootdelay;		/* roundtrip delay to primary source */
@@ -494,15 +535,12 @@ extern u_char	sys_ttl[MAX_TTL];	/* ttl mapping vector */
 extern int	sys_ttlmax;		/* max ttl mapping vector index */
 
 /*
- * Statistics counters
+ * Statistics counters; packets received, processed and restricted
+ * are in ntp_counters.h
  */
 extern u_long	sys_stattime;		/* time since reset */
-extern u_long	sys_received;		/* packets received */
-extern u_long	sys_processed;		/* packets for this host */
-extern u_long	sys_restricted;	 	/* restricted packets */
 extern u_long	sys_newversion;		/* current version  */
 extern u_long	sys_oldversion;		/* old version */
-extern u_long	sys_restricted;		/* access denied */
 extern u_long	sys_badlength;		/* bad length or format */
 extern u_long	sys_badauth;		/* bad authentication */
 extern u_long	sys_declined;		/* declined */
@@ -522,10 +560,33 @@ extern u_char		ntp_minpoll;
 /* ntp_scanner.c */
 extern u_int32		conf_file_sum;	/* Simple sum of characters */
 
+/* ntp_ctlsock.c */
+extern	void	ctlsock_open	(const char *);
+extern	void	ctlsock_send	(struct ctlsock_conn *, const void *,
+				 size_t);
+extern	void	ctlsock_flush	(void);
+
+/* ntp_xdp.c */
+extern	void	xdp_open	(const char *);
+extern	void	xdp_endpoints	(void);
+extern	int	xdp_reply	(sockaddr_u *, endpt *, struct pkt *, int,
+				 l_fp *);
+
+/* ntp_shstate.c */
+#define SHSTATE_OFF	0
+#define SHSTATE_PUBLISH	1	/* sharedstate publish */
+#define SHSTATE_SERVE	2	/* sharedstate serve */
+extern	int	shstate_mode;
+extern	void	shstate_config	(int, int);
+extern	void	shstate_publish	(void);
+extern	void	shstate_fetch	(u_int32);
+extern	void	shstate_timer	(u_int32);
+
 /* ntp_signd.c */
 #ifdef HAVE_NTP_SIGND
 extern void send_via_ntp_signd(struct recvbuf *, int, keyid_t, int,
 			       struct pkt *);
+extern void signd_clearinterface(endpt *);
 #endif
 
 /* ntp_timer.c */
@@ -544,6 +605,11 @@ extern int	leap_smear_intv;
 HANDLE WaitableTimerHandle;
 #endif
 
+/* ntp_trace.c */
+extern	int	ptrace_on;		/* trace running? */
+extern	struct ptrace_rec *ptrace_cur;	/* record receive() fills in */
+extern	volatile int ptrace_signalled;	/* TRACESIG seen */
+
 /* ntp_util.c */
 extern	char	statsdir[MAXFILENAME];
 extern	int	stats_control;		/* write stats to fileset? */
@@ -31,6 +31,7 @@
 #endif /* HAVE_SYS_IOCTL_H */
 
 #include <fcntl.h>
+#include <sys/stat.h>
 
 #ifdef HAVE_MACHINE_SOUNDCARD_H
 # include <machine/soundcard.h>
@@ -66,6 +67,15 @@ static struct audio_info info;	/* audio device info */
 #endif /* not PCM_STYLE_SOUND */
 static int ctl_fd;		/* audio control file descriptor */
 
+/*
+ * File source. A regular file or FIFO can stand in for the audio
+ * device; see audio_init().
+ */
+#define	AUDIO_RATE	8000	/* nominal codec sample rate (Hz) */
+static int audio_file = -1;	/* file source descriptor */
+static u_long audio_count;	/* samples read from the file source */
+static l_fp audio_epoch;	/* time of the first sample */
+
 #ifdef PCM_STYLE_SOUND
 static void audio_config_read (int, const char **, const char **);
 static int  mixer_name (const char *, int);
@@ -207,6 +217,15 @@ audio_config_read(
  * codec sample rate (8000 Hz), precision (8 bits), number of channels
  * (1) and encoding (ITU-T G.711 mu-law companded) have been set by
  * default.
+ *
+ * If the device turns out to be a regular file or a FIFO, for instance
+ * named by idev in /etc/ntp.audio, it is used as a file source of raw
+ * mu-law samples in that format, as written by util/tg2. There is no
+ * control device and the gain is left alone. A FIFO is read at the
+ * pace it is written, which is real time for tg2; a regular file is
+ * read as fast as it can be, a bounded amount each pass of the input
+ * handler, which is useful only for the replay harness in tests/ntpd. Either way the drivers time stamp the samples
+ * by counting them; see audio_stamp().
  */
 int
 audio_init(
@@ -225,6 +244,7 @@ audio_init(
 	snd_chan_param s_c_p;
 # endif
 #endif
+	struct stat sb;
 	int fd;
 	int rval;
 	const char *actl =
@@ -249,11 +269,20 @@ audio_init(
 	/*
 	 * Open audio device
 	 */
+	audio_file = -1;
 	fd = open(dname, O_RDWR | O_NONBLOCK, 0777);
 	if (fd < 0) {
 		msyslog(LOG_ERR, "audio_init: %s %m", dname);
 		return (fd);
 	}
+	if (fstat(fd, &sb) == 0 &&
+	    (S_ISREG(sb.st_mode) || S_ISFIFO(sb.st_mode))) {
+		msyslog(LOG_NOTICE, "audio_init: %s is a file source",
+		    dname);
+		audio_file = fd;
+		audio_count = 0;
+		return (fd);
+	}
 
 	/*
 	 * Open audio control device.
@@ -374,6 +403,9 @@ audio_gain(
 	static int o_mongain = -1;
 	static int o_port = -1;
 
+	if (audio_file >= 0)
+		return (0);
+
 #ifdef PCM_STYLE_SOUND
 	int l, r;
 
@@ -467,6 +499,71 @@ audio_gain(
 }
 
 
+/*
+ * audio_decompand - decompand a block of codec samples
+ *
+ * The codec samples are bit-inverted mu-law and comp is the driver's
+ * decompanding table. If clip is positive, the samples are clipped at
+ * +-clip and the number of clipped samples is returned. The clipper is
+ * a separate pass with no branches, so the compiler can vectorize it.
+ */
+int
+audio_decompand(
+	const u_char *src,	/* codec samples */
+	int	len,		/* number of samples */
+	const double *comp,	/* decompanding table */
+	double	clip,		/* clip level, 0 for none */
+	double	*dst		/* decompanded samples */
+	)
+{
+	int	clipcnt;
+	int	i;
+
+	for (i = 0; i < len; i++)
+		dst[i] = comp[~src[i] & 0xff];
+	if (clip <= 0)
+		return (0);
+
+	clipcnt = 0;
+	for (i = 0; i < len; i++) {
+		clipcnt += (dst[i] > clip) + (dst[i] < -clip);
+		dst[i] = dst[i] > clip ? clip : dst[i];
+		dst[i] = dst[i] < -clip ? -clip : dst[i];
+	}
+	return (clipcnt);
+}
+
+/*
+ * audio_stamp - time stamp a buffer from the file source
+ *
+ * The receive time of a buffer read from a file says when ntpd got
+ * around to reading it, not when the samples were taken. Replace it by
+ * the time of the last sample, counting samples at the nominal rate
+ * from the first buffer. Buffers from a device are left alone.
+ */
+void
+audio_stamp(
+	int	fd,		/* file descriptor */
+	l_fp	*stamp,		/* receive time stamp */
+	int	len		/* buffer length (samples) */
+	)
+{
+	l_fp	ltemp;
+
+	if (fd != audio_file || len <= 0)
+		return;
+
+	if (audio_count == 0) {
+		DTOLFP((double)len / AUDIO_RATE, &ltemp);
+		audio_epoch = *stamp;
+		L_SUB(&audio_epoch, &ltemp);
+	}
+	audio_count += len;
+	DTOLFP((double)audio_count / AUDIO_RATE, &ltemp);
+	*stamp = audio_epoch;
+	L_ADD(stamp, &ltemp);
+}
+
 /*
  * audio_show - display audio parameters
  *
@@ -476,6 +573,11 @@ audio_gain(
 void
 audio_show(void)
 {
+	if (audio_file >= 0) {
+		printf("audio: file source, %lu samples read\n",
+		    audio_count);
+		return;
+	}
 #ifdef PCM_STYLE_SOUND
 	int recsrc = 0;
 
@@ -147,3 +147,81 @@ emalloc(size_t newsz)
 #endif
 #endif
 
+
+
+/*
+ * Heap accounting by subsystem, see the _tag allocators in
+ * ntp_stdlib.h.  The counters are not locked, as all but the
+ * receive buffers are allocated only by the main thread.
+ */
+mem_stat		mem_tag_stats[MEM_TAGS];
+const char * const	mem_tag_name[MEM_TAGS] = {
+	"mru",			/* MEM_MRU */
+	"peer",			/* MEM_PEER */
+	"restrict",		/* MEM_RESTRICT */
+	"recvbuf",		/* MEM_RECVBUF */
+	"config"		/* MEM_CONFIG */
+};
+
+#ifdef DEBUG
+/* with debug on, a new peak this large is logged */
+static u_long	mem_report[MEM_TAGS];
+#endif
+
+
+void
+mem_grow(
+	mem_tag	tag,
+	size_t	size,
+	int	newalloc
+	)
+{
+	mem_stat *	ms;
+
+	ms = &mem_tag_stats[tag];
+	ms->bytes += size;
+	if (newalloc)
+		ms->allocs++;
+	if (ms->bytes <= ms->peak)
+		return;
+	ms->peak = ms->bytes;
+#ifdef DEBUG
+	if (debug && ms->peak >= mem_report[tag]) {
+		msyslog(LOG_DEBUG, "heap: %s peak %lu bytes in %lu allocs",
+			mem_tag_name[tag], ms->peak,
+			ms->allocs - ms->frees);
+		mem_report[tag] = 2 * ms->peak;
+	}
+#endif
+}
+
+
+void
+mem_shrink(
+	mem_tag	tag,
+	size_t	size
+	)
+{
+	mem_stat *	ms;
+
+	ms = &mem_tag_stats[tag];
+	ms->bytes -= (size < ms->bytes) ? size : ms->bytes;
+	ms->frees++;
+}
+
+
+/*
+ * mem_total - bytes allocated now by all subsystems
+ */
+u_long
+mem_total(void)
+{
+	u_long	total;
+	size_t	i;
+
+	total = 0;
+	for (i = 0; i < COUNTOF(mem_tag_stats); i++)
+		total += mem_tag_stats[i].bytes;
+
+	return total;
+}
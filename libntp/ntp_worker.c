@@ -253,7 +253,7 @@ process_blocking_resp(
 			(*resp->done_func)(resp->rtype, resp->context,
 					   resp->octets - sizeof(*resp),
 					   data);
-			free(resp);
+			release_blocking_resp_internal(c, resp);
 		}
 #ifdef WORK_THREAD
 	} while (NULL != resp);
@@ -290,6 +290,25 @@ harvest_blocking_responses(void)
 }
 
 
+/*
+ * blocking_echo - answer a BLOCKING_ECHO request with its own payload,
+ *		   to time the round trip through the worker
+ */
+static int
+blocking_echo(
+	blocking_child *		c,
+	const blocking_pipe_header *	req
+	)
+{
+	blocking_pipe_header *	resp;
+
+	resp = emalloc(req->octets);
+	memcpy(resp, req, req->octets);
+
+	return queue_blocking_response(c, resp, req->octets, req);
+}
+
+
 /*
  * blocking_child_common runs as a forked child or a thread
  */
@@ -322,12 +341,17 @@ blocking_child_common(
 				say_bye = TRUE;
 			break;
 
+		case BLOCKING_ECHO:
+			if (blocking_echo(c, req))
+				say_bye = TRUE;
+			break;
+
 		default:
 			msyslog(LOG_ERR, "unknown req %d to blocking worker", req->rtype);
 			say_bye = TRUE;
 		}
 
-		free(req);
+		release_blocking_req_internal(c, req);
 	}
 
 	return 0;
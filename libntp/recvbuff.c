@@ -85,7 +85,7 @@ create_buffers(int nbufs)
 	buffer_shortfall = 0;
 
 #ifndef DEBUG
-	bufp = emalloc_zero(abuf * sizeof(*bufp));
+	bufp = emalloc_zero_tag(MEM_RECVBUF, abuf * sizeof(*bufp));
 #endif
 
 	for (i = 0; i < abuf; i++) {
@@ -95,7 +95,7 @@ create_buffers(int nbufs)
 		 * free()d during ntpd shutdown on DEBUG builds to
 		 * keep them out of heap leak reports.
 		 */
-		bufp = emalloc_zero(sizeof(*bufp));
+		bufp = emalloc_zero_tag(MEM_RECVBUF, sizeof(*bufp));
 #endif
 		LINK_SLIST(free_recv_list, bufp, link);
 		bufp++;
@@ -137,14 +137,16 @@ uninit_recvbuff(void)
 		UNLINK_FIFO(rbunlinked, full_recv_fifo, link);
 		if (rbunlinked == NULL)
 			break;
-		free(rbunlinked);
+		efree_tag(MEM_RECVBUF, rbunlinked,
+			  sizeof(*rbunlinked));
 	}
 
 	for (;;) {
 		UNLINK_HEAD_SLIST(rbunlinked, free_recv_list, link);
 		if (rbunlinked == NULL)
 			break;
-		free(rbunlinked);
+		efree_tag(MEM_RECVBUF, rbunlinked,
+			  sizeof(*rbunlinked));
 	}
 }
 #endif	/* DEBUG */
@@ -205,7 +207,7 @@ get_free_recv_buffer(void)
 }
 
 
-#ifdef HAVE_IO_COMPLETION_PORT
+#if defined(HAVE_IO_COMPLETION_PORT) || defined(NTP_IO_URING)
 recvbuf_t *
 get_free_recv_buffer_alloc(void)
 {
@@ -21,14 +21,22 @@
 #include "ntp_debug.h"
 
 
-const char *
-socktohost(
-	const sockaddr_u *sock
+/*
+ * socktohost_r - reverse an address and check the name forward again,
+ *		  without touching the lib_strbuf ring so that it can be
+ *		  called from several threads at once.  Returns 1 with the
+ *		  checked name in buf, 0 with the reverse name in buf when
+ *		  it does not resolve back to the address, and -1 when
+ *		  there is no reverse name.
+ */
+int
+socktohost_r(
+	const sockaddr_u *	sock,
+	char *			buf,
+	size_t			len
 	)
 {
 	const char		svc[] = "ntp";
-	char *			pbuf;
-	char *			pliar;
 	int			gni_flags;
 	struct addrinfo		hints;
 	struct addrinfo *	alist;
@@ -36,20 +44,12 @@ socktohost(
 	sockaddr_u		addr;
 	size_t			octets;
 	int			a_info;
-	int			saved_errno;
-
-	saved_errno = socket_errno();
 
 	/* reverse the address to purported DNS name */
-	LIB_GETBUF(pbuf);
 	gni_flags = NI_DGRAM | NI_NAMEREQD;
-	if (getnameinfo(&sock->sa, SOCKLEN(sock), pbuf, LIB_BUFLENGTH,
-			NULL, 0, gni_flags)) {
-		errno = saved_errno;
-		return stoa(sock);	/* use address */
-	}
-
-	TRACE(1, ("%s reversed to %s\n", stoa(sock), pbuf));
+	if (getnameinfo(&sock->sa, SOCKLEN(sock), buf, len, NULL, 0,
+			gni_flags))
+		return -1;
 
 	/*
 	 * Resolve the reversed name and make sure the reversed address
@@ -62,7 +62,7 @@ socktohost(
 	hints.ai_flags = 0;
 	alist = NULL;
 
-	a_info = getaddrinfo(pbuf, svc, &hints, &alist);
+	a_info = getaddrinfo(buf, svc, &hints, &alist);
 	if (a_info == EAI_NONAME
 #ifdef EAI_NODATA
 	    || a_info == EAI_NODATA
@@ -72,17 +72,17 @@ socktohost(
 #ifdef AI_ADDRCONFIG
 		hints.ai_flags |= AI_ADDRCONFIG;
 #endif
-		a_info = getaddrinfo(pbuf, svc, &hints, &alist);	
+		a_info = getaddrinfo(buf, svc, &hints, &alist);	
 	}
 #ifdef AI_ADDRCONFIG
 	/* Some older implementations don't like AI_ADDRCONFIG. */
 	if (a_info == EAI_BADFLAGS) {
 		hints.ai_flags &= ~AI_ADDRCONFIG;
-		a_info = getaddrinfo(pbuf, svc, &hints, &alist);	
+		a_info = getaddrinfo(buf, svc, &hints, &alist);	
 	}
 #endif
 	if (a_info)
-		goto forward_fail;
+		return 0;
 
 	INSIST(alist != NULL);
 
@@ -102,17 +102,35 @@ socktohost(
 	}
 	freeaddrinfo(alist);
 
-	if (ai != NULL) {
-		errno = saved_errno;
-		return pbuf;	/* forward check passed */
-	}
+	return (ai != NULL);
+}
+
 
-    forward_fail:
-	TRACE(1, ("%s forward check lookup fail: %s\n", pbuf,
-		  gai_strerror(a_info)));
+const char *
+socktohost(
+	const sockaddr_u *sock
+	)
+{
+	char *			pbuf;
+	char *			pliar;
+	int			saved_errno;
+	int			rc;
+
+	saved_errno = socket_errno();
+
+	LIB_GETBUF(pbuf);
+	rc = socktohost_r(sock, pbuf, LIB_BUFLENGTH);
+	errno = saved_errno;
+	if (rc < 0)
+		return stoa(sock);	/* use address */
+
+	TRACE(1, ("%s reversed to %s\n", stoa(sock), pbuf));
+	if (rc > 0)
+		return pbuf;		/* forward check passed */
+
+	TRACE(1, ("%s forward check lookup fail\n", pbuf));
 	LIB_GETBUF(pliar);
 	snprintf(pliar, LIB_BUFLENGTH, "%s (%s)", stoa(sock), pbuf);
 
-	errno = saved_errno;
 	return pliar;
 }
@@ -371,6 +371,31 @@ receive_blocking_resp_internal(
 }
 
 
+/*
+ * The requests and responses read from the pipes are private copies.
+ */
+void
+release_blocking_req_internal(
+	blocking_child *	c,
+	blocking_pipe_header *	req
+	)
+{
+	UNUSED_ARG(c);
+	free(req);
+}
+
+
+void
+release_blocking_resp_internal(
+	blocking_child *	c,
+	blocking_pipe_header *	resp
+	)
+{
+	UNUSED_ARG(c);
+	free(resp);
+}
+
+
 #if defined(HAVE_DROPROOT) && defined(WORK_FORK)
 void
 fork_deferred_worker(void)
@@ -23,16 +23,37 @@
 #include "timespecops.h"
 #include "ntp_worker.h"
 
+#ifdef HAVE_SYS_EVENTFD_H
+# include <sys/eventfd.h>
+#endif
+#if defined(HAVE_STDATOMIC_H) && !defined(__STDC_NO_ATOMICS__)
+# include <stdatomic.h>
+#endif
+
 #define CHILD_EXIT_REQ	((blocking_pipe_header *)(intptr_t)-1)
 #define CHILD_GONE_RESP	CHILD_EXIT_REQ
-/* Queue size increments:
- * The request queue grows a bit faster than the response queue -- the
- * deamon can push requests and pull results faster on avarage than the
- * worker can process requests and push results...  If this really pays
- * off is debatable.
+/* Backlog size increment, for requests finding the ring full */
+#define BACKLOG_ALLOC_INC	16
+
+/*
+ * ring_fence() orders the slot contents against the index updates of
+ * the request and response rings.  Without atomics a round trip
+ * through the access semaphore does, as semaphore operations
+ * synchronize memory, too.
  */
-#define WORKITEMS_ALLOC_INC	16
-#define RESPONSES_ALLOC_INC	4
+#if defined(HAVE_STDATOMIC_H) && !defined(__STDC_NO_ATOMICS__)
+# define ring_fence(c)	atomic_thread_fence(memory_order_seq_cst)
+#elif defined(SYS_WINNT)
+# define ring_fence(c)	MemoryBarrier()
+#elif defined(__GNUC__)
+# define ring_fence(c)	__sync_synchronize()
+#else
+# define ring_fence(c)					\
+	do {						\
+		wait_for_sem((c)->accesslock, NULL);	\
+		tickle_sem((c)->accesslock);		\
+	} while (0)
+#endif
 
 /* Fiddle with min/max stack sizes. 64kB minimum seems to work, so we
  * set the maximum to 256kB. If the minimum goes below the
@@ -41,12 +62,7 @@
 #ifndef THREAD_MINSTACKSIZE
 # define THREAD_MINSTACKSIZE	(64U * 1024)
 #endif
-#ifndef __sun
-#if defined(PTHREAD_STACK_MIN) && THREAD_MINSTACKSIZE < PTHREAD_STACK_MIN
-# undef THREAD_MINSTACKSIZE
-# define THREAD_MINSTACKSIZE PTHREAD_STACK_MIN
-#endif
-#endif
+/* PTHREAD_STACK_MIN may be sysconf() based and is checked at runtime */
 
 #ifndef THREAD_MAXSTACKSIZE
 # define THREAD_MAXSTACKSIZE	(256U * 1024)
@@ -82,10 +98,18 @@ addremove_io_semaphore_func	addremove_io_semaphore;
 static	void	start_blocking_thread(blocking_child *);
 static	void	start_blocking_thread_internal(blocking_child *);
 static	void	prepare_child_sems(blocking_child *);
+static	void	prepare_child_rings(blocking_child *);
 static	int	wait_for_sem(sem_ref, struct timespec *);
-static	int	ensure_workitems_empty_slot(blocking_child *);
-static	int	ensure_workresp_empty_slot(blocking_child *);
-static	int	queue_req_pointer(blocking_child *, blocking_pipe_header *);
+static	int	ring_put(blocking_child *, blocking_ring *,
+			 blocking_pipe_header *, const void *);
+static	blocking_pipe_header *
+		ring_peek(blocking_child *, blocking_ring *);
+static	int	ring_release(blocking_child *, blocking_ring *);
+static	void	ring_clear(blocking_ring *);
+static	void	flush_req_backlog(blocking_child *);
+static	int	queue_req_pointer(blocking_child *, blocking_pipe_header *,
+				  const void *);
+static	void	notify_resp(blocking_child *);
 static	void	cleanup_after_child(blocking_child *);
 
 
@@ -149,114 +173,219 @@ interrupt_worker_sleep(void)
 }
 
 /* --------------------------------------------------------------------
- * Make sure there is an empty slot at the head of the request
- * queue. Tell if the queue is currently empty.
+ * The rings: the producer fills the slot at 'head' and then advances
+ * 'head', the consumer uses the slot at 'tail' in place and advances
+ * 'tail' when done with it.  Each index is written by its side only.
+ *
+ * ring_put() puts an item into the next free slot.  With 'data' NULL,
+ * 'item' is a complete item owned by the caller, copied into the slot
+ * and freed if it fits, else handed over as is.  Otherwise 'item' is
+ * just the header and 'data' the payload, copied into the slot or a
+ * new heap copy.  The CHILD_EXIT_REQ and CHILD_GONE_RESP markers pass
+ * as they are.
+ *
+ * Returns -1 if the ring is full, leaving 'item' to the caller, else
+ * whether the ring was empty, i.e. the consumer may need a wakeup.
  */
 static int
-ensure_workitems_empty_slot(
-	blocking_child *c
+ring_put(
+	blocking_child *	c,
+	blocking_ring *		r,
+	blocking_pipe_header *	item,
+	const void *		data
 	)
 {
-	/*
-	** !!! PRECONDITION: caller holds access lock!
-	**
-	** This simply tries to increase the size of the buffer if it
-	** becomes full. The resize operation does *not* maintain the
-	** order of requests, but that should be irrelevant since the
-	** processing is considered asynchronous anyway.
-	**
-	** Return if the buffer is currently empty.
-	*/
-	
-	static const size_t each =
-	    sizeof(blocking_children[0]->workitems[0]);
-
-	size_t	new_alloc;
-	size_t  slots_used;
-	size_t	sidx;
-
-	slots_used = c->head_workitem - c->tail_workitem;
-	if (slots_used >= c->workitems_alloc) {
-		new_alloc  = c->workitems_alloc + WORKITEMS_ALLOC_INC;
-		c->workitems = erealloc(c->workitems, new_alloc * each);
-		for (sidx = c->workitems_alloc; sidx < new_alloc; ++sidx)
-		    c->workitems[sidx] = NULL;
-		c->tail_workitem   = 0;
-		c->head_workitem   = c->workitems_alloc;
-		c->workitems_alloc = new_alloc;
+	blocking_slot *	slot;
+	size_t		head;
+	size_t		payload;
+
+	head = r->head;
+	if (head - r->tail >= BLOCKING_RING_SLOTS)
+		return -1;
+	/* the consumer is done with the slot */
+	ring_fence(c);
+	slot = &r->slot[head % BLOCKING_RING_SLOTS];
+	if (CHILD_EXIT_REQ == item) {
+		slot->spill = item;
+	} else if (NULL == data) {
+		if (item->octets <= sizeof(slot->u)) {
+			slot->spill = NULL;
+			memcpy(&slot->u, item, item->octets);
+			free(item);
+		} else {
+			slot->spill = item;
+		}
+	} else {
+		payload = item->octets - sizeof(*item);
+		if (item->octets <= sizeof(slot->u)) {
+			slot->spill = NULL;
+			memcpy(&slot->u.hdr, item, sizeof(*item));
+			memcpy(slot->u.octets + sizeof(*item), data, payload);
+		} else {
+			slot->spill = emalloc(item->octets);
+			memcpy(slot->spill, item, sizeof(*item));
+			memcpy((char *)slot->spill + sizeof(*item), data,
+			       payload);
+		}
 	}
-	INSIST(NULL == c->workitems[c->head_workitem % c->workitems_alloc]);
-	return (0 == slots_used);
+	/* publish the slot, then look at the consumer */
+	ring_fence(c);
+	r->head = head + 1;
+	ring_fence(c);
+
+	return (r->tail == head);
 }
 
 /* --------------------------------------------------------------------
- * Make sure there is an empty slot at the head of the response
- * queue. Tell if the queue is currently empty.
+ * ring_peek() returns the oldest item in a ring, or NULL if it is
+ * empty.  The item stays in its slot until ring_release().
+ */
+static blocking_pipe_header *
+ring_peek(
+	blocking_child *	c,
+	blocking_ring *		r
+	)
+{
+	blocking_slot *	slot;
+	size_t		tail;
+
+	tail = r->tail;
+	if (r->head == tail)
+		return NULL;
+	/* read the slot only after seeing it published */
+	ring_fence(c);
+	slot = &r->slot[tail % BLOCKING_RING_SLOTS];
+
+	return (slot->spill != NULL)
+		   ? slot->spill
+		   : &slot->u.hdr;
+}
+
+/* --------------------------------------------------------------------
+ * ring_release() frees the slot of the oldest item for reuse.  Returns
+ * whether the ring was full, i.e. the producer may be waiting.
  */
 static int
-ensure_workresp_empty_slot(
-	blocking_child *c
+ring_release(
+	blocking_child *	c,
+	blocking_ring *		r
 	)
 {
-	/*
-	** !!! PRECONDITION: caller holds access lock!
-	**
-	** Works like the companion function above.
-	*/
-	
-	static const size_t each =
-	    sizeof(blocking_children[0]->responses[0]);
-
-	size_t	new_alloc;
-	size_t  slots_used;
-	size_t	sidx;
-
-	slots_used = c->head_response - c->tail_response;
-	if (slots_used >= c->responses_alloc) {
-		new_alloc  = c->responses_alloc + RESPONSES_ALLOC_INC;
-		c->responses = erealloc(c->responses, new_alloc * each);
-		for (sidx = c->responses_alloc; sidx < new_alloc; ++sidx)
-		    c->responses[sidx] = NULL;
-		c->tail_response   = 0;
-		c->head_response   = c->responses_alloc;
-		c->responses_alloc = new_alloc;
+	blocking_slot *	slot;
+	size_t		tail;
+
+	tail = r->tail;
+	slot = &r->slot[tail % BLOCKING_RING_SLOTS];
+	if (slot->spill != NULL && CHILD_EXIT_REQ != slot->spill)
+		free(slot->spill);
+	slot->spill = NULL;
+	ring_fence(c);
+	r->tail = tail + 1;
+	ring_fence(c);
+
+	return (r->head - tail >= BLOCKING_RING_SLOTS);
+}
+
+/* --------------------------------------------------------------------
+ * ring_clear() drops whatever is left in a ring of a gone worker.
+ */
+static void
+ring_clear(
+	blocking_ring *	r
+	)
+{
+	blocking_slot *	slot;
+
+	for (; r->tail != r->head; r->tail++) {
+		slot = &r->slot[r->tail % BLOCKING_RING_SLOTS];
+		if (slot->spill != NULL && CHILD_EXIT_REQ != slot->spill)
+			free(slot->spill);
+		slot->spill = NULL;
 	}
-	INSIST(NULL == c->responses[c->head_response % c->responses_alloc]);
-	return (0 == slots_used);
+	r->head = 0;
+	r->tail = 0;
+}
+
+/* --------------------------------------------------------------------
+ * Move requests which found the ring full into it, as far as the
+ * worker has made room.  Runs in the parent.
+ */
+static void
+flush_req_backlog(
+	blocking_child *	c
+	)
+{
+	size_t	n;
+	int	rc;
+	int	wake;
+
+	wake = FALSE;
+	for (n = 0; n < c->backlog_count; n++) {
+		rc = ring_put(c, c->req_ring, c->backlog[n], NULL);
+		if (-1 == rc)
+			break;
+		wake |= rc;
+	}
+	if (n > 0) {
+		c->backlog_count -= n;
+		memmove(c->backlog, c->backlog + n,
+			c->backlog_count * sizeof(c->backlog[0]));
+	}
+	if (wake)
+		tickle_sem(c->workitems_pending);
 }
 
 
 /* --------------------------------------------------------------------
- * queue_req_pointer() - append a work item or idle exit request to
- *			 blocking_workitems[]. Employ proper locking.
+ * queue_req_pointer() - put a work item (header 'hdr' and payload
+ *			 'data') or the idle exit request into the
+ *			 request ring, or behind it into the backlog if
+ *			 the ring is full.  The request is copied.
  */
 static int
 queue_req_pointer(
 	blocking_child	*	c,
-	blocking_pipe_header *	hdr
+	blocking_pipe_header *	hdr,
+	const void *		data
 	)
 {
-	size_t qhead;
-	
-	/* >>>> ACCESS LOCKING STARTS >>>> */
-	wait_for_sem(c->accesslock, NULL);
-	ensure_workitems_empty_slot(c);
-	qhead = c->head_workitem;
-	c->workitems[qhead % c->workitems_alloc] = hdr;
-	c->head_workitem = 1 + qhead;
-	tickle_sem(c->accesslock);
-	/* <<<< ACCESS LOCKING ENDS <<<< */
-
-	/* queue consumer wake-up notification */
-	tickle_sem(c->workitems_pending);
+	blocking_pipe_header *	copy;
+	size_t			new_alloc;
+	int			rc;
+
+	flush_req_backlog(c);
+	if (0 == c->backlog_count)
+		rc = ring_put(c, c->req_ring, hdr, data);
+	else
+		rc = -1;	/* keep the order */
+
+	if (rc > 0) {
+		tickle_sem(c->workitems_pending);
+	} else if (-1 == rc) {
+		if (CHILD_EXIT_REQ == hdr) {
+			copy = hdr;
+		} else {
+			copy = emalloc(hdr->octets);
+			memcpy(copy, hdr, sizeof(*hdr));
+			memcpy((char *)copy + sizeof(*hdr), data,
+			       hdr->octets - sizeof(*hdr));
+		}
+		if (c->backlog_count == c->backlog_alloc) {
+			new_alloc = c->backlog_alloc + BACKLOG_ALLOC_INC;
+			c->backlog = erealloc(c->backlog,
+					      new_alloc * sizeof(c->backlog[0]));
+			c->backlog_alloc = new_alloc;
+		}
+		c->backlog[c->backlog_count++] = copy;
+	}
 
 	return 0;
 }
 
 /* --------------------------------------------------------------------
- * API function to make sure a worker is running, a proper private copy
- * of the data is made, the data eneterd into the queue and the worker
- * is signalled.
+ * API function to make sure a worker is running and to put the request
+ * into its ring, which needs no heap copy for a request fitting into a
+ * slot.
  */
 int
 send_blocking_req_internal(
@@ -265,29 +394,22 @@ send_blocking_req_internal(
 	void *			data
 	)
 {
-	blocking_pipe_header *	threadcopy;
-	size_t			payload_octets;
-
 	REQUIRE(hdr != NULL);
 	REQUIRE(data != NULL);
 	DEBUG_REQUIRE(BLOCKING_REQ_MAGIC == hdr->magic_sig);
 
 	if (hdr->octets <= sizeof(*hdr))
 		return 1;	/* failure */
-	payload_octets = hdr->octets - sizeof(*hdr);
 
 	if (NULL == c->thread_ref)
 		start_blocking_thread(c);
-	threadcopy = emalloc(hdr->octets);
-	memcpy(threadcopy, hdr, sizeof(*hdr));
-	memcpy((char *)threadcopy + sizeof(*hdr), data, payload_octets);
 
-	return queue_req_pointer(c, threadcopy);
+	return queue_req_pointer(c, hdr, data);
 }
 
 /* --------------------------------------------------------------------
- * Wait for the 'incoming queue no longer empty' signal, lock the shared
- * structure and dequeue an item.
+ * Wait for a request in the ring and return it in place.  The worker
+ * hands it back with release_blocking_req_internal().
  */
 blocking_pipe_header *
 receive_blocking_req_internal(
@@ -295,32 +417,13 @@ receive_blocking_req_internal(
 	)
 {
 	blocking_pipe_header *	req;
-	size_t			qhead, qtail;
 
-	req = NULL;
-	do {
-		/* wait for tickle from the producer side */
+	/* the parent tickles when putting into an empty ring */
+	while (NULL == (req = ring_peek(c, c->req_ring)))
 		wait_for_sem(c->workitems_pending, NULL);
 
-		/* >>>> ACCESS LOCKING STARTS >>>> */
-		wait_for_sem(c->accesslock, NULL);
-		qhead = c->head_workitem;
-		do {
-			qtail = c->tail_workitem;
-			if (qhead == qtail)
-				break;
-			c->tail_workitem = qtail + 1;
-			qtail %= c->workitems_alloc;
-			req = c->workitems[qtail];
-			c->workitems[qtail] = NULL;
-		} while (NULL == req);
-		tickle_sem(c->accesslock);
-		/* <<<< ACCESS LOCKING ENDS <<<< */
-
-	} while (NULL == req);
-
-	INSIST(NULL != req);
 	if (CHILD_EXIT_REQ == req) {	/* idled out */
+		ring_release(c, c->req_ring);
 		send_blocking_resp_internal(c, CHILD_GONE_RESP);
 		req = NULL;
 	}
@@ -329,8 +432,45 @@ receive_blocking_req_internal(
 }
 
 /* --------------------------------------------------------------------
- * Push a response into the return queue and eventually tickle the
- * receiver.
+ * Free the slot of a request the worker is done with.  The parent
+ * never waits for room in the request ring.
+ */
+void
+release_blocking_req_internal(
+	blocking_child *	c,
+	blocking_pipe_header *	req
+	)
+{
+	UNUSED_ARG(req);
+	ring_release(c, c->req_ring);
+}
+
+/* --------------------------------------------------------------------
+ * Tell the parent there is a response in the formerly empty ring.
+ */
+static void
+notify_resp(
+	blocking_child *	c
+	)
+{
+#ifdef WORK_PIPE
+# ifdef HAVE_SYS_EVENTFD_H
+	static const eventfd_t	one = 1;
+
+	if (c->resp_write_pipe == c->resp_read_pipe) {
+		write(c->resp_write_pipe, &one, sizeof(one));
+		return;
+	}
+# endif
+	write(c->resp_write_pipe, "", 1);
+#else
+	tickle_sem(c->responses_pending);
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Push a response into the response ring, waiting for room if it is
+ * full, and eventually tickle the receiver.  Takes over 'resp'.
  */
 int
 send_blocking_resp_internal(
@@ -338,27 +478,13 @@ send_blocking_resp_internal(
 	blocking_pipe_header *	resp
 	)
 {
-	size_t	qhead;
-	int	empty;
-	
-	/* >>>> ACCESS LOCKING STARTS >>>> */
-	wait_for_sem(c->accesslock, NULL);
-	empty = ensure_workresp_empty_slot(c);
-	qhead = c->head_response;
-	c->responses[qhead % c->responses_alloc] = resp;
-	c->head_response = 1 + qhead;
-	tickle_sem(c->accesslock);
-	/* <<<< ACCESS LOCKING ENDS <<<< */
-
-	/* queue consumer wake-up notification */
-	if (empty)
-	{
-#	    ifdef WORK_PIPE
-		write(c->resp_write_pipe, "", 1);
-#	    else
-		tickle_sem(c->responses_pending);
-#	    endif
-	}
+	int	rc;
+
+	while (-1 == (rc = ring_put(c, c->resp_ring, resp, NULL)))
+		wait_for_sem(c->responses_space, NULL);
+	if (rc)
+		notify_resp(c);
+
 	return 0;
 }
 
@@ -404,8 +530,9 @@ handle_blocking_resp_sem(
 #endif	/* !WORK_PIPE */
 
 /* --------------------------------------------------------------------
- * Fetch the next response from the return queue. In case of signalling
- * via pipe, make sure the pipe is flushed, too.
+ * Fetch the next response from the response ring, in place.  The
+ * wakeup signal is consumed only when the ring is found empty, and the
+ * ring looked at once more after that, so no response is missed.
  */
 blocking_pipe_header *
 receive_blocking_resp_internal(
@@ -413,35 +540,32 @@ receive_blocking_resp_internal(
 	)
 {
 	blocking_pipe_header *	removed;
-	size_t			qhead, qtail, slot;
-
 #ifdef WORK_PIPE
 	int			rc;
 	char			scratch[32];
-
-	do
-		rc = read(c->resp_read_pipe, scratch, sizeof(scratch));
-	while (-1 == rc && EINTR == errno);
 #endif
 
-	/* >>>> ACCESS LOCKING STARTS >>>> */
-	wait_for_sem(c->accesslock, NULL);
-	qhead = c->head_response;
-	qtail = c->tail_response;
-	for (removed = NULL; !removed && (qhead != qtail); ++qtail) {
-		slot = qtail % c->responses_alloc;
-		removed = c->responses[slot];
-		c->responses[slot] = NULL;
+	/* responses made room for requests waiting in the backlog */
+	if (c->backlog_count > 0)
+		flush_req_backlog(c);
+
+	removed = ring_peek(c, c->resp_ring);
+#ifdef WORK_PIPE
+	if (NULL == removed) {
+		do
+			rc = read(c->resp_read_pipe, scratch,
+				  sizeof(scratch));
+		while (-1 == rc && EINTR == errno);
+		removed = ring_peek(c, c->resp_ring);
 	}
-	c->tail_response = qtail;
-	tickle_sem(c->accesslock);
-	/* <<<< ACCESS LOCKING ENDS <<<< */
+#endif
 
 	if (NULL != removed) {
 		DEBUG_ENSURE(CHILD_GONE_RESP == removed ||
 			     BLOCKING_RESP_MAGIC == removed->magic_sig);
 	}
 	if (CHILD_GONE_RESP == removed) {
+		ring_release(c, c->resp_ring);
 		cleanup_after_child(c);
 		removed = NULL;
 	}
@@ -449,6 +573,21 @@ receive_blocking_resp_internal(
 	return removed;
 }
 
+/* --------------------------------------------------------------------
+ * Free the slot of a response the parent is done with, waking the
+ * worker if it waits for room.
+ */
+void
+release_blocking_resp_internal(
+	blocking_child *	c,
+	blocking_pipe_header *	resp
+	)
+{
+	UNUSED_ARG(resp);
+	if (ring_release(c, c->resp_ring))
+		tickle_sem(c->responses_space);
+}
+
 /* --------------------------------------------------------------------
  * Light up a new worker.
  */
@@ -461,6 +600,7 @@ start_blocking_thread(
 	DEBUG_INSIST(!c->reusable);
 
 	prepare_child_sems(c);
+	prepare_child_rings(c);
 	start_blocking_thread_internal(c);
 }
 
@@ -531,14 +671,25 @@ start_blocking_thread_internal(
 	}
 # endif
 
-	rc = pipe_socketpair(&pipe_ends[0], &is_pipe);
-	if (0 != rc) {
-		msyslog(LOG_ERR, "start_blocking_thread: pipe_socketpair() %m");
-		exit(1);
+	rc = -1;
+# ifdef HAVE_SYS_EVENTFD_H
+	rc = eventfd(0, 0);
+	if (-1 != rc) {
+		c->resp_read_pipe = move_fd(rc);
+		c->resp_write_pipe = c->resp_read_pipe;
+		c->ispipe = FALSE;
+	}
+# endif
+	if (-1 == rc) {
+		rc = pipe_socketpair(&pipe_ends[0], &is_pipe);
+		if (0 != rc) {
+			msyslog(LOG_ERR, "start_blocking_thread: pipe_socketpair() %m");
+			exit(1);
+		}
+		c->resp_read_pipe = move_fd(pipe_ends[0]);
+		c->resp_write_pipe = move_fd(pipe_ends[1]);
+		c->ispipe = is_pipe;
 	}
-	c->resp_read_pipe = move_fd(pipe_ends[0]);
-	c->resp_write_pipe = move_fd(pipe_ends[1]);
-	c->ispipe = is_pipe;
 	flags = fcntl(c->resp_read_pipe, F_GETFL, 0);
 	if (-1 == flags) {
 		msyslog(LOG_ERR, "start_blocking_thread: fcntl(F_GETFL) %m");
@@ -567,6 +718,10 @@ start_blocking_thread_internal(
 			nstacksize = THREAD_MAXSTACKSIZE;
 		else
 			nstacksize = ostacksize;
+# if defined(PTHREAD_STACK_MIN) && !defined(__sun)
+		if (nstacksize < (size_t)PTHREAD_STACK_MIN)
+			nstacksize = PTHREAD_STACK_MIN;
+# endif
 		if (nstacksize != ostacksize)
 			rc = pthread_attr_setstacksize(&thr_attr, nstacksize);
 		if (0 != rc)
@@ -711,13 +866,13 @@ delete_sema(
  * create sync & access semaphores
  *
  * All semaphores are cleared, only the access semaphore has 1 unit.
- * Childs wait on 'workitems_pending', then grabs 'sema_access'
- * and dequeues jobs. When done, 'sema_access' is given one unit back.
- *
- * The producer grabs 'sema_access', manages the queue, restores
- * 'sema_access' and puts one unit into 'workitems_pending'.
- *
- * The story goes the same for the response queue.
+ * The child waits on 'workitems_pending' when it finds the request
+ * ring empty, and the parent puts one unit into it when it puts a
+ * request into the empty ring.  Likewise the child waits on
+ * 'responses_space' when it finds the response ring full, and the
+ * parent puts one unit into it when it frees a slot of the full ring.
+ * The access semaphore only serves as a memory fence where there is
+ * no other, see ring_fence().
  */
 static void
 prepare_child_sems(
@@ -730,6 +885,22 @@ prepare_child_sems(
 #   ifndef WORK_PIPE
 	c->responses_pending    = create_sema(&c->sem_table[3], 0, 0);
 #   endif
+	c->responses_space      = create_sema(&c->sem_table[4], 0, 0);
+}
+
+/* --------------------------------------------------------------------
+ * prepare_child_rings() allocates the rings on first use.  They are
+ * kept, empty, when the worker goes away.
+ */
+static void
+prepare_child_rings(
+	blocking_child *c
+	)
+{
+	if (NULL == c->req_ring)
+		c->req_ring = emalloc_zero(sizeof(*c->req_ring));
+	if (NULL == c->resp_ring)
+		c->resp_ring = emalloc_zero(sizeof(*c->resp_ring));
 }
 
 /* --------------------------------------------------------------------
@@ -840,7 +1011,7 @@ req_child_exit(
 	)
 {
 	return (c->accesslock)
-	    ? queue_req_pointer(c, CHILD_EXIT_REQ)
+	    ? queue_req_pointer(c, CHILD_EXIT_REQ, NULL)
 	    : 0;
 }
 
@@ -852,6 +1023,8 @@ cleanup_after_child(
 	blocking_child *	c
 	)
 {
+	blocking_pipe_header *	req;
+
 	DEBUG_INSIST(!c->reusable);
 	
 #   ifdef SYS_WINNT
@@ -871,12 +1044,14 @@ cleanup_after_child(
 	c->accesslock           = delete_sema(c->accesslock);
 	c->workitems_pending    = delete_sema(c->workitems_pending);
 	c->wake_scheduled_sleep = delete_sema(c->wake_scheduled_sleep);
+	c->responses_space      = delete_sema(c->responses_space);
 
 #   ifdef WORK_PIPE
 	DEBUG_INSIST(-1 != c->resp_read_pipe);
 	DEBUG_INSIST(-1 != c->resp_write_pipe);
 	(*addremove_io_fd)(c->resp_read_pipe, c->ispipe, TRUE);
-	close(c->resp_write_pipe);
+	if (c->resp_write_pipe != c->resp_read_pipe)
+		close(c->resp_write_pipe);
 	close(c->resp_read_pipe);
 	c->resp_write_pipe = -1;
 	c->resp_read_pipe = -1;
@@ -890,11 +1065,14 @@ cleanup_after_child(
 	 * responses? If so, and if there are, what to do with them?
 	 */
 	
-	/* re-init buffer index sequencers */
-	c->head_workitem = 0;
-	c->tail_workitem = 0;
-	c->head_response = 0;
-	c->tail_response = 0;
+	/* drop leftovers and re-init the ring indices */
+	ring_clear(c->req_ring);
+	ring_clear(c->resp_ring);
+	while (c->backlog_count > 0) {
+		req = c->backlog[--c->backlog_count];
+		if (CHILD_EXIT_REQ != req)
+			free(req);
+	}
 
 	c->reusable = TRUE;
 }
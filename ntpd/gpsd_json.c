@@ -0,0 +1,302 @@
+/*
+ * gpsd_json.c - single pass scanner for the GPSD JSON records
+ *
+ * The contents of 'html/copyright.html' apply.
+ *
+ * This file is included by 'refclock_gpsdjson.c', like the JSMN parser
+ * it replaces, and by the benchmark and unit test.
+ *
+ * GPSD sends one JSON object per line, and the driver needs only a few
+ * members at the top level of the object.  Instead of tokenising the
+ * whole record and searching the token list for each member, the
+ * scanner walks the top level of the object once, looks every key up
+ * in a fixed table and records where the values of the keys it knows
+ * start.  Values are NUL terminated in place, so nothing is copied;
+ * nested objects and arrays are skipped without looking at their
+ * contents.
+ *
+ * GPSD always writes the 'class' member first.  'json_peek_class()'
+ * uses this to reject records the driver does not care about (SKY,
+ * DEVICES, ...) before they are scanned at all.
+ */
+
+#include <string.h>
+
+#include "ntp_types.h"
+
+/* Keys the driver looks at.  Keep 'json_keys[]' in the same order! */
+enum json_key {
+	JK_CLASS,
+	JK_DEVICE,
+	JK_ENABLE,
+	JK_JSON,
+	JK_REV,
+	JK_RELEASE,
+	JK_PROTO_MAJOR,
+	JK_PROTO_MINOR,
+	JK_MODE,
+	JK_TIME,
+	JK_EPT,
+	JK_CLOCK_SEC,
+	JK_CLOCK_NSEC,
+	JK_CLOCK_MUSEC,
+	JK_REAL_SEC,
+	JK_REAL_NSEC,
+	JK_REAL_MUSEC,
+	JK_PRECISION,
+	JK_COUNT
+};
+
+/* value types; JSON_ABSENT must be zero */
+#define JSON_ABSENT	0
+#define JSON_STRING	1
+#define JSON_PRIMITIVE	2
+#define JSON_COMPOUND	3
+
+typedef struct json_key_def {
+	size_t       len;
+	const char * name;
+} json_key_def;
+
+#define JSON_KEY(s)	{ sizeof(s) - 1, s }
+
+static const json_key_def json_keys[JK_COUNT] = {
+	JSON_KEY("class"),
+	JSON_KEY("device"),
+	JSON_KEY("enable"),
+	JSON_KEY("json"),
+	JSON_KEY("rev"),
+	JSON_KEY("release"),
+	JSON_KEY("proto_major"),
+	JSON_KEY("proto_minor"),
+	JSON_KEY("mode"),
+	JSON_KEY("time"),
+	JSON_KEY("ept"),
+	JSON_KEY("clock_sec"),
+	JSON_KEY("clock_nsec"),
+	JSON_KEY("clock_musec"),
+	JSON_KEY("real_sec"),
+	JSON_KEY("real_nsec"),
+	JSON_KEY("real_musec"),
+	JSON_KEY("precision")
+};
+
+/* Record classes the driver processes. A record with a class not
+ * listed here is dropped by 'json_peek_class()'.
+ */
+static const json_key_def json_classes[] = {
+	JSON_KEY("TPV"),
+	JSON_KEY("PPS"),
+	JSON_KEY("TOFF"),
+	JSON_KEY("VERSION"),
+	JSON_KEY("WATCH")
+};
+
+typedef struct json_ctx {
+	const char  * val[JK_COUNT];	/* value, NUL terminated */
+	unsigned char typ[JK_COUNT];	/* JSON_xxx */
+} json_ctx;
+
+/* ------------------------------------------------------------------ */
+
+static int/*BOOL*/
+json_isspace(
+	int ch)
+{
+	return (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n');
+}
+
+static char *
+json_skip_space(
+	char * cp)
+{
+	while (json_isspace(*(u_char*)cp))
+		++cp;
+	return cp;
+}
+
+/* ------------------------------------------------------------------ */
+/* Find the closing quote of the string starting at 'cp', or return
+ * NULL if the buffer ends before the string does.
+ */
+static char *
+json_skip_string(
+	char * cp)
+{
+	for (++cp; *cp != '"'; ++cp) {
+		if (*cp == '\0')
+			return NULL;
+		if (*cp == '\\' && *++cp == '\0')
+			return NULL;
+	}
+	return cp;
+}
+
+/* ------------------------------------------------------------------ */
+/* Skip the object or array starting at 'cp' and return a pointer to
+ * the first char after it, or NULL if the buffer ends before it does.
+ * Only strings and brackets are looked at; the contents are not
+ * checked any further.
+ */
+static char *
+json_skip_compound(
+	char * cp)
+{
+	int depth = 0;
+
+	do {
+		switch (*cp) {
+		case '\0':
+			return NULL;
+		case '"':
+			if (NULL == (cp = json_skip_string(cp)))
+				return NULL;
+			break;
+		case '{':
+		case '[':
+			++depth;
+			break;
+		case '}':
+		case ']':
+			--depth;
+			break;
+		}
+		++cp;
+	} while (depth > 0);
+	return cp;
+}
+
+/* ------------------------------------------------------------------ */
+
+static int
+json_key_index(
+	const char * key,
+	size_t       len)
+{
+	int idx;
+
+	for (idx = 0; idx < JK_COUNT; ++idx)
+		if (json_keys[idx].len == len &&
+		    !memcmp(json_keys[idx].name, key, len))
+			return idx;
+	return -1;
+}
+
+/* ------------------------------------------------------------------ */
+/* Check whether the record in 'buf' is worth scanning. This returns
+ * FALSE only if the record starts with a 'class' member naming a
+ * class we do not process; everything else has to go through the
+ * scanner.
+ */
+static int/*BOOL*/
+json_peek_class(
+	const char * buf)
+{
+	static const char prefix[] = "{\"class\":\"";
+
+	const char * cp;
+	size_t       len, idx;
+
+	if (strncmp(buf, prefix, sizeof(prefix) - 1))
+		return TRUE;
+	buf += sizeof(prefix) - 1;
+	if (NULL == (cp = strchr(buf, '"')))
+		return TRUE;
+	len = (size_t)(cp - buf);
+	for (idx = 0; idx < COUNTOF(json_classes); ++idx)
+		if (json_classes[idx].len == len &&
+		    !memcmp(json_classes[idx].name, buf, len))
+			return TRUE;
+	return FALSE;
+}
+
+/* ------------------------------------------------------------------ */
+/* Scan the NUL terminated record in 'buf', which must be a JSON
+ * object, and note the values of the keys in 'json_keys[]'. If a key
+ * appears more than once, the first value wins. String values are
+ * stored without the quotes and escapes are not resolved.
+ *
+ * The buffer is modified: the closing quote of each string value and
+ * the delimiter after each primitive value are overwritten with NUL.
+ */
+static int/*BOOL*/
+json_parse_record(
+	json_ctx * ctx,
+	char     * buf)
+{
+	char *cp, *key, *val;
+	int   kid, typ;
+	char  sep;
+
+	memset(ctx->typ, JSON_ABSENT, sizeof(ctx->typ));
+
+	cp = json_skip_space(buf);
+	if (*cp++ != '{')
+		return FALSE;
+	cp = json_skip_space(cp);
+	if (*cp == '}')
+		return TRUE;
+
+	for (;;) {
+		/* key and colon */
+		if (*cp != '"')
+			return FALSE;
+		key = cp + 1;
+		if (NULL == (cp = json_skip_string(cp)))
+			return FALSE;
+		kid = json_key_index(key, (size_t)(cp - key));
+		cp = json_skip_space(cp + 1);
+		if (*cp++ != ':')
+			return FALSE;
+		cp = json_skip_space(cp);
+
+		/* value and separator */
+		val = cp;
+		switch (*cp) {
+		case '"':
+			++val;
+			if (NULL == (cp = json_skip_string(cp)))
+				return FALSE;
+			*cp = '\0';
+			cp = json_skip_space(cp + 1);
+			sep = *cp;
+			typ = JSON_STRING;
+			break;
+
+		case '{':
+		case '[':
+			if (NULL == (cp = json_skip_compound(cp)))
+				return FALSE;
+			cp = json_skip_space(cp);
+			sep = *cp;
+			typ = JSON_COMPOUND;
+			break;
+
+		default:
+			while (*cp != '\0' && *cp != ',' && *cp != '}' &&
+			       *cp != ']' && !json_isspace(*(u_char*)cp))
+				++cp;
+			if (cp == val)
+				return FALSE;
+			sep = *cp;
+			*cp = '\0';
+			if (json_isspace(sep)) {
+				cp = json_skip_space(cp + 1);
+				sep = *cp;
+			}
+			typ = JSON_PRIMITIVE;
+			break;
+		}
+
+		if (kid >= 0 && JSON_ABSENT == ctx->typ[kid]) {
+			ctx->val[kid] = val;
+			ctx->typ[kid] = (unsigned char)typ;
+		}
+
+		if (sep == '}')
+			return TRUE;
+		if (sep != ',')
+			return FALSE;
+		cp = json_skip_space(cp + 1);
+	}
+}
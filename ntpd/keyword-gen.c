@@ -223,6 +223,12 @@ struct key_tok ntp_keywords[] = {
 { "port",		T_Port,			FOLLBY_TOKEN },
 { "interface",		T_Interface,		FOLLBY_TOKEN },
 { "saveconfigdir",	T_Saveconfigdir,	FOLLBY_STRING },
+{ "controlsocket",	T_Controlsocket,	FOLLBY_STRING },
+{ "xdp",			T_Xdp,			FOLLBY_STRING },
+{ "sharedstate",	T_Sharedstate,		FOLLBY_TOKEN },
+/* sharedstate mode */
+{ "publish",		T_Publish,		FOLLBY_TOKEN },
+{ "serve",		T_Serve,		FOLLBY_TOKEN },
 /* interface_command (ignore and interface already defined) */
 { "nic",		T_Nic,			FOLLBY_TOKEN },
 { "all",		T_All,			FOLLBY_TOKEN },
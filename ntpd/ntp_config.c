@@ -245,6 +245,15 @@ static void free_config_vars(config_tree *);
 #ifdef SIM
 static void free_config_sim(config_tree *);
 #endif
+
+/*
+ * Syntax tree nodes and fifo anchors are charged to MEM_CONFIG, the
+ * strings hanging off them are not.  The simulator's nodes are left
+ * out as ntpdsim does not free them all.
+ */
+#define CFG_ALLOC(p)	emalloc_zero_tag(MEM_CONFIG, sizeof(*(p)))
+#define CFG_FREE(p)	efree_tag(MEM_CONFIG, (p), sizeof(*(p)))
+
 static void destroy_address_fifo(address_fifo *);
 #define FREE_ADDRESS_FIFO(pf)			\
 	do {					\
@@ -308,6 +317,8 @@ static void config_system_opts(config_tree *);
 static void config_tinker(config_tree *);
 static void config_tos(config_tree *);
 static void config_vars(config_tree *);
+static void config_ctlsock(config_tree *);
+static void config_xdp(config_tree *);
 
 #ifdef SIM
 static sockaddr_u *get_next_address(address_node *addr);
@@ -328,6 +339,7 @@ static void config_peers(config_tree *);
 static void config_unpeers(config_tree *);
 static void config_nic_rules(config_tree *, int/*BOOL*/ input_from_file);
 static void config_reset_counters(config_tree *);
+static void config_ctl_changed(void);
 static u_char get_correct_host_mode(int token);
 static int peerflag_bits(peer_node *);
 #endif	/* !SIM */
@@ -453,7 +465,7 @@ free_config_tree(
 #endif
 	free_auth_node(ptree);
 
-	free(ptree);
+	CFG_FREE(ptree);
 
 #if defined(_MSC_VER) && defined (_DEBUG)
 	_CrtCheckMemory();
@@ -547,6 +559,9 @@ dump_config_tree(
 			break;
 
 		case T_Integer:
+			if (   T_Publish == atrv->attr
+			    || T_Serve == atrv->attr)
+				fprintf(df, "%s ", keyword(T_Sharedstate));
 			fprintf(df, "%s %d\n", keyword(atrv->attr),
 				atrv->value.i);
 			break;
@@ -999,7 +1014,7 @@ append_gen_fifo(
 	pf = fifo;
 	pe = entry;
 	if (NULL == pf)
-		pf = emalloc_zero(sizeof(*pf));
+		pf = CFG_ALLOC(pf);
 	else
 		CHECK_FIFO_CONSISTENCY(*pf);
 	if (pe != NULL)
@@ -1027,7 +1042,7 @@ concat_gen_fifos(
 		return pf1;
 
 	CONCAT_FIFO(*pf1, *pf2, link);
-	free(pf2);
+	CFG_FREE(pf2);
 
 	return pf1;
 }
@@ -1045,7 +1060,7 @@ create_attr_dval(
 {
 	attr_val *my_val;
 
-	my_val = emalloc_zero(sizeof(*my_val));
+	my_val = CFG_ALLOC(my_val);
 	my_val->attr = attr;
 	my_val->value.d = value;
 	my_val->type = T_Double;
@@ -1062,7 +1077,7 @@ create_attr_ival(
 {
 	attr_val *my_val;
 
-	my_val = emalloc_zero(sizeof(*my_val));
+	my_val = CFG_ALLOC(my_val);
 	my_val->attr = attr;
 	my_val->value.i = value;
 	my_val->type = T_Integer;
@@ -1079,7 +1094,7 @@ create_attr_uval(
 {
 	attr_val *my_val;
 
-	my_val = emalloc_zero(sizeof(*my_val));
+	my_val = CFG_ALLOC(my_val);
 	my_val->attr = attr;
 	my_val->value.u = value;
 	my_val->type = T_U_int;
@@ -1097,7 +1112,7 @@ create_attr_rangeval(
 {
 	attr_val *my_val;
 
-	my_val = emalloc_zero(sizeof(*my_val));
+	my_val = CFG_ALLOC(my_val);
 	my_val->attr = attr;
 	my_val->value.r.first = first;
 	my_val->value.r.last = last;
@@ -1115,7 +1130,7 @@ create_attr_sval(
 {
 	attr_val *my_val;
 
-	my_val = emalloc_zero(sizeof(*my_val));
+	my_val = CFG_ALLOC(my_val);
 	my_val->attr = attr;
 	if (NULL == s)			/* free() hates NULL */
 		s = estrdup("");
@@ -1133,7 +1148,7 @@ create_int_node(
 {
 	int_node *i_n;
 
-	i_n = emalloc_zero(sizeof(*i_n));
+	i_n = CFG_ALLOC(i_n);
 	i_n->i = val;
 
 	return i_n;
@@ -1147,7 +1162,7 @@ create_string_node(
 {
 	string_node *sn;
 
-	sn = emalloc_zero(sizeof(*sn));
+	sn = CFG_ALLOC(sn);
 	sn->s = str;
 
 	return sn;
@@ -1164,7 +1179,7 @@ create_address_node(
 
 	REQUIRE(NULL != addr);
 	REQUIRE(AF_INET == type || AF_INET6 == type || AF_UNSPEC == type);
-	my_node = emalloc_zero(sizeof(*my_node));
+	my_node = CFG_ALLOC(my_node);
 	my_node->address = addr;
 	my_node->type = (u_short)type;
 
@@ -1182,7 +1197,7 @@ destroy_address_node(
 	REQUIRE(NULL != my_node->address);
 
 	free(my_node->address);
-	free(my_node);
+	CFG_FREE(my_node);
 }
 
 
@@ -1198,7 +1213,7 @@ create_peer_node(
 	int freenode;
 	int errflag = 0;
 
-	my_node = emalloc_zero(sizeof(*my_node));
+	my_node = CFG_ALLOC(my_node);
 
 	/* Initialize node values to default */
 	my_node->peerversion = NTP_VERSION;
@@ -1219,7 +1234,7 @@ create_peer_node(
 	while (options != NULL) {
 		UNLINK_FIFO(option, *options, link);
 		if (NULL == option) {
-			free(options);
+			CFG_FREE(options);
 			break;
 		}
 
@@ -1303,12 +1318,12 @@ create_peer_node(
 			errflag = 1;
 		}
 		if (freenode)
-			free(option);
+			CFG_FREE(option);
 	}
 
 	/* Check if errors were reported. If yes, ignore the node */
 	if (errflag) {
-		free(my_node);
+		CFG_FREE(my_node);
 		my_node = NULL;
 	}
 
@@ -1325,7 +1340,7 @@ create_unpeer_node(
 	u_int		u;
 	char *		pch;
 
-	my_node = emalloc_zero(sizeof(*my_node));
+	my_node = CFG_ALLOC(my_node);
 
 	/*
 	 * From the parser's perspective an association ID fits into
@@ -1358,7 +1373,7 @@ create_filegen_node(
 {
 	filegen_node *my_node;
 
-	my_node = emalloc_zero(sizeof(*my_node));
+	my_node = CFG_ALLOC(my_node);
 	my_node->filegen_token = filegen_token;
 	my_node->options = options;
 
@@ -1376,7 +1391,7 @@ create_restrict_node(
 {
 	restrict_node *my_node;
 
-	my_node = emalloc_zero(sizeof(*my_node));
+	my_node = CFG_ALLOC(my_node);
 	my_node->addr = addr;
 	my_node->mask = mask;
 	my_node->flags = flags;
@@ -1397,7 +1412,7 @@ destroy_restrict_node(
 	destroy_address_node(my_node->addr);
 	destroy_address_node(my_node->mask);
 	destroy_int_fifo(my_node->flags);
-	free(my_node);
+	CFG_FREE(my_node);
 }
 
 
@@ -1413,9 +1428,9 @@ destroy_int_fifo(
 			UNLINK_FIFO(i_n, *fifo, link);
 			if (i_n == NULL)
 				break;
-			free(i_n);
+			CFG_FREE(i_n);
 		}
-		free(fifo);
+		CFG_FREE(fifo);
 	}
 }
 
@@ -1433,9 +1448,9 @@ destroy_string_fifo(
 			if (sn == NULL)
 				break;
 			free(sn->s);
-			free(sn);
+			CFG_FREE(sn);
 		}
-		free(fifo);
+		CFG_FREE(fifo);
 	}
 }
 
@@ -1454,9 +1469,9 @@ destroy_attr_val_fifo(
 				break;
 			if (T_String == av->type)
 				free(av->value.s);
-			free(av);
+			CFG_FREE(av);
 		}
-		free(av_fifo);
+		CFG_FREE(av_fifo);
 	}
 }
 
@@ -1474,9 +1489,9 @@ destroy_filegen_fifo(
 			if (fg == NULL)
 				break;
 			destroy_attr_val_fifo(fg->options);
-			free(fg);
+			CFG_FREE(fg);
 		}
-		free(fifo);
+		CFG_FREE(fifo);
 	}
 }
 
@@ -1495,7 +1510,7 @@ destroy_restrict_fifo(
 				break;
 			destroy_restrict_node(rn);
 		}
-		free(fifo);
+		CFG_FREE(fifo);
 	}
 }
 
@@ -1514,9 +1529,9 @@ destroy_setvar_fifo(
 				break;
 			free(sv->var);
 			free(sv->val);
-			free(sv);
+			CFG_FREE(sv);
 		}
-		free(fifo);
+		CFG_FREE(fifo);
 	}
 }
 
@@ -1535,9 +1550,9 @@ destroy_addr_opts_fifo(
 				break;
 			destroy_address_node(aon->addr);
 			destroy_attr_val_fifo(aon->options);
-			free(aon);
+			CFG_FREE(aon);
 		}
-		free(fifo);
+		CFG_FREE(fifo);
 	}
 }
 
@@ -1558,7 +1573,7 @@ create_setvar_node(
 		*pch = '\0';
 
 	/* Now store the string into a setvar_node */
-	my_node = emalloc_zero(sizeof(*my_node));
+	my_node = CFG_ALLOC(my_node);
 	my_node->var = var;
 	my_node->val = val;
 	my_node->isdefault = isdefault;
@@ -1578,7 +1593,7 @@ create_nic_rule_node(
 
 	REQUIRE(match_class != 0 || if_name != NULL);
 
-	my_node = emalloc_zero(sizeof(*my_node));
+	my_node = CFG_ALLOC(my_node);
 	my_node->match_class = match_class;
 	my_node->if_name = if_name;
 	my_node->action = action;
@@ -1595,7 +1610,7 @@ create_addr_opts_node(
 {
 	addr_opts_node *my_node;
 
-	my_node = emalloc_zero(sizeof(*my_node));
+	my_node = CFG_ALLOC(my_node);
 	my_node->addr = addr;
 	my_node->options = options;
 
@@ -1802,7 +1817,7 @@ destroy_address_fifo(
 				break;
 			destroy_address_node(addr_node);
 		}
-		free(pfifo);
+		CFG_FREE(pfifo);
 	}
 }
 
@@ -2247,7 +2262,9 @@ config_access(
 	config_tree *ptree
 	)
 {
+#ifndef HAVE_NTP_SIGND
 	static int		warned_signd;
+#endif
 	attr_val *		my_opt;
 	restrict_node *		my_node;
 	int_node *		curr_flag;
@@ -2261,10 +2278,8 @@ config_access(
 	u_short			flags;
 	u_short			mflags;
 	int			range_err;
+#ifndef HAVE_NTP_SIGND
 	const char *		signd_warning =
-#ifdef HAVE_NTP_SIGND
-	    "MS-SNTP signd operations currently block ntpd degrading service to all clients.";
-#else
 	    "mssntp restrict bit ignored, this ntpd was configured without --enable-ntp-signd.";
 #endif
 
@@ -2457,11 +2472,13 @@ config_access(
 			}
 		}
 
+#ifndef HAVE_NTP_SIGND
 		if ((RES_MSSNTP & flags) && !warned_signd) {
 			warned_signd = 1;
 			fprintf(stderr, "%s\n", signd_warning);
 			msyslog(LOG_WARNING, "%s", signd_warning);
 		}
+#endif
 
 		/* It would be swell if we could identify the line number */
 		if ((RES_KOD & flags) && !(RES_LIMITED & flags)) {
@@ -2917,9 +2934,9 @@ free_config_nic_rules(
 			if (NULL == curr_node)
 				break;
 			free(curr_node->if_name);
-			free(curr_node);
+			CFG_FREE(curr_node);
 		}
-		free(ptree->nic_rules);
+		CFG_FREE(ptree->nic_rules);
 		ptree->nic_rules = NULL;
 	}
 }
@@ -3578,6 +3595,22 @@ config_vars(
 					curr_var->value.s);
 			break;
 
+		case T_Controlsocket:
+			/* see config_ctlsock() */
+			break;
+
+		case T_Xdp:
+			/* see config_xdp() */
+			break;
+
+		case T_Publish:
+			shstate_config(SHSTATE_PUBLISH, curr_var->value.i);
+			break;
+
+		case T_Serve:
+			shstate_config(SHSTATE_SERVE, curr_var->value.i);
+			break;
+
 		case T_Saveconfigdir:
 			if (saveconfigdir != NULL)
 				free(saveconfigdir);
@@ -3616,6 +3649,46 @@ config_vars(
 }
 
 
+/*
+ * config_ctlsock - open the control socket
+ *
+ * This has to wait until io_open_sockets() has set up the I/O loop's
+ * descriptors.
+ */
+static void
+config_ctlsock(
+	config_tree *ptree
+	)
+{
+	attr_val *curr_var;
+
+	curr_var = HEAD_PFIFO(ptree->vars);
+	for (; curr_var != NULL; curr_var = curr_var->link)
+		if (T_Controlsocket == curr_var->attr)
+			ctlsock_open(curr_var->value.s);
+}
+
+
+/*
+ * config_xdp - answer client requests on an interface through AF_XDP
+ *
+ * Like the control socket this waits for io_open_sockets(), and the
+ * endpoints the requests are matched to.
+ */
+static void
+config_xdp(
+	config_tree *ptree
+	)
+{
+	attr_val *curr_var;
+
+	curr_var = HEAD_PFIFO(ptree->vars);
+	for (; curr_var != NULL; curr_var = curr_var->link)
+		if (T_Xdp == curr_var->attr)
+			xdp_open(curr_var->value.s);
+}
+
+
 #ifdef FREE_CFG_T
 static void
 free_config_vars(
@@ -3995,9 +4068,9 @@ free_config_peers(
 				break;
 			destroy_address_node(curr_peer->addr);
 			destroy_attr_val_fifo(curr_peer->peerflags);
-			free(curr_peer);
+			CFG_FREE(curr_peer);
 		}
-		free(ptree->peers);
+		CFG_FREE(ptree->peers);
 		ptree->peers = NULL;
 	}
 }
@@ -4156,9 +4229,9 @@ free_config_unpeers(
 			if (NULL == curr_unpeer)
 				break;
 			destroy_address_node(curr_unpeer->addr);
-			free(curr_unpeer);
+			CFG_FREE(curr_unpeer);
 		}
-		free(ptree->unpeers);
+		CFG_FREE(ptree->unpeers);
 	}
 }
 #endif	/* FREE_CFG_T */
@@ -4211,6 +4284,21 @@ config_reset_counters(
 		}
 	}
 }
+
+
+/*
+ * config_ctl_changed - a configuration pass may have changed any of
+ * the variables ntpq reads, so drop ntp_control's cached responses.
+ */
+static void
+config_ctl_changed(void)
+{
+	struct peer *p;
+
+	ctl_sys_changed();
+	for (p = peer_list; p != NULL; p = p->p_link)
+		ctl_peer_changed(p);
+}
 #endif	/* !SIM */
 
 
@@ -4311,7 +4399,7 @@ free_config_sim(
 	if (NULL == ptree->sim_details)
 		return;
 	sim_n = HEAD_PFIFO(ptree->sim_details);
-	free(ptree->sim_details);
+	CFG_FREE(ptree->sim_details);
 	ptree->sim_details = NULL;
 	if (NULL == sim_n)
 		return;
@@ -4330,7 +4418,7 @@ free_config_sim(
 					break;
 				free(script_n);
 			}
-			free(serv_n->script);
+			CFG_FREE(serv_n->script);
 		}
 		free(serv_n);
 	}
@@ -4368,12 +4456,15 @@ config_ntpd(
 	config_vars(ptree);
 
 	io_open_sockets();
+	config_ctlsock(ptree);
+	config_xdp(ptree);
 
 	config_other_modes(ptree);
 	config_peers(ptree);
 	config_unpeers(ptree);
 	config_fudge(ptree);
 	config_reset_counters(ptree);
+	config_ctl_changed();
 
 #ifdef TEST_BLOCKING_WORKER
 	{
@@ -4557,7 +4648,7 @@ save_and_apply_config_tree(int/*BOOL*/ input_from_file)
 	 * a list that can be used to dump the configuration back to
 	 * a text file.
 	 */
-	ptree = emalloc(sizeof(*ptree));
+	ptree = CFG_ALLOC(ptree);
 	memcpy(ptree, &cfgt, sizeof(*ptree));
 	ZERO(cfgt);
 
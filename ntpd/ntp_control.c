@@ -48,6 +48,8 @@ struct ctl_proc {
 	void (*handler) (struct recvbuf *, int); /* handle request */
 };
 
+typedef struct ctl_cache_tag ctl_cache;	/* see sys_cache below */
+
 
 /*
  * Request processing routines
@@ -57,6 +59,7 @@ static	void	ctl_error	(u_char);
 static	u_short ctlclkstatus	(struct refclockstat *);
 #endif
 static	void	ctl_flushpkt	(u_char);
+static	void	ctl_flushstream	(size_t, u_char);
 static	void	ctl_putdata	(const char *, unsigned int, int);
 static	void	ctl_putstr	(const char *, const char *, size_t);
 static	void	ctl_putdblf	(const char *, int, int, double);
@@ -84,14 +87,21 @@ static	const struct ctl_var *ctl_getitem(const struct ctl_var *,
 static	u_short	count_var	(const struct ctl_var *);
 static	void	control_unspec	(struct recvbuf *, int);
 static	void	read_status	(struct recvbuf *, int);
+static	void	ctl_capture_item(const char *, size_t, int);
+static	int	ctl_render	(ctl_cache *, const u_char *,
+				 const u_char *, struct peer *);
+static	void	ctl_putcache	(const ctl_cache *, struct peer *);
 static	void	read_sysvars	(void);
 static	void	read_peervars	(void);
 static	void	read_variables	(struct recvbuf *, int);
+static	int	assoc_cmp	(const void *, const void *);
+static	void	read_peers	(struct recvbuf *, int);
 static	void	write_variables (struct recvbuf *, int);
 static	void	read_clockstatus(struct recvbuf *, int);
 static	void	write_clockstatus(struct recvbuf *, int);
 static	void	set_trap	(struct recvbuf *, int);
 static	void	save_config	(struct recvbuf *, int);
+static	void	packet_trace	(struct recvbuf *, int);
 static	void	configure	(struct recvbuf *, int);
 static	void	send_mru_entry	(mon_entry *, int);
 static	void	send_random_tag_value(int);
@@ -127,6 +137,8 @@ static const struct ctl_proc control_codes[] = {
 	{ CTL_OP_READ_MRU,		NOAUTH,	read_mru_list },
 	{ CTL_OP_READ_ORDLIST_A,	AUTH,	read_ordlist },
 	{ CTL_OP_REQ_NONCE,		NOAUTH,	req_nonce },
+	{ CTL_OP_READ_PEERS,		NOAUTH,	read_peers },
+	{ CTL_OP_TRACE,			AUTH,	packet_trace },
 	{ CTL_OP_UNSETTRAP,		NOAUTH,	unset_trap },
 	{ NO_REQUEST,			0,	NULL }
 };
@@ -227,7 +239,24 @@ static const struct ctl_proc control_codes[] = {
 #define	CS_WANDER_THRESH	89
 #define	CS_LEAPSMEARINTV	90
 #define	CS_LEAPSMEAROFFS	91
-#define	CS_MAX_NOAUTOKEY	CS_LEAPSMEAROFFS
+#define	CS_MEM_TOTAL		92
+/* CS_MEM_MRU through CS_MEM_CONFIG_ALLOCS follow mem_tag order */
+#define	CS_MEM_MRU		93
+#define	CS_MEM_PEER		94
+#define	CS_MEM_RESTRICT		95
+#define	CS_MEM_RECVBUF		96
+#define	CS_MEM_CONFIG		97
+#define	CS_MEM_MRU_PEAK		98
+#define	CS_MEM_PEER_PEAK	99
+#define	CS_MEM_RESTRICT_PEAK	100
+#define	CS_MEM_RECVBUF_PEAK	101
+#define	CS_MEM_CONFIG_PEAK	102
+#define	CS_MEM_MRU_ALLOCS	103
+#define	CS_MEM_PEER_ALLOCS	104
+#define	CS_MEM_RESTRICT_ALLOCS	105
+#define	CS_MEM_RECVBUF_ALLOCS	106
+#define	CS_MEM_CONFIG_ALLOCS	107
+#define	CS_MAX_NOAUTOKEY	CS_MEM_CONFIG_ALLOCS
 #ifdef AUTOKEY
 #define	CS_FLAGS		(1 + CS_MAX_NOAUTOKEY)
 #define	CS_HOST			(2 + CS_MAX_NOAUTOKEY)
@@ -426,6 +455,22 @@ static const struct ctl_var sys_var[] = {
 
 	{ CS_LEAPSMEARINTV,	RO, "leapsmearinterval" },    /* 90 */
 	{ CS_LEAPSMEAROFFS,	RO, "leapsmearoffset" },      /* 91 */
+	{ CS_MEM_TOTAL,		RO, "mem_total" },	/* 92 */
+	{ CS_MEM_MRU,		RO, "mem_mru" },	/* 93 */
+	{ CS_MEM_PEER,		RO, "mem_peer" },	/* 94 */
+	{ CS_MEM_RESTRICT,	RO, "mem_restrict" },	/* 95 */
+	{ CS_MEM_RECVBUF,	RO, "mem_recvbuf" },	/* 96 */
+	{ CS_MEM_CONFIG,	RO, "mem_config" },	/* 97 */
+	{ CS_MEM_MRU_PEAK,	RO, "mem_mru_peak" },	/* 98 */
+	{ CS_MEM_PEER_PEAK,	RO, "mem_peer_peak" },	/* 99 */
+	{ CS_MEM_RESTRICT_PEAK,	RO, "mem_restrict_peak" }, /* 100 */
+	{ CS_MEM_RECVBUF_PEAK,	RO, "mem_recvbuf_peak" }, /* 101 */
+	{ CS_MEM_CONFIG_PEAK,	RO, "mem_config_peak" }, /* 102 */
+	{ CS_MEM_MRU_ALLOCS,	RO, "mem_mru_allocs" },	/* 103 */
+	{ CS_MEM_PEER_ALLOCS,	RO, "mem_peer_allocs" }, /* 104 */
+	{ CS_MEM_RESTRICT_ALLOCS, RO, "mem_restrict_allocs" }, /* 105 */
+	{ CS_MEM_RECVBUF_ALLOCS, RO, "mem_recvbuf_allocs" }, /* 106 */
+	{ CS_MEM_CONFIG_ALLOCS,	RO, "mem_config_allocs" }, /* 107 */
 
 #ifdef AUTOKEY
 	{ CS_FLAGS,	RO, "flags" },		/* 1 + CS_MAX_NOAUTOKEY */
@@ -803,10 +848,72 @@ static u_char	res_authenticate;
 static u_char	res_authokay;
 static keyid_t	res_keyid;
 
+/*
+ * A request from the control socket is answered with one message on
+ * the stream instead of datagrams.  The fragments ctl_flushpkt() would
+ * send are collected in res_sbuf behind room for the length prefix and
+ * the header, and handed to ctlsock_send() when the response is done.
+ */
+static struct ctlsock_conn *res_stream;	/* NULL for datagrams */
+static u_char *	res_sbuf;
+static size_t	res_slen;		/* bytes in use, with prefix */
+static size_t	res_ssize;		/* bytes allocated */
+#define CTL_STREAM_HDR	(sizeof(u_int32) + CTL_HEADER_LEN)
+
 #define MAXDATALINELEN	(72)
 
 static u_char	res_async;	/* sending async trap response? */
 
+/*
+ * Rendered default variable sets.  A readvar without a variable list
+ * keeps the items ctl_putsys() or ctl_putpeer() put into the response,
+ * and the same request is answered from them for as long as the
+ * variables keep the stamp they had.  ctl_sys_changed() and
+ * ctl_peer_changed() hand out a new stamp whenever ntpd changes them.
+ * The few variables which change on their own, like the clock, are
+ * kept by code and put afresh each time.
+ */
+#define CTL_CACHE_ITEMS		96
+#define CTL_CACHE_TEXT		(4 * CTL_MAX_DATA_LEN)
+#define CTL_PEER_CACHES		16	/* direct mapped by associd */
+
+struct ctl_cache_tag {
+	int		valid;
+	u_long		stamp;		/* of the variables rendered */
+	associd_t	associd;	/* 0 for the system variables */
+	u_short		items;
+	u_short		len[CTL_CACHE_ITEMS];	/* item lengths */
+	u_char		live[CTL_CACHE_ITEMS];	/* code to put afresh */
+	size_t		used;		/* bytes of text in use */
+	char		text[CTL_CACHE_TEXT];
+};
+
+static u_long		ctl_stamp;	/* last stamp handed out */
+static u_long		ctl_sys_stamp;	/* of the system variables */
+static ctl_cache	sys_cache;
+static ctl_cache	peer_cache[CTL_PEER_CACHES];
+static ctl_cache *	ctl_capture;	/* ctl_putdata() fills this */
+
+/* default variables which are always put afresh */
+static const u_char live_sys_var[] = {
+	CS_CLOCK,
+	CS_LEAPSMEAROFFS,
+	0
+};
+
+static const u_char live_peer_var[] = {
+	CP_RATE,
+	0
+};
+
+/* read_peers() renders into this to size an association */
+static const u_char no_live_var[] = { 0 };
+static ctl_cache	peers_cache;
+
+/* octets for assid= and status= and for next= in read_peers() */
+#define READ_PEERS_ASSOC_ROOM	32
+#define READ_PEERS_NEXT_ROOM	24
+
 /*
  * Pointers for saving state when decoding request packets
  */
@@ -866,7 +973,11 @@ ctl_error(
 	/*
 	 * send packet and bump counters
 	 */
-	if (res_authenticate && sys_authenticate) {
+	if (res_stream != NULL) {
+		/* drop what was put so far, the error replaces it */
+		res_slen = CTL_STREAM_HDR;
+		ctl_flushstream(0, 0);
+	} else if (res_authenticate && sys_authenticate) {
 		maclen = authencrypt(res_keyid, (u_int32 *)&rpkt,
 				     CTL_HEADER_LEN);
 		sendpkt(rmt_addr, lcl_inter, -2, (void *)&rpkt,
@@ -1000,7 +1111,7 @@ save_config(
 			msyslog(LOG_NOTICE,
 				"saveconfig from %s rejected due to nomodify restriction",
 				stoa(&rbufp->recv_srcadr));
-		sys_restricted++;
+		CTR_INC(CTR_SYS_RESTRICTED);
 		return;
 	}
 
@@ -1234,6 +1345,7 @@ process_control(
 	datasent = 0;
 	datapt = rpkt.u.data;
 	dataend = &rpkt.u.data[CTL_MAX_DATA_LEN];
+	res_slen = CTL_STREAM_HDR;
 
 	if ((rbufp->recv_length & 0x3) != 0)
 		DPRINTF(3, ("Control packet length %d unrounded\n",
@@ -1255,7 +1367,7 @@ process_control(
 
 	properlen = (properlen + 7) & ~7;
 	maclen = rbufp->recv_length - properlen;
-	if ((rbufp->recv_length & 3) == 0 &&
+	if (NULL == res_stream && (rbufp->recv_length & 3) == 0 &&
 	    maclen >= MIN_MAC_LEN && maclen <= MAX_MAC_LEN &&
 	    sys_authenticate) {
 		res_authenticate = TRUE;
@@ -1291,12 +1403,24 @@ process_control(
 		if (cc->control_code == res_opcode) {
 			DPRINTF(3, ("opcode %d, found command handler\n",
 				    res_opcode));
-			if (cc->flags == AUTH
+			/*
+			 * The control socket is authorized by its
+			 * permissions and cannot take traps, which are
+			 * sent to a datagram address.
+			 */
+			if (cc->flags == AUTH && NULL == res_stream
 			    && (!res_authokay
 				|| res_keyid != ctl_auth_keyid)) {
 				ctl_error(CERR_PERMISSION);
 				return;
 			}
+			if (res_stream != NULL
+			    && (CTL_OP_SETTRAP == res_opcode
+				|| CTL_OP_UNSETTRAP == res_opcode)) {
+				numctlbadop++;
+				ctl_error(CERR_BADOP);
+				return;
+			}
 			(cc->handler)(rbufp, restrict_mask);
 			return;
 		}
@@ -1311,6 +1435,22 @@ process_control(
 }
 
 
+/*
+ * process_control_stream - process a control message from the control
+ * socket and send the response back on the connection it came from.
+ */
+void
+process_control_stream(
+	struct recvbuf *	rbufp,
+	struct ctlsock_conn *	conn
+	)
+{
+	res_stream = conn;
+	process_control(rbufp, 0);
+	res_stream = NULL;
+}
+
+
 /*
  * ctlpeerstatus - return a status word for this peer
  */
@@ -1401,6 +1541,14 @@ ctl_flushpkt(
 		*datapt++ = '\n';
 		dlen += 2;
 	}
+	if (res_stream != NULL && !res_async) {
+		rpkt.r_m_e_op = CTL_RESPONSE | (res_opcode & CTL_OP_MASK);
+		ctl_flushstream(dlen, more);
+		res_frags++;
+		res_offset += dlen;
+		datapt = rpkt.u.data;
+		return;
+	}
 	sendlen = dlen + CTL_HEADER_LEN;
 
 	/*
@@ -1473,6 +1621,46 @@ ctl_flushpkt(
 }
 
 
+/*
+ * ctl_flushstream - add the data of the current packet to the stream
+ *		     response, and send the response if it is complete.
+ *
+ * The response is one message with the usual header, and the data of
+ * all fragments following it unpadded.  The length prefix gives the
+ * size of the data, so count only holds it when it fits.
+ */
+static void
+ctl_flushstream(
+	size_t	dlen,
+	u_char	more
+	)
+{
+	size_t	total;
+	u_int32	netlen;
+
+	if (res_slen + dlen > res_ssize) {
+		res_ssize = max(res_slen + dlen,
+				max(2 * res_ssize, 16 * CTL_MAX_DATA_LEN));
+		res_sbuf = erealloc(res_sbuf, res_ssize);
+	}
+	memcpy(res_sbuf + res_slen, rpkt.u.data, dlen);
+	res_slen += dlen;
+	if (more)
+		return;
+
+	total = res_slen - CTL_STREAM_HDR;
+	rpkt.count = htons((u_short)min(total, 0xffff));
+	rpkt.offset = 0;
+	netlen = htonl((u_int32)(res_slen - sizeof(netlen)));
+	memcpy(res_sbuf, &netlen, sizeof(netlen));
+	memcpy(res_sbuf + sizeof(netlen), &rpkt, CTL_HEADER_LEN);
+	ctlsock_send(res_stream, res_sbuf, res_slen);
+	if (!(CTL_ERROR & rpkt.r_m_e_op))
+		numctlresponses++;
+	res_slen = CTL_STREAM_HDR;
+}
+
+
 /*
  * ctl_putdata - write data into the packet, fragmenting and starting
  * another if this one is full.
@@ -1487,6 +1675,11 @@ ctl_putdata(
 	int overhead;
 	unsigned int currentlen;
 
+	if (ctl_capture != NULL && !bin) {
+		ctl_capture_item(dp, dlen, 0);
+		return;
+	}
+
 	overhead = 0;
 	if (!bin) {
 		datanotbinflag = TRUE;
@@ -2225,7 +2418,8 @@ ctl_putsys(
 		break;
 
 	case CS_SS_RECEIVED:
-		ctl_putuint(sys_var[varid].text, sys_received);
+		ctl_putuint(sys_var[varid].text,
+			    ctr_read(CTR_SYS_RECEIVED));
 		break;
 
 	case CS_SS_THISVER:
@@ -2249,7 +2443,8 @@ ctl_putsys(
 		break;
 
 	case CS_SS_RESTRICTED:
-		ctl_putuint(sys_var[varid].text, sys_restricted);
+		ctl_putuint(sys_var[varid].text,
+			    ctr_read(CTR_SYS_RESTRICTED));
 		break;
 
 	case CS_SS_LIMITED:
@@ -2261,7 +2456,8 @@ ctl_putsys(
 		break;
 
 	case CS_SS_PROCESSED:
-		ctl_putuint(sys_var[varid].text, sys_processed);
+		ctl_putuint(sys_var[varid].text,
+			    ctr_read(CTR_SYS_PROCESSED));
 		break;
 
 	case CS_BCASTDELAY:
@@ -2485,11 +2681,13 @@ ctl_putsys(
 		break;
 
 	case CS_IO_RECEIVED:
-		ctl_putuint(sys_var[varid].text, packets_received);
+		ctl_putuint(sys_var[varid].text,
+			    ctr_read(CTR_PACKETS_RECEIVED));
 		break;
 
 	case CS_IO_SENT:
-		ctl_putuint(sys_var[varid].text, packets_sent);
+		ctl_putuint(sys_var[varid].text,
+			    ctr_read(CTR_PACKETS_SENT));
 		break;
 
 	case CS_IO_SENDFAILED:
@@ -2501,7 +2699,8 @@ ctl_putsys(
 		break;
 
 	case CS_IO_GOODWAKEUPS:
-		ctl_putuint(sys_var[varid].text, handler_pkts);
+		ctl_putuint(sys_var[varid].text,
+			    ctr_read(CTR_HANDLER_PKTS));
 		break;
 
 	case CS_TIMERSTATS_RESET:
@@ -2523,6 +2722,37 @@ ctl_putsys(
 	case CS_WANDER_THRESH:
 		ctl_putdbl(sys_var[varid].text, wander_threshold * 1e6);
 		break;
+
+	case CS_MEM_TOTAL:
+		ctl_putuint(sys_var[varid].text, mem_total());
+		break;
+
+	case CS_MEM_MRU:
+	case CS_MEM_PEER:
+	case CS_MEM_RESTRICT:
+	case CS_MEM_RECVBUF:
+	case CS_MEM_CONFIG:
+		ctl_putuint(sys_var[varid].text,
+			    mem_tag_stats[varid - CS_MEM_MRU].bytes);
+		break;
+
+	case CS_MEM_MRU_PEAK:
+	case CS_MEM_PEER_PEAK:
+	case CS_MEM_RESTRICT_PEAK:
+	case CS_MEM_RECVBUF_PEAK:
+	case CS_MEM_CONFIG_PEAK:
+		ctl_putuint(sys_var[varid].text,
+			    mem_tag_stats[varid - CS_MEM_MRU_PEAK].peak);
+		break;
+
+	case CS_MEM_MRU_ALLOCS:
+	case CS_MEM_PEER_ALLOCS:
+	case CS_MEM_RESTRICT_ALLOCS:
+	case CS_MEM_RECVBUF_ALLOCS:
+	case CS_MEM_CONFIG_ALLOCS:
+		ctl_putuint(sys_var[varid].text,
+			    mem_tag_stats[varid - CS_MEM_MRU_ALLOCS].allocs);
+		break;
 #ifdef AUTOKEY
 	case CS_FLAGS:
 		if (crypto_flags)
@@ -3253,6 +3483,125 @@ read_status(
 }
 
 
+/*
+ * ctl_sys_changed - note that system variables have changed, so the
+ *		     rendered default set is not used again.
+ */
+void
+ctl_sys_changed(void)
+{
+	ctl_sys_stamp = ++ctl_stamp;
+}
+
+
+/*
+ * ctl_peer_changed - the same for the variables of one association
+ */
+void
+ctl_peer_changed(
+	struct peer *	p
+	)
+{
+	p->ctl_stamp = ++ctl_stamp;
+}
+
+
+/*
+ * ctl_capture_item - add an item, or the code of a variable to put
+ *		      afresh, to the set being rendered.  A set that
+ *		      does not fit is not kept.
+ */
+static void
+ctl_capture_item(
+	const char *	dp,
+	size_t		dlen,
+	int		live
+	)
+{
+	ctl_cache *	c;
+
+	c = ctl_capture;
+	if (!c->valid)
+		return;
+	if (c->items >= COUNTOF(c->len) ||
+	    dlen > sizeof(c->text) - c->used) {
+		c->valid = FALSE;
+		return;
+	}
+	if (dlen > 0)
+		memcpy(c->text + c->used, dp, dlen);
+	c->used += dlen;
+	c->len[c->items] = (u_short)dlen;
+	c->live[c->items] = (u_char)live;
+	c->items++;
+}
+
+
+/*
+ * ctl_render - render the variables in codes[] into a cache.  Returns
+ *		FALSE if they did not fit.
+ */
+static int
+ctl_render(
+	ctl_cache *	c,
+	const u_char *	codes,
+	const u_char *	live,
+	struct peer *	p
+	)
+{
+	const u_char *	cp;
+	struct ctl_var *kv;
+
+	c->valid = TRUE;
+	c->items = 0;
+	c->used = 0;
+	ctl_capture = c;
+	for (; *codes != 0; codes++) {
+		for (cp = live; *cp != 0 && *cp != *codes; cp++)
+			/* do nothing */;
+		if (*cp != 0)
+			ctl_capture_item(NULL, 0, *codes);
+		else if (p != NULL)
+			ctl_putpeer((int)*codes, p);
+		else
+			ctl_putsys((int)*codes);
+	}
+	if (NULL == p)
+		for (kv = ext_sys_var; kv && !(EOV & kv->flags); kv++)
+			if (DEF & kv->flags)
+				ctl_putdata(kv->text, strlen(kv->text),
+					    0);
+	ctl_capture = NULL;
+
+	return c->valid;
+}
+
+
+/*
+ * ctl_putcache - put a rendered set into the response
+ */
+static void
+ctl_putcache(
+	const ctl_cache *	c,
+	struct peer *		p
+	)
+{
+	const char *	dp;
+	u_int		i;
+
+	dp = c->text;
+	for (i = 0; i < c->items; i++) {
+		if (c->live[i] && p != NULL)
+			ctl_putpeer(c->live[i], p);
+		else if (c->live[i])
+			ctl_putsys(c->live[i]);
+		else
+			ctl_putdata(dp, c->len[i], 0);
+		dp += c->len[i];
+	}
+}
+
+
 /*
  * read_peervars - half of read_variables() implementation
  */
@@ -3262,6 +3611,7 @@ read_peervars(void)
 	const struct ctl_var *v;
 	struct peer *peer;
 	const u_char *cp;
+	ctl_cache *c;
 	size_t i;
 	char *	valuep;
 	u_char	wants[CP_MAXCODE + 1];
@@ -3294,9 +3644,20 @@ read_peervars(void)
 		for (i = 1; i < COUNTOF(wants); i++)
 			if (wants[i])
 				ctl_putpeer(i, peer);
-	} else
-		for (cp = def_peer_var; *cp != 0; cp++)
-			ctl_putpeer((int)*cp, peer);
+	} else {
+		c = &peer_cache[peer->associd % COUNTOF(peer_cache)];
+		if (!c->valid || c->associd != peer->associd ||
+		    c->stamp != peer->ctl_stamp) {
+			c->associd = peer->associd;
+			c->stamp = peer->ctl_stamp;
+			ctl_render(c, def_peer_var, live_peer_var, peer);
+		}
+		if (c->valid)
+			ctl_putcache(c, peer);
+		else
+			for (cp = def_peer_var; *cp != 0; cp++)
+				ctl_putpeer((int)*cp, peer);
+	}
 	ctl_flushpkt(0);
 }
 
@@ -3355,13 +3716,20 @@ read_sysvars(void)
 				pch = ext_sys_var[n].text;
 				ctl_putdata(pch, strlen(pch), 0);
 			}
+	} else if (sys_cache.valid && sys_cache.stamp == ctl_sys_stamp) {
+		ctl_putcache(&sys_cache, NULL);
 	} else {
-		for (cs = def_sys_var; *cs != 0; cs++)
-			ctl_putsys((int)*cs);
-		for (kv = ext_sys_var; kv && !(EOV & kv->flags); kv++)
-			if (DEF & kv->flags)
-				ctl_putdata(kv->text, strlen(kv->text),
-					    0);
+		sys_cache.stamp = ctl_sys_stamp;
+		if (ctl_render(&sys_cache, def_sys_var, live_sys_var, NULL)) {
+			ctl_putcache(&sys_cache, NULL);
+		} else {
+			for (cs = def_sys_var; *cs != 0; cs++)
+				ctl_putsys((int)*cs);
+			for (kv = ext_sys_var; kv && !(EOV & kv->flags); kv++)
+				if (DEF & kv->flags)
+					ctl_putdata(kv->text,
+						    strlen(kv->text), 0);
+		}
 	}
 	free(wants);
 	ctl_flushpkt(0);
@@ -3385,6 +3753,333 @@ read_variables(
 }
 
 
+/*
+ * assoc_cmp - qsort() helper for read_peers(), by association ID
+ */
+static int
+assoc_cmp(
+	const void *	v1,
+	const void *	v2
+	)
+{
+	const struct peer * const *	pp1 = v1;
+	const struct peer * const *	pp2 = v2;
+
+	if ((*pp1)->associd < (*pp2)->associd)
+		return -1;
+	return (*pp1)->associd > (*pp2)->associd;
+}
+
+
+/*
+ * read_peers - CTL_OP_READ_PEERS for ntpq -c peers and friends.
+ *
+ * Returns peer variables for a range of associations in one
+ * multi-datagram response, saving a readvar round trip for each.
+ * The request data is a list of peer variable names, as for readvar,
+ * mixed with these optional parameters:
+ *
+ *	nonce=	as from CTL_OP_REQ_NONCE, needed for more than one
+ *		datagram unless the request is authenticated or comes
+ *		over the control socket
+ *	first=	lowest association ID to return (default 0)
+ *	last=	highest association ID to return (default all)
+ *	frags=	limit on datagrams in the response (default and max
+ *		READ_PEERS_FRAGS_LIMIT, none on the control socket)
+ *
+ * A small request for a large response is a reflection tool, so a
+ * request that is neither authenticated nor on the control socket gets
+ * one datagram back without a nonce, none with a nonce that does not
+ * validate and up to frags= datagrams with a valid one.
+ *
+ * Associations are sent in ascending association ID order, each one
+ * introduced by assid= and status= followed by the requested (or
+ * default) peer variables.  If the datagram limit is reached before
+ * the range is exhausted, the response ends with next= giving the
+ * association ID to use as first= in the following request.
+ */
+static void
+read_peers(
+	struct recvbuf *rbufp,
+	int restrict_mask
+	)
+{
+	const char		nonce_text[] =	"nonce";
+	const char		first_text[] =	"first";
+	const char		last_text[] =	"last";
+	const char		frags_text[] =	"frags";
+	struct ctl_var *	in_parms;
+	const struct ctl_var *	v;
+	const struct ctl_var *	pv;
+	struct peer **		sorted;
+	struct peer *		peer;
+	char *			val;
+	char *			pnonce;
+	int			nonce_valid;
+	const u_char *		cp;
+	u_char			wants[CP_MAXCODE + 1];
+	u_char			codes[CP_MAXCODE + 1];
+	u_int			gotvar;
+	u_int			first;
+	u_int			last;
+	u_short			frags;
+	int			fits;
+	size_t			room;
+	size_t			need;
+	size_t			count;
+	size_t			n;
+	size_t			i;
+
+	/*
+	 * fill in_parms var list with the parameters and the names of
+	 * all peer variables.
+	 */
+	in_parms = NULL;
+	set_var(&in_parms, nonce_text, sizeof(nonce_text), 0);
+	set_var(&in_parms, first_text, sizeof(first_text), 0);
+	set_var(&in_parms, last_text, sizeof(last_text), 0);
+	set_var(&in_parms, frags_text, sizeof(frags_text), 0);
+	for (pv = peer_var; !(EOV & pv->flags); pv++)
+		if (!(PADDING & pv->flags))
+			set_var(&in_parms, pv->text,
+				strlen(pv->text) + 1, 0);
+
+	first = 0;
+	last = ASSOCID_MAX;
+	frags = READ_PEERS_FRAGS_LIMIT;
+	pnonce = NULL;
+	ZERO(wants);
+	gotvar = 0;
+	while (NULL != (v = ctl_getitem(in_parms, &val))) {
+		if (EOV & v->flags) {
+			free_varlist(in_parms);
+			free(pnonce);
+			ctl_error(CERR_UNKNOWNVAR);
+			return;
+		}
+		if (!strcmp(nonce_text, v->text)) {
+			free(pnonce);
+			pnonce = estrdup(val);
+		} else if (!strcmp(first_text, v->text)) {
+			if (1 != sscanf(val, "%u", &first)) {
+				free_varlist(in_parms);
+				free(pnonce);
+				ctl_error(CERR_BADVALUE);
+				return;
+			}
+		} else if (!strcmp(last_text, v->text)) {
+			if (1 != sscanf(val, "%u", &last)) {
+				free_varlist(in_parms);
+				free(pnonce);
+				ctl_error(CERR_BADVALUE);
+				return;
+			}
+		} else if (!strcmp(frags_text, v->text)) {
+			if (1 != sscanf(val, "%hu", &frags) || !frags) {
+				free_varlist(in_parms);
+				free(pnonce);
+				ctl_error(CERR_BADVALUE);
+				return;
+			}
+			frags = min(frags, READ_PEERS_FRAGS_LIMIT);
+		} else {
+			for (pv = peer_var; !(EOV & pv->flags); pv++)
+				if (!(PADDING & pv->flags) &&
+				    !strcmp(pv->text, v->text))
+					break;
+			INSIST(!(EOV & pv->flags));
+			INSIST(pv->code < COUNTOF(wants));
+			wants[pv->code] = 1;
+			gotvar = 1;
+		}
+	}
+	free_varlist(in_parms);
+
+	/*
+	 * Without a nonce return only one datagram, and none at all for
+	 * a nonce that does not validate.  A valid nonce shows the
+	 * source address is not spoofed, so the frags= limit applies
+	 * as for mrulist.
+	 */
+	if (NULL == res_stream && !res_authokay) {
+		if (NULL == pnonce) {
+			frags = 1;
+		} else {
+			nonce_valid = validate_nonce(pnonce, rbufp);
+			free(pnonce);
+			if (!nonce_valid)
+				return;
+		}
+	} else {
+		free(pnonce);
+	}
+
+	/*
+	 * peer_list is in creation order, newest first.  Collect the
+	 * requested range and sort it so the client can resume after
+	 * a partial response.
+	 */
+	count = 0;
+	for (peer = peer_list; peer != NULL; peer = peer->p_link)
+		if (peer->associd >= first && peer->associd <= last)
+			count++;
+	sorted = emalloc(max(count, 1) * sizeof(*sorted));
+	n = 0;
+	for (peer = peer_list; peer != NULL; peer = peer->p_link)
+		if (peer->associd >= first && peer->associd <= last)
+			sorted[n++] = peer;
+	INSIST(n == count);
+	qsort(sorted, count, sizeof(*sorted), assoc_cmp);
+
+	if (gotvar) {
+		n = 0;
+		for (i = 1; i < COUNTOF(wants); i++)
+			if (wants[i])
+				codes[n++] = (u_char)i;
+		codes[n] = 0;
+		cp = codes;
+	} else {
+		cp = def_peer_var;
+	}
+
+	/*
+	 * Render each association before putting it, so that it is
+	 * only started if it fits in the datagrams left.  Each item
+	 * costs at most three octets of separator on top of its text,
+	 * and a datagram leaves three unused.
+	 */
+	rpkt.status = htons(ctlsysstatus());
+	for (n = 0; n < count; n++) {
+		peer = sorted[n];
+		fits = ctl_render(&peers_cache, cp, no_live_var, peer);
+		if (NULL == res_stream) {
+			room = (size_t)(dataend - datapt) +
+			       (size_t)(frags - res_frags) *
+			       (CTL_MAX_DATA_LEN - 3);
+			need = peers_cache.used + 3 * peers_cache.items +
+			       READ_PEERS_ASSOC_ROOM;
+			if (!fits || need + READ_PEERS_NEXT_ROOM > room) {
+				if (0 == n) {
+					/* not even one fits */
+					free(sorted);
+					ctl_error(CERR_BADVALUE);
+					return;
+				}
+				ctl_putuint("next", peer->associd);
+				break;
+			}
+		}
+		if (res_authokay)
+			peer->num_events = 0;
+		ctl_putuint("assid", peer->associd);
+		ctl_puthex("status", ctlpeerstatus(peer));
+		if (fits) {
+			ctl_putcache(&peers_cache, peer);
+		} else {
+			for (i = 0; cp[i] != 0; i++)
+				ctl_putpeer((int)cp[i], peer);
+		}
+	}
+	free(sorted);
+	ctl_flushpkt(0);
+}
+
+
+/*
+ * packet_trace - CTL_OP_TRACE for ntpq -c "trace ..."
+ *
+ * Controls the packet trace of ntp_trace.c.  The request data is one
+ * of
+ *
+ *	start[=records]	start a new trace (default PTRACE_DEFAULT
+ *			records)
+ *	stop		stop the trace
+ *	dump		stop the trace and write it to a file in statsdir
+ *
+ * or nothing, to only read the state.  The response gives trace=on or
+ * off, the ring size in records= and the packets recorded in
+ * recorded=, and after a dump the file name in file=.
+ */
+static void
+packet_trace(
+	struct recvbuf *rbufp,
+	int restrict_mask
+	)
+{
+	const char		start_text[] =	"start";
+	const char		stop_text[] =	"stop";
+	const char		dump_text[] =	"dump";
+	struct ctl_var *	in_parms;
+	const struct ctl_var *	v;
+	char *			val;
+	char			name[MAXFILENAME + 32];
+	u_int			records;
+	u_int			size;
+	u_long			count;
+	int			dumped;
+
+	if (RES_NOMODIFY & restrict_mask) {
+		ctl_printf("%s", "trace prohibited by restrict ... nomodify");
+		ctl_flushpkt(0);
+		NLOG(NLOG_SYSINFO)
+			msyslog(LOG_NOTICE,
+				"trace from %s rejected due to nomodify restriction",
+				stoa(&rbufp->recv_srcadr));
+		CTR_INC(CTR_SYS_RESTRICTED);
+		return;
+	}
+
+	in_parms = NULL;
+	set_var(&in_parms, start_text, sizeof(start_text), 0);
+	set_var(&in_parms, stop_text, sizeof(stop_text), 0);
+	set_var(&in_parms, dump_text, sizeof(dump_text), 0);
+	dumped = FALSE;
+	while (NULL != (v = ctl_getitem(in_parms, &val))) {
+		if (EOV & v->flags) {
+			free_varlist(in_parms);
+			ctl_error(CERR_UNKNOWNVAR);
+			return;
+		}
+		if (!strcmp(start_text, v->text)) {
+			records = 0;
+			if ('\0' != *val
+			    && (1 != sscanf(val, "%u", &records)
+				|| 0 == records)) {
+				free_varlist(in_parms);
+				ctl_error(CERR_BADVALUE);
+				return;
+			}
+			ptrace_start(records);
+		} else if (!strcmp(stop_text, v->text)) {
+			ptrace_stop();
+		} else {
+			ptrace_stop();
+			if (-1 == ptrace_dump(name, sizeof(name))) {
+				free_varlist(in_parms);
+				msyslog(LOG_ERR, "packet trace %s: %m", name);
+				ctl_printf("trace dump to %s failed: %s",
+					   name, strerror(errno));
+				ctl_flushpkt(0);
+				return;
+			}
+			msyslog(LOG_NOTICE, "packet trace written to %s",
+				name);
+			dumped = TRUE;
+		}
+	}
+	free_varlist(in_parms);
+
+	ptrace_status(&size, &count);
+	ctl_putstr("trace", ptrace_on ? "on" : "off",
+		   ptrace_on ? 2 : 3);
+	ctl_putuint("records", size);
+	ctl_putuint("recorded", count);
+	if (dumped)
+		ctl_putstr("file", name, strlen(name));
+	ctl_flushpkt(0);
+}
+
+
 /*
  * write_variables - write into variables. We only allow leap bit
  * writing this way.
@@ -3514,7 +4209,7 @@ static void configure(
 			msyslog(LOG_NOTICE,
 				"runtime config from %s rejected due to nomodify restriction",
 				stoa(&rbufp->recv_srcadr));
-		sys_restricted++;
+		CTR_INC(CTR_SYS_RESTRICTED);
 		return;
 	}
 
@@ -3958,7 +4653,7 @@ static void read_mru_list(
 			msyslog(LOG_NOTICE,
 				"mrulist from %s rejected due to nomrulist restriction",
 				stoa(&rbufp->recv_srcadr));
-		sys_restricted++;
+		CTR_INC(CTR_SYS_RESTRICTED);
 		return;
 	}
 	/*
@@ -4038,28 +4733,39 @@ static void read_mru_list(
 	free_varlist(in_parms);
 	in_parms = NULL;
 
-	/* return no responses until the nonce is validated */
-	if (NULL == pnonce)
-		return;
+	/*
+	 * Return no responses until the nonce is validated.  The
+	 * control socket needs none, nor a limit: its response is
+	 * not cut into datagrams, so frags= is ignored and the whole
+	 * list goes out at once unless limit= asks for less.
+	 */
+	if (res_stream != NULL) {
+		free(pnonce);
+		if (0 == limit)
+			limit = UINT_MAX;
+	} else {
+		if (NULL == pnonce)
+			return;
 
-	nonce_valid = validate_nonce(pnonce, rbufp);
-	free(pnonce);
-	if (!nonce_valid)
-		return;
+		nonce_valid = validate_nonce(pnonce, rbufp);
+		free(pnonce);
+		if (!nonce_valid)
+			return;
 
-	if ((0 == frags && !(0 < limit && limit <= MRU_ROW_LIMIT)) ||
-	    frags > MRU_FRAGS_LIMIT) {
-		ctl_error(CERR_BADVALUE);
-		return;
-	}
+		if ((0 == frags && !(0 < limit && limit <= MRU_ROW_LIMIT)) ||
+		    frags > MRU_FRAGS_LIMIT) {
+			ctl_error(CERR_BADVALUE);
+			return;
+		}
 
-	/*
-	 * If either frags or limit is not given, use the max.
-	 */
-	if (0 != frags && 0 == limit)
-		limit = UINT_MAX;
-	else if (0 != limit && 0 == frags)
-		frags = MRU_FRAGS_LIMIT;
+		/*
+		 * If either frags or limit is not given, use the max.
+		 */
+		if (0 != frags && 0 == limit)
+			limit = UINT_MAX;
+		else if (0 != limit && 0 == frags)
+			frags = MRU_FRAGS_LIMIT;
+	}
 
 	/*
 	 * Find the starting point if one was provided.
@@ -4111,7 +4817,8 @@ static void read_mru_list(
 	ctl_putunqstr("nonce", buf, strlen(buf));
 	prior_mon = NULL;
 	for (count = 0;
-	     mon != NULL && res_frags < frags && count < limit;
+	     mon != NULL && (res_stream != NULL || res_frags < frags)
+		 && count < limit;
 	     mon = PREV_DLIST(mon_mru_list, mon, mru)) {
 
 		if (mon->count < mincount)
@@ -4243,12 +4950,12 @@ send_ifstats_entry(
 
 		case 7:
 			snprintf(tag, sizeof(tag), rx_fmt, ifnum);
-			ctl_putint(tag, la->received);
+			ctl_putuint(tag, ctr_obj_read(&la->received));
 			break;
 
 		case 8:
 			snprintf(tag, sizeof(tag), tx_fmt, ifnum);
-			ctl_putint(tag, la->sent);
+			ctl_putuint(tag, ctr_obj_read(&la->sent));
 			break;
 
 		case 9:
@@ -4392,7 +5099,7 @@ send_restrict_entry(
 
 		case 2:
 			snprintf(tag, sizeof(tag), hits_fmt, idx);
-			ctl_putuint(tag, pres->count);
+			ctl_putuint(tag, ctr_obj_read(&pres->count));
 			break;
 
 		case 3:
@@ -5163,6 +5870,7 @@ set_sys_var(
 	)
 {
 	set_var(&ext_sys_var, data, size, def);
+	ctl_sys_changed();
 }
 
 
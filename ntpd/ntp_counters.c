@@ -0,0 +1,108 @@
+/*
+ * ntp_counters.c - per thread shards of the packet counters
+ *
+ * See ntp_counters.h.
+ */
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include "ntp_types.h"
+#include "ntp_counters.h"
+
+#if !defined(SYS_WINNT) && defined(HAVE_STDATOMIC_H)
+# include <stdatomic.h>
+#endif
+
+ctr_shard	ctr_shards[CTR_SHARDS];
+
+#ifdef NTP_THREAD_LOCAL
+NTP_THREAD_LOCAL u_int ctr_self;	/* 0 until ctr_thread_init() */
+
+# if defined(SYS_WINNT)
+static LONG		ctr_claimed;	/* shards taken by other threads */
+# elif defined(HAVE_STDATOMIC_H)
+static atomic_uint	ctr_claimed;
+# else
+static u_int		ctr_claimed;
+# endif
+#endif
+
+
+/*
+ * ctr_thread_init - give the calling thread a shard of its own
+ *
+ * Threads beyond the first CTR_SHARDS - 1 share the shards of the
+ * others, not that of the main thread, and may lose an increment now
+ * and then.  Without atomic operations threads must not call this at
+ * the same time.
+ */
+void
+ctr_thread_init(void)
+{
+#ifdef NTP_THREAD_LOCAL
+	u_int	n;
+
+# if defined(SYS_WINNT)
+	n = (u_int)InterlockedIncrement(&ctr_claimed) - 1;
+# elif defined(HAVE_STDATOMIC_H)
+	n = atomic_fetch_add(&ctr_claimed, 1);
+# else
+	n = ctr_claimed++;
+# endif
+	ctr_self = 1 + n % (CTR_SHARDS - 1);
+#endif
+}
+
+
+/*
+ * ctr_read - the total of a counter over the shards
+ */
+u_long
+ctr_read(
+	ctr_id	id
+	)
+{
+	u_long	sum;
+	int	i;
+
+	sum = 0;
+	for (i = 0; i < CTR_SHARDS; i++)
+		sum += ctr_shards[i].ctr[id];
+
+	return sum;
+}
+
+
+/*
+ * ctr_obj_read - the total of a counter of an object over the shards
+ */
+u_long
+ctr_obj_read(
+	const ctr_obj *	c
+	)
+{
+	u_long	sum;
+	int	i;
+
+	sum = 0;
+	for (i = 0; i < CTR_SHARDS; i++)
+		sum += c->n[i];
+
+	return sum;
+}
+
+
+/*
+ * ctr_clear - reset a counter in all shards
+ */
+void
+ctr_clear(
+	ctr_id	id
+	)
+{
+	int	i;
+
+	for (i = 0; i < CTR_SHARDS; i++)
+		ctr_shards[i].ctr[id] = 0;
+}
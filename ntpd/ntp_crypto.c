@@ -141,6 +141,18 @@ static int calcomp(struct calendar *pjd1, struct calendar *pjd2)
 #define VALUE_LEN	(6 * 4) /* min response field length */
 #define MAX_VALLEN	(65535 - VALUE_LEN)
 #define YEAR		(60 * 60 * 24 * 365) /* seconds in year */
+#define CACHE_MDLEN	32	/* cache key digest length (SHA-256) */
+#define VRFY_CACHE	64	/* verified signatures kept (power of 2) */
+#define SIGN_CACHE	16	/* signed client certificates kept */
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+# define pkey_hold(pkey)	EVP_PKEY_up_ref(pkey)
+#else
+# define pkey_hold(pkey)	CRYPTO_add(&(pkey)->references, 1, \
+					   CRYPTO_LOCK_EVP_PKEY)
+# define EVP_MD_CTX_new()	EVP_MD_CTX_create()
+# define EVP_MD_CTX_free(ctx)	EVP_MD_CTX_destroy(ctx)
+#endif
 
 /*
  * Global cryptodata in host byte order
@@ -175,6 +187,30 @@ static const EVP_MD *sign_digest = NULL; /* sign digest */
 static u_int sign_siglen;	/* sign key length */
 static char *rand_file = NULL;	/* random seed file */
 
+/*
+ * Verified signatures, keyed by the digest of the signed value and
+ * the signature, and by the public key, which is held by a reference
+ * so it cannot be replaced by another at the same address.
+ */
+struct vrfy_entry {
+	EVP_PKEY *pkey;		/* public key */
+	const EVP_MD *digest;	/* message digest algorithm */
+	u_char	md[CACHE_MDLEN]; /* value and signature digest */
+};
+static struct vrfy_entry vrfy_cache[VRFY_CACHE];
+
+/*
+ * Client certificates signed by this host, keyed by the digest of the
+ * request. They are good until crypto_update() signs anew.
+ */
+struct sign_entry {
+	u_char	md[CACHE_MDLEN]; /* request digest */
+	tstamp_t era;		/* hostval.tstamp when signed */
+	struct value cert;	/* signed certificate/value */
+};
+static struct sign_entry sign_cache[SIGN_CACHE];
+static u_int sign_next;		/* next sign_cache entry to replace */
+
 /*
  * Cryptotypes
  */
@@ -203,6 +239,10 @@ static	struct pkey_info *crypto_key (char *, char *, sockaddr_u *);
 static	void	bighash		(BIGNUM *, BIGNUM *);
 static	struct cert_info *crypto_cert (char *);
 static	u_int	exten_payload_size(const struct exten *);
+static	struct vrfy_entry *vrfy_slot (const struct exten *, u_int,
+				    u_int, u_char *);
+static	struct value *sign_lookup (const struct exten *, u_char *);
+static	void	sign_remember	(const u_char *, struct value *);
 
 #ifdef SYS_WINNT
 int
@@ -230,7 +270,7 @@ session_key(
 	u_long	lifetime 	/* key lifetime */
 	)
 {
-	EVP_MD_CTX ctx;		/* message digest context */
+	EVP_MD_CTX *ctx;	/* message digest context */
 	u_char dgst[EVP_MAX_MD_SIZE]; /* message digest */
 	keyid_t	keyid;		/* key identifer */
 	u_int32	header[10];	/* data in network byte order */
@@ -263,9 +303,11 @@ session_key(
 		hdlen = 10 * sizeof(u_int32);
 		break;
 	}
-	EVP_DigestInit(&ctx, EVP_get_digestbynid(crypto_nid));
-	EVP_DigestUpdate(&ctx, (u_char *)header, hdlen);
-	EVP_DigestFinal(&ctx, dgst, &len);
+	ctx = EVP_MD_CTX_new();
+	EVP_DigestInit(ctx, EVP_get_digestbynid(crypto_nid));
+	EVP_DigestUpdate(ctx, (u_char *)header, hdlen);
+	EVP_DigestFinal(ctx, dgst, &len);
+	EVP_MD_CTX_free(ctx);
 	memcpy(&keyid, dgst, 4);
 	keyid = ntohl(keyid);
 	if (lifetime != 0) {
@@ -1093,6 +1135,8 @@ crypto_xmit(
 	struct calendar tscal;
 	u_int	vallen;
 	struct value vtemp;
+	struct value *vp;	/* cached value pointer */
+	u_char	md[CACHE_MDLEN]; /* sign request digest */
 	associd_t associd;
 	int	rval;
 	int	len;
@@ -1303,8 +1347,11 @@ crypto_xmit(
 	 * invalid or contains an unverified signature.
 	 */
 	case CRYPTO_SIGN | CRYPTO_RESP:
-		if ((rval = cert_sign(ep, &vtemp)) == XEVNT_OK) {
+		if ((vp = sign_lookup(ep, md)) != NULL) {
+			len = crypto_send(fp, vp, start);
+		} else if ((rval = cert_sign(ep, &vtemp)) == XEVNT_OK) {
 			len = crypto_send(fp, &vtemp, start);
+			sign_remember(md, &vtemp);
 			value_free(&vtemp);
 		}
 		break;
@@ -1422,6 +1469,8 @@ crypto_verify(
 {
 	EVP_PKEY *pkey;		/* server public key */
 	EVP_MD_CTX ctx;		/* signature context */
+	struct vrfy_entry *vc;	/* verified signature cache entry */
+	u_char	md[CACHE_MDLEN]; /* value and signature digest */
 	tstamp_t tstamp, tstamp1 = 0; /* timestamp */
 	tstamp_t fstamp, fstamp1 = 0; /* filestamp */
 	u_int	vallen;		/* value length */
@@ -1530,15 +1579,29 @@ crypto_verify(
 
 	/*
 	 * Darn, I thought we would never get here. Verify the
-	 * signature. If the identity exchange is verified, light the
-	 * proventic bit. What a relief.
+	 * signature, unless the very same value and signature have
+	 * been verified with this key before. If the identity exchange
+	 * is verified, light the proventic bit. What a relief.
 	 */
-	EVP_VerifyInit(&ctx, peer->digest);
-	/* XXX: the "+ 12" needs to be at least documented... */
-	EVP_VerifyUpdate(&ctx, (u_char *)&ep->tstamp, vallen + 12);
-	if (EVP_VerifyFinal(&ctx, (u_char *)&ep->pkt[i], siglen,
-	    pkey) <= 0)
-		return (XEVNT_SIG);
+	vc = vrfy_slot(ep, vallen, siglen, md);
+	if (   vc->pkey != pkey
+	    || vc->digest != peer->digest
+	    || memcmp(vc->md, md, sizeof(md)) != 0) {
+		EVP_VerifyInit(&ctx, peer->digest);
+		/* XXX: the "+ 12" needs to be at least documented... */
+		EVP_VerifyUpdate(&ctx, (u_char *)&ep->tstamp,
+		    vallen + 12);
+		if (EVP_VerifyFinal(&ctx, (u_char *)&ep->pkt[i], siglen,
+		    pkey) <= 0)
+			return (XEVNT_SIG);
+
+		if (vc->pkey != NULL)
+			EVP_PKEY_free(vc->pkey);
+		pkey_hold(pkey);
+		vc->pkey = pkey;
+		vc->digest = peer->digest;
+		memcpy(vc->md, md, sizeof(md));
+	}
 
 	if (peer->crypto & CRYPTO_FLAG_VRFY)
 		peer->crypto |= CRYPTO_FLAG_PROV;
@@ -1546,6 +1609,93 @@ crypto_verify(
 }
 
 
+/*
+ * vrfy_slot - digest the signed value and the signature of an
+ * extension field into md and return its verified signature cache
+ * entry.
+ */
+static struct vrfy_entry *
+vrfy_slot(
+	const struct exten *ep,	/* extension pointer */
+	u_int	vallen,		/* value length */
+	u_int	siglen,		/* signature length */
+	u_char	*md		/* digest */
+	)
+{
+	EVP_MD_CTX *ctx;	/* message digest context */
+	u_int	len;
+
+	ctx = EVP_MD_CTX_new();
+	EVP_DigestInit(ctx, EVP_sha256());
+	EVP_DigestUpdate(ctx, (const u_char *)&ep->tstamp, vallen + 12);
+	EVP_DigestUpdate(ctx, (const u_char *)&ep->pkt[(vallen + 3) /
+	    4 + 1], siglen);
+	EVP_DigestFinal(ctx, md, &len);
+	EVP_MD_CTX_free(ctx);
+	INSIST(len == CACHE_MDLEN);
+	return (&vrfy_cache[md[0] & (VRFY_CACHE - 1)]);
+}
+
+
+/*
+ * sign_lookup - digest a certificate sign request into md and return
+ * the certificate signed for it in this era, if any.
+ */
+static struct value *
+sign_lookup(
+	const struct exten *ep,	/* extension pointer */
+	u_char	*md		/* digest */
+	)
+{
+	EVP_MD_CTX *ctx;	/* message digest context */
+	u_int	len, i;
+
+	len = exten_payload_size(ep);
+	if (len == 0 || len > MAX_VALLEN)
+		return (NULL);
+
+	ctx = EVP_MD_CTX_new();
+	EVP_DigestInit(ctx, EVP_sha256());
+	EVP_DigestUpdate(ctx, (const u_char *)&ep->fstamp, 4);
+	EVP_DigestUpdate(ctx, (const u_char *)ep->pkt, len);
+	EVP_DigestFinal(ctx, md, &len);
+	EVP_MD_CTX_free(ctx);
+	INSIST(len == CACHE_MDLEN);
+	for (i = 0; i < SIGN_CACHE; i++) {
+		if (   sign_cache[i].era != 0
+		    && sign_cache[i].era == hostval.tstamp
+		    && memcmp(sign_cache[i].md, md, CACHE_MDLEN) == 0)
+			return (&sign_cache[i].cert);
+	}
+	return (NULL);
+}
+
+
+/*
+ * sign_remember - keep a certificate signed for the request digested
+ * by sign_lookup(). The cache takes over the value, if it keeps it.
+ */
+static void
+sign_remember(
+	const u_char *md,	/* request digest */
+	struct value *vp	/* signed certificate/value */
+	)
+{
+	struct sign_entry *sc;	/* signed certificate cache entry */
+
+	if (hostval.tstamp == 0)
+		return;
+
+	sc = &sign_cache[sign_next];
+	sign_next = (sign_next + 1) % SIGN_CACHE;
+	value_free(&sc->cert);
+	memcpy(sc->md, md, CACHE_MDLEN);
+	sc->era = hostval.tstamp;
+	sc->cert = *vp;
+	memset(vp, 0, sizeof(*vp));
+}
+
+
 /*
  * crypto_encrypt - construct vp (encrypted cookie and signature) from
  * the public key and cookie.
@@ -1828,6 +1978,7 @@ crypto_update(void)
 	if (hostval.tstamp == 0)
 		return;
 
+	ctl_sys_changed();
 	/*
 	 * Sign public key and timestamps. The filestamp is derived from
 	 * the host key file extension from wherever the file was
@@ -3211,6 +3362,20 @@ cert_install(
 {
 	struct cert_info *cp, *xp, **zp;
 
+	/*
+	 * A certificate installed before, byte for byte and with the
+	 * same filestamp, has been parsed and validated then. Nothing
+	 * changes, so skip that and signing all values anew.
+	 */
+	for (xp = cinfo; xp != NULL; xp = xp->link) {
+		if (   (xp->flags & CERT_VALID)
+		    && xp->cert.fstamp == ep->fstamp
+		    && xp->cert.vallen == ep->vallen
+		    && memcmp(xp->cert.ptr, ep->pkt,
+			      ntohl(ep->vallen)) == 0)
+			return (xp);
+	}
+
 	/*
 	 * Parse and validate the signed certificate. If valid,
 	 * construct the info/value structure; otherwise, scamper home
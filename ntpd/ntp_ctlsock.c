@@ -0,0 +1,473 @@
+/*
+ * ntp_ctlsock.c - mode 6 control messages on a local stream socket
+ *
+ * With "controlsocket <path>" in the configuration file ntpd listens
+ * on a Unix domain stream socket for ntpq, ntpsnmpd and other tools on
+ * the same host.  Requests are the usual mode 6 packets and are
+ * processed by ntp_control.c as if they came in as datagrams, except:
+ *
+ *	- each response is one message, however long, instead of a
+ *	  series of fragments of at most CTL_MAX_DATA_LEN octets;
+ *	- mrulist needs no nonce and is not cut into batches;
+ *	- requests which need a key are allowed without one, as access
+ *	  is granted by the permissions of the socket, which is created
+ *	  with mode 0600;
+ *	- traps cannot be set.
+ *
+ * Every message in either direction is preceded by its length in
+ * octets, 4 bytes big endian.  A request is the packet as it would be
+ * sent in a datagram, padded to 32 bits, without a MAC.  A response is
+ * the 12 octet control header followed by the data, unpadded; its
+ * count field is only meaningful up to 65535 octets, the length
+ * prefix always is.
+ *
+ * Responses are written without blocking.  What the socket does not
+ * take at once is queued, the I/O loop then also waits for the socket
+ * to take output, and ctlsock_flush() writes it from the main loop.
+ * A client with more than CTLSOCK_QMAX octets queued, or which takes
+ * up no output for CTLSOCK_TIMEOUT seconds, is dropped.
+ */
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include "ntpd.h"
+#include "ntp_io.h"
+#include "ntp_stdlib.h"
+#include "ntp_control.h"
+
+#include <stdio.h>
+#include <stddef.h>
+
+#if defined(HAVE_SYS_UN_H) && !defined(HAVE_IO_COMPLETION_PORT)
+
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#define CTLSOCK_CONNS	8	/* clients served at once */
+#define CTLSOCK_TIMEOUT	10	/* s a client may stall its output */
+#define CTLSOCK_QMAX	(16 * 1024 * 1024) /* octets queued per client */
+#define CTLSOCK_SNDBUF	(256 * 1024)	/* socket send buffer wanted */
+
+/* longest request: a full packet with a MAC, and its length prefix */
+#define CTLSOCK_REQLEN	(sizeof(u_int32) + sizeof(struct ntp_control))
+
+/*
+ * A client connection
+ */
+struct ctlsock_conn {
+	struct asyncio_reader *	reader;	/* NULL if not in use */
+	size_t		ilen;		/* unparsed bytes in ibuf[] */
+	u_char		ibuf[2 * CTLSOCK_REQLEN];
+	u_char *	obuf;		/* queued output, malloc()ed */
+	size_t		osize;		/* allocated size of obuf */
+	size_t		ooff;		/* octets of obuf written */
+	size_t		olen;		/* octets in obuf */
+	u_long		moved;		/* current_time output last moved */
+};
+
+static struct asyncio_reader *	ctlsock_listener;
+static char *			ctlsock_path;
+static struct ctlsock_conn	ctlsock_conn[CTLSOCK_CONNS];
+static int			ctlsock_queued;	/* clients with output */
+
+static void	ctlsock_accept	(struct asyncio_reader *);
+static void	ctlsock_receive	(struct asyncio_reader *);
+
+
+/*
+ * ctlsock_close - drop a client connection
+ */
+static void
+ctlsock_close(
+	struct ctlsock_conn *	c,
+	const char *		why
+	)
+{
+	if (NULL == c->reader)
+		return;
+	DPRINTF(1, ("control socket: connection %d %s\n",
+		    (int)(c - ctlsock_conn), why));
+	if (c->olen > 0)
+		maintain_writefds(c->reader->fd, FALSE);
+	remove_asyncio_reader(c->reader);
+	delete_asyncio_reader(c->reader);
+	c->reader = NULL;
+	c->ilen = 0;
+	if (c->olen > 0)
+		ctlsock_queued--;
+	free(c->obuf);
+	c->obuf = NULL;
+	c->osize = 0;
+	c->ooff = 0;
+	c->olen = 0;
+}
+
+
+/*
+ * ctlsock_close_listener - stop listening and drop all clients
+ */
+static void
+ctlsock_close_listener(void)
+{
+	struct ctlsock_conn *	c;
+
+	for (c = ctlsock_conn; c < ctlsock_conn + CTLSOCK_CONNS; c++)
+		ctlsock_close(c, "closed");
+	if (ctlsock_listener != NULL) {
+		remove_asyncio_reader(ctlsock_listener);
+		delete_asyncio_reader(ctlsock_listener);
+		ctlsock_listener = NULL;
+		unlink(ctlsock_path);
+	}
+	free(ctlsock_path);
+	ctlsock_path = NULL;
+}
+
+
+/*
+ * ctlsock_open - listen on the control socket
+ *
+ * Called for "controlsocket" in the configuration.  An empty path
+ * stops listening.  A stale socket left at the path is replaced, any
+ * other file there is not touched.
+ */
+void
+ctlsock_open(
+	const char *	path
+	)
+{
+	struct sockaddr_un	addr;
+	struct stat		sb;
+	mode_t			omask;
+	int			fd;
+
+	if (ctlsock_path != NULL && !strcmp(ctlsock_path, path))
+		return;
+	ctlsock_close_listener();
+	if ('\0' == path[0])
+		return;
+
+	ZERO(addr);
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		msyslog(LOG_ERR, "controlsocket %s: path too long", path);
+		return;
+	}
+	strlcpy(addr.sun_path, path, sizeof(addr.sun_path));
+	if (0 == lstat(path, &sb)) {
+		if (!S_ISSOCK(sb.st_mode)) {
+			msyslog(LOG_ERR, "controlsocket %s: not a socket",
+				path);
+			return;
+		}
+		unlink(path);
+	}
+
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (-1 == fd) {
+		msyslog(LOG_ERR, "controlsocket: socket(): %m");
+		return;
+	}
+	omask = umask(S_IRWXG | S_IRWXO);
+	if (-1 == bind(fd, (struct sockaddr *)&addr, sizeof(addr))
+	    || -1 == listen(fd, CTLSOCK_CONNS)) {
+		umask(omask);
+		msyslog(LOG_ERR, "controlsocket %s: %m", path);
+		close(fd);
+		return;
+	}
+	umask(omask);
+	fd = move_fd(fd);
+	make_socket_nonblocking(fd);
+#ifdef HAVE_SIGNALED_IO
+	init_socket_sig(fd);
+#endif
+
+	ctlsock_path = estrdup(path);
+	ctlsock_listener = new_asyncio_reader();
+	ctlsock_listener->fd = fd;
+	ctlsock_listener->receiver = &ctlsock_accept;
+	add_asyncio_reader(ctlsock_listener, FD_TYPE_SOCKET);
+	msyslog(LOG_INFO, "Listening on control socket %s", path);
+}
+
+
+/*
+ * ctlsock_accept - take a new client from the listening socket
+ */
+static void
+ctlsock_accept(
+	struct asyncio_reader *	reader
+	)
+{
+	struct ctlsock_conn *	c;
+	int			fd;
+	int			sndbuf;
+
+	fd = accept(reader->fd, NULL, NULL);
+	if (-1 == fd)
+		return;
+	for (c = ctlsock_conn; c < ctlsock_conn + CTLSOCK_CONNS; c++)
+		if (NULL == c->reader)
+			break;
+	if (ctlsock_conn + CTLSOCK_CONNS == c) {
+		msyslog(LOG_NOTICE,
+			"control socket: too many clients, one refused");
+		close(fd);
+		return;
+	}
+	fd = move_fd(fd);
+	make_socket_nonblocking(fd);
+#ifdef HAVE_SIGNALED_IO
+	init_socket_sig(fd);
+#endif
+	/* most responses then go out in one write, the system may cap it */
+	sndbuf = CTLSOCK_SNDBUF;
+	setsockopt(fd, SOL_SOCKET, SO_SNDBUF, (void *)&sndbuf,
+		   sizeof(sndbuf));
+
+	c->ilen = 0;
+	c->reader = new_asyncio_reader();
+	c->reader->fd = fd;
+	c->reader->data = c;
+	c->reader->receiver = &ctlsock_receive;
+	add_asyncio_reader(c->reader, FD_TYPE_SOCKET);
+	DPRINTF(1, ("control socket: connection %d on fd %d\n",
+		    (int)(c - ctlsock_conn), fd));
+}
+
+
+/*
+ * ctlsock_request - hand one request on to ntp_control.c
+ */
+static void
+ctlsock_request(
+	struct ctlsock_conn *	c,
+	const u_char *		req,
+	u_int32			len
+	)
+{
+	static struct recvbuf	rb;
+
+	/*
+	 * ntp_control.c wants an address to log and to derive
+	 * nonces from; the client is on this host.
+	 */
+	ZERO(rb);
+	AF(&rb.recv_srcadr) = AF_INET;
+	SET_ADDR4N(&rb.recv_srcadr, htonl(INADDR_LOOPBACK));
+	get_systime(&rb.recv_time);
+	rb.fd = c->reader->fd;
+	rb.recv_length = len;
+	memcpy(rb.recv_buffer, req, len);
+	process_control_stream(&rb, c);
+}
+
+
+/*
+ * ctlsock_receive - read requests from a client
+ *
+ * Called from the I/O loop when the connection is readable.
+ */
+static void
+ctlsock_receive(
+	struct asyncio_reader *	reader
+	)
+{
+	struct ctlsock_conn *	c;
+	const u_char *		p;
+	u_int32			len;
+	ssize_t			n;
+
+	c = reader->data;
+	for (;;) {
+		n = read(reader->fd, c->ibuf + c->ilen,
+			 sizeof(c->ibuf) - c->ilen);
+		if (n < 0 && EINTR == errno)
+			continue;
+		if (n < 0 && (EAGAIN == errno || EWOULDBLOCK == errno))
+			return;
+		if (n <= 0) {
+			ctlsock_close(c, (0 == n)
+					     ? "closed by client"
+					     : "read failed");
+			return;
+		}
+		c->ilen += n;
+
+		/* process every complete request in the buffer */
+		p = c->ibuf;
+		while (c->ilen >= sizeof(len)) {
+			memcpy(&len, p, sizeof(len));
+			len = ntohl(len);
+			if (len > CTLSOCK_REQLEN - sizeof(len)) {
+				ctlsock_close(c, "request too long");
+				return;
+			}
+			if (c->ilen < sizeof(len) + len)
+				break;
+			ctlsock_request(c, p + sizeof(len), len);
+			/* the response may have failed */
+			if (NULL == c->reader)
+				return;
+			p += sizeof(len) + len;
+			c->ilen -= sizeof(len) + len;
+		}
+		memmove(c->ibuf, p, c->ilen);
+	}
+}
+
+
+/*
+ * ctlsock_write - write what the socket takes of the queued output
+ *
+ * Returns -1 if the client had to be dropped.
+ */
+static int
+ctlsock_write(
+	struct ctlsock_conn *	c
+	)
+{
+	ssize_t	n;
+
+	while (c->ooff < c->olen) {
+		n = write(c->reader->fd, c->obuf + c->ooff,
+			  c->olen - c->ooff);
+		if (n < 0 && EINTR == errno)
+			continue;
+		if (n < 0 && (EAGAIN == errno || EWOULDBLOCK == errno))
+			break;
+		if (n <= 0) {
+			ctlsock_close(c, "write failed");
+			return -1;
+		}
+		c->ooff += n;
+		c->moved = current_time;
+	}
+	if (c->ooff == c->olen) {
+		ctlsock_queued--;
+		maintain_writefds(c->reader->fd, FALSE);
+		c->ooff = 0;
+		c->olen = 0;
+	}
+
+	return 0;
+}
+
+
+/*
+ * ctlsock_send - write a response to a client
+ *
+ * Called by ntp_control.c with the complete message, length prefix
+ * included.  Whatever the socket does not take now is queued behind
+ * any earlier output for ctlsock_flush().
+ */
+void
+ctlsock_send(
+	struct ctlsock_conn *	c,
+	const void *		msg,
+	size_t			len
+	)
+{
+	const u_char *	p;
+	ssize_t		n;
+
+	p = msg;
+	if (0 == c->olen) {
+		for (;;) {
+			n = write(c->reader->fd, p, len);
+			if (n >= 0 || EINTR != errno)
+				break;
+		}
+		if (n < 0 && EAGAIN != errno && EWOULDBLOCK != errno) {
+			ctlsock_close(c, "write failed");
+			return;
+		}
+		if (n > 0) {
+			p += n;
+			len -= n;
+		}
+		if (0 == len)
+			return;
+		ctlsock_queued++;
+		maintain_writefds(c->reader->fd, TRUE);
+		c->moved = current_time;
+	}
+
+	if (c->olen - c->ooff + len > CTLSOCK_QMAX) {
+		ctlsock_close(c, "client too slow");
+		return;
+	}
+	/* written octets make room before the buffer grows */
+	if (c->ooff > 0) {
+		c->olen -= c->ooff;
+		memmove(c->obuf, c->obuf + c->ooff, c->olen);
+		c->ooff = 0;
+	}
+	if (c->olen + len > c->osize) {
+		c->osize = 2 * c->osize;
+		if (c->osize < c->olen + len)
+			c->osize = c->olen + len;
+		c->obuf = erealloc(c->obuf, c->osize);
+	}
+	memcpy(c->obuf + c->olen, p, len);
+	c->olen += len;
+}
+
+
+/*
+ * ctlsock_flush - write queued output to the clients
+ *
+ * Called each time around the main loop, which wakes up when a
+ * socket with output queued takes more.
+ */
+void
+ctlsock_flush(void)
+{
+	struct ctlsock_conn *	c;
+
+	if (0 == ctlsock_queued)
+		return;
+	for (c = ctlsock_conn; c < ctlsock_conn + CTLSOCK_CONNS; c++) {
+		if (NULL == c->reader || 0 == c->olen)
+			continue;
+		if (ctlsock_write(c) < 0 || 0 == c->olen)
+			continue;
+		if (current_time - c->moved > CTLSOCK_TIMEOUT)
+			ctlsock_close(c, "client too slow");
+	}
+}
+
+#else	/* !HAVE_SYS_UN_H || HAVE_IO_COMPLETION_PORT follows */
+
+void
+ctlsock_open(
+	const char *	path
+	)
+{
+	if (path[0] != '\0')
+		msyslog(LOG_ERR,
+			"controlsocket %s: not supported on this system",
+			path);
+}
+
+
+void
+ctlsock_send(
+	struct ctlsock_conn *	c,
+	const void *		msg,
+	size_t			len
+	)
+{
+	/* never called without a connection */
+}
+
+
+void
+ctlsock_flush(void)
+{
+	/* nothing is ever queued */
+}
+
+#endif	/* !HAVE_SYS_UN_H || HAVE_IO_COMPLETION_PORT */
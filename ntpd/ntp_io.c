@@ -135,6 +135,20 @@ nic_rule *nic_rule_list;
 /* fill in for old/other timestamp interfaces */
 #endif
 
+/*
+ * The io_uring backend replaces select() in io_handler() where it is
+ * configured and the kernel has it, see iou_setup().
+ */
+#if defined(NTP_IO_URING) && !defined(HAVE_SIGNALED_IO) && \
+    !defined(HAVE_IO_COMPLETION_PORT) && !defined(SIM)
+# define USE_IO_URING
+# include <stddef.h>
+# include <poll.h>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <linux/io_uring.h>
+#endif
+
 #if defined(SYS_WINNT)
 #include "win32_io.h"
 #include <isc/win32os.h>
@@ -158,16 +172,14 @@ nic_rule *nic_rule_list;
 
 
 /*
- * Other statistics of possible interest
+ * Other statistics of possible interest; packets received and sent
+ * are counted in ntp_counters.c
  */
 volatile u_long packets_dropped;	/* total number of packets dropped on reception */
 volatile u_long packets_ignored;	/* packets received on wild card interface */
-volatile u_long packets_received;	/* total number of packets received */
-	 u_long packets_sent;		/* total number of packets sent */
 	 u_long packets_notsent;	/* total number of packets which couldn't be sent */
 
 volatile u_long handler_calls;	/* number of calls to interrupt handler */
-volatile u_long handler_pkts;	/* number of pkts received by handler */
 u_long io_timereset;		/* time counters were reset */
 
 /*
@@ -189,6 +201,15 @@ int disable_dynamic_updates;		/* scan interfaces once only */
  * the guys we are doing I/O for.
  */
 static	struct refclockio *refio;
+
+/*
+ * Most octets read from one refclock in one pass of the input handler,
+ * one second of audio.  A device has only what arrived since the last
+ * pass, but a regular file, such as an audio file source, is always
+ * readable and would otherwise be read to the end, and mostly dropped
+ * for want of buffers, before the received buffers are processed.
+ */
+#define	REFCLOCK_READ_MAX	(8 * RX_BUFF_SIZE)
 #endif /* REFCLOCK */
 
 /*
@@ -197,6 +218,8 @@ static	struct refclockio *refio;
  */
 static fd_set activefds;
 static int maxactivefd;
+static fd_set writefds;		/* of activefds, with output waiting */
+static int nwritefds;
 
 /*
  * bit alternating value to detect verified interfaces during an update cycle
@@ -237,7 +260,6 @@ static void print_interface	(const endpt *, const char *, const char *);
 #endif
 
 typedef struct vsock vsock_t;
-enum desc_type { FD_TYPE_SOCKET, FD_TYPE_FILE };
 
 struct vsock {
 	vsock_t	*	link;
@@ -247,29 +269,12 @@ struct vsock {
 
 vsock_t	*fd_list;
 
-#if !defined(HAVE_IO_COMPLETION_PORT) && defined(HAS_ROUTING_SOCKET)
-/*
- * async notification processing (e. g. routing sockets)
- */
+#if !defined(HAVE_IO_COMPLETION_PORT)
 /*
- * support for receiving data on fd that is not a refclock or a socket
- * like e. g. routing sockets
+ * async notification processing (e. g. routing sockets, ntp_signd)
  */
-struct asyncio_reader {
-	struct asyncio_reader *link;		    /* the list this is being kept in */
-	SOCKET fd;				    /* fd to be read */
-	void  *data;				    /* possibly local data */
-	void (*receiver)(struct asyncio_reader *);  /* input handler */
-};
-
 struct asyncio_reader *asyncio_reader_list;
-
-static void delete_asyncio_reader (struct asyncio_reader *);
-static struct asyncio_reader *new_asyncio_reader (void);
-static void add_asyncio_reader (struct asyncio_reader *, enum desc_type);
-static void remove_asyncio_reader (struct asyncio_reader *);
-
-#endif /* !defined(HAVE_IO_COMPLETION_PORT) && defined(HAS_ROUTING_SOCKET) */
+#endif /* !defined(HAVE_IO_COMPLETION_PORT) */
 
 static void init_async_notifications (void);
 
@@ -338,6 +343,8 @@ static int		cmp_addr_distance(const sockaddr_u *,
  */
 #if !defined(HAVE_IO_COMPLETION_PORT)
 static inline int	read_network_packet	(SOCKET, struct interface *, l_fp);
+static int/*BOOL*/	spoofed_loopback	(const struct recvbuf *,
+						 const endpt *);
 static void		ntpd_addremove_io_fd	(int, int, int);
 static void 		input_handler_scan	(const l_fp*, const fd_set*);
 static int/*BOOL*/	sanitize_fdset		(int errc);
@@ -348,6 +355,112 @@ static inline int	read_refclock_packet	(SOCKET, struct refclockio *, l_fp);
 static void 		input_handler		(l_fp*);
 #endif
 #endif
+#ifdef USE_IO_URING
+typedef struct iou_fd_tag iou_fd;
+static int		iou_setup		(void);
+static void		iou_forget		(void);
+static struct io_uring_sqe *iou_sqe		(void);
+static int		iou_enter		(int);
+static void		iou_arm			(int, int, endpt *);
+static void		iou_disarm		(iou_fd *, int);
+static void		iou_fd_closing		(int);
+static void		iou_sync		(void);
+static void		iou_refill		(void);
+static void		iou_recv		(const struct io_uring_cqe *,
+						 l_fp);
+static void		iou_sent		(const struct io_uring_cqe *);
+static void		iou_wait		(void);
+
+/*
+ * io_uring state.  Every NTP socket has a multishot recvmsg request
+ * on the ring, taking its buffers from a provided buffer ring.  Those
+ * are recvbufs: the kernel writes the message header, the source
+ * address and the timestamp control message into the recvbuf fields
+ * in front of recv_space, which iou_recv() then sets up properly, and
+ * the packet lands in recv_space.  The other descriptors in activefds
+ * get one-shot polls, and input_handler_scan() handles those which
+ * fire, as after select().  Those in writefds get one-shot polls for
+ * output as well.  Replies queued by sendpkt_queued() are submitted
+ * at once, as their transmit timestamps were taken already.
+ */
+#define IOU_ENTRIES	256	/* submission queue entries */
+#define IOU_CQ_ENTRIES	1024	/* completion queue entries */
+#define IOU_RXBUFS	128	/* recvbufs on the buffer ring, 2^n */
+#define IOU_TXSLOTS	64	/* replies on the ring */
+#define IOU_BGID	0	/* buffer group of IOU_RXBUFS */
+
+/* request user_data: kind, descriptor generation and index */
+#define IOU_RECV	1	/* multishot recvmsg, index is the fd */
+#define IOU_POLL	2	/* poll, index is the fd */
+#define IOU_SEND	3	/* sendmsg, index is the tx slot */
+#define IOU_CANCEL	4	/* cancellation of the above */
+#define IOU_POLLOUT	5	/* poll for output, index is the fd */
+#define IOU_UDATA(k, g, i)	(((u_int64)(k) << 56) |		\
+				 ((u_int64)((g) & 0xffffff) << 32) | \
+				 (u_int32)(i))
+#define IOU_KIND(u)		((int)((u) >> 56))
+#define IOU_GEN(u)		((u_int32)((u) >> 32) & 0xffffff)
+#define IOU_INDEX(u)		((u_int32)(u))
+
+#if defined(HAVE_TIMESTAMPNS)
+# define IOU_CMSGLEN	CMSG_SPACE(sizeof(struct timespec))
+#elif defined(HAVE_TIMESTAMP)
+# define IOU_CMSGLEN	CMSG_SPACE(sizeof(struct timeval))
+#else
+# define IOU_CMSGLEN	0
+#endif
+/* what the kernel puts in front of a packet in a provided buffer */
+#define IOU_RXHDR	(sizeof(struct io_uring_recvmsg_out) +	\
+			 sizeof(sockaddr_u) + IOU_CMSGLEN)
+
+struct iou_fd_tag {
+	endpt *		ep;	/* socket of the recvmsg, or NULL */
+	u_int32		gen;	/* of the request in armed */
+	int		armed;	/* IOU_RECV, IOU_POLL, IOU_POLLOUT or 0 */
+};
+
+typedef struct iou_tx_tag {
+	struct msghdr	msg;
+	struct iovec	iov;
+	sockaddr_u	dest;
+	endpt *		ep;	/* NULL once the socket is closed */
+	SOCKET		fd;
+	l_fp *		sent;	/* gets the time the reply went */
+	l_fp		when;	/* time it was submitted */
+	struct pkt	pkt;
+} iou_tx;
+
+static int		iou_ring_fd = -1;
+static void *		iou_sq_ring;
+static size_t		iou_sq_ring_sz;
+static void *		iou_cq_ring;
+static size_t		iou_cq_ring_sz;
+static u_int32 *	iou_sq_head;
+static u_int32 *	iou_sq_tail;
+static u_int32		iou_sqt;	/* our submission queue tail */
+static u_int32		iou_sq_mask;
+static u_int32		iou_sq_entries;
+static struct io_uring_sqe *iou_sqes;
+static size_t		iou_sqes_sz;
+static u_int32 *	iou_cq_head;
+static u_int32 *	iou_cq_tail;
+static u_int32		iou_cq_mask;
+static struct io_uring_cqe *iou_cqes;
+static struct io_uring_buf_ring *iou_br;
+static size_t		iou_br_sz;
+static u_short		iou_brt;	/* our buffer ring tail */
+static recvbuf_t *	iou_rxbufs[IOU_RXBUFS];	/* by buffer ID */
+static int		iou_rx_empty;	/* NULL iou_rxbufs[] */
+static struct msghdr	iou_rxmsg;	/* recvmsg name/control sizes */
+static iou_fd		iou_fds[FD_SETSIZE];
+static iou_fd		iou_wfds[FD_SETSIZE];	/* writefds polls */
+static endpt *		iou_sock_ep[FD_SETSIZE]; /* iou_sync() scratch */
+static int		iou_dirty;	/* activefds changed */
+static int		iou_poll_socks;	/* no multishot recvmsg */
+static iou_tx		iou_tx_slots[IOU_TXSLOTS];
+static u_short		iou_tx_free[IOU_TXSLOTS];
+static int		iou_tx_nfree;
+#endif	/* USE_IO_URING */
 
 
 #ifndef HAVE_IO_COMPLETION_PORT
@@ -369,8 +482,18 @@ maintain_activefds(
 	if (!closing) {
 		FD_SET(fd, &activefds);
 		maxactivefd = max(fd, maxactivefd);
+#ifdef USE_IO_URING
+		iou_dirty = TRUE;
+#endif
 	} else {
 		FD_CLR(fd, &activefds);
+		if (FD_ISSET(fd, &writefds)) {
+			FD_CLR(fd, &writefds);
+			nwritefds--;
+		}
+#ifdef USE_IO_URING
+		iou_fd_closing(fd);
+#endif
 		if (maxactivefd && fd == maxactivefd) {
 			for (i = maxactivefd - 1; i >= 0; i--)
 				if (FD_ISSET(i, &activefds)) {
@@ -381,6 +504,34 @@ maintain_activefds(
 		}
 	}
 }
+
+
+/*
+ * maintain_writefds - have io_handler() also wake up when fd, one of
+ *		       activefds, takes output, or no longer.  Used for
+ *		       the output the control socket has queued.
+ */
+void
+maintain_writefds(
+	int fd,
+	int pending
+	)
+{
+	REQUIRE(fd >= 0 && fd < FD_SETSIZE && FD_ISSET(fd, &activefds));
+
+	if (pending == !!FD_ISSET(fd, &writefds))
+		return;
+	if (pending) {
+		FD_SET(fd, &writefds);
+		nwritefds++;
+	} else {
+		FD_CLR(fd, &writefds);
+		nwritefds--;
+	}
+#ifdef USE_IO_URING
+	iou_dirty = TRUE;
+#endif
+}
 #endif	/* !HAVE_IO_COMPLETION_PORT */
 
 
@@ -464,6 +615,8 @@ init_io(void)
 	init_io_completion_port();
 #elif defined(HAVE_SIGNALED_IO)
 	(void) set_signal(input_handler);
+#elif defined(USE_IO_URING)
+	iou_setup();
 #endif
 }
 
@@ -534,8 +687,8 @@ interface_dump(const endpt *itf)
 	printf("last_ttl = %d\n", itf->last_ttl);
 	printf("addr_refid = %08x\n", itf->addr_refid);
 	printf("num_mcast = %d\n", itf->num_mcast);
-	printf("received = %ld\n", itf->received);
-	printf("sent = %ld\n", itf->sent);
+	printf("received = %lu\n", ctr_obj_read(&itf->received));
+	printf("sent = %lu\n", ctr_obj_read(&itf->sent));
 	printf("notsent = %ld\n", itf->notsent);
 	printf("ifindex = %u\n", itf->ifindex);
 	printf("peercnt = %u\n", itf->peercnt);
@@ -594,11 +747,11 @@ print_interface(const endpt *iface, const char *pfx, const char *sfx)
 }
 #endif
 
-#if !defined(HAVE_IO_COMPLETION_PORT) && defined(HAS_ROUTING_SOCKET)
+#if !defined(HAVE_IO_COMPLETION_PORT)
 /*
  * create an asyncio_reader structure
  */
-static struct asyncio_reader *
+struct asyncio_reader *
 new_asyncio_reader(void)
 {
 	struct asyncio_reader *reader;
@@ -612,7 +765,7 @@ new_asyncio_reader(void)
 /*
  * delete a reader
  */
-static void
+void
 delete_asyncio_reader(
 	struct asyncio_reader *reader
 	)
@@ -623,7 +776,7 @@ delete_asyncio_reader(
 /*
  * add asynchio_reader
  */
-static void
+void
 add_asyncio_reader(
 	struct asyncio_reader *	reader,
 	enum desc_type		type)
@@ -635,7 +788,7 @@ add_asyncio_reader(
 /*
  * remove asynchio_reader
  */
-static void
+void
 remove_asyncio_reader(
 	struct asyncio_reader *reader
 	)
@@ -650,7 +803,7 @@ remove_asyncio_reader(
 
 	reader->fd = INVALID_SOCKET;
 }
-#endif /* !defined(HAVE_IO_COMPLETION_PORT) && defined(HAS_ROUTING_SOCKET) */
+#endif /* !defined(HAVE_IO_COMPLETION_PORT) */
 
 
 /* compare two sockaddr prefixes */
@@ -994,13 +1147,13 @@ remove_interface(
 
 	if (ep->fd != INVALID_SOCKET) {
 		msyslog(LOG_INFO,
-			"Deleting interface #%d %s, %s#%d, interface stats: received=%ld, sent=%ld, dropped=%ld, active_time=%ld secs",
+			"Deleting interface #%d %s, %s#%d, interface stats: received=%lu, sent=%lu, dropped=%ld, active_time=%ld secs",
 			ep->ifnum,
 			ep->name,
 			stoa(&ep->sin),
 			SRCPORT(&ep->sin),
-			ep->received,
-			ep->sent,
+			ctr_obj_read(&ep->received),
+			ctr_obj_read(&ep->sent),
 			ep->notsent,
 			current_time - ep->starttime);
 		close_and_delete_fd_from_list(ep->fd);
@@ -1018,6 +1171,9 @@ remove_interface(
 
 	ninterfaces--;
 	mon_clearinterface(ep);
+#ifdef HAVE_NTP_SIGND
+	signd_clearinterface(ep);
+#endif
 
 	/* remove restrict interface entry */
 	SET_HOSTMASK(&resmask, AF(&ep->sin));
@@ -1076,9 +1232,13 @@ create_wildcards(
 		SET_PORT(&wildaddr, port);
 		SET_SCOPE(&wildaddr, 0);
 
-		/* check for interface/nic rules affecting the wildcard */
+		/*
+		 * check for interface/nic rules affecting the wildcard,
+		 * serving processes have none, see open_socket()
+		 */
 		action = interface_action(NULL, &wildaddr, 0);
-		v6wild = (ACTION_IGNORE != action);
+		v6wild = (ACTION_IGNORE != action
+			  && SHSTATE_SERVE != shstate_mode);
 	}
 	if (v6wild) {
 		wildif = new_interface(NULL);
@@ -1120,9 +1280,13 @@ create_wildcards(
 		SET_ADDR4N(&wildaddr, INADDR_ANY);
 		SET_PORT(&wildaddr, port);
 
-		/* check for interface/nic rules affecting the wildcard */
+		/*
+		 * check for interface/nic rules affecting the wildcard,
+		 * serving processes have none, see open_socket()
+		 */
 		action = interface_action(NULL, &wildaddr, 0);
-		v4wild = (ACTION_IGNORE != action);
+		v4wild = (ACTION_IGNORE != action
+			  && SHSTATE_SERVE != shstate_mode);
 	}
 	if (v4wild) {
 		wildif = new_interface(NULL);
@@ -1983,6 +2147,9 @@ update_interfaces(
 	}
 #endif /* MCAST */
 
+	/* the XDP program steers requests for these addresses */
+	xdp_endpoints();
+
 	return new_interface_found;
 }
 
@@ -2002,6 +2169,8 @@ create_sockets(
 	 */
 	maxactivefd = 0;
 	FD_ZERO(&activefds);
+	FD_ZERO(&writefds);
+	nwritefds = 0;
 #endif
 
 	DPRINTF(2, ("create_sockets(%d)\n", port));
@@ -2868,6 +3037,26 @@ open_socket(
 			closesocket(fd);
 			return INVALID_SOCKET;
 		}
+#ifdef SO_REUSEPORT
+	/*
+	 * Serving processes, see ntp_shstate.c, share the NTP port on
+	 * the same addresses and the kernel spreads the requests over
+	 * them.  They open no wildcard sockets.  The publisher sets it
+	 * on its wildcard sockets only, so that the serving processes
+	 * can bind their addresses next to them, and binding one of
+	 * its own addresses fails for them.  The responses from its
+	 * servers and mode 6 queries sent to its addresses are thus
+	 * never delivered to a serving process.
+	 */
+	if (   (   SHSTATE_SERVE == shstate_mode
+		|| (   SHSTATE_PUBLISH == shstate_mode
+		    && (INT_WILDCARD & interf->flags)))
+	    && setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, (char *)&on,
+			  sizeof(on)))
+		msyslog(LOG_ERR,
+			"setsockopt SO_REUSEPORT fails for address %s: %m",
+			stoa(addr));
+#endif
 #ifdef SO_EXCLUSIVEADDRUSE
 	/*
 	 * setting SO_EXCLUSIVEADDRUSE on the wildcard we open
@@ -3128,8 +3317,8 @@ sendpkt(
 			src->notsent++;
 			packets_notsent++;
 		} else	{
-			src->sent++;
-			packets_sent++;
+			CTR_OBJ_INC(src->sent);
+			CTR_INC(CTR_PACKETS_SENT);
 		}
 		if (ismcast)
 			src = src->mclink;
@@ -3137,6 +3326,96 @@ sendpkt(
 }
 
 
+/*
+ * sendpkt_queued - send a unicast reply, in the AF_XDP frame of the
+ * request or through the io_uring if there is one, else at once with
+ * sendpkt().  *sent, unless NULL, gets the time the packet was handed
+ * to the kernel: read just before it was submitted to the ring, or
+ * after sendpkt() returned.  Through the ring *sent stays zero until
+ * the send completes, and for good if the send fails; see
+ * sendpkt_forget() for when *sent goes away before that.
+ */
+void
+sendpkt_queued(
+	sockaddr_u *		dest,
+	struct interface *	ep,
+	struct pkt *		pkt,
+	int			len,
+	l_fp *			sent
+	)
+{
+#ifdef USE_IO_URING
+	struct io_uring_sqe *	sqe;
+	iou_tx *		tx;
+	u_short			slot;
+
+#endif
+#ifdef NTP_XDP
+	if (xdp_reply(dest, ep, pkt, len, sent))
+		return;
+#endif
+#ifdef USE_IO_URING
+	if (iou_ring_fd != -1 && ep != NULL && iou_tx_nfree > 0 &&
+	    !IS_MCAST(dest) && len <= (int)sizeof(tx->pkt) &&
+	    (sqe = iou_sqe()) != NULL) {
+		DPRINTF(2, ("sendpkt_queued(%d, dst=%s, src=%s, len=%d)\n",
+			    ep->fd, stoa(dest), stoa(&ep->sin), len));
+		slot = iou_tx_free[--iou_tx_nfree];
+		tx = &iou_tx_slots[slot];
+		tx->ep = ep;
+		tx->fd = ep->fd;
+		tx->sent = sent;
+		tx->dest = *dest;
+		memcpy(&tx->pkt, pkt, len);
+		tx->iov.iov_base = &tx->pkt;
+		tx->iov.iov_len = len;
+		ZERO(tx->msg);
+		tx->msg.msg_name = &tx->dest;
+		tx->msg.msg_namelen = SOCKLEN(dest);
+		tx->msg.msg_iov = &tx->iov;
+		tx->msg.msg_iovlen = 1;
+		sqe->opcode = IORING_OP_SENDMSG;
+		sqe->fd = ep->fd;
+		sqe->addr = (u_int64)(uintptr_t)&tx->msg;
+		sqe->len = 1;
+		sqe->user_data = IOU_UDATA(IOU_SEND, 0, slot);
+		if (sent != NULL)
+			L_CLR(sent);
+		get_systime(&tx->when);
+		iou_enter(FALSE);
+		return;
+	}
+#endif	/* USE_IO_URING */
+	sendpkt(dest, ep, 0, pkt, len);
+	if (sent != NULL)
+		get_systime(sent);
+}
+
+
+/*
+ * sendpkt_forget - the l_fp a reply queued by sendpkt_queued() was to
+ * stamp is being reused, as when its MRU entry goes to another client,
+ * so leave it alone when the send completes.
+ */
+void
+sendpkt_forget(
+	const l_fp *	sent
+	)
+{
+#ifdef USE_IO_URING
+	int	i;
+
+	if (IOU_TXSLOTS == iou_tx_nfree)
+		return;
+	for (i = 0; i < IOU_TXSLOTS; i++)
+		if (iou_tx_slots[i].sent == sent)
+			iou_tx_slots[i].sent = NULL;
+#else
+	UNUSED_ARG(sent);
+#endif
+}
+
+
 #if !defined(HAVE_IO_COMPLETION_PORT)
 #if !defined(HAVE_SIGNALED_IO)
 /*
@@ -3228,7 +3507,7 @@ read_refclock_packet(
 	consumed = indicate_refclock_packet(rp, rb);
 	if (!consumed) {
 		rp->recvcount++;
-		packets_received++;
+		CTR_INC(CTR_PACKETS_RECEIVED);
 	}
 
 	return buflen;
@@ -3355,6 +3634,37 @@ fetch_timestamp(
 #endif	/* HAVE_PACKET_TIMESTAMP */
 
 
+/*
+ * Bug 2672: Some OSes (MacOSX and Linux) don't block spoofed ::1
+ */
+static int/*BOOL*/
+spoofed_loopback(
+	const struct recvbuf *	rb,
+	const endpt *		itf
+	)
+{
+	if (AF_INET6 != itf->family)
+		return FALSE;
+
+	DPRINTF(2, ("Got an IPv6 packet, from <%s> (%d) to <%s> (%d)\n",
+		stoa(&rb->recv_srcadr),
+		IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(&rb->recv_srcadr)),
+		stoa(&itf->sin),
+		!IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(&itf->sin))
+		));
+
+	if (   IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(&rb->recv_srcadr))
+	    && !IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(&itf->sin))
+	   ) {
+		DPRINTF(2, ("DROPPING that packet\n"));
+		return TRUE;
+	}
+	DPRINTF(2, ("processing that packet\n"));
+
+	return FALSE;
+}
+
+
 /*
  * Routine to read the network NTP packets for a specific interface
  * Return the number of bytes read. That way we know if we should
@@ -3447,27 +3757,10 @@ read_network_packet(
 	DPRINTF(3, ("read_network_packet: fd=%d length %d from %s\n",
 		    fd, buflen, stoa(&rb->recv_srcadr)));
 
-	/*
-	** Bug 2672: Some OSes (MacOSX and Linux) don't block spoofed ::1
-	*/
-
-	if (AF_INET6 == itf->family) {
-		DPRINTF(2, ("Got an IPv6 packet, from <%s> (%d) to <%s> (%d)\n",
-			stoa(&rb->recv_srcadr),
-			IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(&rb->recv_srcadr)),
-			stoa(&itf->sin),
-			!IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(&itf->sin))
-			));
-
-		if (   IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(&rb->recv_srcadr))
-		    && !IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(&itf->sin))
-		   ) {
-			packets_dropped++;
-			DPRINTF(2, ("DROPPING that packet\n"));
-			freerecvbuf(rb);
-			return buflen;
-		}
-		DPRINTF(2, ("processing that packet\n"));
+	if (spoofed_loopback(rb, itf)) {
+		packets_dropped++;
+		freerecvbuf(rb);
+		return buflen;
 	}
 
 	/*
@@ -3485,11 +3778,597 @@ read_network_packet(
 
 	add_full_recv_buffer(rb);
 
-	itf->received++;
-	packets_received++;
+	CTR_OBJ_INC(itf->received);
+	CTR_INC(CTR_PACKETS_RECEIVED);
 	return (buflen);
 }
 
+#ifdef USE_IO_URING
+/*
+ * iou_setup - set up the ring and its buffers.  Returns FALSE, with
+ *	       io_handler() staying with select(), if the kernel lacks
+ *	       any of the io_uring features used.
+ */
+static int/*BOOL*/
+iou_setup(void)
+{
+	struct io_uring_params	p;
+	struct io_uring_buf_reg	reg;
+	u_int32 *		sq_array;
+	u_int32			i;
+	int			fd;
+
+	if (IOU_RXHDR > offsetof(struct recvbuf, recv_space)) {
+		msyslog(LOG_INFO,
+			"io_uring: %lu octets of packet header don't fit in front of a recvbuf, using select()",
+			(u_long)IOU_RXHDR);
+		return FALSE;
+	}
+
+	ZERO(p);
+	p.flags = IORING_SETUP_CQSIZE;
+	p.cq_entries = IOU_CQ_ENTRIES;
+	fd = (int)syscall(__NR_io_uring_setup, IOU_ENTRIES, &p);
+	if (-1 == fd) {
+		msyslog(LOG_INFO, "io_uring_setup: %m, using select()");
+		return FALSE;
+	}
+	if (!(p.features & IORING_FEAT_NODROP)) {
+		msyslog(LOG_INFO, "io_uring: kernel too old, using select()");
+		close(fd);
+		return FALSE;
+	}
+	iou_ring_fd = fd;
+
+	iou_sq_ring_sz = p.sq_off.array + p.sq_entries * sizeof(u_int32);
+	iou_cq_ring_sz = p.cq_off.cqes +
+			 p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+		iou_sq_ring_sz = iou_cq_ring_sz =
+			max(iou_sq_ring_sz, iou_cq_ring_sz);
+	iou_sq_ring = mmap(NULL, iou_sq_ring_sz, PROT_READ | PROT_WRITE,
+			   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if (MAP_FAILED == iou_sq_ring) {
+		iou_sq_ring = NULL;
+		goto fail;
+	}
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		iou_cq_ring = iou_sq_ring;
+	} else {
+		iou_cq_ring = mmap(NULL, iou_cq_ring_sz,
+				   PROT_READ | PROT_WRITE,
+				   MAP_SHARED | MAP_POPULATE, fd,
+				   IORING_OFF_CQ_RING);
+		if (MAP_FAILED == iou_cq_ring) {
+			iou_cq_ring = NULL;
+			goto fail;
+		}
+	}
+	iou_sqes_sz = p.sq_entries * sizeof(struct io_uring_sqe);
+	iou_sqes = mmap(NULL, iou_sqes_sz, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	if (MAP_FAILED == iou_sqes) {
+		iou_sqes = NULL;
+		goto fail;
+	}
+
+	iou_sq_head = (u_int32 *)((char *)iou_sq_ring + p.sq_off.head);
+	iou_sq_tail = (u_int32 *)((char *)iou_sq_ring + p.sq_off.tail);
+	iou_sq_mask = *(u_int32 *)((char *)iou_sq_ring +
+				   p.sq_off.ring_mask);
+	iou_sq_entries = p.sq_entries;
+	iou_sqt = *iou_sq_tail;
+	/* the submission queue indexes the SQEs one to one */
+	sq_array = (u_int32 *)((char *)iou_sq_ring + p.sq_off.array);
+	for (i = 0; i < p.sq_entries; i++)
+		sq_array[i] = i;
+	iou_cq_head = (u_int32 *)((char *)iou_cq_ring + p.cq_off.head);
+	iou_cq_tail = (u_int32 *)((char *)iou_cq_ring + p.cq_off.tail);
+	iou_cq_mask = *(u_int32 *)((char *)iou_cq_ring +
+				   p.cq_off.ring_mask);
+	iou_cqes = (struct io_uring_cqe *)((char *)iou_cq_ring +
+					   p.cq_off.cqes);
+
+	/* the provided buffer ring, recvbufs go on in iou_refill() */
+	iou_br_sz = IOU_RXBUFS * sizeof(struct io_uring_buf);
+	iou_br = mmap(NULL, iou_br_sz, PROT_READ | PROT_WRITE,
+		      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (MAP_FAILED == iou_br) {
+		iou_br = NULL;
+		goto fail;
+	}
+	ZERO(reg);
+	reg.ring_addr = (u_int64)(uintptr_t)iou_br;
+	reg.ring_entries = IOU_RXBUFS;
+	reg.bgid = IOU_BGID;
+	if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PBUF_RING,
+		    &reg, 1) < 0)
+		goto fail;
+	iou_brt = 0;
+	iou_rx_empty = IOU_RXBUFS;
+	iou_refill();
+
+	iou_rxmsg.msg_namelen = sizeof(sockaddr_u);
+	iou_rxmsg.msg_controllen = IOU_CMSGLEN;
+	for (i = 0; i < IOU_TXSLOTS; i++) {
+		iou_tx_slots[i].fd = INVALID_SOCKET;
+		iou_tx_free[i] = (u_short)(IOU_TXSLOTS - 1 - i);
+	}
+	iou_tx_nfree = IOU_TXSLOTS;
+	iou_dirty = TRUE;
+
+	msyslog(LOG_INFO, "Using io_uring for network I/O");
+
+	return TRUE;
+
+    fail:
+	msyslog(LOG_INFO, "io_uring setup: %m, using select()");
+	iou_forget();
+
+	return FALSE;
+}
+
+
+/*
+ * iou_forget - drop the ring, in a forked child or after a failed
+ *		setup.  The child must not touch the parent's queues,
+ *		so the recvbufs on the buffer ring are just left alone.
+ */
+static void
+iou_forget(void)
+{
+	if (-1 == iou_ring_fd)
+		return;
+	if (iou_br != NULL)
+		munmap(iou_br, iou_br_sz);
+	if (iou_sqes != NULL)
+		munmap(iou_sqes, iou_sqes_sz);
+	if (iou_cq_ring != NULL && iou_cq_ring != iou_sq_ring)
+		munmap(iou_cq_ring, iou_cq_ring_sz);
+	if (iou_sq_ring != NULL)
+		munmap(iou_sq_ring, iou_sq_ring_sz);
+	close(iou_ring_fd);
+	iou_br = NULL;
+	iou_sqes = NULL;
+	iou_cq_ring = NULL;
+	iou_sq_ring = NULL;
+	iou_ring_fd = -1;
+}
+
+
+/*
+ * iou_sqe - get a cleared submission queue entry, or NULL if the queue
+ *	     stays full even after submitting what is on it.
+ */
+static struct io_uring_sqe *
+iou_sqe(void)
+{
+	struct io_uring_sqe *	sqe;
+
+	if (iou_sqt - __atomic_load_n(iou_sq_head, __ATOMIC_ACQUIRE) >=
+	    iou_sq_entries) {
+		iou_enter(FALSE);
+		if (iou_sqt - __atomic_load_n(iou_sq_head,
+					      __ATOMIC_ACQUIRE) >=
+		    iou_sq_entries)
+			return NULL;
+	}
+	sqe = &iou_sqes[iou_sqt & iou_sq_mask];
+	ZERO(*sqe);
+	iou_sqt++;
+
+	return sqe;
+}
+
+
+/*
+ * iou_enter - submit the queued requests, and if wait is set, wait for
+ *	       a completion.  SIGALRM ends the wait with EINTR.
+ */
+static int
+iou_enter(
+	int	wait
+	)
+{
+	u_int32	to_submit;
+
+	to_submit = iou_sqt - __atomic_load_n(iou_sq_head, __ATOMIC_ACQUIRE);
+	if (0 == to_submit && !wait)
+		return 0;
+	__atomic_store_n(iou_sq_tail, iou_sqt, __ATOMIC_RELEASE);
+
+	return (int)syscall(__NR_io_uring_enter, iou_ring_fd, to_submit,
+			    (wait) ? 1 : 0,
+			    (wait) ? IORING_ENTER_GETEVENTS : 0,
+			    NULL, 0);
+}
+
+
+/*
+ * iou_arm - put a multishot recvmsg for an NTP socket or a poll for
+ *	     any other descriptor on the ring, or a poll for output.
+ */
+static void
+iou_arm(
+	int	fd,
+	int	kind,
+	endpt *	ep
+	)
+{
+	struct io_uring_sqe *	sqe;
+	iou_fd *		f;
+
+	sqe = iou_sqe();
+	if (NULL == sqe) {
+		iou_dirty = TRUE;	/* try again next time */
+		return;
+	}
+	f = (IOU_POLLOUT == kind) ? &iou_wfds[fd] : &iou_fds[fd];
+	f->gen++;
+	f->ep = ep;
+	f->armed = kind;
+	sqe->fd = fd;
+	sqe->user_data = IOU_UDATA(kind, f->gen, fd);
+	if (IOU_RECV == kind) {
+		sqe->opcode = IORING_OP_RECVMSG;
+		sqe->addr = (u_int64)(uintptr_t)&iou_rxmsg;
+		sqe->len = 1;
+		sqe->ioprio = IORING_RECV_MULTISHOT;
+		sqe->flags = IOSQE_BUFFER_SELECT;
+		sqe->buf_group = IOU_BGID;
+	} else {
+		sqe->opcode = IORING_OP_POLL_ADD;
+		sqe->poll32_events = (IOU_POLLOUT == kind) ? POLLOUT : POLLIN;
+	}
+}
+
+
+/*
+ * iou_disarm - cancel the request for a descriptor, f is its entry in
+ *		iou_fds[] or iou_wfds[].  Completions for it which are
+ *		still to come are recognized as stale by the generation.
+ */
+static void
+iou_disarm(
+	iou_fd *	f,
+	int		fd
+	)
+{
+	struct io_uring_sqe *	sqe;
+
+	if (!f->armed)
+		return;
+	sqe = iou_sqe();
+	if (sqe != NULL) {
+		sqe->opcode = IORING_OP_ASYNC_CANCEL;
+		sqe->addr = IOU_UDATA(f->armed, f->gen, fd);
+		sqe->user_data = IOU_UDATA(IOU_CANCEL, 0, 0);
+	} else {
+		msyslog(LOG_ERR, "io_uring: no room to cancel fd %d", fd);
+	}
+	f->gen++;
+	f->armed = 0;
+	f->ep = NULL;
+}
+
+
+/*
+ * iou_fd_closing - called by maintain_activefds() for a descriptor
+ *		    going away.  The cancellation is submitted right
+ *		    away, as the request holds on to the socket and with
+ *		    it its address.
+ */
+static void
+iou_fd_closing(
+	int	fd
+	)
+{
+	int	i;
+
+	if (-1 == iou_ring_fd)
+		return;
+	for (i = 0; i < IOU_TXSLOTS; i++)
+		if (iou_tx_slots[i].fd == fd)
+			iou_tx_slots[i].ep = NULL;
+	if (iou_fds[fd].armed || iou_wfds[fd].armed) {
+		iou_disarm(&iou_fds[fd], fd);
+		iou_disarm(&iou_wfds[fd], fd);
+		iou_enter(FALSE);
+	}
+}
+
+
+/*
+ * iou_sync - bring the requests on the ring in line with activefds,
+ *	      writefds and the NTP sockets on ep_list.
+ */
+static void
+iou_sync(void)
+{
+	endpt *	ep;
+	iou_fd *f;
+	int	fd;
+	int	kind;
+
+	iou_dirty = FALSE;
+	for (ep = ep_list; ep != NULL; ep = ep->elink) {
+		if (ep->fd >= 0 && ep->fd < FD_SETSIZE)
+			iou_sock_ep[ep->fd] = ep;
+		if ((ep->flags & INT_BCASTOPEN) && ep->bfd >= 0 &&
+		    ep->bfd < FD_SETSIZE)
+			iou_sock_ep[ep->bfd] = ep;
+	}
+	/* iou_fd_closing() disarmed anything past maxactivefd */
+	for (fd = 0; fd <= maxactivefd; fd++) {
+		f = &iou_fds[fd];
+		ep = iou_sock_ep[fd];
+		iou_sock_ep[fd] = NULL;
+		if (!FD_ISSET(fd, &writefds))
+			iou_disarm(&iou_wfds[fd], fd);
+		else if (!iou_wfds[fd].armed)
+			iou_arm(fd, IOU_POLLOUT, NULL);
+		if (!FD_ISSET(fd, &activefds)) {
+			iou_disarm(f, fd);
+			continue;
+		}
+		kind = (ep != NULL && !iou_poll_socks) ? IOU_RECV : IOU_POLL;
+		if (f->armed == kind && f->ep == ep)
+			continue;
+		iou_disarm(f, fd);
+		iou_arm(fd, kind, ep);
+	}
+}
+
+
+/*
+ * iou_refill - put recvbufs on the buffer ring for those taken.
+ */
+static void
+iou_refill(void)
+{
+	struct io_uring_buf *	b;
+	recvbuf_t *		rb;
+	u_short			bid;
+
+	if (0 == iou_rx_empty)
+		return;
+	for (bid = 0; bid < IOU_RXBUFS; bid++) {
+		if (iou_rxbufs[bid] != NULL)
+			continue;
+		rb = get_free_recv_buffer_alloc();
+		iou_rxbufs[bid] = rb;
+		b = &iou_br->bufs[iou_brt & (IOU_RXBUFS - 1)];
+		b->addr = (u_int64)(uintptr_t)
+			  ((char *)&rb->recv_space - IOU_RXHDR);
+		b->len = (u_int32)(IOU_RXHDR + sizeof(rb->recv_space));
+		b->bid = bid;
+		iou_brt++;
+	}
+	iou_rx_empty = 0;
+	__atomic_store_n(&iou_br->tail, iou_brt, __ATOMIC_RELEASE);
+}
+
+
+/*
+ * iou_recv - handle a completion of the recvmsg of an NTP socket,
+ *	      much as read_network_packet() does after recvmsg().
+ */
+static void
+iou_recv(
+	const struct io_uring_cqe *	cqe,
+	l_fp				ts
+	)
+{
+	struct io_uring_recvmsg_out	out;
+	sockaddr_u			from;
+	recvbuf_t *			rb;
+	endpt *				ep;
+	iou_fd *			f;
+	const char *			hdr;
+	u_int32				fd;
+	u_short				bid;
+	int				stale;
+#ifdef HAVE_PACKET_TIMESTAMP
+	struct msghdr			msghdr;
+	union {
+		struct cmsghdr	align;
+		char		buf[IOU_CMSGLEN];
+	}				control;
+#endif
+
+	fd = IOU_INDEX(cqe->user_data);
+	f = &iou_fds[fd];
+	stale = (IOU_GEN(cqe->user_data) != (f->gen & 0xffffff));
+	if (!stale && !(cqe->flags & IORING_CQE_F_MORE)) {
+		/* the multishot ended, ENOBUFS most likely */
+		f->armed = 0;
+		iou_dirty = TRUE;
+	}
+	if (!(cqe->flags & IORING_CQE_F_BUFFER)) {
+		if (-EINVAL == cqe->res && !stale && !iou_poll_socks) {
+			/* before Linux 6.0, let input_handler_scan() read */
+			msyslog(LOG_INFO,
+				"io_uring: no multishot recvmsg, polling NTP sockets");
+			iou_poll_socks = TRUE;
+		} else if (cqe->res < 0 && cqe->res != -ENOBUFS &&
+			   cqe->res != -ECANCELED && !stale) {
+			errno = -cqe->res;
+			msyslog(LOG_ERR, "io_uring recvmsg fd=%u: %m", fd);
+		}
+		return;
+	}
+	bid = (u_short)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+	rb = iou_rxbufs[bid];
+	iou_rxbufs[bid] = NULL;
+	iou_rx_empty++;
+	ep = f->ep;
+	if (stale || NULL == ep || cqe->res < (int)IOU_RXHDR) {
+		freerecvbuf(rb);
+		return;
+	}
+	if (ep->ignore_packets) {
+		packets_ignored++;
+		freerecvbuf(rb);
+		return;
+	}
+
+	/*
+	 * Get the header, address and control message out of the way
+	 * and set up the recvbuf fields they took.
+	 */
+	hdr = (char *)&rb->recv_space - IOU_RXHDR;
+	memcpy(&out, hdr, sizeof(out));
+	memcpy(&from, hdr + sizeof(out), sizeof(from));
+#ifdef HAVE_PACKET_TIMESTAMP
+	memcpy(&control, hdr + sizeof(out) + sizeof(from), IOU_CMSGLEN);
+#endif
+	memset(rb, 0, offsetof(struct recvbuf, recv_space));
+	rb->recv_srcadr = from;
+	rb->recv_length = cqe->res - (int)IOU_RXHDR;
+
+	DPRINTF(3, ("iou_recv: fd=%u length %d from %s\n",
+		    fd, rb->recv_length, stoa(&rb->recv_srcadr)));
+
+	if (spoofed_loopback(rb, ep)) {
+		packets_dropped++;
+		freerecvbuf(rb);
+		return;
+	}
+
+	rb->dstadr = ep;
+	rb->fd = (SOCKET)fd;
+#ifdef HAVE_PACKET_TIMESTAMP
+	ZERO(msghdr);
+	msghdr.msg_control = &control;
+	msghdr.msg_controllen = min(out.controllen, IOU_CMSGLEN);
+	ts = fetch_timestamp(rb, &msghdr, ts);
+#endif
+	rb->recv_time = ts;
+	rb->receiver = receive;
+
+	add_full_recv_buffer(rb);
+
+	CTR_OBJ_INC(ep->received);
+	CTR_INC(CTR_PACKETS_RECEIVED);
+}
+
+
+/*
+ * iou_sent - handle the completion of a queued reply.
+ */
+static void
+iou_sent(
+	const struct io_uring_cqe *	cqe
+	)
+{
+	iou_tx *	tx;
+
+	tx = &iou_tx_slots[IOU_INDEX(cqe->user_data)];
+	if (cqe->res < 0) {
+		if (tx->ep != NULL)
+			tx->ep->notsent++;
+		packets_notsent++;
+	} else {
+		if (tx->ep != NULL)
+			CTR_OBJ_INC(tx->ep->sent);
+		CTR_INC(CTR_PACKETS_SENT);
+		if (tx->sent != NULL)
+			*tx->sent = tx->when;
+	}
+	tx->ep = NULL;
+	tx->fd = INVALID_SOCKET;
+	tx->sent = NULL;
+	iou_tx_free[iou_tx_nfree++] = (u_short)IOU_INDEX(cqe->user_data);
+}
+
+
+/*
+ * iou_wait - io_handler() with the ring: submit what is queued, wait
+ *	      for completions and handle them.
+ */
+static void
+iou_wait(void)
+{
+	const struct io_uring_cqe *	cqe;
+	fd_set				rdfdes;
+	l_fp				ts;
+	iou_fd *			f;
+	u_int32				head;
+	u_int32				tail;
+	u_int32				fd;
+	int				npoll;
+	int				rc;
+
+	++handler_calls;
+	if (iou_dirty)
+		iou_sync();
+	iou_refill();
+
+	head = *iou_cq_head;
+	if (head == __atomic_load_n(iou_cq_tail, __ATOMIC_ACQUIRE)) {
+		rc = iou_enter(TRUE);
+		if (rc < 0 && errno != EINTR && errno != EAGAIN &&
+		    errno != EBUSY)
+			msyslog(LOG_ERR, "io_uring_enter: %m");
+	} else {
+		iou_enter(FALSE);
+	}
+
+	tail = __atomic_load_n(iou_cq_tail, __ATOMIC_ACQUIRE);
+	if (head == tail)
+		return;
+	get_systime(&ts);
+	FD_ZERO(&rdfdes);
+	npoll = 0;
+	for (; head != tail; head++) {
+		cqe = &iou_cqes[head & iou_cq_mask];
+		switch (IOU_KIND(cqe->user_data)) {
+
+		case IOU_RECV:
+			iou_recv(cqe, ts);
+			break;
+
+		case IOU_POLL:
+			fd = IOU_INDEX(cqe->user_data);
+			f = &iou_fds[fd];
+			if (IOU_GEN(cqe->user_data) != (f->gen & 0xffffff))
+				break;
+			f->armed = 0;
+			iou_dirty = TRUE;	/* rearm it */
+			if (cqe->res > 0) {
+				FD_SET(fd, &rdfdes);
+				npoll++;
+			}
+			break;
+
+		case IOU_POLLOUT:
+			/* ctlsock_flush() writes when io_handler() returns */
+			fd = IOU_INDEX(cqe->user_data);
+			f = &iou_wfds[fd];
+			if (IOU_GEN(cqe->user_data) != (f->gen & 0xffffff))
+				break;
+			f->armed = 0;
+			iou_dirty = TRUE;	/* rearm it if still wanted */
+			break;
+
+		case IOU_SEND:
+			iou_sent(cqe);
+			break;
+
+		default:
+			break;
+		}
+	}
+	__atomic_store_n(iou_cq_head, head, __ATOMIC_RELEASE);
+
+	if (npoll > 0)
+		input_handler_scan(&ts, &rdfdes);
+	else
+		CTR_INC(CTR_HANDLER_PKTS);
+}
+#endif	/* USE_IO_URING */
+
+
 /*
  * attempt to handle io (select()/signaled IO)
  */
@@ -3498,8 +4377,16 @@ io_handler(void)
 {
 #  ifndef HAVE_SIGNALED_IO
 	fd_set rdfdes;
+	fd_set wrfdes;
+	fd_set *pwrfdes;
 	int nfound;
 
+#   ifdef USE_IO_URING
+	if (iou_ring_fd != -1) {
+		iou_wait();
+		return;
+	}
+#   endif
 	/*
 	 * Use select() on all on all input fd's for unlimited
 	 * time.  select() will terminate on SIGALARM or on the
@@ -3518,8 +4405,14 @@ io_handler(void)
 	 */
 	++handler_calls;
 	rdfdes = activefds;
+	/* output waiting for room, written by ctlsock_flush() */
+	pwrfdes = NULL;
+	if (nwritefds > 0) {
+		wrfdes = writefds;
+		pwrfdes = &wrfdes;
+	}
 #   if !defined(VMS) && !defined(SYS_VXWORKS)
-	nfound = select(maxactivefd + 1, &rdfdes, NULL,
+	nfound = select(maxactivefd + 1, &rdfdes, pwrfdes,
 			NULL, NULL);
 #   else	/* VMS, VxWorks */
 	/* make select() wake up after one second */
@@ -3528,7 +4421,7 @@ io_handler(void)
 		t1.tv_sec  = 1;
 		t1.tv_usec = 0;
 		nfound = select(maxactivefd + 1,
-				&rdfdes, NULL, NULL,
+				&rdfdes, pwrfdes, NULL,
 				&t1);
 	}
 #   endif	/* VMS, VxWorks */
@@ -3671,14 +4564,13 @@ input_handler_scan(
 #ifdef REFCLOCK
 	struct refclockio *rp;
 	int		saved_errno;
+	int		total;
 	const char *	clk;
 #endif
-#ifdef HAS_ROUTING_SOCKET
 	struct asyncio_reader *	asyncio_reader;
 	struct asyncio_reader *	next_asyncio_reader;
-#endif
 
-	++handler_pkts;
+	CTR_INC(CTR_HANDLER_PKTS);
 	ts = *cts;
 
 #ifdef REFCLOCK
@@ -3711,10 +4603,19 @@ input_handler_scan(
 			msyslog(LOG_ERR, "%s read EOF", clk);
 			maintain_activefds(fd, TRUE);
 		} else {
-			/* drain any remaining refclock input */
-			do {
+			/*
+			 * Drain remaining refclock input, up to a bound
+			 * and only into free buffers; what is left is
+			 * read on the next pass.
+			 */
+			total = buflen;
+			while (total < REFCLOCK_READ_MAX &&
+			       free_recvbuffs() > 0) {
 				buflen = read_refclock_packet(fd, rp, ts);
-			} while (buflen > 0);
+				if (buflen <= 0)
+					break;
+				total += buflen;
+			}
 		}
 	}
 #endif /* REFCLOCK */
@@ -3742,9 +4643,8 @@ input_handler_scan(
 		}
 	}
 
-#ifdef HAS_ROUTING_SOCKET
 	/*
-	 * scan list of asyncio readers - currently only used for routing sockets
+	 * scan list of asyncio readers - routing sockets and ntp_signd
 	 */
 	asyncio_reader = asyncio_reader_list;
 
@@ -3755,7 +4655,6 @@ input_handler_scan(
 			(*asyncio_reader->receiver)(asyncio_reader);
 		asyncio_reader = next_asyncio_reader;
 	}
-#endif /* HAS_ROUTING_SOCKET */
 
 	/*
 	 * Check for a response from a blocking child
@@ -4242,12 +5141,12 @@ io_clr_stats(void)
 {
 	packets_dropped = 0;
 	packets_ignored = 0;
-	packets_received = 0;
-	packets_sent = 0;
+	ctr_clear(CTR_PACKETS_RECEIVED);
+	ctr_clear(CTR_PACKETS_SENT);
 	packets_notsent = 0;
 
 	handler_calls = 0;
-	handler_pkts = 0;
+	ctr_clear(CTR_HANDLER_PKTS);
 	io_timereset = current_time;
 }
 
@@ -4345,6 +5244,11 @@ kill_asyncio(
 {
 	BLOCKIO();
 
+#ifdef USE_IO_URING
+	/* the ring and what is on it belong to the parent */
+	iou_forget();
+#endif
+
 	/*
 	 * In the child process we do not maintain activefds and
 	 * maxactivefd.  Zeroing maxactivefd disables code which
@@ -2,7 +2,7 @@
  * ntp_keyword.h
  * 
  * NOTE: edit this file with caution, it is generated by keyword-gen.c
- *	 Generated 2016-01-16 08:33:03 UTC	  diff_ignore_line
+ *	 Generated 2026-10-17 19:34:29 UTC	  diff_ignore_line
  *
  */
 #include "ntp_scanner.h"
@@ -10,7 +10,7 @@
 
 #define LOWEST_KEYWORD_ID 258
 
-const char * const keyword_text[194] = {
+const char * const keyword_text[199] = {
 	/* 0       258             T_Abbrev */	"abbrev",
 	/* 1       259                T_Age */	"age",
 	/* 2       260                T_All */	"all",
@@ -31,190 +31,195 @@ const char * const keyword_text[194] = {
 	/* 17      275         T_Clockstats */	"clockstats",
 	/* 18      276             T_Cohort */	"cohort",
 	/* 19      277         T_ControlKey */	"controlkey",
-	/* 20      278             T_Crypto */	"crypto",
-	/* 21      279        T_Cryptostats */	"cryptostats",
-	/* 22      280                T_Ctl */	"ctl",
-	/* 23      281                T_Day */	"day",
-	/* 24      282            T_Default */	"default",
-	/* 25      283             T_Digest */	"digest",
-	/* 26      284            T_Disable */	"disable",
-	/* 27      285            T_Discard */	"discard",
-	/* 28      286         T_Dispersion */	"dispersion",
-	/* 29      287             T_Double */	NULL,
-	/* 30      288          T_Driftfile */	"driftfile",
-	/* 31      289               T_Drop */	"drop",
-	/* 32      290               T_Dscp */	"dscp",
-	/* 33      291           T_Ellipsis */	"...",
-	/* 34      292             T_Enable */	"enable",
-	/* 35      293                T_End */	"end",
-	/* 36      294              T_False */	NULL,
-	/* 37      295               T_File */	"file",
-	/* 38      296            T_Filegen */	"filegen",
-	/* 39      297            T_Filenum */	"filenum",
-	/* 40      298              T_Flag1 */	"flag1",
-	/* 41      299              T_Flag2 */	"flag2",
-	/* 42      300              T_Flag3 */	"flag3",
-	/* 43      301              T_Flag4 */	"flag4",
-	/* 44      302              T_Flake */	"flake",
-	/* 45      303              T_Floor */	"floor",
-	/* 46      304               T_Freq */	"freq",
-	/* 47      305              T_Fudge */	"fudge",
-	/* 48      306               T_Host */	"host",
-	/* 49      307           T_Huffpuff */	"huffpuff",
-	/* 50      308             T_Iburst */	"iburst",
-	/* 51      309              T_Ident */	"ident",
-	/* 52      310             T_Ignore */	"ignore",
-	/* 53      311           T_Incalloc */	"incalloc",
-	/* 54      312             T_Incmem */	"incmem",
-	/* 55      313          T_Initalloc */	"initalloc",
-	/* 56      314            T_Initmem */	"initmem",
-	/* 57      315        T_Includefile */	"includefile",
-	/* 58      316            T_Integer */	NULL,
-	/* 59      317          T_Interface */	"interface",
-	/* 60      318           T_Intrange */	NULL,
-	/* 61      319                 T_Io */	"io",
-	/* 62      320               T_Ipv4 */	"ipv4",
-	/* 63      321          T_Ipv4_flag */	"-4",
-	/* 64      322               T_Ipv6 */	"ipv6",
-	/* 65      323          T_Ipv6_flag */	"-6",
-	/* 66      324             T_Kernel */	"kernel",
-	/* 67      325                T_Key */	"key",
-	/* 68      326               T_Keys */	"keys",
-	/* 69      327            T_Keysdir */	"keysdir",
-	/* 70      328                T_Kod */	"kod",
-	/* 71      329             T_Mssntp */	"mssntp",
-	/* 72      330           T_Leapfile */	"leapfile",
-	/* 73      331  T_Leapsmearinterval */	"leapsmearinterval",
-	/* 74      332            T_Limited */	"limited",
-	/* 75      333               T_Link */	"link",
-	/* 76      334             T_Listen */	"listen",
-	/* 77      335          T_Logconfig */	"logconfig",
-	/* 78      336            T_Logfile */	"logfile",
-	/* 79      337          T_Loopstats */	"loopstats",
-	/* 80      338        T_Lowpriotrap */	"lowpriotrap",
-	/* 81      339     T_Manycastclient */	"manycastclient",
-	/* 82      340     T_Manycastserver */	"manycastserver",
-	/* 83      341               T_Mask */	"mask",
-	/* 84      342             T_Maxage */	"maxage",
-	/* 85      343           T_Maxclock */	"maxclock",
-	/* 86      344           T_Maxdepth */	"maxdepth",
-	/* 87      345            T_Maxdist */	"maxdist",
-	/* 88      346             T_Maxmem */	"maxmem",
-	/* 89      347            T_Maxpoll */	"maxpoll",
-	/* 90      348          T_Mdnstries */	"mdnstries",
-	/* 91      349                T_Mem */	"mem",
-	/* 92      350            T_Memlock */	"memlock",
-	/* 93      351           T_Minclock */	"minclock",
-	/* 94      352           T_Mindepth */	"mindepth",
-	/* 95      353            T_Mindist */	"mindist",
-	/* 96      354            T_Minimum */	"minimum",
-	/* 97      355            T_Minpoll */	"minpoll",
-	/* 98      356            T_Minsane */	"minsane",
-	/* 99      357               T_Mode */	"mode",
-	/* 100     358              T_Mode7 */	"mode7",
-	/* 101     359            T_Monitor */	"monitor",
-	/* 102     360              T_Month */	"month",
-	/* 103     361                T_Mru */	"mru",
-	/* 104     362    T_Multicastclient */	"multicastclient",
-	/* 105     363                T_Nic */	"nic",
-	/* 106     364             T_Nolink */	"nolink",
-	/* 107     365           T_Nomodify */	"nomodify",
-	/* 108     366          T_Nomrulist */	"nomrulist",
-	/* 109     367               T_None */	"none",
-	/* 110     368        T_Nonvolatile */	"nonvolatile",
-	/* 111     369             T_Nopeer */	"nopeer",
-	/* 112     370            T_Noquery */	"noquery",
-	/* 113     371           T_Noselect */	"noselect",
-	/* 114     372            T_Noserve */	"noserve",
-	/* 115     373             T_Notrap */	"notrap",
-	/* 116     374            T_Notrust */	"notrust",
-	/* 117     375                T_Ntp */	"ntp",
-	/* 118     376            T_Ntpport */	"ntpport",
-	/* 119     377     T_NtpSignDsocket */	"ntpsigndsocket",
-	/* 120     378             T_Orphan */	"orphan",
-	/* 121     379         T_Orphanwait */	"orphanwait",
-	/* 122     380              T_Panic */	"panic",
-	/* 123     381               T_Peer */	"peer",
-	/* 124     382          T_Peerstats */	"peerstats",
-	/* 125     383              T_Phone */	"phone",
-	/* 126     384                T_Pid */	"pid",
-	/* 127     385            T_Pidfile */	"pidfile",
-	/* 128     386               T_Pool */	"pool",
-	/* 129     387               T_Port */	"port",
-	/* 130     388            T_Preempt */	"preempt",
-	/* 131     389             T_Prefer */	"prefer",
-	/* 132     390         T_Protostats */	"protostats",
-	/* 133     391                 T_Pw */	"pw",
-	/* 134     392           T_Randfile */	"randfile",
-	/* 135     393           T_Rawstats */	"rawstats",
-	/* 136     394              T_Refid */	"refid",
-	/* 137     395         T_Requestkey */	"requestkey",
-	/* 138     396              T_Reset */	"reset",
-	/* 139     397           T_Restrict */	"restrict",
-	/* 140     398             T_Revoke */	"revoke",
-	/* 141     399             T_Rlimit */	"rlimit",
-	/* 142     400      T_Saveconfigdir */	"saveconfigdir",
-	/* 143     401             T_Server */	"server",
-	/* 144     402             T_Setvar */	"setvar",
-	/* 145     403             T_Source */	"source",
-	/* 146     404          T_Stacksize */	"stacksize",
-	/* 147     405         T_Statistics */	"statistics",
-	/* 148     406              T_Stats */	"stats",
-	/* 149     407           T_Statsdir */	"statsdir",
-	/* 150     408               T_Step */	"step",
-	/* 151     409           T_Stepback */	"stepback",
-	/* 152     410            T_Stepfwd */	"stepfwd",
-	/* 153     411            T_Stepout */	"stepout",
-	/* 154     412            T_Stratum */	"stratum",
-	/* 155     413             T_String */	NULL,
-	/* 156     414                T_Sys */	"sys",
-	/* 157     415           T_Sysstats */	"sysstats",
-	/* 158     416               T_Tick */	"tick",
-	/* 159     417              T_Time1 */	"time1",
-	/* 160     418              T_Time2 */	"time2",
-	/* 161     419              T_Timer */	"timer",
-	/* 162     420        T_Timingstats */	"timingstats",
-	/* 163     421             T_Tinker */	"tinker",
-	/* 164     422                T_Tos */	"tos",
-	/* 165     423               T_Trap */	"trap",
-	/* 166     424               T_True */	"true",
-	/* 167     425         T_Trustedkey */	"trustedkey",
-	/* 168     426                T_Ttl */	"ttl",
-	/* 169     427               T_Type */	"type",
-	/* 170     428              T_U_int */	NULL,
-	/* 171     429           T_UEcrypto */	"unpeer_crypto_early",
-	/* 172     430        T_UEcryptonak */	"unpeer_crypto_nak_early",
-	/* 173     431           T_UEdigest */	"unpeer_digest_early",
-	/* 174     432           T_Unconfig */	"unconfig",
-	/* 175     433             T_Unpeer */	"unpeer",
-	/* 176     434            T_Version */	"version",
-	/* 177     435    T_WanderThreshold */	NULL,
-	/* 178     436               T_Week */	"week",
-	/* 179     437           T_Wildcard */	"wildcard",
-	/* 180     438             T_Xleave */	"xleave",
-	/* 181     439               T_Year */	"year",
-	/* 182     440               T_Flag */	NULL,
-	/* 183     441                T_EOC */	NULL,
-	/* 184     442           T_Simulate */	"simulate",
-	/* 185     443         T_Beep_Delay */	"beep_delay",
-	/* 186     444       T_Sim_Duration */	"simulation_duration",
-	/* 187     445      T_Server_Offset */	"server_offset",
-	/* 188     446           T_Duration */	"duration",
-	/* 189     447        T_Freq_Offset */	"freq_offset",
-	/* 190     448             T_Wander */	"wander",
-	/* 191     449             T_Jitter */	"jitter",
-	/* 192     450         T_Prop_Delay */	"prop_delay",
-	/* 193     451         T_Proc_Delay */	"proc_delay"
+	/* 20      278      T_Controlsocket */	"controlsocket",
+	/* 21      279             T_Crypto */	"crypto",
+	/* 22      280        T_Cryptostats */	"cryptostats",
+	/* 23      281                T_Ctl */	"ctl",
+	/* 24      282                T_Day */	"day",
+	/* 25      283            T_Default */	"default",
+	/* 26      284             T_Digest */	"digest",
+	/* 27      285            T_Disable */	"disable",
+	/* 28      286            T_Discard */	"discard",
+	/* 29      287         T_Dispersion */	"dispersion",
+	/* 30      288             T_Double */	NULL,
+	/* 31      289          T_Driftfile */	"driftfile",
+	/* 32      290               T_Drop */	"drop",
+	/* 33      291               T_Dscp */	"dscp",
+	/* 34      292           T_Ellipsis */	"...",
+	/* 35      293             T_Enable */	"enable",
+	/* 36      294                T_End */	"end",
+	/* 37      295              T_False */	NULL,
+	/* 38      296               T_File */	"file",
+	/* 39      297            T_Filegen */	"filegen",
+	/* 40      298            T_Filenum */	"filenum",
+	/* 41      299              T_Flag1 */	"flag1",
+	/* 42      300              T_Flag2 */	"flag2",
+	/* 43      301              T_Flag3 */	"flag3",
+	/* 44      302              T_Flag4 */	"flag4",
+	/* 45      303              T_Flake */	"flake",
+	/* 46      304              T_Floor */	"floor",
+	/* 47      305               T_Freq */	"freq",
+	/* 48      306              T_Fudge */	"fudge",
+	/* 49      307               T_Host */	"host",
+	/* 50      308           T_Huffpuff */	"huffpuff",
+	/* 51      309             T_Iburst */	"iburst",
+	/* 52      310              T_Ident */	"ident",
+	/* 53      311             T_Ignore */	"ignore",
+	/* 54      312           T_Incalloc */	"incalloc",
+	/* 55      313             T_Incmem */	"incmem",
+	/* 56      314          T_Initalloc */	"initalloc",
+	/* 57      315            T_Initmem */	"initmem",
+	/* 58      316        T_Includefile */	"includefile",
+	/* 59      317            T_Integer */	NULL,
+	/* 60      318          T_Interface */	"interface",
+	/* 61      319           T_Intrange */	NULL,
+	/* 62      320                 T_Io */	"io",
+	/* 63      321               T_Ipv4 */	"ipv4",
+	/* 64      322          T_Ipv4_flag */	"-4",
+	/* 65      323               T_Ipv6 */	"ipv6",
+	/* 66      324          T_Ipv6_flag */	"-6",
+	/* 67      325             T_Kernel */	"kernel",
+	/* 68      326                T_Key */	"key",
+	/* 69      327               T_Keys */	"keys",
+	/* 70      328            T_Keysdir */	"keysdir",
+	/* 71      329                T_Kod */	"kod",
+	/* 72      330             T_Mssntp */	"mssntp",
+	/* 73      331           T_Leapfile */	"leapfile",
+	/* 74      332  T_Leapsmearinterval */	"leapsmearinterval",
+	/* 75      333            T_Limited */	"limited",
+	/* 76      334               T_Link */	"link",
+	/* 77      335             T_Listen */	"listen",
+	/* 78      336          T_Logconfig */	"logconfig",
+	/* 79      337            T_Logfile */	"logfile",
+	/* 80      338          T_Loopstats */	"loopstats",
+	/* 81      339        T_Lowpriotrap */	"lowpriotrap",
+	/* 82      340     T_Manycastclient */	"manycastclient",
+	/* 83      341     T_Manycastserver */	"manycastserver",
+	/* 84      342               T_Mask */	"mask",
+	/* 85      343             T_Maxage */	"maxage",
+	/* 86      344           T_Maxclock */	"maxclock",
+	/* 87      345           T_Maxdepth */	"maxdepth",
+	/* 88      346            T_Maxdist */	"maxdist",
+	/* 89      347             T_Maxmem */	"maxmem",
+	/* 90      348            T_Maxpoll */	"maxpoll",
+	/* 91      349          T_Mdnstries */	"mdnstries",
+	/* 92      350                T_Mem */	"mem",
+	/* 93      351            T_Memlock */	"memlock",
+	/* 94      352           T_Minclock */	"minclock",
+	/* 95      353           T_Mindepth */	"mindepth",
+	/* 96      354            T_Mindist */	"mindist",
+	/* 97      355            T_Minimum */	"minimum",
+	/* 98      356            T_Minpoll */	"minpoll",
+	/* 99      357            T_Minsane */	"minsane",
+	/* 100     358               T_Mode */	"mode",
+	/* 101     359              T_Mode7 */	"mode7",
+	/* 102     360            T_Monitor */	"monitor",
+	/* 103     361              T_Month */	"month",
+	/* 104     362                T_Mru */	"mru",
+	/* 105     363    T_Multicastclient */	"multicastclient",
+	/* 106     364                T_Nic */	"nic",
+	/* 107     365             T_Nolink */	"nolink",
+	/* 108     366           T_Nomodify */	"nomodify",
+	/* 109     367          T_Nomrulist */	"nomrulist",
+	/* 110     368               T_None */	"none",
+	/* 111     369        T_Nonvolatile */	"nonvolatile",
+	/* 112     370             T_Nopeer */	"nopeer",
+	/* 113     371            T_Noquery */	"noquery",
+	/* 114     372           T_Noselect */	"noselect",
+	/* 115     373            T_Noserve */	"noserve",
+	/* 116     374             T_Notrap */	"notrap",
+	/* 117     375            T_Notrust */	"notrust",
+	/* 118     376                T_Ntp */	"ntp",
+	/* 119     377            T_Ntpport */	"ntpport",
+	/* 120     378     T_NtpSignDsocket */	"ntpsigndsocket",
+	/* 121     379             T_Orphan */	"orphan",
+	/* 122     380         T_Orphanwait */	"orphanwait",
+	/* 123     381              T_Panic */	"panic",
+	/* 124     382               T_Peer */	"peer",
+	/* 125     383          T_Peerstats */	"peerstats",
+	/* 126     384              T_Phone */	"phone",
+	/* 127     385                T_Pid */	"pid",
+	/* 128     386            T_Pidfile */	"pidfile",
+	/* 129     387               T_Pool */	"pool",
+	/* 130     388               T_Port */	"port",
+	/* 131     389            T_Preempt */	"preempt",
+	/* 132     390             T_Prefer */	"prefer",
+	/* 133     391         T_Protostats */	"protostats",
+	/* 134     392            T_Publish */	"publish",
+	/* 135     393                 T_Pw */	"pw",
+	/* 136     394           T_Randfile */	"randfile",
+	/* 137     395           T_Rawstats */	"rawstats",
+	/* 138     396              T_Refid */	"refid",
+	/* 139     397         T_Requestkey */	"requestkey",
+	/* 140     398              T_Reset */	"reset",
+	/* 141     399           T_Restrict */	"restrict",
+	/* 142     400             T_Revoke */	"revoke",
+	/* 143     401             T_Rlimit */	"rlimit",
+	/* 144     402      T_Saveconfigdir */	"saveconfigdir",
+	/* 145     403              T_Serve */	"serve",
+	/* 146     404             T_Server */	"server",
+	/* 147     405             T_Setvar */	"setvar",
+	/* 148     406        T_Sharedstate */	"sharedstate",
+	/* 149     407             T_Source */	"source",
+	/* 150     408          T_Stacksize */	"stacksize",
+	/* 151     409         T_Statistics */	"statistics",
+	/* 152     410              T_Stats */	"stats",
+	/* 153     411           T_Statsdir */	"statsdir",
+	/* 154     412               T_Step */	"step",
+	/* 155     413           T_Stepback */	"stepback",
+	/* 156     414            T_Stepfwd */	"stepfwd",
+	/* 157     415            T_Stepout */	"stepout",
+	/* 158     416            T_Stratum */	"stratum",
+	/* 159     417             T_String */	NULL,
+	/* 160     418                T_Sys */	"sys",
+	/* 161     419           T_Sysstats */	"sysstats",
+	/* 162     420               T_Tick */	"tick",
+	/* 163     421              T_Time1 */	"time1",
+	/* 164     422              T_Time2 */	"time2",
+	/* 165     423              T_Timer */	"timer",
+	/* 166     424        T_Timingstats */	"timingstats",
+	/* 167     425             T_Tinker */	"tinker",
+	/* 168     426                T_Tos */	"tos",
+	/* 169     427               T_Trap */	"trap",
+	/* 170     428               T_True */	"true",
+	/* 171     429         T_Trustedkey */	"trustedkey",
+	/* 172     430                T_Ttl */	"ttl",
+	/* 173     431               T_Type */	"type",
+	/* 174     432              T_U_int */	NULL,
+	/* 175     433           T_UEcrypto */	"unpeer_crypto_early",
+	/* 176     434        T_UEcryptonak */	"unpeer_crypto_nak_early",
+	/* 177     435           T_UEdigest */	"unpeer_digest_early",
+	/* 178     436           T_Unconfig */	"unconfig",
+	/* 179     437             T_Unpeer */	"unpeer",
+	/* 180     438            T_Version */	"version",
+	/* 181     439    T_WanderThreshold */	NULL,
+	/* 182     440               T_Week */	"week",
+	/* 183     441           T_Wildcard */	"wildcard",
+	/* 184     442                T_Xdp */	"xdp",
+	/* 185     443             T_Xleave */	"xleave",
+	/* 186     444               T_Year */	"year",
+	/* 187     445               T_Flag */	NULL,
+	/* 188     446                T_EOC */	NULL,
+	/* 189     447           T_Simulate */	"simulate",
+	/* 190     448         T_Beep_Delay */	"beep_delay",
+	/* 191     449       T_Sim_Duration */	"simulation_duration",
+	/* 192     450      T_Server_Offset */	"server_offset",
+	/* 193     451           T_Duration */	"duration",
+	/* 194     452        T_Freq_Offset */	"freq_offset",
+	/* 195     453             T_Wander */	"wander",
+	/* 196     454             T_Jitter */	"jitter",
+	/* 197     455         T_Prop_Delay */	"prop_delay",
+	/* 198     456         T_Proc_Delay */	"proc_delay"
 };
 
-#define SCANNER_INIT_S 887
+#define SCANNER_INIT_S 911
 
-const scan_state sst[890] = {
+const scan_state sst[914] = {
 /*SS_T( ch,	f-by, match, other ),				 */
   0,				      /*     0                   */
-  S_ST( '-',	3,      323,     0 ), /*     1                   */
+  S_ST( '-',	3,      324,     0 ), /*     1                   */
   S_ST( '.',	3,        3,     1 ), /*     2                   */
-  S_ST( '.',	3,      291,     0 ), /*     3 .                 */
+  S_ST( '.',	3,      292,     0 ), /*     3 .                 */
   S_ST( 'a',	3,       23,     2 ), /*     4                   */
   S_ST( 'b',	3,        6,     0 ), /*     5 a                 */
   S_ST( 'b',	3,        7,     0 ), /*     6 ab                */
@@ -255,7 +260,7 @@ const scan_state sst[890] = {
   S_ST( 'd',	3,       42,     0 ), /*    41 beep_             */
   S_ST( 'e',	3,       43,     0 ), /*    42 beep_d            */
   S_ST( 'l',	3,       44,     0 ), /*    43 beep_de           */
-  S_ST( 'a',	3,      443,     0 ), /*    44 beep_del          */
+  S_ST( 'a',	3,      448,     0 ), /*    44 beep_del          */
   S_ST( 'r',	3,       46,    34 ), /*    45 b                 */
   S_ST( 'o',	3,       47,     0 ), /*    46 br                */
   S_ST( 'a',	3,       48,     0 ), /*    47 bro               */
@@ -275,7 +280,7 @@ const scan_state sst[890] = {
   S_ST( 'u',	3,       62,    45 ), /*    61 b                 */
   S_ST( 'r',	3,       63,     0 ), /*    62 bu                */
   S_ST( 's',	3,      272,     0 ), /*    63 bur               */
-  S_ST( 'c',	3,      104,    28 ), /*    64                   */
+  S_ST( 'c',	3,      109,    28 ), /*    64                   */
   S_ST( 'a',	3,       66,     0 ), /*    65 c                 */
   S_ST( 'l',	3,       67,     0 ), /*    66 ca                */
   S_ST( 'i',	3,       68,     0 ), /*    67 cal               */
@@ -304,171 +309,171 @@ const scan_state sst[890] = {
   S_ST( 't',	3,       91,     0 ), /*    90 con               */
   S_ST( 'r',	3,       92,     0 ), /*    91 cont              */
   S_ST( 'o',	3,       93,     0 ), /*    92 contr             */
-  S_ST( 'l',	3,       94,     0 ), /*    93 contro            */
+  S_ST( 'l',	3,       96,     0 ), /*    93 contro            */
   S_ST( 'k',	3,       95,     0 ), /*    94 control           */
   S_ST( 'e',	3,      277,     0 ), /*    95 controlk          */
-  S_ST( 'r',	3,       97,    85 ), /*    96 c                 */
-  S_ST( 'y',	3,       98,     0 ), /*    97 cr                */
-  S_ST( 'p',	3,       99,     0 ), /*    98 cry               */
-  S_ST( 't',	3,      278,     0 ), /*    99 cryp              */
-  S_ST( 's',	3,      101,     0 ), /*   100 crypto            */
-  S_ST( 't',	3,      102,     0 ), /*   101 cryptos           */
-  S_ST( 'a',	3,      103,     0 ), /*   102 cryptost          */
-  S_ST( 't',	3,      279,     0 ), /*   103 cryptosta         */
-  S_ST( 't',	3,      280,    96 ), /*   104 c                 */
-  S_ST( 'd',	3,      139,    64 ), /*   105                   */
-  S_ST( 'a',	3,      281,     0 ), /*   106 d                 */
-  S_ST( 'e',	3,      108,   106 ), /*   107 d                 */
-  S_ST( 'f',	3,      109,     0 ), /*   108 de                */
-  S_ST( 'a',	3,      110,     0 ), /*   109 def               */
-  S_ST( 'u',	3,      111,     0 ), /*   110 defa              */
-  S_ST( 'l',	3,      282,     0 ), /*   111 defau             */
-  S_ST( 'i',	3,      116,   107 ), /*   112 d                 */
-  S_ST( 'g',	3,      114,     0 ), /*   113 di                */
-  S_ST( 'e',	3,      115,     0 ), /*   114 dig               */
-  S_ST( 's',	3,      283,     0 ), /*   115 dige              */
-  S_ST( 's',	3,      123,   113 ), /*   116 di                */
-  S_ST( 'a',	3,      118,     0 ), /*   117 dis               */
-  S_ST( 'b',	3,      119,     0 ), /*   118 disa              */
-  S_ST( 'l',	3,      284,     0 ), /*   119 disab             */
-  S_ST( 'c',	3,      121,   117 ), /*   120 dis               */
-  S_ST( 'a',	3,      122,     0 ), /*   121 disc              */
-  S_ST( 'r',	3,      285,     0 ), /*   122 disca             */
-  S_ST( 'p',	3,      124,   120 ), /*   123 dis               */
-  S_ST( 'e',	3,      125,     0 ), /*   124 disp              */
-  S_ST( 'r',	3,      126,     0 ), /*   125 dispe             */
-  S_ST( 's',	3,      127,     0 ), /*   126 disper            */
-  S_ST( 'i',	3,      128,     0 ), /*   127 dispers           */
-  S_ST( 'o',	3,      286,     0 ), /*   128 dispersi          */
-  S_ST( 'r',	3,      136,   112 ), /*   129 d                 */
-  S_ST( 'i',	3,      131,     0 ), /*   130 dr                */
-  S_ST( 'f',	3,      132,     0 ), /*   131 dri               */
-  S_ST( 't',	3,      133,     0 ), /*   132 drif              */
-  S_ST( 'f',	3,      134,     0 ), /*   133 drift             */
-  S_ST( 'i',	3,      135,     0 ), /*   134 driftf            */
-  S_ST( 'l',	3,      288,     0 ), /*   135 driftfi           */
-  S_ST( 'o',	3,      289,   130 ), /*   136 dr                */
-  S_ST( 's',	3,      138,   129 ), /*   137 d                 */
-  S_ST( 'c',	3,      290,     0 ), /*   138 ds                */
-  S_ST( 'u',	3,      140,   137 ), /*   139 d                 */
-  S_ST( 'r',	3,      141,     0 ), /*   140 du                */
-  S_ST( 'a',	3,      142,     0 ), /*   141 dur               */
-  S_ST( 't',	3,      143,     0 ), /*   142 dura              */
-  S_ST( 'i',	3,      144,     0 ), /*   143 durat             */
-  S_ST( 'o',	3,      446,     0 ), /*   144 durati            */
-  S_ST( 'e',	3,      146,   105 ), /*   145                   */
-  S_ST( 'n',	3,      293,     0 ), /*   146 e                 */
-  S_ST( 'a',	3,      148,     0 ), /*   147 en                */
-  S_ST( 'b',	3,      149,     0 ), /*   148 ena               */
-  S_ST( 'l',	3,      292,     0 ), /*   149 enab              */
-  S_ST( 'f',	3,      171,   145 ), /*   150                   */
-  S_ST( 'i',	3,      152,     0 ), /*   151 f                 */
-  S_ST( 'l',	3,      295,     0 ), /*   152 fi                */
-  S_ST( 'g',	3,      154,     0 ), /*   153 file              */
-  S_ST( 'e',	3,      296,     0 ), /*   154 fileg             */
-  S_ST( 'n',	3,      156,   153 ), /*   155 file              */
-  S_ST( 'u',	3,      297,     0 ), /*   156 filen             */
-  S_ST( 'l',	3,      161,   151 ), /*   157 f                 */
-  S_ST( 'a',	3,      160,     0 ), /*   158 fl                */
-  S_ST( 'g',	3,      301,     0 ), /*   159 fla               */
-  S_ST( 'k',	3,      302,   159 ), /*   160 fla               */
-  S_ST( 'o',	3,      162,   158 ), /*   161 fl                */
-  S_ST( 'o',	3,      303,     0 ), /*   162 flo               */
-  S_ST( 'r',	3,      164,   157 ), /*   163 f                 */
-  S_ST( 'e',	3,      304,     0 ), /*   164 fr                */
-  S_ST( '_',	3,      166,     0 ), /*   165 freq              */
-  S_ST( 'o',	3,      167,     0 ), /*   166 freq_             */
-  S_ST( 'f',	3,      168,     0 ), /*   167 freq_o            */
-  S_ST( 'f',	3,      169,     0 ), /*   168 freq_of           */
-  S_ST( 's',	3,      170,     0 ), /*   169 freq_off          */
-  S_ST( 'e',	3,      447,     0 ), /*   170 freq_offs         */
-  S_ST( 'u',	3,      172,   163 ), /*   171 f                 */
-  S_ST( 'd',	3,      173,     0 ), /*   172 fu                */
-  S_ST( 'g',	3,      305,     0 ), /*   173 fud               */
-  S_ST( 'h',	3,      177,   150 ), /*   174                   */
-  S_ST( 'o',	3,      176,     0 ), /*   175 h                 */
-  S_ST( 's',	3,      306,     0 ), /*   176 ho                */
-  S_ST( 'u',	3,      178,   175 ), /*   177 h                 */
-  S_ST( 'f',	3,      179,     0 ), /*   178 hu                */
-  S_ST( 'f',	3,      180,     0 ), /*   179 huf               */
-  S_ST( 'p',	3,      181,     0 ), /*   180 huff              */
-  S_ST( 'u',	3,      182,     0 ), /*   181 huffp             */
-  S_ST( 'f',	3,      307,     0 ), /*   182 huffpu            */
-  S_ST( 'i',	3,      224,   174 ), /*   183                   */
-  S_ST( 'b',	3,      185,     0 ), /*   184 i                 */
-  S_ST( 'u',	3,      186,     0 ), /*   185 ib                */
-  S_ST( 'r',	3,      187,     0 ), /*   186 ibu               */
-  S_ST( 's',	3,      308,     0 ), /*   187 ibur              */
-  S_ST( 'd',	3,      189,   184 ), /*   188 i                 */
-  S_ST( 'e',	3,      190,     0 ), /*   189 id                */
-  S_ST( 'n',	3,      309,     0 ), /*   190 ide               */
-  S_ST( 'g',	3,      192,   188 ), /*   191 i                 */
-  S_ST( 'n',	3,      193,     0 ), /*   192 ig                */
-  S_ST( 'o',	3,      194,     0 ), /*   193 ign               */
-  S_ST( 'r',	3,      310,     0 ), /*   194 igno              */
-  S_ST( 'n',	3,      218,   191 ), /*   195 i                 */
-  S_ST( 'c',	3,      208,     0 ), /*   196 in                */
-  S_ST( 'a',	3,      198,     0 ), /*   197 inc               */
-  S_ST( 'l',	3,      199,     0 ), /*   198 inca              */
-  S_ST( 'l',	3,      200,     0 ), /*   199 incal             */
-  S_ST( 'o',	3,      311,     0 ), /*   200 incall            */
-  S_ST( 'l',	3,      202,   197 ), /*   201 inc               */
-  S_ST( 'u',	3,      203,     0 ), /*   202 incl              */
-  S_ST( 'd',	3,      204,     0 ), /*   203 inclu             */
-  S_ST( 'e',	3,      205,     0 ), /*   204 includ            */
-  S_ST( 'f',	3,      206,     0 ), /*   205 include           */
-  S_ST( 'i',	3,      207,     0 ), /*   206 includef          */
-  S_ST( 'l',	3,      315,     0 ), /*   207 includefi         */
-  S_ST( 'm',	3,      209,   201 ), /*   208 inc               */
-  S_ST( 'e',	3,      312,     0 ), /*   209 incm              */
-  S_ST( 'i',	3,      211,   196 ), /*   210 in                */
-  S_ST( 't',	3,      216,     0 ), /*   211 ini               */
-  S_ST( 'a',	3,      213,     0 ), /*   212 init              */
-  S_ST( 'l',	3,      214,     0 ), /*   213 inita             */
-  S_ST( 'l',	3,      215,     0 ), /*   214 inital            */
-  S_ST( 'o',	3,      313,     0 ), /*   215 initall           */
-  S_ST( 'm',	3,      217,   212 ), /*   216 init              */
-  S_ST( 'e',	3,      314,     0 ), /*   217 initm             */
-  S_ST( 't',	3,      219,   210 ), /*   218 in                */
-  S_ST( 'e',	3,      220,     0 ), /*   219 int               */
-  S_ST( 'r',	3,      221,     0 ), /*   220 inte              */
-  S_ST( 'f',	3,      222,     0 ), /*   221 inter             */
-  S_ST( 'a',	3,      223,     0 ), /*   222 interf            */
-  S_ST( 'c',	3,      317,     0 ), /*   223 interfa           */
-  S_ST( 'p',	3,      225,   319 ), /*   224 i                 */
-  S_ST( 'v',	3,      322,     0 ), /*   225 ip                */
-  S_ST( 'j',	3,      227,   183 ), /*   226                   */
-  S_ST( 'i',	3,      228,     0 ), /*   227 j                 */
-  S_ST( 't',	3,      229,     0 ), /*   228 ji                */
-  S_ST( 't',	3,      230,     0 ), /*   229 jit               */
-  S_ST( 'e',	3,      449,     0 ), /*   230 jitt              */
-  S_ST( 'k',	3,      238,   226 ), /*   231                   */
-  S_ST( 'e',	3,      325,     0 ), /*   232 k                 */
-  S_ST( 'r',	3,      234,     0 ), /*   233 ke                */
-  S_ST( 'n',	3,      235,     0 ), /*   234 ker               */
-  S_ST( 'e',	3,      324,     0 ), /*   235 kern              */
-  S_ST( 'd',	3,      237,     0 ), /*   236 keys              */
-  S_ST( 'i',	3,      327,     0 ), /*   237 keysd             */
-  S_ST( 'o',	3,      328,   232 ), /*   238 k                 */
-  S_ST( 'l',	3,      452,   231 ), /*   239                   */
-  S_ST( 'e',	3,      241,     0 ), /*   240 l                 */
-  S_ST( 'a',	3,      242,     0 ), /*   241 le                */
-  S_ST( 'p',	3,      246,     0 ), /*   242 lea               */
-  S_ST( 'f',	3,      244,     0 ), /*   243 leap              */
-  S_ST( 'i',	3,      245,     0 ), /*   244 leapf             */
-  S_ST( 'l',	3,      330,     0 ), /*   245 leapfi            */
-  S_ST( 's',	3,      247,   243 ), /*   246 leap              */
-  S_ST( 'm',	3,      248,     0 ), /*   247 leaps             */
-  S_ST( 'e',	3,      249,     0 ), /*   248 leapsm            */
-  S_ST( 'a',	3,      250,     0 ), /*   249 leapsme           */
-  S_ST( 'r',	3,      251,     0 ), /*   250 leapsmea          */
-  S_ST( 'i',	3,      252,     0 ), /*   251 leapsmear         */
-  S_ST( 'n',	3,      253,     0 ), /*   252 leapsmeari        */
-  S_ST( 't',	3,      254,     0 ), /*   253 leapsmearin       */
-  S_ST( 'e',	3,      255,     0 ), /*   254 leapsmearint      */
-  S_ST( 'r',	3,      256,     0 ), /*   255 leapsmearinte     */
-  S_ST( 'v',	3,      257,     0 ), /*   256 leapsmearinter    */
-  S_ST( 'a',	3,      331,     0 ), /*   257 leapsmearinterv   */
+  S_ST( 's',	3,       97,    94 ), /*    96 control           */
+  S_ST( 'o',	3,       98,     0 ), /*    97 controls          */
+  S_ST( 'c',	3,       99,     0 ), /*    98 controlso         */
+  S_ST( 'k',	3,      100,     0 ), /*    99 controlsoc        */
+  S_ST( 'e',	3,      278,     0 ), /*   100 controlsock       */
+  S_ST( 'r',	3,      102,    85 ), /*   101 c                 */
+  S_ST( 'y',	3,      103,     0 ), /*   102 cr                */
+  S_ST( 'p',	3,      104,     0 ), /*   103 cry               */
+  S_ST( 't',	3,      279,     0 ), /*   104 cryp              */
+  S_ST( 's',	3,      106,     0 ), /*   105 crypto            */
+  S_ST( 't',	3,      107,     0 ), /*   106 cryptos           */
+  S_ST( 'a',	3,      108,     0 ), /*   107 cryptost          */
+  S_ST( 't',	3,      280,     0 ), /*   108 cryptosta         */
+  S_ST( 't',	3,      281,   101 ), /*   109 c                 */
+  S_ST( 'd',	3,      144,    64 ), /*   110                   */
+  S_ST( 'a',	3,      282,     0 ), /*   111 d                 */
+  S_ST( 'e',	3,      113,   111 ), /*   112 d                 */
+  S_ST( 'f',	3,      114,     0 ), /*   113 de                */
+  S_ST( 'a',	3,      115,     0 ), /*   114 def               */
+  S_ST( 'u',	3,      116,     0 ), /*   115 defa              */
+  S_ST( 'l',	3,      283,     0 ), /*   116 defau             */
+  S_ST( 'i',	3,      121,   112 ), /*   117 d                 */
+  S_ST( 'g',	3,      119,     0 ), /*   118 di                */
+  S_ST( 'e',	3,      120,     0 ), /*   119 dig               */
+  S_ST( 's',	3,      284,     0 ), /*   120 dige              */
+  S_ST( 's',	3,      128,   118 ), /*   121 di                */
+  S_ST( 'a',	3,      123,     0 ), /*   122 dis               */
+  S_ST( 'b',	3,      124,     0 ), /*   123 disa              */
+  S_ST( 'l',	3,      285,     0 ), /*   124 disab             */
+  S_ST( 'c',	3,      126,   122 ), /*   125 dis               */
+  S_ST( 'a',	3,      127,     0 ), /*   126 disc              */
+  S_ST( 'r',	3,      286,     0 ), /*   127 disca             */
+  S_ST( 'p',	3,      129,   125 ), /*   128 dis               */
+  S_ST( 'e',	3,      130,     0 ), /*   129 disp              */
+  S_ST( 'r',	3,      131,     0 ), /*   130 dispe             */
+  S_ST( 's',	3,      132,     0 ), /*   131 disper            */
+  S_ST( 'i',	3,      133,     0 ), /*   132 dispers           */
+  S_ST( 'o',	3,      287,     0 ), /*   133 dispersi          */
+  S_ST( 'r',	3,      141,   117 ), /*   134 d                 */
+  S_ST( 'i',	3,      136,     0 ), /*   135 dr                */
+  S_ST( 'f',	3,      137,     0 ), /*   136 dri               */
+  S_ST( 't',	3,      138,     0 ), /*   137 drif              */
+  S_ST( 'f',	3,      139,     0 ), /*   138 drift             */
+  S_ST( 'i',	3,      140,     0 ), /*   139 driftf            */
+  S_ST( 'l',	3,      289,     0 ), /*   140 driftfi           */
+  S_ST( 'o',	3,      290,   135 ), /*   141 dr                */
+  S_ST( 's',	3,      143,   134 ), /*   142 d                 */
+  S_ST( 'c',	3,      291,     0 ), /*   143 ds                */
+  S_ST( 'u',	3,      145,   142 ), /*   144 d                 */
+  S_ST( 'r',	3,      146,     0 ), /*   145 du                */
+  S_ST( 'a',	3,      147,     0 ), /*   146 dur               */
+  S_ST( 't',	3,      148,     0 ), /*   147 dura              */
+  S_ST( 'i',	3,      149,     0 ), /*   148 durat             */
+  S_ST( 'o',	3,      451,     0 ), /*   149 durati            */
+  S_ST( 'e',	3,      151,   110 ), /*   150                   */
+  S_ST( 'n',	3,      294,     0 ), /*   151 e                 */
+  S_ST( 'a',	3,      153,     0 ), /*   152 en                */
+  S_ST( 'b',	3,      154,     0 ), /*   153 ena               */
+  S_ST( 'l',	3,      293,     0 ), /*   154 enab              */
+  S_ST( 'f',	3,      176,   150 ), /*   155                   */
+  S_ST( 'i',	3,      157,     0 ), /*   156 f                 */
+  S_ST( 'l',	3,      296,     0 ), /*   157 fi                */
+  S_ST( 'g',	3,      159,     0 ), /*   158 file              */
+  S_ST( 'e',	3,      297,     0 ), /*   159 fileg             */
+  S_ST( 'n',	3,      161,   158 ), /*   160 file              */
+  S_ST( 'u',	3,      298,     0 ), /*   161 filen             */
+  S_ST( 'l',	3,      166,   156 ), /*   162 f                 */
+  S_ST( 'a',	3,      165,     0 ), /*   163 fl                */
+  S_ST( 'g',	3,      302,     0 ), /*   164 fla               */
+  S_ST( 'k',	3,      303,   164 ), /*   165 fla               */
+  S_ST( 'o',	3,      167,   163 ), /*   166 fl                */
+  S_ST( 'o',	3,      304,     0 ), /*   167 flo               */
+  S_ST( 'r',	3,      169,   162 ), /*   168 f                 */
+  S_ST( 'e',	3,      305,     0 ), /*   169 fr                */
+  S_ST( '_',	3,      171,     0 ), /*   170 freq              */
+  S_ST( 'o',	3,      172,     0 ), /*   171 freq_             */
+  S_ST( 'f',	3,      173,     0 ), /*   172 freq_o            */
+  S_ST( 'f',	3,      174,     0 ), /*   173 freq_of           */
+  S_ST( 's',	3,      175,     0 ), /*   174 freq_off          */
+  S_ST( 'e',	3,      452,     0 ), /*   175 freq_offs         */
+  S_ST( 'u',	3,      177,   168 ), /*   176 f                 */
+  S_ST( 'd',	3,      178,     0 ), /*   177 fu                */
+  S_ST( 'g',	3,      306,     0 ), /*   178 fud               */
+  S_ST( 'h',	3,      182,   155 ), /*   179                   */
+  S_ST( 'o',	3,      181,     0 ), /*   180 h                 */
+  S_ST( 's',	3,      307,     0 ), /*   181 ho                */
+  S_ST( 'u',	3,      183,   180 ), /*   182 h                 */
+  S_ST( 'f',	3,      184,     0 ), /*   183 hu                */
+  S_ST( 'f',	3,      185,     0 ), /*   184 huf               */
+  S_ST( 'p',	3,      186,     0 ), /*   185 huff              */
+  S_ST( 'u',	3,      187,     0 ), /*   186 huffp             */
+  S_ST( 'f',	3,      308,     0 ), /*   187 huffpu            */
+  S_ST( 'i',	3,      229,   179 ), /*   188                   */
+  S_ST( 'b',	3,      190,     0 ), /*   189 i                 */
+  S_ST( 'u',	3,      191,     0 ), /*   190 ib                */
+  S_ST( 'r',	3,      192,     0 ), /*   191 ibu               */
+  S_ST( 's',	3,      309,     0 ), /*   192 ibur              */
+  S_ST( 'd',	3,      194,   189 ), /*   193 i                 */
+  S_ST( 'e',	3,      195,     0 ), /*   194 id                */
+  S_ST( 'n',	3,      310,     0 ), /*   195 ide               */
+  S_ST( 'g',	3,      197,   193 ), /*   196 i                 */
+  S_ST( 'n',	3,      198,     0 ), /*   197 ig                */
+  S_ST( 'o',	3,      199,     0 ), /*   198 ign               */
+  S_ST( 'r',	3,      311,     0 ), /*   199 igno              */
+  S_ST( 'n',	3,      223,   196 ), /*   200 i                 */
+  S_ST( 'c',	3,      213,     0 ), /*   201 in                */
+  S_ST( 'a',	3,      203,     0 ), /*   202 inc               */
+  S_ST( 'l',	3,      204,     0 ), /*   203 inca              */
+  S_ST( 'l',	3,      205,     0 ), /*   204 incal             */
+  S_ST( 'o',	3,      312,     0 ), /*   205 incall            */
+  S_ST( 'l',	3,      207,   202 ), /*   206 inc               */
+  S_ST( 'u',	3,      208,     0 ), /*   207 incl              */
+  S_ST( 'd',	3,      209,     0 ), /*   208 inclu             */
+  S_ST( 'e',	3,      210,     0 ), /*   209 includ            */
+  S_ST( 'f',	3,      211,     0 ), /*   210 include           */
+  S_ST( 'i',	3,      212,     0 ), /*   211 includef          */
+  S_ST( 'l',	3,      316,     0 ), /*   212 includefi         */
+  S_ST( 'm',	3,      214,   206 ), /*   213 inc               */
+  S_ST( 'e',	3,      313,     0 ), /*   214 incm              */
+  S_ST( 'i',	3,      216,   201 ), /*   215 in                */
+  S_ST( 't',	3,      221,     0 ), /*   216 ini               */
+  S_ST( 'a',	3,      218,     0 ), /*   217 init              */
+  S_ST( 'l',	3,      219,     0 ), /*   218 inita             */
+  S_ST( 'l',	3,      220,     0 ), /*   219 inital            */
+  S_ST( 'o',	3,      314,     0 ), /*   220 initall           */
+  S_ST( 'm',	3,      222,   217 ), /*   221 init              */
+  S_ST( 'e',	3,      315,     0 ), /*   222 initm             */
+  S_ST( 't',	3,      224,   215 ), /*   223 in                */
+  S_ST( 'e',	3,      225,     0 ), /*   224 int               */
+  S_ST( 'r',	3,      226,     0 ), /*   225 inte              */
+  S_ST( 'f',	3,      227,     0 ), /*   226 inter             */
+  S_ST( 'a',	3,      228,     0 ), /*   227 interf            */
+  S_ST( 'c',	3,      318,     0 ), /*   228 interfa           */
+  S_ST( 'p',	3,      230,   320 ), /*   229 i                 */
+  S_ST( 'v',	3,      323,     0 ), /*   230 ip                */
+  S_ST( 'j',	3,      232,   188 ), /*   231                   */
+  S_ST( 'i',	3,      233,     0 ), /*   232 j                 */
+  S_ST( 't',	3,      234,     0 ), /*   233 ji                */
+  S_ST( 't',	3,      235,     0 ), /*   234 jit               */
+  S_ST( 'e',	3,      454,     0 ), /*   235 jitt              */
+  S_ST( 'k',	3,      243,   231 ), /*   236                   */
+  S_ST( 'e',	3,      326,     0 ), /*   237 k                 */
+  S_ST( 'r',	3,      239,     0 ), /*   238 ke                */
+  S_ST( 'n',	3,      240,     0 ), /*   239 ker               */
+  S_ST( 'e',	3,      325,     0 ), /*   240 kern              */
+  S_ST( 'd',	3,      242,     0 ), /*   241 keys              */
+  S_ST( 'i',	3,      328,     0 ), /*   242 keysd             */
+  S_ST( 'o',	3,      329,   237 ), /*   243 k                 */
+  S_ST( 'l',	3,      462,   236 ), /*   244                   */
+  S_ST( 'e',	3,      246,     0 ), /*   245 l                 */
+  S_ST( 'a',	3,      247,     0 ), /*   246 le                */
+  S_ST( 'p',	3,      251,     0 ), /*   247 lea               */
+  S_ST( 'f',	3,      249,     0 ), /*   248 leap              */
+  S_ST( 'i',	3,      250,     0 ), /*   249 leapf             */
+  S_ST( 'l',	3,      331,     0 ), /*   250 leapfi            */
+  S_ST( 's',	3,      252,   248 ), /*   251 leap              */
+  S_ST( 'm',	3,      253,     0 ), /*   252 leaps             */
+  S_ST( 'e',	3,      254,     0 ), /*   253 leapsm            */
+  S_ST( 'a',	3,      255,     0 ), /*   254 leapsme           */
+  S_ST( 'r',	3,      256,     0 ), /*   255 leapsmea          */
+  S_ST( 'i',	3,      257,     0 ), /*   256 leapsmear         */
+  S_ST( 'n',	3,      288,     0 ), /*   257 leapsmeari        */
   S_ST( 'v',	1,        0,     0 ), /*   258 T_Abbrev          */
   S_ST( 'e',	0,        0,     0 ), /*   259 T_Age             */
   S_ST( 'l',	0,       12,     0 ), /*   260 T_All             */
@@ -489,617 +494,641 @@ const scan_state sst[890] = {
   S_ST( 's',	0,        0,     0 ), /*   275 T_Clockstats      */
   S_ST( 't',	0,        0,     0 ), /*   276 T_Cohort          */
   S_ST( 'y',	0,        0,     0 ), /*   277 T_ControlKey      */
-  S_ST( 'o',	0,      100,     0 ), /*   278 T_Crypto          */
-  S_ST( 's',	0,        0,     0 ), /*   279 T_Cryptostats     */
-  S_ST( 'l',	0,        0,     0 ), /*   280 T_Ctl             */
-  S_ST( 'y',	0,        0,     0 ), /*   281 T_Day             */
-  S_ST( 't',	0,        0,     0 ), /*   282 T_Default         */
-  S_ST( 't',	1,        0,     0 ), /*   283 T_Digest          */
-  S_ST( 'e',	0,        0,     0 ), /*   284 T_Disable         */
-  S_ST( 'd',	0,        0,     0 ), /*   285 T_Discard         */
-  S_ST( 'n',	0,        0,     0 ), /*   286 T_Dispersion      */
-  S_ST( 'i',	3,      435,   240 ), /*   287 l                 */
-  S_ST( 'e',	1,        0,     0 ), /*   288 T_Driftfile       */
-  S_ST( 'p',	0,        0,     0 ), /*   289 T_Drop            */
-  S_ST( 'p',	0,        0,     0 ), /*   290 T_Dscp            */
-  S_ST( '.',	0,        0,     0 ), /*   291 T_Ellipsis        */
-  S_ST( 'e',	0,        0,     0 ), /*   292 T_Enable          */
-  S_ST( 'd',	0,        0,   147 ), /*   293 T_End             */
-  S_ST( 'm',	3,      316,     0 ), /*   294 li                */
-  S_ST( 'e',	1,      155,     0 ), /*   295 T_File            */
-  S_ST( 'n',	0,        0,     0 ), /*   296 T_Filegen         */
-  S_ST( 'm',	0,        0,     0 ), /*   297 T_Filenum         */
-  S_ST( '1',	0,        0,     0 ), /*   298 T_Flag1           */
-  S_ST( '2',	0,        0,   298 ), /*   299 T_Flag2           */
-  S_ST( '3',	0,        0,   299 ), /*   300 T_Flag3           */
-  S_ST( '4',	0,        0,   300 ), /*   301 T_Flag4           */
-  S_ST( 'e',	0,        0,     0 ), /*   302 T_Flake           */
-  S_ST( 'r',	0,        0,     0 ), /*   303 T_Floor           */
-  S_ST( 'q',	0,      165,     0 ), /*   304 T_Freq            */
-  S_ST( 'e',	1,        0,     0 ), /*   305 T_Fudge           */
-  S_ST( 't',	1,        0,     0 ), /*   306 T_Host            */
-  S_ST( 'f',	0,        0,     0 ), /*   307 T_Huffpuff        */
-  S_ST( 't',	0,        0,     0 ), /*   308 T_Iburst          */
-  S_ST( 't',	1,        0,     0 ), /*   309 T_Ident           */
-  S_ST( 'e',	0,        0,     0 ), /*   310 T_Ignore          */
-  S_ST( 'c',	0,        0,     0 ), /*   311 T_Incalloc        */
-  S_ST( 'm',	0,        0,     0 ), /*   312 T_Incmem          */
-  S_ST( 'c',	0,        0,     0 ), /*   313 T_Initalloc       */
-  S_ST( 'm',	0,        0,     0 ), /*   314 T_Initmem         */
-  S_ST( 'e',	1,        0,     0 ), /*   315 T_Includefile     */
-  S_ST( 'i',	3,      318,     0 ), /*   316 lim               */
-  S_ST( 'e',	0,        0,     0 ), /*   317 T_Interface       */
-  S_ST( 't',	3,      413,     0 ), /*   318 limi              */
-  S_ST( 'o',	0,        0,   195 ), /*   319 T_Io              */
-  S_ST( '4',	0,        0,     0 ), /*   320 T_Ipv4            */
-  S_ST( '4',	0,        0,     0 ), /*   321 T_Ipv4_flag       */
-  S_ST( '6',	0,        0,   320 ), /*   322 T_Ipv6            */
-  S_ST( '6',	0,        0,   321 ), /*   323 T_Ipv6_flag       */
-  S_ST( 'l',	0,        0,     0 ), /*   324 T_Kernel          */
-  S_ST( 'y',	0,      326,   233 ), /*   325 T_Key             */
-  S_ST( 's',	1,      236,     0 ), /*   326 T_Keys            */
-  S_ST( 'r',	1,        0,     0 ), /*   327 T_Keysdir         */
-  S_ST( 'd',	0,        0,     0 ), /*   328 T_Kod             */
-  S_ST( 'p',	0,        0,     0 ), /*   329 T_Mssntp          */
-  S_ST( 'e',	1,        0,     0 ), /*   330 T_Leapfile        */
-  S_ST( 'l',	0,        0,     0 ), /*   331 T_Leapsmearinterval */
-  S_ST( 'd',	0,        0,     0 ), /*   332 T_Limited         */
-  S_ST( 'k',	0,        0,     0 ), /*   333 T_Link            */
-  S_ST( 'n',	0,        0,     0 ), /*   334 T_Listen          */
-  S_ST( 'g',	2,        0,     0 ), /*   335 T_Logconfig       */
-  S_ST( 'e',	1,        0,     0 ), /*   336 T_Logfile         */
-  S_ST( 's',	0,        0,     0 ), /*   337 T_Loopstats       */
-  S_ST( 'p',	0,        0,     0 ), /*   338 T_Lowpriotrap     */
-  S_ST( 't',	1,        0,     0 ), /*   339 T_Manycastclient  */
-  S_ST( 'r',	2,        0,     0 ), /*   340 T_Manycastserver  */
-  S_ST( 'k',	0,        0,     0 ), /*   341 T_Mask            */
-  S_ST( 'e',	0,        0,     0 ), /*   342 T_Maxage          */
-  S_ST( 'k',	0,        0,     0 ), /*   343 T_Maxclock        */
-  S_ST( 'h',	0,        0,     0 ), /*   344 T_Maxdepth        */
-  S_ST( 't',	0,        0,     0 ), /*   345 T_Maxdist         */
-  S_ST( 'm',	0,        0,     0 ), /*   346 T_Maxmem          */
-  S_ST( 'l',	0,        0,     0 ), /*   347 T_Maxpoll         */
-  S_ST( 's',	0,        0,     0 ), /*   348 T_Mdnstries       */
-  S_ST( 'm',	0,      521,     0 ), /*   349 T_Mem             */
-  S_ST( 'k',	0,        0,     0 ), /*   350 T_Memlock         */
-  S_ST( 'k',	0,        0,     0 ), /*   351 T_Minclock        */
-  S_ST( 'h',	0,        0,     0 ), /*   352 T_Mindepth        */
-  S_ST( 't',	0,        0,     0 ), /*   353 T_Mindist         */
-  S_ST( 'm',	0,        0,     0 ), /*   354 T_Minimum         */
-  S_ST( 'l',	0,        0,     0 ), /*   355 T_Minpoll         */
-  S_ST( 'e',	0,        0,     0 ), /*   356 T_Minsane         */
-  S_ST( 'e',	0,      358,     0 ), /*   357 T_Mode            */
-  S_ST( '7',	0,        0,     0 ), /*   358 T_Mode7           */
-  S_ST( 'r',	0,        0,     0 ), /*   359 T_Monitor         */
-  S_ST( 'h',	0,        0,     0 ), /*   360 T_Month           */
-  S_ST( 'u',	0,        0,     0 ), /*   361 T_Mru             */
-  S_ST( 't',	2,        0,     0 ), /*   362 T_Multicastclient */
-  S_ST( 'c',	0,        0,     0 ), /*   363 T_Nic             */
-  S_ST( 'k',	0,        0,     0 ), /*   364 T_Nolink          */
-  S_ST( 'y',	0,        0,     0 ), /*   365 T_Nomodify        */
-  S_ST( 't',	0,        0,     0 ), /*   366 T_Nomrulist       */
-  S_ST( 'e',	0,        0,     0 ), /*   367 T_None            */
-  S_ST( 'e',	0,        0,     0 ), /*   368 T_Nonvolatile     */
-  S_ST( 'r',	0,        0,     0 ), /*   369 T_Nopeer          */
-  S_ST( 'y',	0,        0,     0 ), /*   370 T_Noquery         */
-  S_ST( 't',	0,        0,     0 ), /*   371 T_Noselect        */
-  S_ST( 'e',	0,        0,     0 ), /*   372 T_Noserve         */
-  S_ST( 'p',	0,        0,     0 ), /*   373 T_Notrap          */
-  S_ST( 't',	0,        0,     0 ), /*   374 T_Notrust         */
-  S_ST( 'p',	0,      617,     0 ), /*   375 T_Ntp             */
-  S_ST( 't',	0,        0,     0 ), /*   376 T_Ntpport         */
-  S_ST( 't',	1,        0,     0 ), /*   377 T_NtpSignDsocket  */
-  S_ST( 'n',	0,      632,     0 ), /*   378 T_Orphan          */
-  S_ST( 't',	0,        0,     0 ), /*   379 T_Orphanwait      */
-  S_ST( 'c',	0,        0,     0 ), /*   380 T_Panic           */
-  S_ST( 'r',	1,      641,     0 ), /*   381 T_Peer            */
-  S_ST( 's',	0,        0,     0 ), /*   382 T_Peerstats       */
-  S_ST( 'e',	2,        0,     0 ), /*   383 T_Phone           */
-  S_ST( 'd',	0,      649,     0 ), /*   384 T_Pid             */
-  S_ST( 'e',	1,        0,     0 ), /*   385 T_Pidfile         */
-  S_ST( 'l',	1,        0,     0 ), /*   386 T_Pool            */
-  S_ST( 't',	0,        0,     0 ), /*   387 T_Port            */
-  S_ST( 't',	0,        0,     0 ), /*   388 T_Preempt         */
-  S_ST( 'r',	0,        0,     0 ), /*   389 T_Prefer          */
-  S_ST( 's',	0,        0,     0 ), /*   390 T_Protostats      */
-  S_ST( 'w',	1,        0,   655 ), /*   391 T_Pw              */
-  S_ST( 'e',	1,        0,     0 ), /*   392 T_Randfile        */
-  S_ST( 's',	0,        0,     0 ), /*   393 T_Rawstats        */
-  S_ST( 'd',	1,        0,     0 ), /*   394 T_Refid           */
-  S_ST( 'y',	0,        0,     0 ), /*   395 T_Requestkey      */
-  S_ST( 't',	0,        0,     0 ), /*   396 T_Reset           */
-  S_ST( 't',	0,        0,     0 ), /*   397 T_Restrict        */
-  S_ST( 'e',	0,        0,     0 ), /*   398 T_Revoke          */
-  S_ST( 't',	0,        0,     0 ), /*   399 T_Rlimit          */
-  S_ST( 'r',	1,        0,     0 ), /*   400 T_Saveconfigdir   */
-  S_ST( 'r',	1,      732,     0 ), /*   401 T_Server          */
-  S_ST( 'r',	1,        0,     0 ), /*   402 T_Setvar          */
-  S_ST( 'e',	0,        0,     0 ), /*   403 T_Source          */
-  S_ST( 'e',	0,        0,     0 ), /*   404 T_Stacksize       */
-  S_ST( 's',	0,        0,     0 ), /*   405 T_Statistics      */
-  S_ST( 's',	0,      775,   770 ), /*   406 T_Stats           */
-  S_ST( 'r',	1,        0,     0 ), /*   407 T_Statsdir        */
-  S_ST( 'p',	0,      783,     0 ), /*   408 T_Step            */
-  S_ST( 'k',	0,        0,     0 ), /*   409 T_Stepback        */
-  S_ST( 'd',	0,        0,     0 ), /*   410 T_Stepfwd         */
-  S_ST( 't',	0,        0,     0 ), /*   411 T_Stepout         */
-  S_ST( 'm',	0,        0,     0 ), /*   412 T_Stratum         */
-  S_ST( 'e',	3,      332,     0 ), /*   413 limit             */
-  S_ST( 's',	0,      790,     0 ), /*   414 T_Sys             */
-  S_ST( 's',	0,        0,     0 ), /*   415 T_Sysstats        */
-  S_ST( 'k',	0,        0,     0 ), /*   416 T_Tick            */
-  S_ST( '1',	0,        0,     0 ), /*   417 T_Time1           */
-  S_ST( '2',	0,        0,   417 ), /*   418 T_Time2           */
-  S_ST( 'r',	0,        0,   418 ), /*   419 T_Timer           */
-  S_ST( 's',	0,        0,     0 ), /*   420 T_Timingstats     */
-  S_ST( 'r',	0,        0,     0 ), /*   421 T_Tinker          */
-  S_ST( 's',	0,        0,     0 ), /*   422 T_Tos             */
-  S_ST( 'p',	1,        0,     0 ), /*   423 T_Trap            */
-  S_ST( 'e',	0,        0,     0 ), /*   424 T_True            */
-  S_ST( 'y',	0,        0,     0 ), /*   425 T_Trustedkey      */
-  S_ST( 'l',	0,        0,     0 ), /*   426 T_Ttl             */
-  S_ST( 'e',	0,        0,     0 ), /*   427 T_Type            */
-  S_ST( 'n',	3,      333,   294 ), /*   428 li                */
-  S_ST( 'y',	0,        0,     0 ), /*   429 T_UEcrypto        */
-  S_ST( 'y',	0,        0,     0 ), /*   430 T_UEcryptonak     */
-  S_ST( 'y',	0,        0,     0 ), /*   431 T_UEdigest        */
-  S_ST( 'g',	1,        0,     0 ), /*   432 T_Unconfig        */
-  S_ST( 'r',	1,      832,     0 ), /*   433 T_Unpeer          */
-  S_ST( 'n',	0,        0,     0 ), /*   434 T_Version         */
-  S_ST( 's',	3,      440,   428 ), /*   435 li                */
-  S_ST( 'k',	0,        0,     0 ), /*   436 T_Week            */
-  S_ST( 'd',	0,        0,     0 ), /*   437 T_Wildcard        */
-  S_ST( 'e',	0,        0,     0 ), /*   438 T_Xleave          */
-  S_ST( 'r',	0,        0,     0 ), /*   439 T_Year            */
-  S_ST( 't',	3,      441,     0 ), /*   440 lis               */
-  S_ST( 'e',	3,      334,     0 ), /*   441 list              */
-  S_ST( 'e',	0,        0,     0 ), /*   442 T_Simulate        */
-  S_ST( 'y',	0,        0,     0 ), /*   443 T_Beep_Delay      */
-  S_ST( 'n',	0,        0,     0 ), /*   444 T_Sim_Duration    */
-  S_ST( 't',	0,        0,     0 ), /*   445 T_Server_Offset   */
-  S_ST( 'n',	0,        0,     0 ), /*   446 T_Duration        */
-  S_ST( 't',	0,        0,     0 ), /*   447 T_Freq_Offset     */
-  S_ST( 'r',	0,        0,     0 ), /*   448 T_Wander          */
-  S_ST( 'r',	0,        0,     0 ), /*   449 T_Jitter          */
-  S_ST( 'y',	0,        0,     0 ), /*   450 T_Prop_Delay      */
-  S_ST( 'y',	0,        0,     0 ), /*   451 T_Proc_Delay      */
-  S_ST( 'o',	3,      468,   287 ), /*   452 l                 */
-  S_ST( 'g',	3,      459,     0 ), /*   453 lo                */
-  S_ST( 'c',	3,      455,     0 ), /*   454 log               */
-  S_ST( 'o',	3,      456,     0 ), /*   455 logc              */
-  S_ST( 'n',	3,      457,     0 ), /*   456 logco             */
-  S_ST( 'f',	3,      458,     0 ), /*   457 logcon            */
-  S_ST( 'i',	3,      335,     0 ), /*   458 logconf           */
-  S_ST( 'f',	3,      460,   454 ), /*   459 log               */
-  S_ST( 'i',	3,      461,     0 ), /*   460 logf              */
-  S_ST( 'l',	3,      336,     0 ), /*   461 logfi             */
-  S_ST( 'o',	3,      463,   453 ), /*   462 lo                */
-  S_ST( 'p',	3,      464,     0 ), /*   463 loo               */
-  S_ST( 's',	3,      465,     0 ), /*   464 loop              */
-  S_ST( 't',	3,      466,     0 ), /*   465 loops             */
-  S_ST( 'a',	3,      467,     0 ), /*   466 loopst            */
-  S_ST( 't',	3,      337,     0 ), /*   467 loopsta           */
-  S_ST( 'w',	3,      469,   462 ), /*   468 lo                */
-  S_ST( 'p',	3,      470,     0 ), /*   469 low               */
-  S_ST( 'r',	3,      471,     0 ), /*   470 lowp              */
-  S_ST( 'i',	3,      472,     0 ), /*   471 lowpr             */
-  S_ST( 'o',	3,      473,     0 ), /*   472 lowpri            */
-  S_ST( 't',	3,      474,     0 ), /*   473 lowprio           */
-  S_ST( 'r',	3,      475,     0 ), /*   474 lowpriot          */
-  S_ST( 'a',	3,      338,     0 ), /*   475 lowpriotr         */
-  S_ST( 'm',	3,      557,   239 ), /*   476                   */
-  S_ST( 'a',	3,      495,     0 ), /*   477 m                 */
-  S_ST( 'n',	3,      479,     0 ), /*   478 ma                */
-  S_ST( 'y',	3,      480,     0 ), /*   479 man               */
-  S_ST( 'c',	3,      481,     0 ), /*   480 many              */
-  S_ST( 'a',	3,      482,     0 ), /*   481 manyc             */
-  S_ST( 's',	3,      483,     0 ), /*   482 manyca            */
-  S_ST( 't',	3,      489,     0 ), /*   483 manycas           */
-  S_ST( 'c',	3,      485,     0 ), /*   484 manycast          */
-  S_ST( 'l',	3,      486,     0 ), /*   485 manycastc         */
-  S_ST( 'i',	3,      487,     0 ), /*   486 manycastcl        */
-  S_ST( 'e',	3,      488,     0 ), /*   487 manycastcli       */
-  S_ST( 'n',	3,      339,     0 ), /*   488 manycastclie      */
-  S_ST( 's',	3,      490,   484 ), /*   489 manycast          */
-  S_ST( 'e',	3,      491,     0 ), /*   490 manycasts         */
-  S_ST( 'r',	3,      492,     0 ), /*   491 manycastse        */
-  S_ST( 'v',	3,      493,     0 ), /*   492 manycastser       */
-  S_ST( 'e',	3,      340,     0 ), /*   493 manycastserv      */
-  S_ST( 's',	3,      341,   478 ), /*   494 ma                */
-  S_ST( 'x',	3,      510,   494 ), /*   495 ma                */
-  S_ST( 'a',	3,      497,     0 ), /*   496 max               */
-  S_ST( 'g',	3,      342,     0 ), /*   497 maxa              */
-  S_ST( 'c',	3,      499,   496 ), /*   498 max               */
-  S_ST( 'l',	3,      500,     0 ), /*   499 maxc              */
-  S_ST( 'o',	3,      501,     0 ), /*   500 maxcl             */
-  S_ST( 'c',	3,      343,     0 ), /*   501 maxclo            */
-  S_ST( 'd',	3,      506,   498 ), /*   502 max               */
-  S_ST( 'e',	3,      504,     0 ), /*   503 maxd              */
-  S_ST( 'p',	3,      505,     0 ), /*   504 maxde             */
-  S_ST( 't',	3,      344,     0 ), /*   505 maxdep            */
-  S_ST( 'i',	3,      507,   503 ), /*   506 maxd              */
-  S_ST( 's',	3,      345,     0 ), /*   507 maxdi             */
-  S_ST( 'm',	3,      509,   502 ), /*   508 max               */
-  S_ST( 'e',	3,      346,     0 ), /*   509 maxm              */
-  S_ST( 'p',	3,      511,   508 ), /*   510 max               */
-  S_ST( 'o',	3,      512,     0 ), /*   511 maxp              */
-  S_ST( 'l',	3,      347,     0 ), /*   512 maxpo             */
-  S_ST( 'd',	3,      514,   477 ), /*   513 m                 */
-  S_ST( 'n',	3,      515,     0 ), /*   514 md                */
-  S_ST( 's',	3,      516,     0 ), /*   515 mdn               */
-  S_ST( 't',	3,      517,     0 ), /*   516 mdns              */
-  S_ST( 'r',	3,      518,     0 ), /*   517 mdnst             */
-  S_ST( 'i',	3,      519,     0 ), /*   518 mdnstr            */
-  S_ST( 'e',	3,      348,     0 ), /*   519 mdnstri           */
-  S_ST( 'e',	3,      349,   513 ), /*   520 m                 */
-  S_ST( 'l',	3,      522,     0 ), /*   521 mem               */
-  S_ST( 'o',	3,      523,     0 ), /*   522 meml              */
-  S_ST( 'c',	3,      350,     0 ), /*   523 memlo             */
-  S_ST( 'i',	3,      525,   520 ), /*   524 m                 */
-  S_ST( 'n',	3,      542,     0 ), /*   525 mi                */
-  S_ST( 'c',	3,      527,     0 ), /*   526 min               */
-  S_ST( 'l',	3,      528,     0 ), /*   527 minc              */
-  S_ST( 'o',	3,      529,     0 ), /*   528 mincl             */
-  S_ST( 'c',	3,      351,     0 ), /*   529 minclo            */
-  S_ST( 'd',	3,      534,   526 ), /*   530 min               */
-  S_ST( 'e',	3,      532,     0 ), /*   531 mind              */
-  S_ST( 'p',	3,      533,     0 ), /*   532 minde             */
-  S_ST( 't',	3,      352,     0 ), /*   533 mindep            */
-  S_ST( 'i',	3,      535,   531 ), /*   534 mind              */
-  S_ST( 's',	3,      353,     0 ), /*   535 mindi             */
-  S_ST( 'i',	3,      537,   530 ), /*   536 min               */
-  S_ST( 'm',	3,      538,     0 ), /*   537 mini              */
-  S_ST( 'u',	3,      354,     0 ), /*   538 minim             */
-  S_ST( 'p',	3,      540,   536 ), /*   539 min               */
-  S_ST( 'o',	3,      541,     0 ), /*   540 minp              */
-  S_ST( 'l',	3,      355,     0 ), /*   541 minpo             */
-  S_ST( 's',	3,      543,   539 ), /*   542 min               */
-  S_ST( 'a',	3,      544,     0 ), /*   543 mins              */
-  S_ST( 'n',	3,      356,     0 ), /*   544 minsa             */
-  S_ST( 'o',	3,      547,   524 ), /*   545 m                 */
-  S_ST( 'd',	3,      357,     0 ), /*   546 mo                */
-  S_ST( 'n',	3,      551,   546 ), /*   547 mo                */
-  S_ST( 'i',	3,      549,     0 ), /*   548 mon               */
-  S_ST( 't',	3,      550,     0 ), /*   549 moni              */
-  S_ST( 'o',	3,      359,     0 ), /*   550 monit             */
-  S_ST( 't',	3,      360,   548 ), /*   551 mon               */
-  S_ST( 'r',	3,      361,   545 ), /*   552 m                 */
-  S_ST( 's',	3,      554,   552 ), /*   553 m                 */
-  S_ST( 's',	3,      555,     0 ), /*   554 ms                */
-  S_ST( 'n',	3,      556,     0 ), /*   555 mss               */
-  S_ST( 't',	3,      329,     0 ), /*   556 mssn              */
-  S_ST( 'u',	3,      558,   553 ), /*   557 m                 */
-  S_ST( 'l',	3,      559,     0 ), /*   558 mu                */
-  S_ST( 't',	3,      560,     0 ), /*   559 mul               */
-  S_ST( 'i',	3,      561,     0 ), /*   560 mult              */
-  S_ST( 'c',	3,      562,     0 ), /*   561 multi             */
-  S_ST( 'a',	3,      563,     0 ), /*   562 multic            */
-  S_ST( 's',	3,      564,     0 ), /*   563 multica           */
-  S_ST( 't',	3,      565,     0 ), /*   564 multicas          */
-  S_ST( 'c',	3,      566,     0 ), /*   565 multicast         */
-  S_ST( 'l',	3,      567,     0 ), /*   566 multicastc        */
-  S_ST( 'i',	3,      568,     0 ), /*   567 multicastcl       */
-  S_ST( 'e',	3,      569,     0 ), /*   568 multicastcli      */
-  S_ST( 'n',	3,      362,     0 ), /*   569 multicastclie     */
-  S_ST( 'n',	3,      613,   476 ), /*   570                   */
-  S_ST( 'i',	3,      363,     0 ), /*   571 n                 */
-  S_ST( 'o',	3,      608,   571 ), /*   572 n                 */
-  S_ST( 'l',	3,      574,     0 ), /*   573 no                */
-  S_ST( 'i',	3,      575,     0 ), /*   574 nol               */
-  S_ST( 'n',	3,      364,     0 ), /*   575 noli              */
-  S_ST( 'm',	3,      581,   573 ), /*   576 no                */
-  S_ST( 'o',	3,      578,     0 ), /*   577 nom               */
-  S_ST( 'd',	3,      579,     0 ), /*   578 nomo              */
-  S_ST( 'i',	3,      580,     0 ), /*   579 nomod             */
-  S_ST( 'f',	3,      365,     0 ), /*   580 nomodi            */
-  S_ST( 'r',	3,      582,   577 ), /*   581 nom               */
-  S_ST( 'u',	3,      583,     0 ), /*   582 nomr              */
-  S_ST( 'l',	3,      584,     0 ), /*   583 nomru             */
-  S_ST( 'i',	3,      585,     0 ), /*   584 nomrul            */
-  S_ST( 's',	3,      366,     0 ), /*   585 nomruli           */
-  S_ST( 'n',	3,      587,   576 ), /*   586 no                */
-  S_ST( 'v',	3,      588,   367 ), /*   587 non               */
-  S_ST( 'o',	3,      589,     0 ), /*   588 nonv              */
-  S_ST( 'l',	3,      590,     0 ), /*   589 nonvo             */
-  S_ST( 'a',	3,      591,     0 ), /*   590 nonvol            */
-  S_ST( 't',	3,      592,     0 ), /*   591 nonvola           */
-  S_ST( 'i',	3,      593,     0 ), /*   592 nonvolat          */
-  S_ST( 'l',	3,      368,     0 ), /*   593 nonvolati         */
-  S_ST( 'p',	3,      595,   586 ), /*   594 no                */
-  S_ST( 'e',	3,      596,     0 ), /*   595 nop               */
-  S_ST( 'e',	3,      369,     0 ), /*   596 nope              */
-  S_ST( 'q',	3,      598,   594 ), /*   597 no                */
-  S_ST( 'u',	3,      599,     0 ), /*   598 noq               */
-  S_ST( 'e',	3,      600,     0 ), /*   599 noqu              */
-  S_ST( 'r',	3,      370,     0 ), /*   600 noque             */
-  S_ST( 's',	3,      602,   597 ), /*   601 no                */
-  S_ST( 'e',	3,      606,     0 ), /*   602 nos               */
-  S_ST( 'l',	3,      604,     0 ), /*   603 nose              */
-  S_ST( 'e',	3,      605,     0 ), /*   604 nosel             */
-  S_ST( 'c',	3,      371,     0 ), /*   605 nosele            */
-  S_ST( 'r',	3,      607,   603 ), /*   606 nose              */
-  S_ST( 'v',	3,      372,     0 ), /*   607 noser             */
-  S_ST( 't',	3,      609,   601 ), /*   608 no                */
-  S_ST( 'r',	3,      611,     0 ), /*   609 not               */
-  S_ST( 'a',	3,      373,     0 ), /*   610 notr              */
-  S_ST( 'u',	3,      612,   610 ), /*   611 notr              */
-  S_ST( 's',	3,      374,     0 ), /*   612 notru             */
-  S_ST( 't',	3,      375,   572 ), /*   613 n                 */
-  S_ST( 'p',	3,      615,     0 ), /*   614 ntp               */
-  S_ST( 'o',	3,      616,     0 ), /*   615 ntpp              */
-  S_ST( 'r',	3,      376,     0 ), /*   616 ntppo             */
-  S_ST( 's',	3,      618,   614 ), /*   617 ntp               */
-  S_ST( 'i',	3,      619,     0 ), /*   618 ntps              */
-  S_ST( 'g',	3,      620,     0 ), /*   619 ntpsi             */
-  S_ST( 'n',	3,      621,     0 ), /*   620 ntpsig            */
-  S_ST( 'd',	3,      622,     0 ), /*   621 ntpsign           */
-  S_ST( 's',	3,      623,     0 ), /*   622 ntpsignd          */
-  S_ST( 'o',	3,      624,     0 ), /*   623 ntpsignds         */
-  S_ST( 'c',	3,      625,     0 ), /*   624 ntpsigndso        */
-  S_ST( 'k',	3,      626,     0 ), /*   625 ntpsigndsoc       */
-  S_ST( 'e',	3,      377,     0 ), /*   626 ntpsigndsock      */
-  S_ST( 'o',	3,      628,   570 ), /*   627                   */
-  S_ST( 'r',	3,      629,     0 ), /*   628 o                 */
-  S_ST( 'p',	3,      630,     0 ), /*   629 or                */
-  S_ST( 'h',	3,      631,     0 ), /*   630 orp               */
-  S_ST( 'a',	3,      378,     0 ), /*   631 orph              */
-  S_ST( 'w',	3,      633,     0 ), /*   632 orphan            */
-  S_ST( 'a',	3,      634,     0 ), /*   633 orphanw           */
-  S_ST( 'i',	3,      379,     0 ), /*   634 orphanwa          */
-  S_ST( 'p',	3,      391,   627 ), /*   635                   */
-  S_ST( 'a',	3,      637,     0 ), /*   636 p                 */
-  S_ST( 'n',	3,      638,     0 ), /*   637 pa                */
-  S_ST( 'i',	3,      380,     0 ), /*   638 pan               */
-  S_ST( 'e',	3,      640,   636 ), /*   639 p                 */
-  S_ST( 'e',	3,      381,     0 ), /*   640 pe                */
-  S_ST( 's',	3,      642,     0 ), /*   641 peer              */
-  S_ST( 't',	3,      643,     0 ), /*   642 peers             */
-  S_ST( 'a',	3,      644,     0 ), /*   643 peerst            */
-  S_ST( 't',	3,      382,     0 ), /*   644 peersta           */
-  S_ST( 'h',	3,      646,   639 ), /*   645 p                 */
-  S_ST( 'o',	3,      647,     0 ), /*   646 ph                */
-  S_ST( 'n',	3,      383,     0 ), /*   647 pho               */
-  S_ST( 'i',	3,      384,   645 ), /*   648 p                 */
-  S_ST( 'f',	3,      650,     0 ), /*   649 pid               */
-  S_ST( 'i',	3,      651,     0 ), /*   650 pidf              */
-  S_ST( 'l',	3,      385,     0 ), /*   651 pidfi             */
-  S_ST( 'o',	3,      654,   648 ), /*   652 p                 */
-  S_ST( 'o',	3,      386,     0 ), /*   653 po                */
-  S_ST( 'r',	3,      387,   653 ), /*   654 po                */
-  S_ST( 'r',	3,      662,   652 ), /*   655 p                 */
-  S_ST( 'e',	3,      660,     0 ), /*   656 pr                */
-  S_ST( 'e',	3,      658,     0 ), /*   657 pre               */
-  S_ST( 'm',	3,      659,     0 ), /*   658 pree              */
-  S_ST( 'p',	3,      388,     0 ), /*   659 preem             */
-  S_ST( 'f',	3,      661,   657 ), /*   660 pre               */
-  S_ST( 'e',	3,      389,     0 ), /*   661 pref              */
-  S_ST( 'o',	3,      675,   656 ), /*   662 pr                */
-  S_ST( 'c',	3,      664,     0 ), /*   663 pro               */
-  S_ST( '_',	3,      665,     0 ), /*   664 proc              */
-  S_ST( 'd',	3,      666,     0 ), /*   665 proc_             */
-  S_ST( 'e',	3,      667,     0 ), /*   666 proc_d            */
-  S_ST( 'l',	3,      668,     0 ), /*   667 proc_de           */
-  S_ST( 'a',	3,      451,     0 ), /*   668 proc_del          */
-  S_ST( 'p',	3,      670,   663 ), /*   669 pro               */
-  S_ST( '_',	3,      671,     0 ), /*   670 prop              */
-  S_ST( 'd',	3,      672,     0 ), /*   671 prop_             */
-  S_ST( 'e',	3,      673,     0 ), /*   672 prop_d            */
-  S_ST( 'l',	3,      674,     0 ), /*   673 prop_de           */
-  S_ST( 'a',	3,      450,     0 ), /*   674 prop_del          */
-  S_ST( 't',	3,      676,   669 ), /*   675 pro               */
-  S_ST( 'o',	3,      677,     0 ), /*   676 prot              */
-  S_ST( 's',	3,      678,     0 ), /*   677 proto             */
-  S_ST( 't',	3,      679,     0 ), /*   678 protos            */
-  S_ST( 'a',	3,      680,     0 ), /*   679 protost           */
-  S_ST( 't',	3,      390,     0 ), /*   680 protosta          */
-  S_ST( 'r',	3,      712,   635 ), /*   681                   */
-  S_ST( 'a',	3,      688,     0 ), /*   682 r                 */
-  S_ST( 'n',	3,      684,     0 ), /*   683 ra                */
-  S_ST( 'd',	3,      685,     0 ), /*   684 ran               */
-  S_ST( 'f',	3,      686,     0 ), /*   685 rand              */
-  S_ST( 'i',	3,      687,     0 ), /*   686 randf             */
-  S_ST( 'l',	3,      392,     0 ), /*   687 randfi            */
-  S_ST( 'w',	3,      689,   683 ), /*   688 ra                */
-  S_ST( 's',	3,      690,     0 ), /*   689 raw               */
-  S_ST( 't',	3,      691,     0 ), /*   690 raws              */
-  S_ST( 'a',	3,      692,     0 ), /*   691 rawst             */
-  S_ST( 't',	3,      393,     0 ), /*   692 rawsta            */
-  S_ST( 'e',	3,      709,   682 ), /*   693 r                 */
-  S_ST( 'f',	3,      695,     0 ), /*   694 re                */
-  S_ST( 'i',	3,      394,     0 ), /*   695 ref               */
-  S_ST( 'q',	3,      697,   694 ), /*   696 re                */
-  S_ST( 'u',	3,      698,     0 ), /*   697 req               */
-  S_ST( 'e',	3,      699,     0 ), /*   698 requ              */
-  S_ST( 's',	3,      700,     0 ), /*   699 reque             */
-  S_ST( 't',	3,      701,     0 ), /*   700 reques            */
-  S_ST( 'k',	3,      702,     0 ), /*   701 request           */
-  S_ST( 'e',	3,      395,     0 ), /*   702 requestk          */
-  S_ST( 's',	3,      705,   696 ), /*   703 re                */
-  S_ST( 'e',	3,      396,     0 ), /*   704 res               */
-  S_ST( 't',	3,      706,   704 ), /*   705 res               */
-  S_ST( 'r',	3,      707,     0 ), /*   706 rest              */
-  S_ST( 'i',	3,      708,     0 ), /*   707 restr             */
-  S_ST( 'c',	3,      397,     0 ), /*   708 restri            */
-  S_ST( 'v',	3,      710,   703 ), /*   709 re                */
-  S_ST( 'o',	3,      711,     0 ), /*   710 rev               */
-  S_ST( 'k',	3,      398,     0 ), /*   711 revo              */
-  S_ST( 'l',	3,      713,   693 ), /*   712 r                 */
-  S_ST( 'i',	3,      714,     0 ), /*   713 rl                */
-  S_ST( 'm',	3,      715,     0 ), /*   714 rli               */
-  S_ST( 'i',	3,      399,     0 ), /*   715 rlim              */
-  S_ST( 's',	3,      789,   681 ), /*   716                   */
-  S_ST( 'a',	3,      718,     0 ), /*   717 s                 */
-  S_ST( 'v',	3,      719,     0 ), /*   718 sa                */
-  S_ST( 'e',	3,      720,     0 ), /*   719 sav               */
-  S_ST( 'c',	3,      721,     0 ), /*   720 save              */
-  S_ST( 'o',	3,      722,     0 ), /*   721 savec             */
-  S_ST( 'n',	3,      723,     0 ), /*   722 saveco            */
-  S_ST( 'f',	3,      724,     0 ), /*   723 savecon           */
-  S_ST( 'i',	3,      725,     0 ), /*   724 saveconf          */
-  S_ST( 'g',	3,      726,     0 ), /*   725 saveconfi         */
-  S_ST( 'd',	3,      727,     0 ), /*   726 saveconfig        */
-  S_ST( 'i',	3,      400,     0 ), /*   727 saveconfigd       */
-  S_ST( 'e',	3,      738,   717 ), /*   728 s                 */
-  S_ST( 'r',	3,      730,     0 ), /*   729 se                */
-  S_ST( 'v',	3,      731,     0 ), /*   730 ser               */
-  S_ST( 'e',	3,      401,     0 ), /*   731 serv              */
-  S_ST( '_',	3,      733,     0 ), /*   732 server            */
-  S_ST( 'o',	3,      734,     0 ), /*   733 server_           */
-  S_ST( 'f',	3,      735,     0 ), /*   734 server_o          */
-  S_ST( 'f',	3,      736,     0 ), /*   735 server_of         */
-  S_ST( 's',	3,      737,     0 ), /*   736 server_off        */
-  S_ST( 'e',	3,      445,     0 ), /*   737 server_offs       */
-  S_ST( 't',	3,      739,   729 ), /*   738 se                */
-  S_ST( 'v',	3,      740,     0 ), /*   739 set               */
-  S_ST( 'a',	3,      402,     0 ), /*   740 setv              */
-  S_ST( 'i',	3,      742,   728 ), /*   741 s                 */
-  S_ST( 'm',	3,      743,     0 ), /*   742 si                */
-  S_ST( 'u',	3,      744,     0 ), /*   743 sim               */
-  S_ST( 'l',	3,      745,     0 ), /*   744 simu              */
-  S_ST( 'a',	3,      746,     0 ), /*   745 simul             */
-  S_ST( 't',	3,      747,     0 ), /*   746 simula            */
-  S_ST( 'i',	3,      748,   442 ), /*   747 simulat           */
-  S_ST( 'o',	3,      749,     0 ), /*   748 simulati          */
-  S_ST( 'n',	3,      750,     0 ), /*   749 simulatio         */
-  S_ST( '_',	3,      751,     0 ), /*   750 simulation        */
-  S_ST( 'd',	3,      752,     0 ), /*   751 simulation_       */
-  S_ST( 'u',	3,      753,     0 ), /*   752 simulation_d      */
-  S_ST( 'r',	3,      754,     0 ), /*   753 simulation_du     */
-  S_ST( 'a',	3,      755,     0 ), /*   754 simulation_dur    */
-  S_ST( 't',	3,      756,     0 ), /*   755 simulation_dura   */
-  S_ST( 'i',	3,      757,     0 ), /*   756 simulation_durat  */
-  S_ST( 'o',	3,      444,     0 ), /*   757 simulation_durati */
-  S_ST( 'o',	3,      759,   741 ), /*   758 s                 */
-  S_ST( 'u',	3,      760,     0 ), /*   759 so                */
-  S_ST( 'r',	3,      761,     0 ), /*   760 sou               */
-  S_ST( 'c',	3,      403,     0 ), /*   761 sour              */
-  S_ST( 't',	3,      785,   758 ), /*   762 s                 */
-  S_ST( 'a',	3,      769,     0 ), /*   763 st                */
-  S_ST( 'c',	3,      765,     0 ), /*   764 sta               */
-  S_ST( 'k',	3,      766,     0 ), /*   765 stac              */
-  S_ST( 's',	3,      767,     0 ), /*   766 stack             */
-  S_ST( 'i',	3,      768,     0 ), /*   767 stacks            */
-  S_ST( 'z',	3,      404,     0 ), /*   768 stacksi           */
-  S_ST( 't',	3,      406,   764 ), /*   769 sta               */
-  S_ST( 'i',	3,      771,     0 ), /*   770 stat              */
-  S_ST( 's',	3,      772,     0 ), /*   771 stati             */
-  S_ST( 't',	3,      773,     0 ), /*   772 statis            */
-  S_ST( 'i',	3,      774,     0 ), /*   773 statist           */
-  S_ST( 'c',	3,      405,     0 ), /*   774 statisti          */
-  S_ST( 'd',	3,      776,     0 ), /*   775 stats             */
-  S_ST( 'i',	3,      407,     0 ), /*   776 statsd            */
-  S_ST( 'e',	3,      408,   763 ), /*   777 st                */
-  S_ST( 'b',	3,      779,     0 ), /*   778 step              */
-  S_ST( 'a',	3,      780,     0 ), /*   779 stepb             */
-  S_ST( 'c',	3,      409,     0 ), /*   780 stepba            */
-  S_ST( 'f',	3,      782,   778 ), /*   781 step              */
-  S_ST( 'w',	3,      410,     0 ), /*   782 stepf             */
-  S_ST( 'o',	3,      784,   781 ), /*   783 step              */
-  S_ST( 'u',	3,      411,     0 ), /*   784 stepo             */
-  S_ST( 'r',	3,      786,   777 ), /*   785 st                */
-  S_ST( 'a',	3,      787,     0 ), /*   786 str               */
-  S_ST( 't',	3,      788,     0 ), /*   787 stra              */
-  S_ST( 'u',	3,      412,     0 ), /*   788 strat             */
-  S_ST( 'y',	3,      414,   762 ), /*   789 s                 */
-  S_ST( 's',	3,      791,     0 ), /*   790 sys               */
-  S_ST( 't',	3,      792,     0 ), /*   791 syss              */
-  S_ST( 'a',	3,      793,     0 ), /*   792 sysst             */
-  S_ST( 't',	3,      415,     0 ), /*   793 syssta            */
-  S_ST( 't',	3,      820,   716 ), /*   794                   */
-  S_ST( 'i',	3,      806,     0 ), /*   795 t                 */
-  S_ST( 'c',	3,      416,     0 ), /*   796 ti                */
-  S_ST( 'm',	3,      799,   796 ), /*   797 ti                */
-  S_ST( 'e',	3,      419,     0 ), /*   798 tim               */
-  S_ST( 'i',	3,      800,   798 ), /*   799 tim               */
-  S_ST( 'n',	3,      801,     0 ), /*   800 timi              */
-  S_ST( 'g',	3,      802,     0 ), /*   801 timin             */
-  S_ST( 's',	3,      803,     0 ), /*   802 timing            */
-  S_ST( 't',	3,      804,     0 ), /*   803 timings           */
-  S_ST( 'a',	3,      805,     0 ), /*   804 timingst          */
-  S_ST( 't',	3,      420,     0 ), /*   805 timingsta         */
-  S_ST( 'n',	3,      807,   797 ), /*   806 ti                */
-  S_ST( 'k',	3,      808,     0 ), /*   807 tin               */
-  S_ST( 'e',	3,      421,     0 ), /*   808 tink              */
-  S_ST( 'o',	3,      422,   795 ), /*   809 t                 */
-  S_ST( 'r',	3,      812,   809 ), /*   810 t                 */
-  S_ST( 'a',	3,      423,     0 ), /*   811 tr                */
-  S_ST( 'u',	3,      813,   811 ), /*   812 tr                */
-  S_ST( 's',	3,      814,   424 ), /*   813 tru               */
-  S_ST( 't',	3,      815,     0 ), /*   814 trus              */
-  S_ST( 'e',	3,      816,     0 ), /*   815 trust             */
-  S_ST( 'd',	3,      817,     0 ), /*   816 truste            */
-  S_ST( 'k',	3,      818,     0 ), /*   817 trusted           */
-  S_ST( 'e',	3,      425,     0 ), /*   818 trustedk          */
-  S_ST( 't',	3,      426,   810 ), /*   819 t                 */
-  S_ST( 'y',	3,      821,   819 ), /*   820 t                 */
-  S_ST( 'p',	3,      427,     0 ), /*   821 ty                */
-  S_ST( 'u',	3,      823,   794 ), /*   822                   */
-  S_ST( 'n',	3,      829,     0 ), /*   823 u                 */
-  S_ST( 'c',	3,      825,     0 ), /*   824 un                */
-  S_ST( 'o',	3,      826,     0 ), /*   825 unc               */
-  S_ST( 'n',	3,      827,     0 ), /*   826 unco              */
-  S_ST( 'f',	3,      828,     0 ), /*   827 uncon             */
-  S_ST( 'i',	3,      432,     0 ), /*   828 unconf            */
-  S_ST( 'p',	3,      830,   824 ), /*   829 un                */
-  S_ST( 'e',	3,      831,     0 ), /*   830 unp               */
-  S_ST( 'e',	3,      433,     0 ), /*   831 unpe              */
-  S_ST( '_',	3,      852,     0 ), /*   832 unpeer            */
-  S_ST( 'c',	3,      834,     0 ), /*   833 unpeer_           */
-  S_ST( 'r',	3,      835,     0 ), /*   834 unpeer_c          */
-  S_ST( 'y',	3,      836,     0 ), /*   835 unpeer_cr         */
-  S_ST( 'p',	3,      837,     0 ), /*   836 unpeer_cry        */
-  S_ST( 't',	3,      838,     0 ), /*   837 unpeer_cryp       */
-  S_ST( 'o',	3,      839,     0 ), /*   838 unpeer_crypt      */
-  S_ST( '_',	3,      844,     0 ), /*   839 unpeer_crypto     */
-  S_ST( 'e',	3,      841,     0 ), /*   840 unpeer_crypto_    */
-  S_ST( 'a',	3,      842,     0 ), /*   841 unpeer_crypto_e   */
-  S_ST( 'r',	3,      843,     0 ), /*   842 unpeer_crypto_ea  */
-  S_ST( 'l',	3,      429,     0 ), /*   843 unpeer_crypto_ear */
-  S_ST( 'n',	3,      845,   840 ), /*   844 unpeer_crypto_    */
-  S_ST( 'a',	3,      846,     0 ), /*   845 unpeer_crypto_n   */
-  S_ST( 'k',	3,      847,     0 ), /*   846 unpeer_crypto_na  */
-  S_ST( '_',	3,      848,     0 ), /*   847 unpeer_crypto_nak */
-  S_ST( 'e',	3,      849,     0 ), /*   848 unpeer_crypto_nak_ */
-  S_ST( 'a',	3,      850,     0 ), /*   849 unpeer_crypto_nak_e */
-  S_ST( 'r',	3,      851,     0 ), /*   850 unpeer_crypto_nak_ea */
-  S_ST( 'l',	3,      430,     0 ), /*   851 unpeer_crypto_nak_ear */
-  S_ST( 'd',	3,      853,   833 ), /*   852 unpeer_           */
-  S_ST( 'i',	3,      854,     0 ), /*   853 unpeer_d          */
-  S_ST( 'g',	3,      855,     0 ), /*   854 unpeer_di         */
-  S_ST( 'e',	3,      856,     0 ), /*   855 unpeer_dig        */
-  S_ST( 's',	3,      857,     0 ), /*   856 unpeer_dige       */
-  S_ST( 't',	3,      858,     0 ), /*   857 unpeer_diges      */
-  S_ST( '_',	3,      859,     0 ), /*   858 unpeer_digest     */
-  S_ST( 'e',	3,      860,     0 ), /*   859 unpeer_digest_    */
-  S_ST( 'a',	3,      861,     0 ), /*   860 unpeer_digest_e   */
-  S_ST( 'r',	3,      862,     0 ), /*   861 unpeer_digest_ea  */
-  S_ST( 'l',	3,      431,     0 ), /*   862 unpeer_digest_ear */
-  S_ST( 'v',	3,      864,   822 ), /*   863                   */
-  S_ST( 'e',	3,      865,     0 ), /*   864 v                 */
-  S_ST( 'r',	3,      866,     0 ), /*   865 ve                */
-  S_ST( 's',	3,      867,     0 ), /*   866 ver               */
-  S_ST( 'i',	3,      868,     0 ), /*   867 vers              */
-  S_ST( 'o',	3,      434,     0 ), /*   868 versi             */
-  S_ST( 'w',	3,      876,   863 ), /*   869                   */
-  S_ST( 'a',	3,      871,     0 ), /*   870 w                 */
-  S_ST( 'n',	3,      872,     0 ), /*   871 wa                */
-  S_ST( 'd',	3,      873,     0 ), /*   872 wan               */
-  S_ST( 'e',	3,      448,     0 ), /*   873 wand              */
-  S_ST( 'e',	3,      875,   870 ), /*   874 w                 */
-  S_ST( 'e',	3,      436,     0 ), /*   875 we                */
-  S_ST( 'i',	3,      877,   874 ), /*   876 w                 */
-  S_ST( 'l',	3,      878,     0 ), /*   877 wi                */
-  S_ST( 'd',	3,      879,     0 ), /*   878 wil               */
-  S_ST( 'c',	3,      880,     0 ), /*   879 wild              */
-  S_ST( 'a',	3,      881,     0 ), /*   880 wildc             */
-  S_ST( 'r',	3,      437,     0 ), /*   881 wildca            */
-  S_ST( 'x',	3,      883,   869 ), /*   882                   */
-  S_ST( 'l',	3,      884,     0 ), /*   883 x                 */
-  S_ST( 'e',	3,      885,     0 ), /*   884 xl                */
-  S_ST( 'a',	3,      886,     0 ), /*   885 xle               */
-  S_ST( 'v',	3,      438,     0 ), /*   886 xlea              */
-  S_ST( 'y',	3,      888,   882 ), /*   887 [initial state]   */
-  S_ST( 'e',	3,      889,     0 ), /*   888 y                 */
-  S_ST( 'a',	3,      439,     0 )  /*   889 ye                */
+  S_ST( 't',	1,        0,     0 ), /*   278 T_Controlsocket   */
+  S_ST( 'o',	0,      105,     0 ), /*   279 T_Crypto          */
+  S_ST( 's',	0,        0,     0 ), /*   280 T_Cryptostats     */
+  S_ST( 'l',	0,        0,     0 ), /*   281 T_Ctl             */
+  S_ST( 'y',	0,        0,     0 ), /*   282 T_Day             */
+  S_ST( 't',	0,        0,     0 ), /*   283 T_Default         */
+  S_ST( 't',	1,        0,     0 ), /*   284 T_Digest          */
+  S_ST( 'e',	0,        0,     0 ), /*   285 T_Disable         */
+  S_ST( 'd',	0,        0,     0 ), /*   286 T_Discard         */
+  S_ST( 'n',	0,        0,     0 ), /*   287 T_Dispersion      */
+  S_ST( 't',	3,      295,     0 ), /*   288 leapsmearin       */
+  S_ST( 'e',	1,        0,     0 ), /*   289 T_Driftfile       */
+  S_ST( 'p',	0,        0,     0 ), /*   290 T_Drop            */
+  S_ST( 'p',	0,        0,     0 ), /*   291 T_Dscp            */
+  S_ST( '.',	0,        0,     0 ), /*   292 T_Ellipsis        */
+  S_ST( 'e',	0,        0,     0 ), /*   293 T_Enable          */
+  S_ST( 'd',	0,        0,   152 ), /*   294 T_End             */
+  S_ST( 'e',	3,      317,     0 ), /*   295 leapsmearint      */
+  S_ST( 'e',	1,      160,     0 ), /*   296 T_File            */
+  S_ST( 'n',	0,        0,     0 ), /*   297 T_Filegen         */
+  S_ST( 'm',	0,        0,     0 ), /*   298 T_Filenum         */
+  S_ST( '1',	0,        0,     0 ), /*   299 T_Flag1           */
+  S_ST( '2',	0,        0,   299 ), /*   300 T_Flag2           */
+  S_ST( '3',	0,        0,   300 ), /*   301 T_Flag3           */
+  S_ST( '4',	0,        0,   301 ), /*   302 T_Flag4           */
+  S_ST( 'e',	0,        0,     0 ), /*   303 T_Flake           */
+  S_ST( 'r',	0,        0,     0 ), /*   304 T_Floor           */
+  S_ST( 'q',	0,      170,     0 ), /*   305 T_Freq            */
+  S_ST( 'e',	1,        0,     0 ), /*   306 T_Fudge           */
+  S_ST( 't',	1,        0,     0 ), /*   307 T_Host            */
+  S_ST( 'f',	0,        0,     0 ), /*   308 T_Huffpuff        */
+  S_ST( 't',	0,        0,     0 ), /*   309 T_Iburst          */
+  S_ST( 't',	1,        0,     0 ), /*   310 T_Ident           */
+  S_ST( 'e',	0,        0,     0 ), /*   311 T_Ignore          */
+  S_ST( 'c',	0,        0,     0 ), /*   312 T_Incalloc        */
+  S_ST( 'm',	0,        0,     0 ), /*   313 T_Incmem          */
+  S_ST( 'c',	0,        0,     0 ), /*   314 T_Initalloc       */
+  S_ST( 'm',	0,        0,     0 ), /*   315 T_Initmem         */
+  S_ST( 'e',	1,        0,     0 ), /*   316 T_Includefile     */
+  S_ST( 'r',	3,      319,     0 ), /*   317 leapsmearinte     */
+  S_ST( 'e',	0,        0,     0 ), /*   318 T_Interface       */
+  S_ST( 'v',	3,      417,     0 ), /*   319 leapsmearinter    */
+  S_ST( 'o',	0,        0,   200 ), /*   320 T_Io              */
+  S_ST( '4',	0,        0,     0 ), /*   321 T_Ipv4            */
+  S_ST( '4',	0,        0,     0 ), /*   322 T_Ipv4_flag       */
+  S_ST( '6',	0,        0,   321 ), /*   323 T_Ipv6            */
+  S_ST( '6',	0,        0,   322 ), /*   324 T_Ipv6_flag       */
+  S_ST( 'l',	0,        0,     0 ), /*   325 T_Kernel          */
+  S_ST( 'y',	0,      327,   238 ), /*   326 T_Key             */
+  S_ST( 's',	1,      241,     0 ), /*   327 T_Keys            */
+  S_ST( 'r',	1,        0,     0 ), /*   328 T_Keysdir         */
+  S_ST( 'd',	0,        0,     0 ), /*   329 T_Kod             */
+  S_ST( 'p',	0,        0,     0 ), /*   330 T_Mssntp          */
+  S_ST( 'e',	1,        0,     0 ), /*   331 T_Leapfile        */
+  S_ST( 'l',	0,        0,     0 ), /*   332 T_Leapsmearinterval */
+  S_ST( 'd',	0,        0,     0 ), /*   333 T_Limited         */
+  S_ST( 'k',	0,        0,     0 ), /*   334 T_Link            */
+  S_ST( 'n',	0,        0,     0 ), /*   335 T_Listen          */
+  S_ST( 'g',	2,        0,     0 ), /*   336 T_Logconfig       */
+  S_ST( 'e',	1,        0,     0 ), /*   337 T_Logfile         */
+  S_ST( 's',	0,        0,     0 ), /*   338 T_Loopstats       */
+  S_ST( 'p',	0,        0,     0 ), /*   339 T_Lowpriotrap     */
+  S_ST( 't',	1,        0,     0 ), /*   340 T_Manycastclient  */
+  S_ST( 'r',	2,        0,     0 ), /*   341 T_Manycastserver  */
+  S_ST( 'k',	0,        0,     0 ), /*   342 T_Mask            */
+  S_ST( 'e',	0,        0,     0 ), /*   343 T_Maxage          */
+  S_ST( 'k',	0,        0,     0 ), /*   344 T_Maxclock        */
+  S_ST( 'h',	0,        0,     0 ), /*   345 T_Maxdepth        */
+  S_ST( 't',	0,        0,     0 ), /*   346 T_Maxdist         */
+  S_ST( 'm',	0,        0,     0 ), /*   347 T_Maxmem          */
+  S_ST( 'l',	0,        0,     0 ), /*   348 T_Maxpoll         */
+  S_ST( 's',	0,        0,     0 ), /*   349 T_Mdnstries       */
+  S_ST( 'm',	0,      531,     0 ), /*   350 T_Mem             */
+  S_ST( 'k',	0,        0,     0 ), /*   351 T_Memlock         */
+  S_ST( 'k',	0,        0,     0 ), /*   352 T_Minclock        */
+  S_ST( 'h',	0,        0,     0 ), /*   353 T_Mindepth        */
+  S_ST( 't',	0,        0,     0 ), /*   354 T_Mindist         */
+  S_ST( 'm',	0,        0,     0 ), /*   355 T_Minimum         */
+  S_ST( 'l',	0,        0,     0 ), /*   356 T_Minpoll         */
+  S_ST( 'e',	0,        0,     0 ), /*   357 T_Minsane         */
+  S_ST( 'e',	0,      359,     0 ), /*   358 T_Mode            */
+  S_ST( '7',	0,        0,     0 ), /*   359 T_Mode7           */
+  S_ST( 'r',	0,        0,     0 ), /*   360 T_Monitor         */
+  S_ST( 'h',	0,        0,     0 ), /*   361 T_Month           */
+  S_ST( 'u',	0,        0,     0 ), /*   362 T_Mru             */
+  S_ST( 't',	2,        0,     0 ), /*   363 T_Multicastclient */
+  S_ST( 'c',	0,        0,     0 ), /*   364 T_Nic             */
+  S_ST( 'k',	0,        0,     0 ), /*   365 T_Nolink          */
+  S_ST( 'y',	0,        0,     0 ), /*   366 T_Nomodify        */
+  S_ST( 't',	0,        0,     0 ), /*   367 T_Nomrulist       */
+  S_ST( 'e',	0,        0,     0 ), /*   368 T_None            */
+  S_ST( 'e',	0,        0,     0 ), /*   369 T_Nonvolatile     */
+  S_ST( 'r',	0,        0,     0 ), /*   370 T_Nopeer          */
+  S_ST( 'y',	0,        0,     0 ), /*   371 T_Noquery         */
+  S_ST( 't',	0,        0,     0 ), /*   372 T_Noselect        */
+  S_ST( 'e',	0,        0,     0 ), /*   373 T_Noserve         */
+  S_ST( 'p',	0,        0,     0 ), /*   374 T_Notrap          */
+  S_ST( 't',	0,        0,     0 ), /*   375 T_Notrust         */
+  S_ST( 'p',	0,      627,     0 ), /*   376 T_Ntp             */
+  S_ST( 't',	0,        0,     0 ), /*   377 T_Ntpport         */
+  S_ST( 't',	1,        0,     0 ), /*   378 T_NtpSignDsocket  */
+  S_ST( 'n',	0,      642,     0 ), /*   379 T_Orphan          */
+  S_ST( 't',	0,        0,     0 ), /*   380 T_Orphanwait      */
+  S_ST( 'c',	0,        0,     0 ), /*   381 T_Panic           */
+  S_ST( 'r',	1,      651,     0 ), /*   382 T_Peer            */
+  S_ST( 's',	0,        0,     0 ), /*   383 T_Peerstats       */
+  S_ST( 'e',	2,        0,     0 ), /*   384 T_Phone           */
+  S_ST( 'd',	0,      659,     0 ), /*   385 T_Pid             */
+  S_ST( 'e',	1,        0,     0 ), /*   386 T_Pidfile         */
+  S_ST( 'l',	1,        0,     0 ), /*   387 T_Pool            */
+  S_ST( 't',	0,        0,     0 ), /*   388 T_Port            */
+  S_ST( 't',	0,        0,     0 ), /*   389 T_Preempt         */
+  S_ST( 'r',	0,        0,     0 ), /*   390 T_Prefer          */
+  S_ST( 's',	0,        0,     0 ), /*   391 T_Protostats      */
+  S_ST( 'h',	0,        0,     0 ), /*   392 T_Publish         */
+  S_ST( 'w',	1,        0,   691 ), /*   393 T_Pw              */
+  S_ST( 'e',	1,        0,     0 ), /*   394 T_Randfile        */
+  S_ST( 's',	0,        0,     0 ), /*   395 T_Rawstats        */
+  S_ST( 'd',	1,        0,     0 ), /*   396 T_Refid           */
+  S_ST( 'y',	0,        0,     0 ), /*   397 T_Requestkey      */
+  S_ST( 't',	0,        0,     0 ), /*   398 T_Reset           */
+  S_ST( 't',	0,        0,     0 ), /*   399 T_Restrict        */
+  S_ST( 'e',	0,        0,     0 ), /*   400 T_Revoke          */
+  S_ST( 't',	0,        0,     0 ), /*   401 T_Rlimit          */
+  S_ST( 'r',	1,        0,     0 ), /*   402 T_Saveconfigdir   */
+  S_ST( 'e',	0,      404,     0 ), /*   403 T_Serve           */
+  S_ST( 'r',	1,      746,     0 ), /*   404 T_Server          */
+  S_ST( 'r',	1,        0,     0 ), /*   405 T_Setvar          */
+  S_ST( 'e',	0,        0,     0 ), /*   406 T_Sharedstate     */
+  S_ST( 'e',	0,        0,     0 ), /*   407 T_Source          */
+  S_ST( 'e',	0,        0,     0 ), /*   408 T_Stacksize       */
+  S_ST( 's',	0,        0,     0 ), /*   409 T_Statistics      */
+  S_ST( 's',	0,      798,   793 ), /*   410 T_Stats           */
+  S_ST( 'r',	1,        0,     0 ), /*   411 T_Statsdir        */
+  S_ST( 'p',	0,      806,     0 ), /*   412 T_Step            */
+  S_ST( 'k',	0,        0,     0 ), /*   413 T_Stepback        */
+  S_ST( 'd',	0,        0,     0 ), /*   414 T_Stepfwd         */
+  S_ST( 't',	0,        0,     0 ), /*   415 T_Stepout         */
+  S_ST( 'm',	0,        0,     0 ), /*   416 T_Stratum         */
+  S_ST( 'a',	3,      332,     0 ), /*   417 leapsmearinterv   */
+  S_ST( 's',	0,      813,     0 ), /*   418 T_Sys             */
+  S_ST( 's',	0,        0,     0 ), /*   419 T_Sysstats        */
+  S_ST( 'k',	0,        0,     0 ), /*   420 T_Tick            */
+  S_ST( '1',	0,        0,     0 ), /*   421 T_Time1           */
+  S_ST( '2',	0,        0,   421 ), /*   422 T_Time2           */
+  S_ST( 'r',	0,        0,   422 ), /*   423 T_Timer           */
+  S_ST( 's',	0,        0,     0 ), /*   424 T_Timingstats     */
+  S_ST( 'r',	0,        0,     0 ), /*   425 T_Tinker          */
+  S_ST( 's',	0,        0,     0 ), /*   426 T_Tos             */
+  S_ST( 'p',	1,        0,     0 ), /*   427 T_Trap            */
+  S_ST( 'e',	0,        0,     0 ), /*   428 T_True            */
+  S_ST( 'y',	0,        0,     0 ), /*   429 T_Trustedkey      */
+  S_ST( 'l',	0,        0,     0 ), /*   430 T_Ttl             */
+  S_ST( 'e',	0,        0,     0 ), /*   431 T_Type            */
+  S_ST( 'i',	3,      459,   245 ), /*   432 l                 */
+  S_ST( 'y',	0,        0,     0 ), /*   433 T_UEcrypto        */
+  S_ST( 'y',	0,        0,     0 ), /*   434 T_UEcryptonak     */
+  S_ST( 'y',	0,        0,     0 ), /*   435 T_UEdigest        */
+  S_ST( 'g',	1,        0,     0 ), /*   436 T_Unconfig        */
+  S_ST( 'r',	1,      855,     0 ), /*   437 T_Unpeer          */
+  S_ST( 'n',	0,        0,     0 ), /*   438 T_Version         */
+  S_ST( 'm',	3,      445,     0 ), /*   439 li                */
+  S_ST( 'k',	0,        0,     0 ), /*   440 T_Week            */
+  S_ST( 'd',	0,        0,     0 ), /*   441 T_Wildcard        */
+  S_ST( 'p',	1,        0,     0 ), /*   442 T_Xdp             */
+  S_ST( 'e',	0,        0,     0 ), /*   443 T_Xleave          */
+  S_ST( 'r',	0,        0,     0 ), /*   444 T_Year            */
+  S_ST( 'i',	3,      446,     0 ), /*   445 lim               */
+  S_ST( 't',	3,      457,     0 ), /*   446 limi              */
+  S_ST( 'e',	0,        0,     0 ), /*   447 T_Simulate        */
+  S_ST( 'y',	0,        0,     0 ), /*   448 T_Beep_Delay      */
+  S_ST( 'n',	0,        0,     0 ), /*   449 T_Sim_Duration    */
+  S_ST( 't',	0,        0,     0 ), /*   450 T_Server_Offset   */
+  S_ST( 'n',	0,        0,     0 ), /*   451 T_Duration        */
+  S_ST( 't',	0,        0,     0 ), /*   452 T_Freq_Offset     */
+  S_ST( 'r',	0,        0,     0 ), /*   453 T_Wander          */
+  S_ST( 'r',	0,        0,     0 ), /*   454 T_Jitter          */
+  S_ST( 'y',	0,        0,     0 ), /*   455 T_Prop_Delay      */
+  S_ST( 'y',	0,        0,     0 ), /*   456 T_Proc_Delay      */
+  S_ST( 'e',	3,      333,     0 ), /*   457 limit             */
+  S_ST( 'n',	3,      334,   439 ), /*   458 li                */
+  S_ST( 's',	3,      460,   458 ), /*   459 li                */
+  S_ST( 't',	3,      461,     0 ), /*   460 lis               */
+  S_ST( 'e',	3,      335,     0 ), /*   461 list              */
+  S_ST( 'o',	3,      478,   432 ), /*   462 l                 */
+  S_ST( 'g',	3,      469,     0 ), /*   463 lo                */
+  S_ST( 'c',	3,      465,     0 ), /*   464 log               */
+  S_ST( 'o',	3,      466,     0 ), /*   465 logc              */
+  S_ST( 'n',	3,      467,     0 ), /*   466 logco             */
+  S_ST( 'f',	3,      468,     0 ), /*   467 logcon            */
+  S_ST( 'i',	3,      336,     0 ), /*   468 logconf           */
+  S_ST( 'f',	3,      470,   464 ), /*   469 log               */
+  S_ST( 'i',	3,      471,     0 ), /*   470 logf              */
+  S_ST( 'l',	3,      337,     0 ), /*   471 logfi             */
+  S_ST( 'o',	3,      473,   463 ), /*   472 lo                */
+  S_ST( 'p',	3,      474,     0 ), /*   473 loo               */
+  S_ST( 's',	3,      475,     0 ), /*   474 loop              */
+  S_ST( 't',	3,      476,     0 ), /*   475 loops             */
+  S_ST( 'a',	3,      477,     0 ), /*   476 loopst            */
+  S_ST( 't',	3,      338,     0 ), /*   477 loopsta           */
+  S_ST( 'w',	3,      479,   472 ), /*   478 lo                */
+  S_ST( 'p',	3,      480,     0 ), /*   479 low               */
+  S_ST( 'r',	3,      481,     0 ), /*   480 lowp              */
+  S_ST( 'i',	3,      482,     0 ), /*   481 lowpr             */
+  S_ST( 'o',	3,      483,     0 ), /*   482 lowpri            */
+  S_ST( 't',	3,      484,     0 ), /*   483 lowprio           */
+  S_ST( 'r',	3,      485,     0 ), /*   484 lowpriot          */
+  S_ST( 'a',	3,      339,     0 ), /*   485 lowpriotr         */
+  S_ST( 'm',	3,      567,   244 ), /*   486                   */
+  S_ST( 'a',	3,      505,     0 ), /*   487 m                 */
+  S_ST( 'n',	3,      489,     0 ), /*   488 ma                */
+  S_ST( 'y',	3,      490,     0 ), /*   489 man               */
+  S_ST( 'c',	3,      491,     0 ), /*   490 many              */
+  S_ST( 'a',	3,      492,     0 ), /*   491 manyc             */
+  S_ST( 's',	3,      493,     0 ), /*   492 manyca            */
+  S_ST( 't',	3,      499,     0 ), /*   493 manycas           */
+  S_ST( 'c',	3,      495,     0 ), /*   494 manycast          */
+  S_ST( 'l',	3,      496,     0 ), /*   495 manycastc         */
+  S_ST( 'i',	3,      497,     0 ), /*   496 manycastcl        */
+  S_ST( 'e',	3,      498,     0 ), /*   497 manycastcli       */
+  S_ST( 'n',	3,      340,     0 ), /*   498 manycastclie      */
+  S_ST( 's',	3,      500,   494 ), /*   499 manycast          */
+  S_ST( 'e',	3,      501,     0 ), /*   500 manycasts         */
+  S_ST( 'r',	3,      502,     0 ), /*   501 manycastse        */
+  S_ST( 'v',	3,      503,     0 ), /*   502 manycastser       */
+  S_ST( 'e',	3,      341,     0 ), /*   503 manycastserv      */
+  S_ST( 's',	3,      342,   488 ), /*   504 ma                */
+  S_ST( 'x',	3,      520,   504 ), /*   505 ma                */
+  S_ST( 'a',	3,      507,     0 ), /*   506 max               */
+  S_ST( 'g',	3,      343,     0 ), /*   507 maxa              */
+  S_ST( 'c',	3,      509,   506 ), /*   508 max               */
+  S_ST( 'l',	3,      510,     0 ), /*   509 maxc              */
+  S_ST( 'o',	3,      511,     0 ), /*   510 maxcl             */
+  S_ST( 'c',	3,      344,     0 ), /*   511 maxclo            */
+  S_ST( 'd',	3,      516,   508 ), /*   512 max               */
+  S_ST( 'e',	3,      514,     0 ), /*   513 maxd              */
+  S_ST( 'p',	3,      515,     0 ), /*   514 maxde             */
+  S_ST( 't',	3,      345,     0 ), /*   515 maxdep            */
+  S_ST( 'i',	3,      517,   513 ), /*   516 maxd              */
+  S_ST( 's',	3,      346,     0 ), /*   517 maxdi             */
+  S_ST( 'm',	3,      519,   512 ), /*   518 max               */
+  S_ST( 'e',	3,      347,     0 ), /*   519 maxm              */
+  S_ST( 'p',	3,      521,   518 ), /*   520 max               */
+  S_ST( 'o',	3,      522,     0 ), /*   521 maxp              */
+  S_ST( 'l',	3,      348,     0 ), /*   522 maxpo             */
+  S_ST( 'd',	3,      524,   487 ), /*   523 m                 */
+  S_ST( 'n',	3,      525,     0 ), /*   524 md                */
+  S_ST( 's',	3,      526,     0 ), /*   525 mdn               */
+  S_ST( 't',	3,      527,     0 ), /*   526 mdns              */
+  S_ST( 'r',	3,      528,     0 ), /*   527 mdnst             */
+  S_ST( 'i',	3,      529,     0 ), /*   528 mdnstr            */
+  S_ST( 'e',	3,      349,     0 ), /*   529 mdnstri           */
+  S_ST( 'e',	3,      350,   523 ), /*   530 m                 */
+  S_ST( 'l',	3,      532,     0 ), /*   531 mem               */
+  S_ST( 'o',	3,      533,     0 ), /*   532 meml              */
+  S_ST( 'c',	3,      351,     0 ), /*   533 memlo             */
+  S_ST( 'i',	3,      535,   530 ), /*   534 m                 */
+  S_ST( 'n',	3,      552,     0 ), /*   535 mi                */
+  S_ST( 'c',	3,      537,     0 ), /*   536 min               */
+  S_ST( 'l',	3,      538,     0 ), /*   537 minc              */
+  S_ST( 'o',	3,      539,     0 ), /*   538 mincl             */
+  S_ST( 'c',	3,      352,     0 ), /*   539 minclo            */
+  S_ST( 'd',	3,      544,   536 ), /*   540 min               */
+  S_ST( 'e',	3,      542,     0 ), /*   541 mind              */
+  S_ST( 'p',	3,      543,     0 ), /*   542 minde             */
+  S_ST( 't',	3,      353,     0 ), /*   543 mindep            */
+  S_ST( 'i',	3,      545,   541 ), /*   544 mind              */
+  S_ST( 's',	3,      354,     0 ), /*   545 mindi             */
+  S_ST( 'i',	3,      547,   540 ), /*   546 min               */
+  S_ST( 'm',	3,      548,     0 ), /*   547 mini              */
+  S_ST( 'u',	3,      355,     0 ), /*   548 minim             */
+  S_ST( 'p',	3,      550,   546 ), /*   549 min               */
+  S_ST( 'o',	3,      551,     0 ), /*   550 minp              */
+  S_ST( 'l',	3,      356,     0 ), /*   551 minpo             */
+  S_ST( 's',	3,      553,   549 ), /*   552 min               */
+  S_ST( 'a',	3,      554,     0 ), /*   553 mins              */
+  S_ST( 'n',	3,      357,     0 ), /*   554 minsa             */
+  S_ST( 'o',	3,      557,   534 ), /*   555 m                 */
+  S_ST( 'd',	3,      358,     0 ), /*   556 mo                */
+  S_ST( 'n',	3,      561,   556 ), /*   557 mo                */
+  S_ST( 'i',	3,      559,     0 ), /*   558 mon               */
+  S_ST( 't',	3,      560,     0 ), /*   559 moni              */
+  S_ST( 'o',	3,      360,     0 ), /*   560 monit             */
+  S_ST( 't',	3,      361,   558 ), /*   561 mon               */
+  S_ST( 'r',	3,      362,   555 ), /*   562 m                 */
+  S_ST( 's',	3,      564,   562 ), /*   563 m                 */
+  S_ST( 's',	3,      565,     0 ), /*   564 ms                */
+  S_ST( 'n',	3,      566,     0 ), /*   565 mss               */
+  S_ST( 't',	3,      330,     0 ), /*   566 mssn              */
+  S_ST( 'u',	3,      568,   563 ), /*   567 m                 */
+  S_ST( 'l',	3,      569,     0 ), /*   568 mu                */
+  S_ST( 't',	3,      570,     0 ), /*   569 mul               */
+  S_ST( 'i',	3,      571,     0 ), /*   570 mult              */
+  S_ST( 'c',	3,      572,     0 ), /*   571 multi             */
+  S_ST( 'a',	3,      573,     0 ), /*   572 multic            */
+  S_ST( 's',	3,      574,     0 ), /*   573 multica           */
+  S_ST( 't',	3,      575,     0 ), /*   574 multicas          */
+  S_ST( 'c',	3,      576,     0 ), /*   575 multicast         */
+  S_ST( 'l',	3,      577,     0 ), /*   576 multicastc        */
+  S_ST( 'i',	3,      578,     0 ), /*   577 multicastcl       */
+  S_ST( 'e',	3,      579,     0 ), /*   578 multicastcli      */
+  S_ST( 'n',	3,      363,     0 ), /*   579 multicastclie     */
+  S_ST( 'n',	3,      623,   486 ), /*   580                   */
+  S_ST( 'i',	3,      364,     0 ), /*   581 n                 */
+  S_ST( 'o',	3,      618,   581 ), /*   582 n                 */
+  S_ST( 'l',	3,      584,     0 ), /*   583 no                */
+  S_ST( 'i',	3,      585,     0 ), /*   584 nol               */
+  S_ST( 'n',	3,      365,     0 ), /*   585 noli              */
+  S_ST( 'm',	3,      591,   583 ), /*   586 no                */
+  S_ST( 'o',	3,      588,     0 ), /*   587 nom               */
+  S_ST( 'd',	3,      589,     0 ), /*   588 nomo              */
+  S_ST( 'i',	3,      590,     0 ), /*   589 nomod             */
+  S_ST( 'f',	3,      366,     0 ), /*   590 nomodi            */
+  S_ST( 'r',	3,      592,   587 ), /*   591 nom               */
+  S_ST( 'u',	3,      593,     0 ), /*   592 nomr              */
+  S_ST( 'l',	3,      594,     0 ), /*   593 nomru             */
+  S_ST( 'i',	3,      595,     0 ), /*   594 nomrul            */
+  S_ST( 's',	3,      367,     0 ), /*   595 nomruli           */
+  S_ST( 'n',	3,      597,   586 ), /*   596 no                */
+  S_ST( 'v',	3,      598,   368 ), /*   597 non               */
+  S_ST( 'o',	3,      599,     0 ), /*   598 nonv              */
+  S_ST( 'l',	3,      600,     0 ), /*   599 nonvo             */
+  S_ST( 'a',	3,      601,     0 ), /*   600 nonvol            */
+  S_ST( 't',	3,      602,     0 ), /*   601 nonvola           */
+  S_ST( 'i',	3,      603,     0 ), /*   602 nonvolat          */
+  S_ST( 'l',	3,      369,     0 ), /*   603 nonvolati         */
+  S_ST( 'p',	3,      605,   596 ), /*   604 no                */
+  S_ST( 'e',	3,      606,     0 ), /*   605 nop               */
+  S_ST( 'e',	3,      370,     0 ), /*   606 nope              */
+  S_ST( 'q',	3,      608,   604 ), /*   607 no                */
+  S_ST( 'u',	3,      609,     0 ), /*   608 noq               */
+  S_ST( 'e',	3,      610,     0 ), /*   609 noqu              */
+  S_ST( 'r',	3,      371,     0 ), /*   610 noque             */
+  S_ST( 's',	3,      612,   607 ), /*   611 no                */
+  S_ST( 'e',	3,      616,     0 ), /*   612 nos               */
+  S_ST( 'l',	3,      614,     0 ), /*   613 nose              */
+  S_ST( 'e',	3,      615,     0 ), /*   614 nosel             */
+  S_ST( 'c',	3,      372,     0 ), /*   615 nosele            */
+  S_ST( 'r',	3,      617,   613 ), /*   616 nose              */
+  S_ST( 'v',	3,      373,     0 ), /*   617 noser             */
+  S_ST( 't',	3,      619,   611 ), /*   618 no                */
+  S_ST( 'r',	3,      621,     0 ), /*   619 not               */
+  S_ST( 'a',	3,      374,     0 ), /*   620 notr              */
+  S_ST( 'u',	3,      622,   620 ), /*   621 notr              */
+  S_ST( 's',	3,      375,     0 ), /*   622 notru             */
+  S_ST( 't',	3,      376,   582 ), /*   623 n                 */
+  S_ST( 'p',	3,      625,     0 ), /*   624 ntp               */
+  S_ST( 'o',	3,      626,     0 ), /*   625 ntpp              */
+  S_ST( 'r',	3,      377,     0 ), /*   626 ntppo             */
+  S_ST( 's',	3,      628,   624 ), /*   627 ntp               */
+  S_ST( 'i',	3,      629,     0 ), /*   628 ntps              */
+  S_ST( 'g',	3,      630,     0 ), /*   629 ntpsi             */
+  S_ST( 'n',	3,      631,     0 ), /*   630 ntpsig            */
+  S_ST( 'd',	3,      632,     0 ), /*   631 ntpsign           */
+  S_ST( 's',	3,      633,     0 ), /*   632 ntpsignd          */
+  S_ST( 'o',	3,      634,     0 ), /*   633 ntpsignds         */
+  S_ST( 'c',	3,      635,     0 ), /*   634 ntpsigndso        */
+  S_ST( 'k',	3,      636,     0 ), /*   635 ntpsigndsoc       */
+  S_ST( 'e',	3,      378,     0 ), /*   636 ntpsigndsock      */
+  S_ST( 'o',	3,      638,   580 ), /*   637                   */
+  S_ST( 'r',	3,      639,     0 ), /*   638 o                 */
+  S_ST( 'p',	3,      640,     0 ), /*   639 or                */
+  S_ST( 'h',	3,      641,     0 ), /*   640 orp               */
+  S_ST( 'a',	3,      379,     0 ), /*   641 orph              */
+  S_ST( 'w',	3,      643,     0 ), /*   642 orphan            */
+  S_ST( 'a',	3,      644,     0 ), /*   643 orphanw           */
+  S_ST( 'i',	3,      380,     0 ), /*   644 orphanwa          */
+  S_ST( 'p',	3,      393,   637 ), /*   645                   */
+  S_ST( 'a',	3,      647,     0 ), /*   646 p                 */
+  S_ST( 'n',	3,      648,     0 ), /*   647 pa                */
+  S_ST( 'i',	3,      381,     0 ), /*   648 pan               */
+  S_ST( 'e',	3,      650,   646 ), /*   649 p                 */
+  S_ST( 'e',	3,      382,     0 ), /*   650 pe                */
+  S_ST( 's',	3,      652,     0 ), /*   651 peer              */
+  S_ST( 't',	3,      653,     0 ), /*   652 peers             */
+  S_ST( 'a',	3,      654,     0 ), /*   653 peerst            */
+  S_ST( 't',	3,      383,     0 ), /*   654 peersta           */
+  S_ST( 'h',	3,      656,   649 ), /*   655 p                 */
+  S_ST( 'o',	3,      657,     0 ), /*   656 ph                */
+  S_ST( 'n',	3,      384,     0 ), /*   657 pho               */
+  S_ST( 'i',	3,      385,   655 ), /*   658 p                 */
+  S_ST( 'f',	3,      660,     0 ), /*   659 pid               */
+  S_ST( 'i',	3,      661,     0 ), /*   660 pidf              */
+  S_ST( 'l',	3,      386,     0 ), /*   661 pidfi             */
+  S_ST( 'o',	3,      664,   658 ), /*   662 p                 */
+  S_ST( 'o',	3,      387,     0 ), /*   663 po                */
+  S_ST( 'r',	3,      388,   663 ), /*   664 po                */
+  S_ST( 'r',	3,      672,   662 ), /*   665 p                 */
+  S_ST( 'e',	3,      670,     0 ), /*   666 pr                */
+  S_ST( 'e',	3,      668,     0 ), /*   667 pre               */
+  S_ST( 'm',	3,      669,     0 ), /*   668 pree              */
+  S_ST( 'p',	3,      389,     0 ), /*   669 preem             */
+  S_ST( 'f',	3,      671,   667 ), /*   670 pre               */
+  S_ST( 'e',	3,      390,     0 ), /*   671 pref              */
+  S_ST( 'o',	3,      685,   666 ), /*   672 pr                */
+  S_ST( 'c',	3,      674,     0 ), /*   673 pro               */
+  S_ST( '_',	3,      675,     0 ), /*   674 proc              */
+  S_ST( 'd',	3,      676,     0 ), /*   675 proc_             */
+  S_ST( 'e',	3,      677,     0 ), /*   676 proc_d            */
+  S_ST( 'l',	3,      678,     0 ), /*   677 proc_de           */
+  S_ST( 'a',	3,      456,     0 ), /*   678 proc_del          */
+  S_ST( 'p',	3,      680,   673 ), /*   679 pro               */
+  S_ST( '_',	3,      681,     0 ), /*   680 prop              */
+  S_ST( 'd',	3,      682,     0 ), /*   681 prop_             */
+  S_ST( 'e',	3,      683,     0 ), /*   682 prop_d            */
+  S_ST( 'l',	3,      684,     0 ), /*   683 prop_de           */
+  S_ST( 'a',	3,      455,     0 ), /*   684 prop_del          */
+  S_ST( 't',	3,      686,   679 ), /*   685 pro               */
+  S_ST( 'o',	3,      687,     0 ), /*   686 prot              */
+  S_ST( 's',	3,      688,     0 ), /*   687 proto             */
+  S_ST( 't',	3,      689,     0 ), /*   688 protos            */
+  S_ST( 'a',	3,      690,     0 ), /*   689 protost           */
+  S_ST( 't',	3,      391,     0 ), /*   690 protosta          */
+  S_ST( 'u',	3,      692,   665 ), /*   691 p                 */
+  S_ST( 'b',	3,      693,     0 ), /*   692 pu                */
+  S_ST( 'l',	3,      694,     0 ), /*   693 pub               */
+  S_ST( 'i',	3,      695,     0 ), /*   694 publ              */
+  S_ST( 's',	3,      392,     0 ), /*   695 publi             */
+  S_ST( 'r',	3,      727,   645 ), /*   696                   */
+  S_ST( 'a',	3,      703,     0 ), /*   697 r                 */
+  S_ST( 'n',	3,      699,     0 ), /*   698 ra                */
+  S_ST( 'd',	3,      700,     0 ), /*   699 ran               */
+  S_ST( 'f',	3,      701,     0 ), /*   700 rand              */
+  S_ST( 'i',	3,      702,     0 ), /*   701 randf             */
+  S_ST( 'l',	3,      394,     0 ), /*   702 randfi            */
+  S_ST( 'w',	3,      704,   698 ), /*   703 ra                */
+  S_ST( 's',	3,      705,     0 ), /*   704 raw               */
+  S_ST( 't',	3,      706,     0 ), /*   705 raws              */
+  S_ST( 'a',	3,      707,     0 ), /*   706 rawst             */
+  S_ST( 't',	3,      395,     0 ), /*   707 rawsta            */
+  S_ST( 'e',	3,      724,   697 ), /*   708 r                 */
+  S_ST( 'f',	3,      710,     0 ), /*   709 re                */
+  S_ST( 'i',	3,      396,     0 ), /*   710 ref               */
+  S_ST( 'q',	3,      712,   709 ), /*   711 re                */
+  S_ST( 'u',	3,      713,     0 ), /*   712 req               */
+  S_ST( 'e',	3,      714,     0 ), /*   713 requ              */
+  S_ST( 's',	3,      715,     0 ), /*   714 reque             */
+  S_ST( 't',	3,      716,     0 ), /*   715 reques            */
+  S_ST( 'k',	3,      717,     0 ), /*   716 request           */
+  S_ST( 'e',	3,      397,     0 ), /*   717 requestk          */
+  S_ST( 's',	3,      720,   711 ), /*   718 re                */
+  S_ST( 'e',	3,      398,     0 ), /*   719 res               */
+  S_ST( 't',	3,      721,   719 ), /*   720 res               */
+  S_ST( 'r',	3,      722,     0 ), /*   721 rest              */
+  S_ST( 'i',	3,      723,     0 ), /*   722 restr             */
+  S_ST( 'c',	3,      399,     0 ), /*   723 restri            */
+  S_ST( 'v',	3,      725,   718 ), /*   724 re                */
+  S_ST( 'o',	3,      726,     0 ), /*   725 rev               */
+  S_ST( 'k',	3,      400,     0 ), /*   726 revo              */
+  S_ST( 'l',	3,      728,   708 ), /*   727 r                 */
+  S_ST( 'i',	3,      729,     0 ), /*   728 rl                */
+  S_ST( 'm',	3,      730,     0 ), /*   729 rli               */
+  S_ST( 'i',	3,      401,     0 ), /*   730 rlim              */
+  S_ST( 's',	3,      812,   696 ), /*   731                   */
+  S_ST( 'a',	3,      733,     0 ), /*   732 s                 */
+  S_ST( 'v',	3,      734,     0 ), /*   733 sa                */
+  S_ST( 'e',	3,      735,     0 ), /*   734 sav               */
+  S_ST( 'c',	3,      736,     0 ), /*   735 save              */
+  S_ST( 'o',	3,      737,     0 ), /*   736 savec             */
+  S_ST( 'n',	3,      738,     0 ), /*   737 saveco            */
+  S_ST( 'f',	3,      739,     0 ), /*   738 savecon           */
+  S_ST( 'i',	3,      740,     0 ), /*   739 saveconf          */
+  S_ST( 'g',	3,      741,     0 ), /*   740 saveconfi         */
+  S_ST( 'd',	3,      742,     0 ), /*   741 saveconfig        */
+  S_ST( 'i',	3,      402,     0 ), /*   742 saveconfigd       */
+  S_ST( 'e',	3,      752,   732 ), /*   743 s                 */
+  S_ST( 'r',	3,      745,     0 ), /*   744 se                */
+  S_ST( 'v',	3,      403,     0 ), /*   745 ser               */
+  S_ST( '_',	3,      747,     0 ), /*   746 server            */
+  S_ST( 'o',	3,      748,     0 ), /*   747 server_           */
+  S_ST( 'f',	3,      749,     0 ), /*   748 server_o          */
+  S_ST( 'f',	3,      750,     0 ), /*   749 server_of         */
+  S_ST( 's',	3,      751,     0 ), /*   750 server_off        */
+  S_ST( 'e',	3,      450,     0 ), /*   751 server_offs       */
+  S_ST( 't',	3,      753,   744 ), /*   752 se                */
+  S_ST( 'v',	3,      754,     0 ), /*   753 set               */
+  S_ST( 'a',	3,      405,     0 ), /*   754 setv              */
+  S_ST( 'h',	3,      756,   743 ), /*   755 s                 */
+  S_ST( 'a',	3,      757,     0 ), /*   756 sh                */
+  S_ST( 'r',	3,      758,     0 ), /*   757 sha               */
+  S_ST( 'e',	3,      759,     0 ), /*   758 shar              */
+  S_ST( 'd',	3,      760,     0 ), /*   759 share             */
+  S_ST( 's',	3,      761,     0 ), /*   760 shared            */
+  S_ST( 't',	3,      762,     0 ), /*   761 shareds           */
+  S_ST( 'a',	3,      763,     0 ), /*   762 sharedst          */
+  S_ST( 't',	3,      406,     0 ), /*   763 sharedsta         */
+  S_ST( 'i',	3,      765,   755 ), /*   764 s                 */
+  S_ST( 'm',	3,      766,     0 ), /*   765 si                */
+  S_ST( 'u',	3,      767,     0 ), /*   766 sim               */
+  S_ST( 'l',	3,      768,     0 ), /*   767 simu              */
+  S_ST( 'a',	3,      769,     0 ), /*   768 simul             */
+  S_ST( 't',	3,      770,     0 ), /*   769 simula            */
+  S_ST( 'i',	3,      771,   447 ), /*   770 simulat           */
+  S_ST( 'o',	3,      772,     0 ), /*   771 simulati          */
+  S_ST( 'n',	3,      773,     0 ), /*   772 simulatio         */
+  S_ST( '_',	3,      774,     0 ), /*   773 simulation        */
+  S_ST( 'd',	3,      775,     0 ), /*   774 simulation_       */
+  S_ST( 'u',	3,      776,     0 ), /*   775 simulation_d      */
+  S_ST( 'r',	3,      777,     0 ), /*   776 simulation_du     */
+  S_ST( 'a',	3,      778,     0 ), /*   777 simulation_dur    */
+  S_ST( 't',	3,      779,     0 ), /*   778 simulation_dura   */
+  S_ST( 'i',	3,      780,     0 ), /*   779 simulation_durat  */
+  S_ST( 'o',	3,      449,     0 ), /*   780 simulation_durati */
+  S_ST( 'o',	3,      782,   764 ), /*   781 s                 */
+  S_ST( 'u',	3,      783,     0 ), /*   782 so                */
+  S_ST( 'r',	3,      784,     0 ), /*   783 sou               */
+  S_ST( 'c',	3,      407,     0 ), /*   784 sour              */
+  S_ST( 't',	3,      808,   781 ), /*   785 s                 */
+  S_ST( 'a',	3,      792,     0 ), /*   786 st                */
+  S_ST( 'c',	3,      788,     0 ), /*   787 sta               */
+  S_ST( 'k',	3,      789,     0 ), /*   788 stac              */
+  S_ST( 's',	3,      790,     0 ), /*   789 stack             */
+  S_ST( 'i',	3,      791,     0 ), /*   790 stacks            */
+  S_ST( 'z',	3,      408,     0 ), /*   791 stacksi           */
+  S_ST( 't',	3,      410,   787 ), /*   792 sta               */
+  S_ST( 'i',	3,      794,     0 ), /*   793 stat              */
+  S_ST( 's',	3,      795,     0 ), /*   794 stati             */
+  S_ST( 't',	3,      796,     0 ), /*   795 statis            */
+  S_ST( 'i',	3,      797,     0 ), /*   796 statist           */
+  S_ST( 'c',	3,      409,     0 ), /*   797 statisti          */
+  S_ST( 'd',	3,      799,     0 ), /*   798 stats             */
+  S_ST( 'i',	3,      411,     0 ), /*   799 statsd            */
+  S_ST( 'e',	3,      412,   786 ), /*   800 st                */
+  S_ST( 'b',	3,      802,     0 ), /*   801 step              */
+  S_ST( 'a',	3,      803,     0 ), /*   802 stepb             */
+  S_ST( 'c',	3,      413,     0 ), /*   803 stepba            */
+  S_ST( 'f',	3,      805,   801 ), /*   804 step              */
+  S_ST( 'w',	3,      414,     0 ), /*   805 stepf             */
+  S_ST( 'o',	3,      807,   804 ), /*   806 step              */
+  S_ST( 'u',	3,      415,     0 ), /*   807 stepo             */
+  S_ST( 'r',	3,      809,   800 ), /*   808 st                */
+  S_ST( 'a',	3,      810,     0 ), /*   809 str               */
+  S_ST( 't',	3,      811,     0 ), /*   810 stra              */
+  S_ST( 'u',	3,      416,     0 ), /*   811 strat             */
+  S_ST( 'y',	3,      418,   785 ), /*   812 s                 */
+  S_ST( 's',	3,      814,     0 ), /*   813 sys               */
+  S_ST( 't',	3,      815,     0 ), /*   814 syss              */
+  S_ST( 'a',	3,      816,     0 ), /*   815 sysst             */
+  S_ST( 't',	3,      419,     0 ), /*   816 syssta            */
+  S_ST( 't',	3,      843,   731 ), /*   817                   */
+  S_ST( 'i',	3,      829,     0 ), /*   818 t                 */
+  S_ST( 'c',	3,      420,     0 ), /*   819 ti                */
+  S_ST( 'm',	3,      822,   819 ), /*   820 ti                */
+  S_ST( 'e',	3,      423,     0 ), /*   821 tim               */
+  S_ST( 'i',	3,      823,   821 ), /*   822 tim               */
+  S_ST( 'n',	3,      824,     0 ), /*   823 timi              */
+  S_ST( 'g',	3,      825,     0 ), /*   824 timin             */
+  S_ST( 's',	3,      826,     0 ), /*   825 timing            */
+  S_ST( 't',	3,      827,     0 ), /*   826 timings           */
+  S_ST( 'a',	3,      828,     0 ), /*   827 timingst          */
+  S_ST( 't',	3,      424,     0 ), /*   828 timingsta         */
+  S_ST( 'n',	3,      830,   820 ), /*   829 ti                */
+  S_ST( 'k',	3,      831,     0 ), /*   830 tin               */
+  S_ST( 'e',	3,      425,     0 ), /*   831 tink              */
+  S_ST( 'o',	3,      426,   818 ), /*   832 t                 */
+  S_ST( 'r',	3,      835,   832 ), /*   833 t                 */
+  S_ST( 'a',	3,      427,     0 ), /*   834 tr                */
+  S_ST( 'u',	3,      836,   834 ), /*   835 tr                */
+  S_ST( 's',	3,      837,   428 ), /*   836 tru               */
+  S_ST( 't',	3,      838,     0 ), /*   837 trus              */
+  S_ST( 'e',	3,      839,     0 ), /*   838 trust             */
+  S_ST( 'd',	3,      840,     0 ), /*   839 truste            */
+  S_ST( 'k',	3,      841,     0 ), /*   840 trusted           */
+  S_ST( 'e',	3,      429,     0 ), /*   841 trustedk          */
+  S_ST( 't',	3,      430,   833 ), /*   842 t                 */
+  S_ST( 'y',	3,      844,   842 ), /*   843 t                 */
+  S_ST( 'p',	3,      431,     0 ), /*   844 ty                */
+  S_ST( 'u',	3,      846,   817 ), /*   845                   */
+  S_ST( 'n',	3,      852,     0 ), /*   846 u                 */
+  S_ST( 'c',	3,      848,     0 ), /*   847 un                */
+  S_ST( 'o',	3,      849,     0 ), /*   848 unc               */
+  S_ST( 'n',	3,      850,     0 ), /*   849 unco              */
+  S_ST( 'f',	3,      851,     0 ), /*   850 uncon             */
+  S_ST( 'i',	3,      436,     0 ), /*   851 unconf            */
+  S_ST( 'p',	3,      853,   847 ), /*   852 un                */
+  S_ST( 'e',	3,      854,     0 ), /*   853 unp               */
+  S_ST( 'e',	3,      437,     0 ), /*   854 unpe              */
+  S_ST( '_',	3,      875,     0 ), /*   855 unpeer            */
+  S_ST( 'c',	3,      857,     0 ), /*   856 unpeer_           */
+  S_ST( 'r',	3,      858,     0 ), /*   857 unpeer_c          */
+  S_ST( 'y',	3,      859,     0 ), /*   858 unpeer_cr         */
+  S_ST( 'p',	3,      860,     0 ), /*   859 unpeer_cry        */
+  S_ST( 't',	3,      861,     0 ), /*   860 unpeer_cryp       */
+  S_ST( 'o',	3,      862,     0 ), /*   861 unpeer_crypt      */
+  S_ST( '_',	3,      867,     0 ), /*   862 unpeer_crypto     */
+  S_ST( 'e',	3,      864,     0 ), /*   863 unpeer_crypto_    */
+  S_ST( 'a',	3,      865,     0 ), /*   864 unpeer_crypto_e   */
+  S_ST( 'r',	3,      866,     0 ), /*   865 unpeer_crypto_ea  */
+  S_ST( 'l',	3,      433,     0 ), /*   866 unpeer_crypto_ear */
+  S_ST( 'n',	3,      868,   863 ), /*   867 unpeer_crypto_    */
+  S_ST( 'a',	3,      869,     0 ), /*   868 unpeer_crypto_n   */
+  S_ST( 'k',	3,      870,     0 ), /*   869 unpeer_crypto_na  */
+  S_ST( '_',	3,      871,     0 ), /*   870 unpeer_crypto_nak */
+  S_ST( 'e',	3,      872,     0 ), /*   871 unpeer_crypto_nak_ */
+  S_ST( 'a',	3,      873,     0 ), /*   872 unpeer_crypto_nak_e */
+  S_ST( 'r',	3,      874,     0 ), /*   873 unpeer_crypto_nak_ea */
+  S_ST( 'l',	3,      434,     0 ), /*   874 unpeer_crypto_nak_ear */
+  S_ST( 'd',	3,      876,   856 ), /*   875 unpeer_           */
+  S_ST( 'i',	3,      877,     0 ), /*   876 unpeer_d          */
+  S_ST( 'g',	3,      878,     0 ), /*   877 unpeer_di         */
+  S_ST( 'e',	3,      879,     0 ), /*   878 unpeer_dig        */
+  S_ST( 's',	3,      880,     0 ), /*   879 unpeer_dige       */
+  S_ST( 't',	3,      881,     0 ), /*   880 unpeer_diges      */
+  S_ST( '_',	3,      882,     0 ), /*   881 unpeer_digest     */
+  S_ST( 'e',	3,      883,     0 ), /*   882 unpeer_digest_    */
+  S_ST( 'a',	3,      884,     0 ), /*   883 unpeer_digest_e   */
+  S_ST( 'r',	3,      885,     0 ), /*   884 unpeer_digest_ea  */
+  S_ST( 'l',	3,      435,     0 ), /*   885 unpeer_digest_ear */
+  S_ST( 'v',	3,      887,   845 ), /*   886                   */
+  S_ST( 'e',	3,      888,     0 ), /*   887 v                 */
+  S_ST( 'r',	3,      889,     0 ), /*   888 ve                */
+  S_ST( 's',	3,      890,     0 ), /*   889 ver               */
+  S_ST( 'i',	3,      891,     0 ), /*   890 vers              */
+  S_ST( 'o',	3,      438,     0 ), /*   891 versi             */
+  S_ST( 'w',	3,      899,   886 ), /*   892                   */
+  S_ST( 'a',	3,      894,     0 ), /*   893 w                 */
+  S_ST( 'n',	3,      895,     0 ), /*   894 wa                */
+  S_ST( 'd',	3,      896,     0 ), /*   895 wan               */
+  S_ST( 'e',	3,      453,     0 ), /*   896 wand              */
+  S_ST( 'e',	3,      898,   893 ), /*   897 w                 */
+  S_ST( 'e',	3,      440,     0 ), /*   898 we                */
+  S_ST( 'i',	3,      900,   897 ), /*   899 w                 */
+  S_ST( 'l',	3,      901,     0 ), /*   900 wi                */
+  S_ST( 'd',	3,      902,     0 ), /*   901 wil               */
+  S_ST( 'c',	3,      903,     0 ), /*   902 wild              */
+  S_ST( 'a',	3,      904,     0 ), /*   903 wildc             */
+  S_ST( 'r',	3,      441,     0 ), /*   904 wildca            */
+  S_ST( 'x',	3,      907,   892 ), /*   905                   */
+  S_ST( 'd',	3,      442,     0 ), /*   906 x                 */
+  S_ST( 'l',	3,      908,   906 ), /*   907 x                 */
+  S_ST( 'e',	3,      909,     0 ), /*   908 xl                */
+  S_ST( 'a',	3,      910,     0 ), /*   909 xle               */
+  S_ST( 'v',	3,      443,     0 ), /*   910 xlea              */
+  S_ST( 'y',	3,      912,   905 ), /*   911 [initial state]   */
+  S_ST( 'e',	3,      913,     0 ), /*   912 y                 */
+  S_ST( 'a',	3,      444,     0 )  /*   913 ye                */
 };
 
@@ -459,6 +459,7 @@ local_clock(
 	char	tbuf[80];	/* report buffer */
 
 	(void)ntp_adj_ret; /* not always used below... */
+	ctl_sys_changed();
 	/*
 	 * If the loop is opened or the NIST LOCKCLOCK is in use,
 	 * monitor and record the offsets anyway in order to determine
@@ -1230,6 +1231,7 @@ loop_config(
 	double	ftemp;
 
 	DPRINTF(2, ("loop_config: item %d freq %f\n", item, freq));
+	ctl_sys_changed();
 	switch (item) {
 
 	/*
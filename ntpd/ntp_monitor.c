@@ -62,8 +62,16 @@ u_char	mon_hash_bits;
  * table is allocated only if monitoring is enabled.
  */
 mon_entry **	mon_hash;	/* MRU hash table */
+static size_t	mon_hash_octets; /* its size in octets */
 mon_entry	mon_mru_list;	/* mru listhead */
 
+/*
+ * The entry ntp_monitor() last found or made for a packet, for
+ * fast_xmit() to keep the interleaved timestamps of its reply in.
+ * NULL if the packet was not recorded.
+ */
+mon_entry *	mon_rx_entry;
+
 /*
  * List of free structures structures, and counters of in-use and total
  * structures. The free structures are linked with the hash_next field.
@@ -142,6 +150,7 @@ mon_free_entry(
 	mon_entry *m
 	)
 {
+	sendpkt_forget(&m->xleave_xmt);
 	ZERO(*m);
 	LINK_SLIST(mon_free, m, hash_next);
 }
@@ -165,6 +174,7 @@ mon_reclaim_entry(
 
 	UNLINK_DLIST(m, mru);
 	remove_from_hash(m);
+	sendpkt_forget(&m->xleave_xmt);
 	ZERO(*m);
 }
 
@@ -183,7 +193,8 @@ mon_getmoremem(void)
 		      : mru_incalloc;
 
 	if (entries) {
-		chunk = eallocarray(entries, sizeof(*chunk));
+		chunk = eallocarray_tag(MEM_MRU, entries,
+					sizeof(*chunk));
 		mru_alloc += entries;
 		for (chunk += entries; entries; entries--)
 			mon_free_entry(--chunk);
@@ -224,7 +235,11 @@ mon_start(
 	mon_hash_bits = max(4, mon_hash_bits);
 	mon_hash_bits = min(16, mon_hash_bits);
 	octets = sizeof(*mon_hash) * MON_HASH_SIZE;
+	if (mon_hash != NULL)
+		mem_shrink(MEM_MRU, mon_hash_octets);
+	mem_grow(MEM_MRU, octets, TRUE);
 	mon_hash = erealloc_zero(mon_hash, octets, 0);
+	mon_hash_octets = octets;
 
 	mon_enabled = mode;
 }
@@ -259,6 +274,7 @@ mon_stop(
 	ITER_DLIST_END()
 
 	/* empty the MRU list and hash table. */
+	mon_rx_entry = NULL;
 	mru_entries = 0;
 	INIT_DLIST(mon_mru_list, mru);
 	zero_mem(mon_hash, sizeof(*mon_hash) * MON_HASH_SIZE);
@@ -327,6 +343,7 @@ ntp_monitor(
 
 	REQUIRE(rbufp != NULL);
 
+	mon_rx_entry = NULL;
 	if (mon_enabled == MON_OFF)
 		return ~(RES_LIMITED | RES_KOD) & flags;
 
@@ -398,6 +415,7 @@ ntp_monitor(
 			restrict_mask &= ~RES_KOD;
 
 		mon->flags = restrict_mask;
+		mon_rx_entry = mon;
 
 		return mon->flags;
 	}
@@ -480,6 +498,8 @@ ntp_monitor(
 	mon->count = 1;
 	mon->flags = ~(RES_LIMITED | RES_KOD) & flags;
 	mon->leak = 0;
+	L_CLR(&mon->xleave_rec);
+	L_CLR(&mon->xleave_xmt);
 	memcpy(&mon->rmtadr, &rbufp->recv_srcadr, sizeof(mon->rmtadr));
 	mon->vn_mode = VN_MODE(version, mode);
 	mon->lcladr = rbufp->dstadr;
@@ -493,6 +513,7 @@ ntp_monitor(
 	 */
 	LINK_SLIST(mon_hash[hash], mon, hash_next);
 	LINK_DLIST(mon_mru_list, mon, mru);
+	mon_rx_entry = mon;
 
 	return mon->flags;
 }
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.7.12-4996.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2013 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_NTP_PARSER_H_INCLUDED
 # define YY_YY_NTP_PARSER_H_INCLUDED
-/* Enabling traces.  */
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 1
 #endif
@@ -40,209 +45,222 @@
 extern int yydebug;
 #endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     T_Abbrev = 258,
-     T_Age = 259,
-     T_All = 260,
-     T_Allan = 261,
-     T_Allpeers = 262,
-     T_Auth = 263,
-     T_Autokey = 264,
-     T_Automax = 265,
-     T_Average = 266,
-     T_Bclient = 267,
-     T_Beacon = 268,
-     T_Broadcast = 269,
-     T_Broadcastclient = 270,
-     T_Broadcastdelay = 271,
-     T_Burst = 272,
-     T_Calibrate = 273,
-     T_Ceiling = 274,
-     T_Clockstats = 275,
-     T_Cohort = 276,
-     T_ControlKey = 277,
-     T_Crypto = 278,
-     T_Cryptostats = 279,
-     T_Ctl = 280,
-     T_Day = 281,
-     T_Default = 282,
-     T_Digest = 283,
-     T_Disable = 284,
-     T_Discard = 285,
-     T_Dispersion = 286,
-     T_Double = 287,
-     T_Driftfile = 288,
-     T_Drop = 289,
-     T_Dscp = 290,
-     T_Ellipsis = 291,
-     T_Enable = 292,
-     T_End = 293,
-     T_False = 294,
-     T_File = 295,
-     T_Filegen = 296,
-     T_Filenum = 297,
-     T_Flag1 = 298,
-     T_Flag2 = 299,
-     T_Flag3 = 300,
-     T_Flag4 = 301,
-     T_Flake = 302,
-     T_Floor = 303,
-     T_Freq = 304,
-     T_Fudge = 305,
-     T_Host = 306,
-     T_Huffpuff = 307,
-     T_Iburst = 308,
-     T_Ident = 309,
-     T_Ignore = 310,
-     T_Incalloc = 311,
-     T_Incmem = 312,
-     T_Initalloc = 313,
-     T_Initmem = 314,
-     T_Includefile = 315,
-     T_Integer = 316,
-     T_Interface = 317,
-     T_Intrange = 318,
-     T_Io = 319,
-     T_Ipv4 = 320,
-     T_Ipv4_flag = 321,
-     T_Ipv6 = 322,
-     T_Ipv6_flag = 323,
-     T_Kernel = 324,
-     T_Key = 325,
-     T_Keys = 326,
-     T_Keysdir = 327,
-     T_Kod = 328,
-     T_Mssntp = 329,
-     T_Leapfile = 330,
-     T_Leapsmearinterval = 331,
-     T_Limited = 332,
-     T_Link = 333,
-     T_Listen = 334,
-     T_Logconfig = 335,
-     T_Logfile = 336,
-     T_Loopstats = 337,
-     T_Lowpriotrap = 338,
-     T_Manycastclient = 339,
-     T_Manycastserver = 340,
-     T_Mask = 341,
-     T_Maxage = 342,
-     T_Maxclock = 343,
-     T_Maxdepth = 344,
-     T_Maxdist = 345,
-     T_Maxmem = 346,
-     T_Maxpoll = 347,
-     T_Mdnstries = 348,
-     T_Mem = 349,
-     T_Memlock = 350,
-     T_Minclock = 351,
-     T_Mindepth = 352,
-     T_Mindist = 353,
-     T_Minimum = 354,
-     T_Minpoll = 355,
-     T_Minsane = 356,
-     T_Mode = 357,
-     T_Mode7 = 358,
-     T_Monitor = 359,
-     T_Month = 360,
-     T_Mru = 361,
-     T_Multicastclient = 362,
-     T_Nic = 363,
-     T_Nolink = 364,
-     T_Nomodify = 365,
-     T_Nomrulist = 366,
-     T_None = 367,
-     T_Nonvolatile = 368,
-     T_Nopeer = 369,
-     T_Noquery = 370,
-     T_Noselect = 371,
-     T_Noserve = 372,
-     T_Notrap = 373,
-     T_Notrust = 374,
-     T_Ntp = 375,
-     T_Ntpport = 376,
-     T_NtpSignDsocket = 377,
-     T_Orphan = 378,
-     T_Orphanwait = 379,
-     T_Panic = 380,
-     T_Peer = 381,
-     T_Peerstats = 382,
-     T_Phone = 383,
-     T_Pid = 384,
-     T_Pidfile = 385,
-     T_Pool = 386,
-     T_Port = 387,
-     T_Preempt = 388,
-     T_Prefer = 389,
-     T_Protostats = 390,
-     T_Pw = 391,
-     T_Randfile = 392,
-     T_Rawstats = 393,
-     T_Refid = 394,
-     T_Requestkey = 395,
-     T_Reset = 396,
-     T_Restrict = 397,
-     T_Revoke = 398,
-     T_Rlimit = 399,
-     T_Saveconfigdir = 400,
-     T_Server = 401,
-     T_Setvar = 402,
-     T_Source = 403,
-     T_Stacksize = 404,
-     T_Statistics = 405,
-     T_Stats = 406,
-     T_Statsdir = 407,
-     T_Step = 408,
-     T_Stepback = 409,
-     T_Stepfwd = 410,
-     T_Stepout = 411,
-     T_Stratum = 412,
-     T_String = 413,
-     T_Sys = 414,
-     T_Sysstats = 415,
-     T_Tick = 416,
-     T_Time1 = 417,
-     T_Time2 = 418,
-     T_Timer = 419,
-     T_Timingstats = 420,
-     T_Tinker = 421,
-     T_Tos = 422,
-     T_Trap = 423,
-     T_True = 424,
-     T_Trustedkey = 425,
-     T_Ttl = 426,
-     T_Type = 427,
-     T_U_int = 428,
-     T_UEcrypto = 429,
-     T_UEcryptonak = 430,
-     T_UEdigest = 431,
-     T_Unconfig = 432,
-     T_Unpeer = 433,
-     T_Version = 434,
-     T_WanderThreshold = 435,
-     T_Week = 436,
-     T_Wildcard = 437,
-     T_Xleave = 438,
-     T_Year = 439,
-     T_Flag = 440,
-     T_EOC = 441,
-     T_Simulate = 442,
-     T_Beep_Delay = 443,
-     T_Sim_Duration = 444,
-     T_Server_Offset = 445,
-     T_Duration = 446,
-     T_Freq_Offset = 447,
-     T_Wander = 448,
-     T_Jitter = 449,
-     T_Prop_Delay = 450,
-     T_Proc_Delay = 451
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    T_Abbrev = 258,                /* T_Abbrev  */
+    T_Age = 259,                   /* T_Age  */
+    T_All = 260,                   /* T_All  */
+    T_Allan = 261,                 /* T_Allan  */
+    T_Allpeers = 262,              /* T_Allpeers  */
+    T_Auth = 263,                  /* T_Auth  */
+    T_Autokey = 264,               /* T_Autokey  */
+    T_Automax = 265,               /* T_Automax  */
+    T_Average = 266,               /* T_Average  */
+    T_Bclient = 267,               /* T_Bclient  */
+    T_Beacon = 268,                /* T_Beacon  */
+    T_Broadcast = 269,             /* T_Broadcast  */
+    T_Broadcastclient = 270,       /* T_Broadcastclient  */
+    T_Broadcastdelay = 271,        /* T_Broadcastdelay  */
+    T_Burst = 272,                 /* T_Burst  */
+    T_Calibrate = 273,             /* T_Calibrate  */
+    T_Ceiling = 274,               /* T_Ceiling  */
+    T_Clockstats = 275,            /* T_Clockstats  */
+    T_Cohort = 276,                /* T_Cohort  */
+    T_ControlKey = 277,            /* T_ControlKey  */
+    T_Controlsocket = 278,         /* T_Controlsocket  */
+    T_Crypto = 279,                /* T_Crypto  */
+    T_Cryptostats = 280,           /* T_Cryptostats  */
+    T_Ctl = 281,                   /* T_Ctl  */
+    T_Day = 282,                   /* T_Day  */
+    T_Default = 283,               /* T_Default  */
+    T_Digest = 284,                /* T_Digest  */
+    T_Disable = 285,               /* T_Disable  */
+    T_Discard = 286,               /* T_Discard  */
+    T_Dispersion = 287,            /* T_Dispersion  */
+    T_Double = 288,                /* T_Double  */
+    T_Driftfile = 289,             /* T_Driftfile  */
+    T_Drop = 290,                  /* T_Drop  */
+    T_Dscp = 291,                  /* T_Dscp  */
+    T_Ellipsis = 292,              /* T_Ellipsis  */
+    T_Enable = 293,                /* T_Enable  */
+    T_End = 294,                   /* T_End  */
+    T_False = 295,                 /* T_False  */
+    T_File = 296,                  /* T_File  */
+    T_Filegen = 297,               /* T_Filegen  */
+    T_Filenum = 298,               /* T_Filenum  */
+    T_Flag1 = 299,                 /* T_Flag1  */
+    T_Flag2 = 300,                 /* T_Flag2  */
+    T_Flag3 = 301,                 /* T_Flag3  */
+    T_Flag4 = 302,                 /* T_Flag4  */
+    T_Flake = 303,                 /* T_Flake  */
+    T_Floor = 304,                 /* T_Floor  */
+    T_Freq = 305,                  /* T_Freq  */
+    T_Fudge = 306,                 /* T_Fudge  */
+    T_Host = 307,                  /* T_Host  */
+    T_Huffpuff = 308,              /* T_Huffpuff  */
+    T_Iburst = 309,                /* T_Iburst  */
+    T_Ident = 310,                 /* T_Ident  */
+    T_Ignore = 311,                /* T_Ignore  */
+    T_Incalloc = 312,              /* T_Incalloc  */
+    T_Incmem = 313,                /* T_Incmem  */
+    T_Initalloc = 314,             /* T_Initalloc  */
+    T_Initmem = 315,               /* T_Initmem  */
+    T_Includefile = 316,           /* T_Includefile  */
+    T_Integer = 317,               /* T_Integer  */
+    T_Interface = 318,             /* T_Interface  */
+    T_Intrange = 319,              /* T_Intrange  */
+    T_Io = 320,                    /* T_Io  */
+    T_Ipv4 = 321,                  /* T_Ipv4  */
+    T_Ipv4_flag = 322,             /* T_Ipv4_flag  */
+    T_Ipv6 = 323,                  /* T_Ipv6  */
+    T_Ipv6_flag = 324,             /* T_Ipv6_flag  */
+    T_Kernel = 325,                /* T_Kernel  */
+    T_Key = 326,                   /* T_Key  */
+    T_Keys = 327,                  /* T_Keys  */
+    T_Keysdir = 328,               /* T_Keysdir  */
+    T_Kod = 329,                   /* T_Kod  */
+    T_Mssntp = 330,                /* T_Mssntp  */
+    T_Leapfile = 331,              /* T_Leapfile  */
+    T_Leapsmearinterval = 332,     /* T_Leapsmearinterval  */
+    T_Limited = 333,               /* T_Limited  */
+    T_Link = 334,                  /* T_Link  */
+    T_Listen = 335,                /* T_Listen  */
+    T_Logconfig = 336,             /* T_Logconfig  */
+    T_Logfile = 337,               /* T_Logfile  */
+    T_Loopstats = 338,             /* T_Loopstats  */
+    T_Lowpriotrap = 339,           /* T_Lowpriotrap  */
+    T_Manycastclient = 340,        /* T_Manycastclient  */
+    T_Manycastserver = 341,        /* T_Manycastserver  */
+    T_Mask = 342,                  /* T_Mask  */
+    T_Maxage = 343,                /* T_Maxage  */
+    T_Maxclock = 344,              /* T_Maxclock  */
+    T_Maxdepth = 345,              /* T_Maxdepth  */
+    T_Maxdist = 346,               /* T_Maxdist  */
+    T_Maxmem = 347,                /* T_Maxmem  */
+    T_Maxpoll = 348,               /* T_Maxpoll  */
+    T_Mdnstries = 349,             /* T_Mdnstries  */
+    T_Mem = 350,                   /* T_Mem  */
+    T_Memlock = 351,               /* T_Memlock  */
+    T_Minclock = 352,              /* T_Minclock  */
+    T_Mindepth = 353,              /* T_Mindepth  */
+    T_Mindist = 354,               /* T_Mindist  */
+    T_Minimum = 355,               /* T_Minimum  */
+    T_Minpoll = 356,               /* T_Minpoll  */
+    T_Minsane = 357,               /* T_Minsane  */
+    T_Mode = 358,                  /* T_Mode  */
+    T_Mode7 = 359,                 /* T_Mode7  */
+    T_Monitor = 360,               /* T_Monitor  */
+    T_Month = 361,                 /* T_Month  */
+    T_Mru = 362,                   /* T_Mru  */
+    T_Multicastclient = 363,       /* T_Multicastclient  */
+    T_Nic = 364,                   /* T_Nic  */
+    T_Nolink = 365,                /* T_Nolink  */
+    T_Nomodify = 366,              /* T_Nomodify  */
+    T_Nomrulist = 367,             /* T_Nomrulist  */
+    T_None = 368,                  /* T_None  */
+    T_Nonvolatile = 369,           /* T_Nonvolatile  */
+    T_Nopeer = 370,                /* T_Nopeer  */
+    T_Noquery = 371,               /* T_Noquery  */
+    T_Noselect = 372,              /* T_Noselect  */
+    T_Noserve = 373,               /* T_Noserve  */
+    T_Notrap = 374,                /* T_Notrap  */
+    T_Notrust = 375,               /* T_Notrust  */
+    T_Ntp = 376,                   /* T_Ntp  */
+    T_Ntpport = 377,               /* T_Ntpport  */
+    T_NtpSignDsocket = 378,        /* T_NtpSignDsocket  */
+    T_Orphan = 379,                /* T_Orphan  */
+    T_Orphanwait = 380,            /* T_Orphanwait  */
+    T_Panic = 381,                 /* T_Panic  */
+    T_Peer = 382,                  /* T_Peer  */
+    T_Peerstats = 383,             /* T_Peerstats  */
+    T_Phone = 384,                 /* T_Phone  */
+    T_Pid = 385,                   /* T_Pid  */
+    T_Pidfile = 386,               /* T_Pidfile  */
+    T_Pool = 387,                  /* T_Pool  */
+    T_Port = 388,                  /* T_Port  */
+    T_Preempt = 389,               /* T_Preempt  */
+    T_Prefer = 390,                /* T_Prefer  */
+    T_Protostats = 391,            /* T_Protostats  */
+    T_Publish = 392,               /* T_Publish  */
+    T_Pw = 393,                    /* T_Pw  */
+    T_Randfile = 394,              /* T_Randfile  */
+    T_Rawstats = 395,              /* T_Rawstats  */
+    T_Refid = 396,                 /* T_Refid  */
+    T_Requestkey = 397,            /* T_Requestkey  */
+    T_Reset = 398,                 /* T_Reset  */
+    T_Restrict = 399,              /* T_Restrict  */
+    T_Revoke = 400,                /* T_Revoke  */
+    T_Rlimit = 401,                /* T_Rlimit  */
+    T_Saveconfigdir = 402,         /* T_Saveconfigdir  */
+    T_Serve = 403,                 /* T_Serve  */
+    T_Server = 404,                /* T_Server  */
+    T_Setvar = 405,                /* T_Setvar  */
+    T_Sharedstate = 406,           /* T_Sharedstate  */
+    T_Source = 407,                /* T_Source  */
+    T_Stacksize = 408,             /* T_Stacksize  */
+    T_Statistics = 409,            /* T_Statistics  */
+    T_Stats = 410,                 /* T_Stats  */
+    T_Statsdir = 411,              /* T_Statsdir  */
+    T_Step = 412,                  /* T_Step  */
+    T_Stepback = 413,              /* T_Stepback  */
+    T_Stepfwd = 414,               /* T_Stepfwd  */
+    T_Stepout = 415,               /* T_Stepout  */
+    T_Stratum = 416,               /* T_Stratum  */
+    T_String = 417,                /* T_String  */
+    T_Sys = 418,                   /* T_Sys  */
+    T_Sysstats = 419,              /* T_Sysstats  */
+    T_Tick = 420,                  /* T_Tick  */
+    T_Time1 = 421,                 /* T_Time1  */
+    T_Time2 = 422,                 /* T_Time2  */
+    T_Timer = 423,                 /* T_Timer  */
+    T_Timingstats = 424,           /* T_Timingstats  */
+    T_Tinker = 425,                /* T_Tinker  */
+    T_Tos = 426,                   /* T_Tos  */
+    T_Trap = 427,                  /* T_Trap  */
+    T_True = 428,                  /* T_True  */
+    T_Trustedkey = 429,            /* T_Trustedkey  */
+    T_Ttl = 430,                   /* T_Ttl  */
+    T_Type = 431,                  /* T_Type  */
+    T_U_int = 432,                 /* T_U_int  */
+    T_UEcrypto = 433,              /* T_UEcrypto  */
+    T_UEcryptonak = 434,           /* T_UEcryptonak  */
+    T_UEdigest = 435,              /* T_UEdigest  */
+    T_Unconfig = 436,              /* T_Unconfig  */
+    T_Unpeer = 437,                /* T_Unpeer  */
+    T_Version = 438,               /* T_Version  */
+    T_WanderThreshold = 439,       /* T_WanderThreshold  */
+    T_Week = 440,                  /* T_Week  */
+    T_Wildcard = 441,              /* T_Wildcard  */
+    T_Xdp = 442,                   /* T_Xdp  */
+    T_Xleave = 443,                /* T_Xleave  */
+    T_Year = 444,                  /* T_Year  */
+    T_Flag = 445,                  /* T_Flag  */
+    T_EOC = 446,                   /* T_EOC  */
+    T_Simulate = 447,              /* T_Simulate  */
+    T_Beep_Delay = 448,            /* T_Beep_Delay  */
+    T_Sim_Duration = 449,          /* T_Sim_Duration  */
+    T_Server_Offset = 450,         /* T_Server_Offset  */
+    T_Duration = 451,              /* T_Duration  */
+    T_Freq_Offset = 452,           /* T_Freq_Offset  */
+    T_Wander = 453,                /* T_Wander  */
+    T_Jitter = 454,                /* T_Jitter  */
+    T_Prop_Delay = 455,            /* T_Prop_Delay  */
+    T_Proc_Delay = 456             /* T_Proc_Delay  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define T_Abbrev 258
 #define T_Age 259
 #define T_All 260
@@ -263,188 +281,191 @@ extern int yydebug;
 #define T_Clockstats 275
 #define T_Cohort 276
 #define T_ControlKey 277
-#define T_Crypto 278
-#define T_Cryptostats 279
-#define T_Ctl 280
-#define T_Day 281
-#define T_Default 282
-#define T_Digest 283
-#define T_Disable 284
-#define T_Discard 285
-#define T_Dispersion 286
-#define T_Double 287
-#define T_Driftfile 288
-#define T_Drop 289
-#define T_Dscp 290
-#define T_Ellipsis 291
-#define T_Enable 292
-#define T_End 293
-#define T_False 294
-#define T_File 295
-#define T_Filegen 296
-#define T_Filenum 297
-#define T_Flag1 298
-#define T_Flag2 299
-#define T_Flag3 300
-#define T_Flag4 301
-#define T_Flake 302
-#define T_Floor 303
-#define T_Freq 304
-#define T_Fudge 305
-#define T_Host 306
-#define T_Huffpuff 307
-#define T_Iburst 308
-#define T_Ident 309
-#define T_Ignore 310
-#define T_Incalloc 311
-#define T_Incmem 312
-#define T_Initalloc 313
-#define T_Initmem 314
-#define T_Includefile 315
-#define T_Integer 316
-#define T_Interface 317
-#define T_Intrange 318
-#define T_Io 319
-#define T_Ipv4 320
-#define T_Ipv4_flag 321
-#define T_Ipv6 322
-#define T_Ipv6_flag 323
-#define T_Kernel 324
-#define T_Key 325
-#define T_Keys 326
-#define T_Keysdir 327
-#define T_Kod 328
-#define T_Mssntp 329
-#define T_Leapfile 330
-#define T_Leapsmearinterval 331
-#define T_Limited 332
-#define T_Link 333
-#define T_Listen 334
-#define T_Logconfig 335
-#define T_Logfile 336
-#define T_Loopstats 337
-#define T_Lowpriotrap 338
-#define T_Manycastclient 339
-#define T_Manycastserver 340
-#define T_Mask 341
-#define T_Maxage 342
-#define T_Maxclock 343
-#define T_Maxdepth 344
-#define T_Maxdist 345
-#define T_Maxmem 346
-#define T_Maxpoll 347
-#define T_Mdnstries 348
-#define T_Mem 349
-#define T_Memlock 350
-#define T_Minclock 351
-#define T_Mindepth 352
-#define T_Mindist 353
-#define T_Minimum 354
-#define T_Minpoll 355
-#define T_Minsane 356
-#define T_Mode 357
-#define T_Mode7 358
-#define T_Monitor 359
-#define T_Month 360
-#define T_Mru 361
-#define T_Multicastclient 362
-#define T_Nic 363
-#define T_Nolink 364
-#define T_Nomodify 365
-#define T_Nomrulist 366
-#define T_None 367
-#define T_Nonvolatile 368
-#define T_Nopeer 369
-#define T_Noquery 370
-#define T_Noselect 371
-#define T_Noserve 372
-#define T_Notrap 373
-#define T_Notrust 374
-#define T_Ntp 375
-#define T_Ntpport 376
-#define T_NtpSignDsocket 377
-#define T_Orphan 378
-#define T_Orphanwait 379
-#define T_Panic 380
-#define T_Peer 381
-#define T_Peerstats 382
-#define T_Phone 383
-#define T_Pid 384
-#define T_Pidfile 385
-#define T_Pool 386
-#define T_Port 387
-#define T_Preempt 388
-#define T_Prefer 389
-#define T_Protostats 390
-#define T_Pw 391
-#define T_Randfile 392
-#define T_Rawstats 393
-#define T_Refid 394
-#define T_Requestkey 395
-#define T_Reset 396
-#define T_Restrict 397
-#define T_Revoke 398
-#define T_Rlimit 399
-#define T_Saveconfigdir 400
-#define T_Server 401
-#define T_Setvar 402
-#define T_Source 403
-#define T_Stacksize 404
-#define T_Statistics 405
-#define T_Stats 406
-#define T_Statsdir 407
-#define T_Step 408
-#define T_Stepback 409
-#define T_Stepfwd 410
-#define T_Stepout 411
-#define T_Stratum 412
-#define T_String 413
-#define T_Sys 414
-#define T_Sysstats 415
-#define T_Tick 416
-#define T_Time1 417
-#define T_Time2 418
-#define T_Timer 419
-#define T_Timingstats 420
-#define T_Tinker 421
-#define T_Tos 422
-#define T_Trap 423
-#define T_True 424
-#define T_Trustedkey 425
-#define T_Ttl 426
-#define T_Type 427
-#define T_U_int 428
-#define T_UEcrypto 429
-#define T_UEcryptonak 430
-#define T_UEdigest 431
-#define T_Unconfig 432
-#define T_Unpeer 433
-#define T_Version 434
-#define T_WanderThreshold 435
-#define T_Week 436
-#define T_Wildcard 437
-#define T_Xleave 438
-#define T_Year 439
-#define T_Flag 440
-#define T_EOC 441
-#define T_Simulate 442
-#define T_Beep_Delay 443
-#define T_Sim_Duration 444
-#define T_Server_Offset 445
-#define T_Duration 446
-#define T_Freq_Offset 447
-#define T_Wander 448
-#define T_Jitter 449
-#define T_Prop_Delay 450
-#define T_Proc_Delay 451
-
-
+#define T_Controlsocket 278
+#define T_Crypto 279
+#define T_Cryptostats 280
+#define T_Ctl 281
+#define T_Day 282
+#define T_Default 283
+#define T_Digest 284
+#define T_Disable 285
+#define T_Discard 286
+#define T_Dispersion 287
+#define T_Double 288
+#define T_Driftfile 289
+#define T_Drop 290
+#define T_Dscp 291
+#define T_Ellipsis 292
+#define T_Enable 293
+#define T_End 294
+#define T_False 295
+#define T_File 296
+#define T_Filegen 297
+#define T_Filenum 298
+#define T_Flag1 299
+#define T_Flag2 300
+#define T_Flag3 301
+#define T_Flag4 302
+#define T_Flake 303
+#define T_Floor 304
+#define T_Freq 305
+#define T_Fudge 306
+#define T_Host 307
+#define T_Huffpuff 308
+#define T_Iburst 309
+#define T_Ident 310
+#define T_Ignore 311
+#define T_Incalloc 312
+#define T_Incmem 313
+#define T_Initalloc 314
+#define T_Initmem 315
+#define T_Includefile 316
+#define T_Integer 317
+#define T_Interface 318
+#define T_Intrange 319
+#define T_Io 320
+#define T_Ipv4 321
+#define T_Ipv4_flag 322
+#define T_Ipv6 323
+#define T_Ipv6_flag 324
+#define T_Kernel 325
+#define T_Key 326
+#define T_Keys 327
+#define T_Keysdir 328
+#define T_Kod 329
+#define T_Mssntp 330
+#define T_Leapfile 331
+#define T_Leapsmearinterval 332
+#define T_Limited 333
+#define T_Link 334
+#define T_Listen 335
+#define T_Logconfig 336
+#define T_Logfile 337
+#define T_Loopstats 338
+#define T_Lowpriotrap 339
+#define T_Manycastclient 340
+#define T_Manycastserver 341
+#define T_Mask 342
+#define T_Maxage 343
+#define T_Maxclock 344
+#define T_Maxdepth 345
+#define T_Maxdist 346
+#define T_Maxmem 347
+#define T_Maxpoll 348
+#define T_Mdnstries 349
+#define T_Mem 350
+#define T_Memlock 351
+#define T_Minclock 352
+#define T_Mindepth 353
+#define T_Mindist 354
+#define T_Minimum 355
+#define T_Minpoll 356
+#define T_Minsane 357
+#define T_Mode 358
+#define T_Mode7 359
+#define T_Monitor 360
+#define T_Month 361
+#define T_Mru 362
+#define T_Multicastclient 363
+#define T_Nic 364
+#define T_Nolink 365
+#define T_Nomodify 366
+#define T_Nomrulist 367
+#define T_None 368
+#define T_Nonvolatile 369
+#define T_Nopeer 370
+#define T_Noquery 371
+#define T_Noselect 372
+#define T_Noserve 373
+#define T_Notrap 374
+#define T_Notrust 375
+#define T_Ntp 376
+#define T_Ntpport 377
+#define T_NtpSignDsocket 378
+#define T_Orphan 379
+#define T_Orphanwait 380
+#define T_Panic 381
+#define T_Peer 382
+#define T_Peerstats 383
+#define T_Phone 384
+#define T_Pid 385
+#define T_Pidfile 386
+#define T_Pool 387
+#define T_Port 388
+#define T_Preempt 389
+#define T_Prefer 390
+#define T_Protostats 391
+#define T_Publish 392
+#define T_Pw 393
+#define T_Randfile 394
+#define T_Rawstats 395
+#define T_Refid 396
+#define T_Requestkey 397
+#define T_Reset 398
+#define T_Restrict 399
+#define T_Revoke 400
+#define T_Rlimit 401
+#define T_Saveconfigdir 402
+#define T_Serve 403
+#define T_Server 404
+#define T_Setvar 405
+#define T_Sharedstate 406
+#define T_Source 407
+#define T_Stacksize 408
+#define T_Statistics 409
+#define T_Stats 410
+#define T_Statsdir 411
+#define T_Step 412
+#define T_Stepback 413
+#define T_Stepfwd 414
+#define T_Stepout 415
+#define T_Stratum 416
+#define T_String 417
+#define T_Sys 418
+#define T_Sysstats 419
+#define T_Tick 420
+#define T_Time1 421
+#define T_Time2 422
+#define T_Timer 423
+#define T_Timingstats 424
+#define T_Tinker 425
+#define T_Tos 426
+#define T_Trap 427
+#define T_True 428
+#define T_Trustedkey 429
+#define T_Ttl 430
+#define T_Type 431
+#define T_U_int 432
+#define T_UEcrypto 433
+#define T_UEcryptonak 434
+#define T_UEdigest 435
+#define T_Unconfig 436
+#define T_Unpeer 437
+#define T_Version 438
+#define T_WanderThreshold 439
+#define T_Week 440
+#define T_Wildcard 441
+#define T_Xdp 442
+#define T_Xleave 443
+#define T_Year 444
+#define T_Flag 445
+#define T_EOC 446
+#define T_Simulate 447
+#define T_Beep_Delay 448
+#define T_Sim_Duration 449
+#define T_Server_Offset 450
+#define T_Duration 451
+#define T_Freq_Offset 452
+#define T_Wander 453
+#define T_Jitter 454
+#define T_Prop_Delay 455
+#define T_Proc_Delay 456
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-/* Line 2053 of yacc.c  */
-#line 51 "../../ntpd/ntp_parser.y"
+#line 51 "ntp_parser.y"
 
 	char *			String;
 	double			Double;
@@ -463,29 +484,19 @@ typedef union YYSTYPE
 	script_info *		Sim_script;
 	script_info_fifo *	Sim_script_fifo;
 
+#line 488 "ntp_parser.h"
 
-/* Line 2053 of yacc.c  */
-#line 469 "ntp_parser.h"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
+
 int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
+
 
 #endif /* !YY_YY_NTP_PARSER_H_INCLUDED  */
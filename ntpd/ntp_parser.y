@@ -88,6 +88,7 @@
 %token	<Integer>	T_Clockstats
 %token	<Integer>	T_Cohort
 %token	<Integer>	T_ControlKey
+%token	<Integer>	T_Controlsocket
 %token	<Integer>	T_Crypto
 %token	<Integer>	T_Cryptostats
 %token	<Integer>	T_Ctl
@@ -201,6 +202,7 @@
 %token	<Integer>	T_Preempt
 %token	<Integer>	T_Prefer
 %token	<Integer>	T_Protostats
+%token	<Integer>	T_Publish
 %token	<Integer>	T_Pw
 %token	<Integer>	T_Randfile
 %token	<Integer>	T_Rawstats
@@ -211,8 +213,10 @@
 %token	<Integer>	T_Revoke
 %token	<Integer>	T_Rlimit
 %token	<Integer>	T_Saveconfigdir
+%token	<Integer>	T_Serve
 %token	<Integer>	T_Server
 %token	<Integer>	T_Setvar
+%token	<Integer>	T_Sharedstate
 %token	<Integer>	T_Source
 %token	<Integer>	T_Stacksize
 %token	<Integer>	T_Statistics
@@ -248,6 +252,7 @@
 %token	<Integer>	T_WanderThreshold	/* Not a token */
 %token	<Integer>	T_Week
 %token	<Integer>	T_Wildcard
+%token	<Integer>	T_Xdp
 %token	<Integer>	T_Xleave
 %token	<Integer>	T_Year
 %token	<Integer>	T_Flag			/* Not a token */
@@ -324,6 +329,8 @@
 %type	<Integer>	rlimit_option_keyword
 %type	<Attr_val>	rlimit_option
 %type	<Attr_val_fifo>	rlimit_option_list
+%type	<Integer>	sharedstate_mode
+%type	<Integer>	sharedstate_unit
 %type	<Integer>	stat
 %type	<Int_fifo>	stats_list
 %type	<String_fifo>	string_list
@@ -1214,6 +1221,17 @@ miscellaneous_command
 		}
 	|	T_Ttl integer_list
 			{ CONCAT_G_FIFOS(cfgt.ttl, $2); }
+	|	T_Sharedstate sharedstate_mode sharedstate_unit
+		{
+			attr_val *av;
+
+			if (lex_from_file()) {
+				av = create_attr_ival($2, $3);
+				APPEND_G_FIFO(cfgt.vars, av);
+			} else {
+				yyerror("sharedstate remote config ignored");
+			}
+		}
 	;
 
 misc_cmd_dbl_keyword
@@ -1241,9 +1259,22 @@ misc_cmd_str_keyword
 	;
 
 misc_cmd_str_lcl_keyword
-	:	T_Logfile
+	:	T_Controlsocket
+	|	T_Logfile
 	|	T_Pidfile
 	|	T_Saveconfigdir
+	|	T_Xdp
+	;
+
+sharedstate_mode
+	:	T_Publish
+	|	T_Serve
+	;
+
+sharedstate_unit
+	:	/* empty */
+			{ $$ = 0; }
+	|	T_Integer
 	;
 
 drift_parm
@@ -161,7 +161,8 @@ getmorepeermem(void)
 	int i;
 	struct peer *peers;
 
-	peers = emalloc_zero(INC_PEER_ALLOC * sizeof(*peers));
+	peers = emalloc_zero_tag(MEM_PEER,
+				 INC_PEER_ALLOC * sizeof(*peers));
 
 	for (i = INC_PEER_ALLOC - 1; i >= 0; i--)
 		LINK_SLIST(peer_free, &peers[i], p_link);
@@ -529,6 +530,7 @@ unpeer(
 	)
 {
 	mprintf_event(PEVNT_DEMOBIL, peer, "assoc %u", peer->associd);
+	ctl_sys_changed();
 	restrict_source(&peer->srcadr, 1, 0);
 	set_peerdstadr(peer, NULL);
 	peer_demobilizations++;
@@ -624,6 +626,8 @@ set_peerdstadr(
 	if (p->dstadr == dstadr)
 		return;
 
+	ctl_peer_changed(p);
+
 	/*
 	 * Don't accept updates to a separate multicast receive-only
 	 * endpt while a BCLNT peer is running its unicast protocol.
@@ -752,6 +756,18 @@ newpeer(
 
 	DEBUG_REQUIRE(srcadr);
 
+	/*
+	 * A serving process leaves the associations to the ntpd whose
+	 * state it serves, see ntp_shstate.c.
+	 */
+	if (SHSTATE_SERVE == shstate_mode) {
+		if (FLAG_CONFIG & flags)
+			msyslog(LOG_NOTICE,
+				"sharedstate: serving, no association with %s",
+				(hostname != NULL) ? hostname : stoa(srcadr));
+		return (NULL);
+	}
+
 #ifdef AUTOKEY
 	/*
 	 * If Autokey is requested but not configured, complain loudly.
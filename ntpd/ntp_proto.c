@@ -139,14 +139,12 @@ int	sys_ttlmax;		/* max ttl mapping vector index */
 u_char	sys_ttl[MAX_TTL];	/* ttl mapping vector */
 
 /*
- * Statistics counters - first the good, then the bad
+ * Statistics counters - first the good, then the bad.  Packets
+ * received, processed and restricted are counted in ntp_counters.c.
  */
 u_long	sys_stattime;		/* elapsed time */
-u_long	sys_received;		/* packets received */
-u_long	sys_processed;		/* packets for this host */
 u_long	sys_newversion;		/* current version */
 u_long	sys_oldversion;		/* old version */
-u_long	sys_restricted;		/* access denied */
 u_long	sys_badlength;		/* bad length or format */
 u_long	sys_badauth;		/* bad authentication */
 u_long	sys_declined;		/* declined */
@@ -169,6 +167,7 @@ int unpeer_digest_early		= 1;	/* bad digest (TEST5) */
 static int kiss_code_check(u_char hisleap, u_char hisstratum, u_char hismode, u_int32 refid);
 static	double	root_distance	(struct peer *);
 static	void	clock_combine	(peer_select *, int, int);
+static	void	receive_pkt	(struct recvbuf *);
 static	void	peer_xmit	(struct peer *);
 static	void	fast_xmit	(struct recvbuf *, int, keyid_t, int);
 static	void	pool_xmit	(struct peer *);
@@ -196,6 +195,7 @@ set_sys_leap(
 {
 	sys_leap = new_sys_leap;
 	xmt_leap = sys_leap;
+	ctl_sys_changed();
 
 	/*
 	 * Under certain conditions we send faked leap bits to clients, so
@@ -263,6 +263,8 @@ transmit(
 {
 	u_char	hpoll;
 
+	ctl_peer_changed(peer);
+
 	/*
 	 * The polling state machine. There are two kinds of machines,
 	 * those that never expect a reply (broadcast and manycast
@@ -479,6 +481,24 @@ void
 receive(
 	struct recvbuf *rbufp
 	)
+{
+	if (!ptrace_on) {
+		receive_pkt(rbufp);
+		return;
+	}
+	ptrace_recv_begin(rbufp);
+	receive_pkt(rbufp);
+	ptrace_recv_end();
+}
+
+
+/*
+ * receive_pkt - the work of receive()
+ */
+static void
+receive_pkt(
+	struct recvbuf *rbufp
+	)
 {
 	register struct peer *peer;	/* peer structure pointer */
 	register struct pkt *pkt;	/* receive packet pointer */
@@ -523,12 +543,13 @@ receive(
 	 * Bogus port check is before anything, since it probably
 	 * reveals a clogging attack.
 	 */
-	sys_received++;
+	CTR_INC(CTR_SYS_RECEIVED);
 	if (0 == SRCPORT(&rbufp->recv_srcadr)) {
 		sys_badlength++;
 		return;				/* bogus port */
 	}
 	restrict_mask = restrictions(&rbufp->recv_srcadr);
+	PTRACE_RX(rflags, restrict_mask);
 	pkt = &rbufp->recv_pkt;
 	DPRINTF(2, ("receive: at %ld %s<-%s flags %x restrict %03x org %#010x.%08x xmt %#010x.%08x\n",
 		    current_time, stoa(&rbufp->dstadr->sin),
@@ -540,12 +561,12 @@ receive(
 	hismode = (int)PKT_MODE(pkt->li_vn_mode);
 	hisstratum = PKT_TO_STRATUM(pkt->stratum);
 	if (restrict_mask & RES_IGNORE) {
-		sys_restricted++;
+		CTR_INC(CTR_SYS_RESTRICTED);
 		return;				/* ignore everything */
 	}
 	if (hismode == MODE_PRIVATE) {
 		if (!ntp_mode7 || (restrict_mask & RES_NOQUERY)) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* no query private */
 		}
 		process_private(rbufp, ((restrict_mask &
@@ -554,14 +575,14 @@ receive(
 	}
 	if (hismode == MODE_CONTROL) {
 		if (restrict_mask & RES_NOQUERY) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* no query control */
 		}
 		process_control(rbufp, restrict_mask);
 		return;
 	}
 	if (restrict_mask & RES_DONTSERVE) {
-		sys_restricted++;
+		CTR_INC(CTR_SYS_RESTRICTED);
 		return;				/* no time serve */
 	}
 
@@ -571,7 +592,7 @@ receive(
 	 */
 	if (restrict_mask & RES_FLAKE) {
 		if ((double)ntp_random() / 0x7fffffff < .1) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* no flakeway */
 		}
 	}
@@ -686,7 +707,7 @@ receive(
 	 * If authentication required, a MAC must be present.
 	 */
 	if (restrict_mask & RES_DONTTRUST && has_mac == 0) {
-		sys_restricted++;
+		CTR_INC(CTR_SYS_RESTRICTED);
 		return;				/* access denied */
 	}
 
@@ -697,6 +718,7 @@ receive(
 	 * restrict_mask unless one or both actions are warranted.
 	 */
 	restrict_mask = ntp_monitor(rbufp, restrict_mask);
+	PTRACE_RX(rflags, restrict_mask);
 	if (restrict_mask & RES_LIMITED) {
 		sys_limitrejected++;
 		if (   !(restrict_mask & RES_KOD)
@@ -737,6 +759,7 @@ receive(
 	 * unicast address anyway. Don't ask.
 	 */
 	peer = findpeer(rbufp,  hismode, &retcode);
+	PTRACE_RX(match, retcode);
 	dstadr_sin = &rbufp->dstadr->sin;
 	NTOHL_FP(&pkt->org, &p_org);
 	NTOHL_FP(&pkt->rec, &p_rec);
@@ -857,7 +880,7 @@ receive(
 				if (   crypto_flags
 				    && rbufp->dstadr ==
 				       ANY_INTERFACE_CHOOSE(&rbufp->recv_srcadr)) {
-					sys_restricted++;
+					CTR_INC(CTR_SYS_RESTRICTED);
 					return;	     /* no wildcard */
 				}
 				pkeyid = 0;
@@ -952,7 +975,7 @@ receive(
 				    restrict_mask);
 				sys_badauth++;
 			} else {
-				sys_restricted++;
+				CTR_INC(CTR_SYS_RESTRICTED);
 			}
 			return;			/* hooray */
 		}
@@ -962,7 +985,7 @@ receive(
 		 * configured as a manycast server.
 		 */
 		if (!sys_manycastserver) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* not enabled */
 		}
 
@@ -1029,14 +1052,14 @@ receive(
 		}
 #endif /* AUTOKEY */
 		if ((peer2 = findmanycastpeer(rbufp)) == NULL) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* not enabled */
 		}
 		if (!AUTH(  (!(peer2->cast_flags & MDF_POOL)
 			     && sys_authenticate)
 			  || (restrict_mask & (RES_NOPEER |
 			      RES_DONTTRUST)), is_authentic)) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* access denied */
 		}
 
@@ -1095,12 +1118,12 @@ receive(
 		}
 #endif /* AUTOKEY */
 		if (sys_bclient == 0) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* not enabled */
 		}
 		if (!AUTH(sys_authenticate | (restrict_mask &
 		    (RES_NOPEER | RES_DONTTRUST)), is_authentic)) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* access denied */
 		}
 
@@ -1151,7 +1174,7 @@ receive(
 			 * neither is Autokey.
 			 */
 			if (crypto_flags && skeyid > NTP_MAXKEY) {
-				sys_restricted++;
+				CTR_INC(CTR_SYS_RESTRICTED);
 				return;		/* no autokey */
 			}
 #endif	/* AUTOKEY */
@@ -1165,7 +1188,7 @@ receive(
 			    pkt->ppoll, pkt->ppoll, FLAG_PREEMPT,
 			    MDF_BCLNT, 0, skeyid, sys_ident);
 			if (NULL == peer) {
-				sys_restricted++;
+				CTR_INC(CTR_SYS_RESTRICTED);
 				return;		/* ignore duplicate */
 
 			} else {
@@ -1188,7 +1211,7 @@ receive(
 		    FLAG_BC_VOL | FLAG_IBURST | FLAG_PREEMPT, MDF_BCLNT,
 		    0, skeyid, sys_ident);
 		if (NULL == peer) {
-			sys_restricted++;
+			CTR_INC(CTR_SYS_RESTRICTED);
 			return;			/* ignore duplicate */
 		}
 		peer->bxmt = p_xmt;
@@ -1234,7 +1257,7 @@ receive(
 			if (is_authentic == AUTH_ERROR) {
 				fast_xmit(rbufp, MODE_ACTIVE, 0,
 				    restrict_mask);
-				sys_restricted++;
+				CTR_INC(CTR_SYS_RESTRICTED);
 				return;
 			}
 			/* [Bug 2941]
@@ -1402,6 +1425,7 @@ receive(
 	}
 #endif	/* AUTOKEY */
 	peer->received++;
+	ctl_peer_changed(peer);
 	peer->flash &= ~PKT_TEST_MASK;
 	if (peer->flags & FLAG_XBOGUS) {
 		peer->flags &= ~FLAG_XBOGUS;
@@ -1808,7 +1832,7 @@ process_packet(
 	double	etemp, ftemp, td;
 #endif /* ASSYM */
 
-	sys_processed++;
+	CTR_INC(CTR_SYS_PROCESSED);
 	peer->processed++;
 	p_del = FPTOD(NTOHS_FP(pkt->rootdelay));
 	p_offset = 0;
@@ -2116,6 +2140,8 @@ clock_update(
 	char	*fmri;
 #endif /* HAVE_LIBSCF_H */
 
+	ctl_sys_changed();
+
 	/*
 	 * Update the system state variables. We do this very carefully,
 	 * as the poll interval might need to be clamped differently.
@@ -2271,6 +2297,7 @@ clock_update(
 	default:
 		break;
 	}
+	shstate_publish();
 }
 
 
@@ -2286,6 +2313,8 @@ poll_update(
 	u_long	next, utemp;
 	u_char	hpoll;
 
+	ctl_peer_changed(peer);
+
 	/*
 	 * This routine figures out when the next poll should be sent.
 	 * That turns out to be wickedly complicated. One problem is
@@ -2401,6 +2430,8 @@ peer_clear(
 {
 	u_char	u;
 
+	ctl_peer_changed(peer);
+
 #ifdef AUTOKEY
 	/*
 	 * If cryptographic credentials have been acquired, toss them to
@@ -2498,6 +2529,8 @@ clock_filter(
 	double	dtemp, etemp;
 	char	tbuf[80];
 
+	ctl_peer_changed(peer);
+
 	/*
 	 * A sample consists of the offset, delay, dispersion and epoch
 	 * of arrival. The offset and delay are determined by the on-
@@ -2704,6 +2737,7 @@ clock_select(void)
 	 * Initialize and create endpoint, index and peer lists big
 	 * enough to handle all associations.
 	 */
+	ctl_sys_changed();
 	osys_peer = sys_peer;
 	sys_survivors = 0;
 #ifdef LOCKCLOCK
@@ -3720,7 +3754,9 @@ fast_xmit(
 {
 	struct pkt xpkt;	/* transmit packet structure */
 	struct pkt *rpkt;	/* receive packet structure */
+	mon_entry *mon;		/* client MRU entry for interleaving */
 	l_fp	xmt_tx, xmt_ty;
+	l_fp	xmt_rec, rorg;
 	size_t	sendlen;
 #ifdef AUTOKEY
 	u_int32	temp32;
@@ -3775,6 +3811,13 @@ fast_xmit(
 		l_fp this_recv_time;
 #endif
 
+		/*
+		 * A serving process answers with the state of the
+		 * ntpd which disciplines the clock, see ntp_shstate.c.
+		 */
+		if (SHSTATE_SERVE == shstate_mode)
+			shstate_fetch(rbufp->recv_time.l_ui);
+
 		/*
 		 * If we are inside the leap smear interval we add the current smear offset to
 		 * the packet receive time, to the packet transmit time, and eventually to the
@@ -3824,9 +3867,44 @@ fast_xmit(
 		HTONL_FP(&xmt_tx, &xpkt.xmt);
 	}
 
+	/*
+	 * Server replies keep their receive timestamp and the transmit
+	 * timestamp taken when they went out, see sendpkt_queued(), in
+	 * the MRU entry of the client.  A client capable of interleaved
+	 * mode sends the receive timestamp of our last reply as its
+	 * origin timestamp.  It then gets the precise transmit timestamp
+	 * of that reply, with the receive timestamp it sent for that
+	 * reply as the origin timestamp.  The receive timestamp stays
+	 * that of this request, which the client sends back as the
+	 * origin timestamp of its next request.
+	 */
+	mon = NULL;
+	if (   MODE_SERVER == xmode
+	    && !(flags & (RES_KOD | RES_MSSNTP))
+	    && mon_rx_entry != NULL
+	    && SOCK_EQ(&mon_rx_entry->rmtadr, &rbufp->recv_srcadr)) {
+		mon = mon_rx_entry;
+		NTOHL_FP(&xpkt.rec, &xmt_rec);
+		NTOHL_FP(&rpkt->org, &rorg);
+		if (   !L_ISZERO(&mon->xleave_xmt)
+		    && !L_ISZERO(&rorg)
+		    && L_ISEQU(&rorg, &mon->xleave_rec)) {
+			xmt_tx = mon->xleave_xmt;
+#ifdef LEAP_SMEAR
+			if (leap_smear.in_progress)
+				leap_smear_add_offs(&xmt_tx, NULL);
+#endif
+			xpkt.org = rpkt->rec;
+			HTONL_FP(&xmt_tx, &xpkt.xmt);
+			DPRINTF(2, ("fast_xmit: interleaved reply to %s\n",
+				    stoa(&rbufp->recv_srcadr)));
+		}
+	}
+
 #ifdef HAVE_NTP_SIGND
 	if (flags & RES_MSSNTP) {
 		send_via_ntp_signd(rbufp, xmode, xkeyid, flags, &xpkt);
+		PTRACE_TX(rbufp, &xpkt, LEN_PKT_NOMAC, flags, PTV_SIGND);
 		return;
 	}
 #endif /* HAVE_NTP_SIGND */
@@ -3838,8 +3916,12 @@ fast_xmit(
 	 */
 	sendlen = LEN_PKT_NOMAC;
 	if (rbufp->recv_length == sendlen) {
-		sendpkt(&rbufp->recv_srcadr, rbufp->dstadr, 0, &xpkt,
-		    sendlen);
+		if (mon != NULL)
+			mon->xleave_rec = xmt_rec;
+		sendpkt_queued(&rbufp->recv_srcadr, rbufp->dstadr, &xpkt,
+		    sendlen, (mon != NULL) ? &mon->xleave_xmt : NULL);
+		PTRACE_TX(rbufp, &xpkt, sendlen, flags,
+		    (flags & RES_KOD) ? PTV_KOD : PTV_SENT);
 		DPRINTF(1, ("fast_xmit: at %ld %s->%s mode %d len %lu\n",
 			    current_time, stoa(&rbufp->dstadr->sin),
 			    stoa(&rbufp->recv_srcadr), xmode,
@@ -3890,8 +3972,13 @@ fast_xmit(
 	if (xkeyid > NTP_MAXKEY)
 		authtrust(xkeyid, 0);
 #endif	/* AUTOKEY */
-	sendpkt(&rbufp->recv_srcadr, rbufp->dstadr, 0, &xpkt, sendlen);
+	if (mon != NULL)
+		mon->xleave_rec = xmt_rec;
+	sendpkt_queued(&rbufp->recv_srcadr, rbufp->dstadr, &xpkt, sendlen,
+	    (mon != NULL) ? &mon->xleave_xmt : NULL);
 	get_systime(&xmt_ty);
+	PTRACE_TX(rbufp, &xpkt, sendlen, flags,
+	    (flags & RES_KOD) ? PTV_KOD : PTV_SENT);
 	L_SUB(&xmt_ty, &xmt_tx);
 	sys_authdelay = xmt_ty;
 	DPRINTF(1, ("fast_xmit: at %ld %s->%s mode %d keyid %08x len %lu\n",
@@ -4363,6 +4450,7 @@ proto_config(
 	 */
 	DPRINTF(2, ("proto_config: code %d value %lu dvalue %lf\n",
 		    item, value, dvalue));
+	ctl_sys_changed();
 
 	switch (item) {
 
@@ -4518,12 +4606,12 @@ void
 proto_clr_stats(void)
 {
 	sys_stattime = current_time;
-	sys_received = 0;
-	sys_processed = 0;
+	ctr_clear(CTR_SYS_RECEIVED);
+	ctr_clear(CTR_SYS_PROCESSED);
 	sys_newversion = 0;
 	sys_oldversion = 0;
 	sys_declined = 0;
-	sys_restricted = 0;
+	ctr_clear(CTR_SYS_RESTRICTED);
 	sys_badlength = 0;
 	sys_badauth = 0;
 	sys_limitrejected = 0;
@@ -292,6 +292,7 @@ refclock_transmit(
 	clktype = peer->refclktype;
 	unit = peer->refclkunit;
 	peer->sent++;
+	ctl_peer_changed(peer);
 	get_systime(&peer->xmt);
 
 	/*
@@ -520,6 +521,7 @@ refclock_receive(
 {
 	struct refclockproc *pp;
 
+	ctl_peer_changed(peer);
 #ifdef DEBUG
 	if (debug)
 		printf("refclock_receive: at %lu %s\n",
@@ -709,8 +711,8 @@ process_refclock_packet(
 	 */
 	if (rio->io_input == NULL || (*rio->io_input)(rb) != 0) {
 		rio->recvcount++;
-		packets_received++;
-		handler_pkts++;		
+		CTR_INC(CTR_PACKETS_RECEIVED);
+		CTR_INC(CTR_HANDLER_PKTS);		
 		(*rio->clock_recv)(rb);
 	}
 }
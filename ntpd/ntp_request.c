@@ -615,7 +615,7 @@ process_private(
 				mod_okay);
 #endif
 			if (!mod_okay) {
-				sys_restricted++;
+				CTR_INC(CTR_SYS_RESTRICTED);
 			}
 			req_ack(srcadr, inter, inpkt, INFO_ERR_AUTH);
 			return;
@@ -1141,15 +1141,15 @@ sys_stats(
 		sizeof(struct info_sys_stats));
 	ss->timeup = htonl((u_int32)current_time);
 	ss->timereset = htonl((u_int32)(current_time - sys_stattime));
-	ss->denied = htonl((u_int32)sys_restricted);
+	ss->denied = htonl((u_int32)ctr_read(CTR_SYS_RESTRICTED));
 	ss->oldversionpkt = htonl((u_int32)sys_oldversion);
 	ss->newversionpkt = htonl((u_int32)sys_newversion);
 	ss->unknownversion = htonl((u_int32)sys_declined);
 	ss->badlength = htonl((u_int32)sys_badlength);
-	ss->processed = htonl((u_int32)sys_processed);
+	ss->processed = htonl((u_int32)ctr_read(CTR_SYS_PROCESSED));
 	ss->badauth = htonl((u_int32)sys_badauth);
 	ss->limitrejected = htonl((u_int32)sys_limitrejected);
-	ss->received = htonl((u_int32)sys_received);
+	ss->received = htonl((u_int32)ctr_read(CTR_SYS_RECEIVED));
 	(void) more_pkt();
 	flush_pkt();
 }
@@ -1209,11 +1209,11 @@ io_stats(
 	io->lowwater = htons((u_short) lowater_additions());
 	io->dropped = htonl((u_int32)packets_dropped);
 	io->ignored = htonl((u_int32)packets_ignored);
-	io->received = htonl((u_int32)packets_received);
-	io->sent = htonl((u_int32)packets_sent);
+	io->received = htonl((u_int32)ctr_read(CTR_PACKETS_RECEIVED));
+	io->sent = htonl((u_int32)ctr_read(CTR_PACKETS_SENT));
 	io->notsent = htonl((u_int32)packets_notsent);
 	io->interrupts = htonl((u_int32)handler_calls);
-	io->int_received = htonl((u_int32)handler_pkts);
+	io->int_received = htonl((u_int32)ctr_read(CTR_HANDLER_PKTS));
 
 	(void) more_pkt();
 	flush_pkt();
@@ -1655,7 +1655,7 @@ list_restrict4(
 		if (client_v6_capable) 
 			pir->v6_flag = 0;
 		pir->mask = htonl(res->u.v4.mask);
-		pir->count = htonl(res->count);
+		pir->count = htonl((u_int32)ctr_obj_read(&res->count));
 		pir->flags = htons(res->flags);
 		pir->mflags = htons(res->mflags);
 		pir = (struct info_restrict *)more_pkt();
@@ -1686,7 +1686,7 @@ list_restrict6(
 		pir->addr6 = res->u.v6.addr; 
 		pir->mask6 = res->u.v6.mask;
 		pir->v6_flag = 1;
-		pir->count = htonl(res->count);
+		pir->count = htonl((u_int32)ctr_obj_read(&res->count));
 		pir->flags = htons(res->flags);
 		pir->mflags = htons(res->mflags);
 		pir = (struct info_restrict *)more_pkt();
@@ -2688,8 +2688,8 @@ fill_info_if_stats(void *data, interface_info_t *interface_info)
 	ifs->flags = htonl(ep->flags);
 	ifs->last_ttl = htonl(ep->last_ttl);
 	ifs->num_mcast = htonl(ep->num_mcast);
-	ifs->received = htonl(ep->received);
-	ifs->sent = htonl(ep->sent);
+	ifs->received = htonl((u_int32)ctr_obj_read(&ep->received));
+	ifs->sent = htonl((u_int32)ctr_obj_read(&ep->sent));
 	ifs->notsent = htonl(ep->notsent);
 	ifs->ifindex = htonl(ep->ifindex);
 	/* scope no longer in endpt, in in6_addr typically */
@@ -75,7 +75,6 @@ static restrict_u *resfree4;	/* available entries (free list) */
 static restrict_u *resfree6;
 
 static u_long res_calls;
-static u_long res_found;
 static u_long res_not_found;
 
 /*
@@ -166,7 +165,7 @@ alloc_res4(void)
 	if (res != NULL)
 		return res;
 
-	rl = emalloc_zero(count * cb);
+	rl = emalloc_zero_tag(MEM_RESTRICT, count * cb);
 	/* link all but the first onto free list */
 	res = (void *)((char *)rl + (count - 1) * cb);
 	for (i = count - 1; i > 0; i--) {
@@ -192,7 +191,7 @@ alloc_res6(void)
 	if (res != NULL)
 		return res;
 
-	rl = emalloc_zero(count * cb);
+	rl = emalloc_zero_tag(MEM_RESTRICT, count * cb);
 	/* link all but the first onto free list */
 	res = (void *)((char *)rl + (count - 1) * cb);
 	for (i = count - 1; i > 0; i--) {
@@ -438,7 +437,7 @@ restrictions(
 
 		INSIST(match != NULL);
 
-		match->count++;
+		CTR_OBJ_INC(match->count);
 		/*
 		 * res_not_found counts only use of the final default
 		 * entry, not any "restrict default ntpport ...", which
@@ -447,7 +446,7 @@ restrictions(
 		if (&restrict_def4 == match)
 			res_not_found++;
 		else
-			res_found++;
+			CTR_INC(CTR_RES_FOUND);
 		flags = match->flags;
 	}
 
@@ -465,11 +464,11 @@ restrictions(
 
 		match = match_restrict6_addr(pin6, SRCPORT(srcadr));
 		INSIST(match != NULL);
-		match->count++;
+		CTR_OBJ_INC(match->count);
 		if (&restrict_def6 == match)
 			res_not_found++;
 		else
-			res_found++;
+			CTR_INC(CTR_RES_FOUND);
 		flags = match->flags;
 	}
 	return (flags);
@@ -0,0 +1,392 @@
+/*
+ * ntp_shstate.c - share the state replies are made of with other ntpds
+ *
+ * With "sharedstate publish [unit]" in the configuration file ntpd
+ * keeps everything that goes into its replies to clients, apart from
+ * the time stamps, in a shared memory segment, struct shmState in
+ * ntp_shm.h: leap indicator, stratum, reference ID, root delay and
+ * dispersion, reference time, precision and the leap smear offset.
+ * It updates the segment at every clock update and once a second.
+ *
+ * An ntpd configured with "sharedstate serve [unit]" instead is a
+ * serving process only.  It mobilizes no associations, leaves the
+ * clock and the kernel discipline alone and copies the published
+ * state into its system variables before each reply to a client and
+ * once a second, so its replies are those of the publisher.  Several
+ * serving processes on the same host can share the NTP port on the
+ * same addresses, see open_socket(), and the kernel spreads the
+ * requests over them.  The publisher needs addresses of its own, or
+ * the responses of its servers could be delivered to a serving
+ * process.
+ *
+ * A serving process reports itself unsynchronized until it finds the
+ * segment, and again when the publisher has not updated it for
+ * SHSTATE_MAXAGE seconds or has gone away.
+ */
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include "ntpd.h"
+#include "ntp_stdlib.h"
+
+#include <stdio.h>
+
+int	shstate_mode = SHSTATE_OFF;	/* publishing, serving or neither */
+
+#ifdef HAVE_SYS_SHM_H
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef HAVE_STDATOMIC_H
+# include <stdatomic.h>
+#endif
+
+#include "ntp_shm.h"
+
+#define SHSTATE_MAXAGE	8	/* s without an update to go stale */
+#define SHSTATE_TRIES	4	/* reads while the publisher writes */
+
+static volatile struct shmState *shst;	/* the segment, if attached */
+static int	shst_unit;		/* its unit */
+static int	shst_pid;		/* publisher: our pid */
+static u_int	shst_seq;		/* server: seq of the last copy */
+static u_int32	shst_beat;		/* server: beat of the last copy */
+static int	shst_live;		/* server: serving the state */
+static int	shst_refused = -1;	/* shmid of a segment refused */
+
+
+/*
+ * shstate_barrier - order the accesses to the segment.
+ * atomic_thread_fence() is usually a macro, so it is not found by
+ * AC_CHECK_FUNCS and HAVE_STDATOMIC_H is the better test.
+ */
+static inline void
+shstate_barrier(void)
+{
+#ifdef HAVE_STDATOMIC_H
+	atomic_thread_fence(memory_order_seq_cst);
+#endif
+}
+
+
+/*
+ * shstate_attach - attach the segment of our unit, creating it when
+ * publishing
+ *
+ * The key is well known and the segment may exist already, so it is
+ * only used if it belongs to us or to root and nobody else may write
+ * to it.
+ */
+static int/*BOOL*/
+shstate_attach(
+	int	publish
+	)
+{
+	struct shmid_ds	ds;
+	void *		p;
+	uid_t		uid;
+	int		shmid;
+
+	shmid = shmget(SHSTATE_KEY_BASE + shst_unit,
+		       sizeof(struct shmState),
+		       publish ? (IPC_CREAT | 0644) : 0);
+	if (-1 == shmid) {
+		if (publish || ENOENT != errno)
+			msyslog(LOG_ERR, "sharedstate: shmget (unit %d): %m",
+				shst_unit);
+		return FALSE;
+	}
+	p = shmat(shmid, NULL, publish ? 0 : SHM_RDONLY);
+	if ((void *)-1 == p) {
+		msyslog(LOG_ERR, "sharedstate: shmat (unit %d): %m",
+			shst_unit);
+		return FALSE;
+	}
+	uid = geteuid();
+	if (   -1 == shmctl(shmid, IPC_STAT, &ds)
+	    || (ds.shm_perm.uid != uid && ds.shm_perm.uid != 0)
+	    || (ds.shm_perm.cuid != uid && ds.shm_perm.cuid != 0)
+	    || (ds.shm_perm.mode & (S_IWGRP | S_IWOTH))) {
+		if (shmid != shst_refused)
+			msyslog(LOG_ERR,
+				"sharedstate: segment of unit %d is not ours or writable by others, not used",
+				shst_unit);
+		shst_refused = shmid;
+		shmdt(p);
+		return FALSE;
+	}
+	shst = p;
+
+	return TRUE;
+}
+
+
+/*
+ * shstate_retract - tell the serving processes at exit that there is
+ * no state to serve any longer
+ */
+static void
+shstate_retract(void)
+{
+	/* forked children such as the DNS workers inherit atexit() */
+	if (NULL == shst || (int)getpid() != shst_pid)
+		return;
+	shst->seq++;
+	shstate_barrier();
+	shst->leap = LEAP_NOTINSYNC;
+	shst->xmt_leap = LEAP_NOTINSYNC;
+	shst->stratum = STRATUM_UNSPEC;
+	shst->beat = 0;
+	shstate_barrier();
+	shst->seq++;
+}
+
+
+/*
+ * shstate_unsync - a serving process has nothing to serve
+ */
+static void
+shstate_unsync(
+	const char *	why
+	)
+{
+	if (shst_live)
+		msyslog(LOG_WARNING, "sharedstate: %s, unsynchronized",
+			why);
+	shst_live = FALSE;
+	if (   LEAP_NOTINSYNC == sys_leap
+	    && STRATUM_UNSPEC == sys_stratum)
+		return;
+	set_sys_leap(LEAP_NOTINSYNC);
+	sys_stratum = STRATUM_UNSPEC;
+	memcpy(&sys_refid, "INIT", 4);
+	sys_rootdelay = 0;
+	sys_rootdisp = 0;
+	L_CLR(&sys_reftime);
+#ifdef LEAP_SMEAR
+	leap_smear.in_progress = 0;
+	leap_smear.doffset = 0;
+	L_CLR(&leap_smear.offset);
+#endif
+}
+
+
+/*
+ * shstate_config - publish or serve the state of unit
+ */
+void
+shstate_config(
+	int	mode,
+	int	unit
+	)
+{
+	if (shstate_mode != SHSTATE_OFF) {
+		msyslog(LOG_ERR, "sharedstate: configured more than once");
+		return;
+	}
+	if (unit < 0 || unit > 255) {
+		msyslog(LOG_ERR, "sharedstate: unit %d out of range 0-255",
+			unit);
+		return;
+	}
+	shst_unit = unit;
+
+	if (SHSTATE_PUBLISH == mode) {
+		if (!shstate_attach(TRUE))
+			return;
+		shst_pid = (int)getpid();
+		shst->magic = SHSTATE_MAGIC;
+		shst->version = SHSTATE_VERSION;
+		shst->seq &= ~1U;
+		shstate_mode = SHSTATE_PUBLISH;
+		shstate_publish();
+		atexit(&shstate_retract);
+		msyslog(LOG_NOTICE, "sharedstate: publishing to unit %d",
+			unit);
+		return;
+	}
+
+	/*
+	 * Serving: the clock is the publisher's business.
+	 */
+	shstate_mode = SHSTATE_SERVE;
+	ntp_enable = FALSE;
+	kern_enable = FALSE;
+	shstate_unsync("no state yet");
+	if (!shstate_attach(FALSE))
+		msyslog(LOG_NOTICE,
+			"sharedstate: waiting for a publisher on unit %d",
+			unit);
+	else
+		msyslog(LOG_NOTICE, "sharedstate: serving unit %d", unit);
+}
+
+
+/*
+ * shstate_publish - update the segment from the system variables
+ */
+void
+shstate_publish(void)
+{
+	l_fp	now;
+
+	if (SHSTATE_PUBLISH != shstate_mode)
+		return;
+	get_systime(&now);
+
+	shst->seq++;
+	shstate_barrier();
+	shst->pid = shst_pid;
+	shst->beat = now.l_ui;
+	shst->leap = sys_leap;
+	shst->xmt_leap = xmt_leap;
+	shst->stratum = sys_stratum;
+	shst->precision = sys_precision;
+	shst->refid = sys_refid;
+	shst->reftime_ui = sys_reftime.l_ui;
+	shst->reftime_uf = sys_reftime.l_uf;
+	shst->rootdelay = sys_rootdelay;
+	shst->rootdisp = sys_rootdisp;
+#ifdef LEAP_SMEAR
+	shst->smear = leap_smear.in_progress;
+	shst->smear_ui = leap_smear.offset.l_ui;
+	shst->smear_uf = leap_smear.offset.l_uf;
+#endif
+	shstate_barrier();
+	shst->seq++;
+}
+
+
+/*
+ * shstate_fetch - copy the published state into the system variables
+ *
+ * This is called for every reply, so it returns after one read of seq
+ * when nothing has changed.
+ */
+void
+shstate_fetch(
+	u_int32	now		/* NTP seconds */
+	)
+{
+	struct shmState	st;
+	u_int		seq;
+	int		tries;
+
+	if (NULL == shst)
+		return;
+	seq = shst->seq;
+	if (   seq == shst_seq
+	    && (int32)(now - shst_beat) <= SHSTATE_MAXAGE)
+		return;
+
+	for (tries = 0; ; tries++) {
+		seq = shst->seq;
+		shstate_barrier();
+		memcpy(&st, (void *)(uintptr_t)shst, sizeof(st));
+		shstate_barrier();
+		if (!(seq & 1) && seq == shst->seq)
+			break;
+		if (tries == SHSTATE_TRIES)
+			return;		/* try again next time */
+	}
+	shst_seq = seq;
+	shst_beat = st.beat;
+
+	if (   SHSTATE_MAGIC != st.magic
+	    || SHSTATE_VERSION != st.version) {
+		shstate_unsync("segment of another version");
+		return;
+	}
+	if (0 == st.beat) {
+		shstate_unsync("publisher gone");
+		return;
+	}
+	if ((int32)(now - st.beat) > SHSTATE_MAXAGE) {
+		shstate_unsync("publisher stopped updating");
+		return;
+	}
+	if (!shst_live)
+		msyslog(LOG_NOTICE, "sharedstate: serving the state of pid %d",
+			st.pid);
+	shst_live = TRUE;
+
+	sys_leap = (u_char)st.leap;
+	xmt_leap = (u_char)st.xmt_leap;
+	sys_stratum = (u_char)st.stratum;
+	sys_precision = (s_char)st.precision;
+	sys_refid = st.refid;
+	sys_reftime.l_ui = st.reftime_ui;
+	sys_reftime.l_uf = st.reftime_uf;
+	sys_rootdelay = st.rootdelay;
+	sys_rootdisp = st.rootdisp;
+#ifdef LEAP_SMEAR
+	leap_smear.in_progress = st.smear;
+	leap_smear.offset.l_ui = st.smear_ui;
+	leap_smear.offset.l_uf = st.smear_uf;
+	LFPTOD(&leap_smear.offset, leap_smear.doffset);
+#endif
+	ctl_sys_changed();
+}
+
+
+/*
+ * shstate_timer - once a second: publish, or look for the segment and
+ * fetch the state so that mode 6 queries see it too
+ */
+void
+shstate_timer(
+	u_int32	now		/* NTP seconds */
+	)
+{
+	switch (shstate_mode) {
+
+	case SHSTATE_PUBLISH:
+		shstate_publish();
+		break;
+
+	case SHSTATE_SERVE:
+		if (NULL == shst && shstate_attach(FALSE))
+			msyslog(LOG_NOTICE, "sharedstate: serving unit %d",
+				shst_unit);
+		shstate_fetch(now);
+		break;
+	}
+}
+
+#else	/* !HAVE_SYS_SHM_H follows */
+
+void
+shstate_config(
+	int	mode,
+	int	unit
+	)
+{
+	msyslog(LOG_ERR, "sharedstate: not supported by this build");
+}
+
+
+void
+shstate_publish(void)
+{
+}
+
+
+void
+shstate_fetch(
+	u_int32	now
+	)
+{
+}
+
+
+void
+shstate_timer(
+	u_int32	now
+	)
+{
+}
+
+#endif	/* !HAVE_SYS_SHM_H */
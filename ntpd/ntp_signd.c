@@ -14,6 +14,7 @@
 #include "ntp_unixtime.h"
 #include "ntp_control.h"
 #include "ntp_string.h"
+#include "iosignal.h"
 
 #include <stdio.h>
 #include <stddef.h>
@@ -24,10 +25,93 @@
 
 #include <sys/un.h>
 
+/*
+ * ntpd keeps a small pool of persistent connections to the signing
+ * daemon and pipelines requests on them.  Requests are written from
+ * the receive path without waiting; the replies are read by the I/O
+ * loop as they arrive and sent on to the clients.  ntp_signd answers
+ * the requests on a connection in the order they were written, so
+ * each connection keeps a FIFO of the clients it is signing for.
+ *
+ * The protocol (all values big endian except the key ID):
+ *
+ * request:
+ *	[packet size] - 4 bytes
+ *	[protocol version (0)] - 4 bytes
+ *	[operation (sign message=0)] - 4 bytes
+ *	[packet ID] - 4 bytes
+ *	[key id] - LITTLE endian (as on wire) - 4 bytes
+ *	[message to sign] - as marshalled, without signature
+ *
+ * reply:
+ *	[packet size] - 4 bytes
+ *	[protocol version (0)] - 4 bytes
+ *	[operation (signed success=3, failure=4)] - 4 bytes
+ *	[packet ID] - 4 bytes
+ *	(optional) [signed message] - as provided before, with
+ *	signature appended
+ */
+struct samba_key_in {
+	uint32_t version;
+	uint32_t op;
+	uint32_t packet_id;
+	uint32_t key_id_le;
+	struct pkt pkt;
+};
+
+struct samba_key_out {
+	uint32_t version;
+	uint32_t op;
+	uint32_t packet_id;
+	struct pkt pkt;
+};
+
+#define SIGND_CONNS	4	/* connections to ntp_signd */
+#define SIGND_DEPTH	64	/* requests in flight per connection */
+#define SIGND_TIMEOUT	2	/* s to wait for the oldest reply */
+
+/* request and largest acceptable reply, with length prefix */
+#define SIGND_REQLEN	(sizeof(uint32_t) + \
+			 offsetof(struct samba_key_in, pkt) + LEN_PKT_NOMAC)
+#define SIGND_REPLEN	(sizeof(uint32_t) + sizeof(struct samba_key_out))
+
+/*
+ * A client waiting for its signed reply
+ */
+struct signd_req {
+	sockaddr_u	srcadr;		/* client address */
+	endpt *		dstadr;		/* local address, NULL if gone */
+	keyid_t		keyid;		/* key ID, for debugging */
+	int		xmode;		/* reply mode, for debugging */
+	u_long		sent;		/* time the request was written */
+	uint32_t	id;		/* packet ID ntp_signd echoes */
+};
+
+/*
+ * A connection to ntp_signd
+ */
+struct signd_conn {
+	struct asyncio_reader *	reader;	/* NULL if not connected */
+	struct signd_req pend[SIGND_DEPTH]; /* requests in flight */
+	u_int		head;		/* oldest request in pend[] */
+	u_int		count;		/* requests in flight */
+	size_t		olen;		/* unsent bytes in obuf[] */
+	size_t		ilen;		/* unparsed bytes in ibuf[] */
+	u_char		obuf[SIGND_DEPTH * SIGND_REQLEN];
+	u_char		ibuf[2 * SIGND_REPLEN];
+};
+
+static struct signd_conn signd_conn[SIGND_CONNS];
+static u_long	signd_retry;	/* no reconnect before this time */
+static uint32_t	signd_id;	/* packet ID of the last request */
+
+static void	signd_receive	(struct asyncio_reader *);
+
 /* socket routines by tridge - from junkcode.samba.org */
 
 /*
-  connect to a unix domain socket
+  connect to a unix domain socket, without blocking if the
+  listener's backlog is full
 */
 static int 
 ux_socket_connect(const char *name)
@@ -46,6 +130,7 @@ ux_socket_connect(const char *name)
 	if (fd == -1) {
 		return -1;
 	}
+	make_socket_nonblocking(fd);
 	
 	if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
 		close(fd);
@@ -57,68 +142,281 @@ ux_socket_connect(const char *name)
 
 
 /*
-  keep writing until its all sent
-*/
-static int 
-write_all(int fd, const void *buf, size_t len)
+ * signd_close - drop a connection and the requests in flight on it
+ */
+static void
+signd_close(
+	struct signd_conn *	c,
+	const char *		why
+	)
 {
-	size_t total = 0;
-	while (len) {
-		int n = write(fd, buf, len);
-		if (n <= 0) return total;
-		buf = n + (const char *)buf;
-		len -= n;
-		total += n;
-	}
-	return total;
+	if (NULL == c->reader)
+		return;
+	msyslog(LOG_ERR, "ntp_signd: %s, %u request%s dropped", why,
+		c->count, (1 == c->count) ? "" : "s");
+	remove_asyncio_reader(c->reader);
+	delete_asyncio_reader(c->reader);
+	c->reader = NULL;
+	c->head = 0;
+	c->count = 0;
+	c->olen = 0;
+	c->ilen = 0;
 }
 
+
 /*
-  keep reading until its all read
-*/
-static int 
-read_all(int fd, void *buf, size_t len)
+ * signd_open - connect to ntp_signd
+ */
+static int
+signd_open(
+	struct signd_conn *	c
+	)
 {
-	size_t total = 0;
-	while (len) {
-		int n = read(fd, buf, len);
-		if (n <= 0) return total;
-		buf = n + (char *)buf;
-		len -= n;
-		total += n;
+	char	full_socket[256];
+	int	fd;
+
+	if (current_time < signd_retry)
+		return FALSE;
+
+	snprintf(full_socket, sizeof(full_socket), "%s/socket",
+		 ntp_signd_socket);
+	fd = ux_socket_connect(full_socket);
+	if (-1 == fd) {
+		/* Only continue with this if we can talk to Samba */
+		signd_retry = current_time + 1;
+		return FALSE;
 	}
-	return total;
+	fd = move_fd(fd);
+#ifdef HAVE_SIGNALED_IO
+	init_socket_sig(fd);
+#endif
+
+	c->reader = new_asyncio_reader();
+	c->reader->fd = fd;
+	c->reader->data = c;
+	c->reader->receiver = &signd_receive;
+	add_asyncio_reader(c->reader, FD_TYPE_SOCKET);
+	DPRINTF(1, ("ntp_signd: connection %d on fd %d\n",
+		    (int)(c - signd_conn), fd));
+
+	return TRUE;
 }
 
+
 /*
-  send a packet in length prefix format
-*/
-static int 
-send_packet(int fd, const char *buf, uint32_t len)
+ * signd_flush - write what the socket will take of the output buffer
+ */
+static int
+signd_flush(
+	struct signd_conn *	c
+	)
 {
-	uint32_t net_len = htonl(len);
-	if (write_all(fd, &net_len, sizeof(net_len)) != sizeof(net_len)) return -1;
-	if (write_all(fd, buf, len) != len) return -1;	
+	ssize_t	n;
+
+	while (c->olen > 0) {
+		n = write(c->reader->fd, c->obuf, c->olen);
+		if (n < 0) {
+			if (EINTR == errno)
+				continue;
+			if (EAGAIN == errno || EWOULDBLOCK == errno)
+				return 0;
+			signd_close(c, "write failed");
+			return -1;
+		}
+		c->olen -= n;
+		memmove(c->obuf, c->obuf + n, c->olen);
+	}
+
 	return 0;
 }
 
+
 /*
-  receive a packet in length prefix format
-*/
-static int 
-recv_packet(int fd, char **buf, uint32_t *len)
+ * signd_timedout - check whether the oldest request has been waiting
+ * too long.  If ntp_signd is stuck, the connection is dropped so the
+ * next request gets a fresh one.
+ */
+static int
+signd_timedout(
+	struct signd_conn *	c
+	)
 {
-	if (read_all(fd, len, sizeof(*len)) != sizeof(*len)) return -1;
-	*len = ntohl(*len);
-	*buf = emalloc(*len);
-	if (read_all(fd, *buf, *len) != *len) {
-		free(*buf);
-		*buf = NULL;
-		return -1;
+	if (NULL == c->reader || 0 == c->count
+	    || current_time - c->pend[c->head].sent <= SIGND_TIMEOUT)
+		return FALSE;
+	signd_close(c, "no reply");
+
+	return TRUE;
+}
+
+
+/*
+ * signd_reply - pass one reply on to the client it belongs to
+ *
+ * ntp_signd answers in order, so the reply belongs to the oldest
+ * request.  A reply with a packet ID of no request in flight is
+ * discarded; one for a later request means the requests before it
+ * were dropped.
+ */
+static void
+signd_reply(
+	struct signd_conn *	c,
+	const u_char *		reply,
+	uint32_t		reply_len
+	)
+{
+	struct samba_key_out	samba_reply;
+	struct signd_req *	req;
+	uint32_t		id;
+	u_int			i;
+	int			sendlen;
+
+	memcpy(&samba_reply, reply, reply_len);
+	id = ntohl(samba_reply.packet_id);
+	for (i = 0; i < c->count; i++)
+		if (c->pend[(c->head + i) % SIGND_DEPTH].id == id)
+			break;
+	if (i == c->count) {
+		DPRINTF(1, ("ntp_signd: reply with unknown packet ID %u discarded\n",
+			    id));
+		return;
 	}
-	return 0;
+	if (i > 0)
+		msyslog(LOG_ERR, "ntp_signd: %u request%s not answered",
+			i, (1 == i) ? "" : "s");
+	req = &c->pend[(c->head + i) % SIGND_DEPTH];
+	c->head = (c->head + i + 1) % SIGND_DEPTH;
+	c->count -= i + 1;
+
+	if (ntohl(samba_reply.op) == 3
+	    && reply_len > offsetof(struct samba_key_out, pkt)) {
+		sendlen = reply_len - offsetof(struct samba_key_out, pkt);
+		sendpkt(&req->srcadr, req->dstadr, 0, &samba_reply.pkt,
+			sendlen);
+		DPRINTF(1, ("transmit ntp_signd packet: at %ld %s->%s mode %d keyid %08x len %d\n",
+			    current_time, latoa(req->dstadr),
+			    stoa(&req->srcadr), req->xmode,
+			    req->keyid, sendlen));
+	}
+}
+
+
+/*
+ * signd_receive - read replies from ntp_signd
+ *
+ * Called from the I/O loop when the connection is readable.
+ */
+static void
+signd_receive(
+	struct asyncio_reader *	reader
+	)
+{
+	struct signd_conn *	c;
+	const u_char *		p;
+	uint32_t		reply_len;
+	ssize_t			n;
+
+	c = reader->data;
+	for (;;) {
+		n = read(reader->fd, c->ibuf + c->ilen,
+			 sizeof(c->ibuf) - c->ilen);
+		if (n < 0 && EINTR == errno)
+			continue;
+		if (n < 0 && (EAGAIN == errno || EWOULDBLOCK == errno))
+			break;
+		if (n <= 0) {
+			signd_close(c, (0 == n)
+					   ? "connection closed"
+					   : "read failed");
+			return;
+		}
+		c->ilen += n;
+
+		/* hand on every complete reply in the buffer */
+		p = c->ibuf;
+		while (c->ilen >= sizeof(reply_len)) {
+			memcpy(&reply_len, p, sizeof(reply_len));
+			reply_len = ntohl(reply_len);
+			if (reply_len > sizeof(struct samba_key_out)) {
+				signd_close(c, "reply too long");
+				return;
+			}
+			if (reply_len < offsetof(struct samba_key_out, pkt)) {
+				signd_close(c, "reply too short");
+				return;
+			}
+			if (c->ilen < sizeof(reply_len) + reply_len)
+				break;
+			if (0 == c->count) {
+				signd_close(c, "unexpected reply");
+				return;
+			}
+			signd_reply(c, p + sizeof(reply_len), reply_len);
+			p += sizeof(reply_len) + reply_len;
+			c->ilen -= sizeof(reply_len) + reply_len;
+		}
+		memmove(c->ibuf, p, c->ilen);
+	}
+
+	/* the socket may have room again for requests left over */
+	signd_flush(c);
+}
+
+
+/*
+ * signd_clearinterface - forget a local address that is going away
+ */
+void
+signd_clearinterface(
+	endpt *	ep
+	)
+{
+	struct signd_conn *	c;
+	u_int			i;
+
+	for (c = signd_conn; c < signd_conn + SIGND_CONNS; c++)
+		for (i = 0; i < c->count; i++)
+			if (c->pend[(c->head + i) % SIGND_DEPTH].dstadr
+			    == ep)
+				c->pend[(c->head + i) % SIGND_DEPTH].dstadr
+				    = NULL;
+}
+
+
+/*
+ * signd_select - pick the connection for the next request
+ *
+ * The least loaded connection is used, and a new one is opened when
+ * all existing connections are busy and the pool is not full.
+ */
+static struct signd_conn *
+signd_select(void)
+{
+	struct signd_conn *	c;
+	struct signd_conn *	best;
+	struct signd_conn *	idle;
+
+	best = NULL;
+	idle = NULL;
+	for (c = signd_conn; c < signd_conn + SIGND_CONNS; c++) {
+		if (signd_timedout(c) || NULL == c->reader) {
+			if (NULL == idle)
+				idle = c;
+			continue;
+		}
+		if (NULL == best || c->count < best->count)
+			best = c;
+	}
+	if (idle != NULL && (NULL == best || best->count > 0)
+	    && signd_open(idle))
+		best = idle;
+	if (best != NULL && SIGND_DEPTH == best->count)
+		best = NULL;
+
+	return best;
 }
 
+
 void 
 send_via_ntp_signd(
 	struct recvbuf *rbufp,	/* receive packet pointer */
@@ -143,34 +441,33 @@ send_via_ntp_signd(
 	 * http://msdn.microsoft.com/en-us/library/cc212930.aspx
 	 */
 	
-	int fd, sendlen;
-	struct samba_key_in {
-		uint32_t version;
-		uint32_t op;
-		uint32_t packet_id;
-		uint32_t key_id_le;
-		struct pkt pkt;
-	} samba_pkt;
-	
-	struct samba_key_out {
-		uint32_t version;
-		uint32_t op;
-		uint32_t packet_id;
-		struct pkt pkt;
-	} samba_reply;
-	
-	char full_socket[256];
+	struct samba_key_in	samba_pkt;
+	struct signd_conn *	c;
+	struct signd_req *	req;
+	uint32_t		net_len;
+
+	BLOCKIO();
+	c = signd_select();
+	if (NULL == c) {
+		/* Huh?  could not talk to Samba... */
+		UNBLOCKIO();
+		return;
+	}
+
+	req = &c->pend[(c->head + c->count) % SIGND_DEPTH];
+	c->count++;
+	req->srcadr = rbufp->recv_srcadr;
+	req->dstadr = rbufp->dstadr;
+	req->keyid = xkeyid;
+	req->xmode = xmode;
+	req->sent = current_time;
+	req->id = ++signd_id;
 
-	char *reply = NULL;
-	uint32_t reply_len;
-	
 	ZERO(samba_pkt);
 	samba_pkt.op = 0; /* Sign message */
-	/* This will be echoed into the reply - a different
-	 * impelementation might want multiple packets
-	 * awaiting signing */
-
-	samba_pkt.packet_id = 1;
+	/* This will be echoed into the reply, which tells us the
+	 * request it answers */
+	samba_pkt.packet_id = htonl(req->id);
 
 	/* Swap the byte order back - it's actually little
 	 * endian on the wire, but it was read above as
@@ -178,63 +475,13 @@ send_via_ntp_signd(
 	samba_pkt.key_id_le = htonl(xkeyid);
 	samba_pkt.pkt = *xpkt;
 
-	snprintf(full_socket, sizeof(full_socket), "%s/socket", ntp_signd_socket);
+	net_len = htonl(SIGND_REQLEN - sizeof(net_len));
+	memcpy(c->obuf + c->olen, &net_len, sizeof(net_len));
+	memcpy(c->obuf + c->olen + sizeof(net_len), &samba_pkt,
+	       SIGND_REQLEN - sizeof(net_len));
+	c->olen += SIGND_REQLEN;
 
-	fd = ux_socket_connect(full_socket);
-	/* Only continue with this if we can talk to Samba */
-	if (fd != -1) {
-		/* Send old packet to Samba, expect response */
-		/* Packet to Samba is quite simple: 
-		   All values BIG endian except key ID as noted
-		   [packet size as BE] - 4 bytes
-		   [protocol version (0)] - 4 bytes
-		   [packet ID] - 4 bytes
-		   [operation (sign message=0)] - 4 bytes
-		   [key id] - LITTLE endian (as on wire) - 4 bytes
-		   [message to sign] - as marshalled, without signature
-		*/
-			
-		if (send_packet(fd, (char *)&samba_pkt, offsetof(struct samba_key_in, pkt) + LEN_PKT_NOMAC) != 0) {
-			/* Huh?  could not talk to Samba... */
-			close(fd);
-			return;
-		}
-			
-		if (recv_packet(fd, &reply, &reply_len) != 0) {
-			if (reply) {
-				free(reply);
-			}
-			close(fd);
-			return;
-		}
-		/* Return packet is also simple: 
-		   [packet size] - network byte order - 4 bytes
-		   [protocol version (0)] network byte order - - 4 bytes
-		   [operation (signed success=3, failure=4)] network byte order - - 4 byte
-		   (optional) [signed message] - as provided before, with signature appended
-		*/
-			
-		if (reply_len <= sizeof(samba_reply)) {
-			memcpy(&samba_reply, reply, reply_len);
-			if (ntohl(samba_reply.op) == 3 && reply_len >  offsetof(struct samba_key_out, pkt)) {
-				sendlen = reply_len - offsetof(struct samba_key_out, pkt);
-				xpkt = &samba_reply.pkt;
-				sendpkt(&rbufp->recv_srcadr, rbufp->dstadr, 0, xpkt, sendlen);
-#ifdef DEBUG
-				if (debug)
-					printf(
-						"transmit ntp_signd packet: at %ld %s->%s mode %d keyid %08x len %d\n",
-						current_time, ntoa(&rbufp->dstadr->sin),
-						ntoa(&rbufp->recv_srcadr), xmode, xkeyid, sendlen);
-#endif
-			}
-		}
-		
-		if (reply) {
-			free(reply);
-		}
-		close(fd);
-		
-	}
+	signd_flush(c);
+	UNBLOCKIO();
 }
 #endif
@@ -362,6 +362,7 @@ timer(void)
 		sys_offset = 0;
 		sys_rootdelay = 0;
 		sys_rootdisp = 0;
+		ctl_sys_changed();
 	}
 
 	get_systime(&now);
@@ -385,6 +386,13 @@ timer(void)
                 }
 	}
 
+	/*
+	 * Publish the system variables to the serving processes, or
+	 * fetch them from the publisher.
+	 */
+	if (shstate_mode != SHSTATE_OFF)
+		shstate_timer(now.l_ui);
+
 	/*
 	 * Update huff-n'-puff filter.
 	 */
@@ -535,6 +543,8 @@ check_leapsec(
 
 	leap_result_t lsdata;
 	u_int32       lsprox;
+	u_long        oleapsec = leapsec;
+	u_int         otai     = sys_tai;
 #ifdef AUTOKEY
 	int/*BOOL*/   update_autokey = FALSE;
 #endif
@@ -697,6 +707,10 @@ check_leapsec(
 
 	check_leap_sec_in_progress(&lsdata);
 
+	/* the leap and TAI variables ntpq shows may have moved */
+	if (reset || leapsec != oleapsec || sys_tai != otai)
+		ctl_sys_changed();
+
 #ifdef AUTOKEY
 	if (update_autokey)
 		crypto_update_taichange();
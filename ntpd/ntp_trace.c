@@ -0,0 +1,382 @@
+/*
+ * ntp_trace.c - binary packet trace ring
+ *
+ * DPRINTF() formats every packet with stoa() and writes it out, which
+ * a busy server cannot afford.  While the trace runs, receive() and
+ * fast_xmit() instead fill in one fixed size record per packet in a
+ * ring (struct ptrace_rec, see ntp_trace.h), which costs a few stores
+ * and two get_systime() calls per packet.  Once the ring is full the
+ * oldest records are overwritten.  The trace is started, stopped and
+ * written to a file in statsdir by the mode 6 CTL_OP_TRACE request
+ * (ntpq's "trace" command) or by TRACESIG, and util/tracedump prints
+ * the file.
+ *
+ * Only the main thread handles packets, so the single writer needs no
+ * lock; the ring is read only by ptrace_dump() on the same thread.
+ */
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include "ntpd.h"
+#include "ntp_stdlib.h"
+#include "ntp_trace.h"
+
+#include <stdio.h>
+#include <time.h>
+#include <fcntl.h>
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+
+int			ptrace_on;		/* trace running? */
+struct ptrace_rec *	ptrace_cur;		/* receive()'s record */
+volatile int		ptrace_signalled;	/* TRACESIG seen */
+
+static struct ptrace_rec *ring;		/* NULL until first started */
+static u_int		ring_size;	/* records, a power of 2 */
+static u_int32		ring_head;	/* records written since start */
+
+/*
+ * The counters receive() bumps, to tell what became of a packet
+ * without a note at each of its many exits.
+ */
+static l_fp		rx_start;	/* receive() entered */
+static u_long		rx_restricted;
+static u_long		rx_badlength;
+static u_long		rx_declined;
+static u_long		rx_badauth;
+static u_long		rx_limitrejected;
+static u_long		rx_kodsent;
+static u_long		rx_processed;
+
+
+/*
+ * ptrace_start - start a new trace in a ring of 'records' records,
+ *		  PTRACE_DEFAULT if 0.  Returns the size of the ring.
+ */
+int
+ptrace_start(
+	u_int	records
+	)
+{
+	u_int	size;
+
+	if (0 == records)
+		records = PTRACE_DEFAULT;
+	records = min(records, PTRACE_MAX);
+	for (size = 16; size < records; size <<= 1)
+		/* round up to a power of 2 */;
+
+	ptrace_on = FALSE;
+	ptrace_cur = NULL;
+	if (size != ring_size) {
+		free(ring);
+		ring = emalloc_zero(size * sizeof(*ring));
+		ring_size = size;
+	}
+	ring_head = 0;
+	ptrace_on = TRUE;
+	msyslog(LOG_NOTICE, "packet trace started, %u records", size);
+
+	return size;
+}
+
+
+/*
+ * ptrace_stop - stop the trace, keeping the ring for ptrace_dump()
+ */
+void
+ptrace_stop(void)
+{
+	if (ptrace_on)
+		msyslog(LOG_NOTICE, "packet trace stopped, %lu packets",
+			(u_long)ring_head);
+	ptrace_on = FALSE;
+	ptrace_cur = NULL;
+}
+
+
+/*
+ * ptrace_status - the size of the ring and the packets recorded in it
+ *		   since the trace was started
+ */
+void
+ptrace_status(
+	u_int *		size,
+	u_long *	count
+	)
+{
+	*size = ring_size;
+	*count = ring_head;
+}
+
+
+/*
+ * fracdiff - 'later' - 'earlier' in units of 2^-32 s, clamped to the
+ *	      range of a u_int32
+ */
+static u_int32
+fracdiff(
+	const l_fp *	later,
+	const l_fp *	earlier
+	)
+{
+	l_fp	diff;
+
+	diff = *later;
+	L_SUB(&diff, earlier);
+	if (L_ISNEG(&diff))
+		return 0;
+	if (diff.l_ui != 0)
+		return 0xffffffff;
+	return diff.l_uf;
+}
+
+
+/*
+ * ptrace_addr - fill in the address fields of a record
+ */
+static void
+ptrace_addr(
+	struct ptrace_rec *	tr,
+	const sockaddr_u *	remote,
+	const endpt *		local
+	)
+{
+	ZERO(tr->raddr);
+	ZERO(tr->laddr);
+	tr->rport = SRCPORT(remote);
+	tr->lport = 0;
+	if (IS_IPV6(remote)) {
+		tr->family = 6;
+		memcpy(tr->raddr, PSOCK_ADDR6(remote), sizeof(tr->raddr));
+	} else {
+		tr->family = 4;
+		memcpy(tr->raddr, &NSRCADR(remote), sizeof(u_int32));
+	}
+	if (NULL == local)
+		return;
+	tr->lport = SRCPORT(&local->sin);
+	if (IS_IPV6(&local->sin))
+		memcpy(tr->laddr, PSOCK_ADDR6(&local->sin), sizeof(tr->laddr));
+	else
+		memcpy(tr->laddr, &NSRCADR(&local->sin), sizeof(u_int32));
+}
+
+
+/*
+ * ptrace_next - the slot for the next record
+ */
+static struct ptrace_rec *
+ptrace_next(void)
+{
+	return &ring[ring_head++ & (ring_size - 1)];
+}
+
+
+/*
+ * ptrace_recv_begin - start the record of a packet receive() is about
+ *		       to handle
+ */
+void
+ptrace_recv_begin(
+	struct recvbuf *	rbufp
+	)
+{
+	struct ptrace_rec *	tr;
+	const struct pkt *	pkt;
+
+	get_systime(&rx_start);
+	tr = ptrace_next();
+	tr->ts_ui = rbufp->recv_time.l_ui;
+	tr->ts_uf = rbufp->recv_time.l_uf;
+	tr->wait = fracdiff(&rx_start, &rbufp->recv_time);
+	tr->proc = 0;
+	tr->rflags = 0;
+	tr->len = (u_short)min(rbufp->recv_length, 0xffff);
+	tr->dir = PT_RX;
+	tr->match = 0;
+	tr->unused = 0;
+	ptrace_addr(tr, &rbufp->recv_srcadr, rbufp->dstadr);
+	pkt = &rbufp->recv_pkt;
+	tr->mode = PKT_MODE(pkt->li_vn_mode);
+	tr->version = PKT_VERSION(pkt->li_vn_mode);
+	if (tr->mode < MODE_CONTROL && rbufp->recv_length > 1)
+		tr->stratum = pkt->stratum;
+	else
+		tr->stratum = 0;
+	tr->verdict = PTV_ACCEPTED;
+
+	rx_restricted = ctr_read(CTR_SYS_RESTRICTED);
+	rx_badlength = sys_badlength;
+	rx_declined = sys_declined;
+	rx_badauth = sys_badauth;
+	rx_limitrejected = sys_limitrejected;
+	rx_kodsent = sys_kodsent;
+	rx_processed = ctr_read(CTR_SYS_PROCESSED);
+	ptrace_cur = tr;
+}
+
+
+/*
+ * ptrace_recv_end - finish the record when receive() is done
+ */
+void
+ptrace_recv_end(void)
+{
+	struct ptrace_rec *	tr;
+	l_fp			now;
+
+	/* the trace may have been restarted or stopped meanwhile */
+	tr = ptrace_cur;
+	ptrace_cur = NULL;
+	if (NULL == tr)
+		return;
+
+	get_systime(&now);
+	tr->proc = fracdiff(&now, &rx_start);
+	if (sys_kodsent != rx_kodsent)
+		tr->verdict = PTV_KOD;
+	else if (sys_limitrejected != rx_limitrejected)
+		tr->verdict = PTV_LIMITED;
+	else if (ctr_read(CTR_SYS_RESTRICTED) != rx_restricted)
+		tr->verdict = PTV_RESTRICTED;
+	else if (sys_badlength != rx_badlength)
+		tr->verdict = PTV_BADLENGTH;
+	else if (sys_badauth != rx_badauth)
+		tr->verdict = PTV_BADAUTH;
+	else if (sys_declined != rx_declined)
+		tr->verdict = PTV_DECLINED;
+	else if (ctr_read(CTR_SYS_PROCESSED) != rx_processed)
+		tr->verdict = PTV_PROCESSED;
+}
+
+
+/*
+ * ptrace_xmit - record a reply sent by fast_xmit()
+ */
+void
+ptrace_xmit(
+	struct recvbuf *	rbufp,
+	struct pkt *		xpkt,
+	size_t			len,
+	int			flags,
+	int			verdict
+	)
+{
+	struct ptrace_rec *	tr;
+	l_fp			now;
+
+	get_systime(&now);
+	tr = ptrace_next();
+	tr->ts_ui = now.l_ui;
+	tr->ts_uf = now.l_uf;
+	tr->wait = fracdiff(&now, &rbufp->recv_time);
+	tr->proc = 0;
+	tr->rflags = (u_short)flags;
+	tr->len = (u_short)len;
+	tr->dir = PT_TX;
+	tr->mode = PKT_MODE(xpkt->li_vn_mode);
+	tr->version = PKT_VERSION(xpkt->li_vn_mode);
+	tr->stratum = xpkt->stratum;
+	tr->verdict = (u_char)verdict;
+	tr->match = 0;
+	tr->unused = 0;
+	ptrace_addr(tr, &rbufp->recv_srcadr, rbufp->dstadr);
+}
+
+
+/*
+ * ptrace_dump - write the ring to a new file in statsdir
+ *
+ * The file name is returned in 'name'.  Returns 0, or -1 with errno
+ * set.
+ */
+int
+ptrace_dump(
+	char *	name,
+	size_t	namelen
+	)
+{
+	struct ptrace_hdr	hdr;
+	struct ptrace_rec	out;
+	const struct ptrace_rec *tr;
+	char			stamp[32];
+	time_t			now;
+	u_int32			first;
+	u_int32			n;
+	int			fd;
+	FILE *			fp;
+	int			saved_errno;
+
+	time(&now);
+	strftime(stamp, sizeof(stamp), "%Y%m%d.%H%M%S", localtime(&now));
+	snprintf(name, namelen, "%sptrace.%s", statsdir, stamp);
+	if (NULL == ring) {
+		errno = ENOENT;
+		return -1;
+	}
+	fd = open(name, O_CREAT | O_EXCL | O_WRONLY, 0644);
+	if (-1 == fd)
+		return -1;
+	fp = fdopen(fd, "wb");
+	if (NULL == fp) {
+		saved_errno = errno;
+		close(fd);
+		errno = saved_errno;
+		return -1;
+	}
+
+	n = min(ring_head, ring_size);
+	first = ring_head - n;
+	hdr.magic = htonl(PTRACE_MAGIC);
+	hdr.version = htonl(PTRACE_VERSION);
+	hdr.reclen = htonl(sizeof(out));
+	hdr.count = htonl(n);
+	hdr.lost = htonl(first);
+	fwrite(&hdr, sizeof(hdr), 1, fp);
+	for (; first != ring_head; first++) {
+		tr = &ring[first & (ring_size - 1)];
+		out = *tr;
+		out.ts_ui = htonl(tr->ts_ui);
+		out.ts_uf = htonl(tr->ts_uf);
+		out.wait = htonl(tr->wait);
+		out.proc = htonl(tr->proc);
+		out.rflags = htons(tr->rflags);
+		out.len = htons(tr->len);
+		out.rport = htons(tr->rport);
+		out.lport = htons(tr->lport);
+		fwrite(&out, sizeof(out), 1, fp);
+	}
+	if (ferror(fp)) {
+		saved_errno = errno;
+		fclose(fp);
+		errno = saved_errno;
+		return -1;
+	}
+
+	return (0 == fclose(fp)) ? 0 : -1;
+}
+
+
+/*
+ * ptrace_signal - act on TRACESIG: start the trace, or stop it and
+ *		   write it out.  Called from the main loop.
+ */
+void
+ptrace_signal(void)
+{
+	char	name[MAXFILENAME + 32];
+
+	ptrace_signalled = FALSE;
+	if (!ptrace_on) {
+		ptrace_start(ring_size);
+		return;
+	}
+	ptrace_stop();
+	if (0 == ptrace_dump(name, sizeof(name)))
+		msyslog(LOG_NOTICE, "packet trace written to %s", name);
+	else
+		msyslog(LOG_ERR, "packet trace %s: %m", name);
+}
@@ -254,7 +254,7 @@ write_stats(void)
 #endif /* VMS */
 #endif /* DOSYNCTODR */
 	record_sys_stats();
-	if (stats_drift_file != 0) {
+	if (stats_drift_file != 0 && shstate_mode != SHSTATE_SERVE) {
 
 		/*
 		 * When the frequency file is written, initialize the
@@ -489,6 +489,8 @@ stats_config(
 		{
 			leap_signature_t lsig;
 
+			ctl_sys_changed();
+
 			get_systime(&now);
 			time(&ttnow);
 			leapsec_getsig(&lsig);
@@ -744,8 +746,10 @@ record_sys_stats(void)
 		fprintf(sysstats.fp,
 		    "%lu %s %lu %lu %lu %lu %lu %lu %lu %lu %lu %lu %lu\n",
 		    day, ulfptoa(&now, 3), current_time - sys_stattime,
-		    sys_received, sys_processed, sys_newversion,
-		    sys_oldversion, sys_restricted, sys_badlength,
+		    ctr_read(CTR_SYS_RECEIVED),
+		    ctr_read(CTR_SYS_PROCESSED), sys_newversion,
+		    sys_oldversion, ctr_read(CTR_SYS_RESTRICTED),
+		    sys_badlength,
 		    sys_badauth, sys_declined, sys_limitrejected,
 		    sys_kodsent);
 		fflush(sysstats.fp);
@@ -882,9 +886,10 @@ check_leap_file(
 	/* try to load leapfile, force it if no leapfile loaded yet */
 	if (leapsec_load_file(
 		    leapfile_name, &leapfile_stat,
-		    !have_leapfile, is_daily_check))
+		    !have_leapfile, is_daily_check)) {
 		have_leapfile = TRUE;
-	else if (!have_leapfile)
+		ctl_sys_changed();
+	} else if (!have_leapfile)
 		return;
 
 	check_leap_expiration(is_daily_check, ntptime, systime);
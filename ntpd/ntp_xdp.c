@@ -0,0 +1,941 @@
+/*
+ * ntp_xdp.c - answer client requests through AF_XDP
+ *
+ * With "xdp <interface>" in the configuration file ntpd loads a small
+ * XDP program on the interface.  It steers plain client requests to an
+ * AF_XDP socket on each receive queue: unauthenticated 48 octet mode 3
+ * packets to UDP port 123, over IPv4 without options or IPv6 without
+ * extension headers, for an address in a hash map of those ntpd has an
+ * endpoint on.  xdp_endpoints() refills the map after each interface
+ * scan.  Everything else goes on to the kernel and the usual sockets.
+ * That includes requests with a MAC, VLAN tagged frames and fragments.
+ *
+ * The requests are taken off the sockets in batches.  Each one is
+ * handed to receive() as read_network_packet() would hand it on, so
+ * restrictions, rate limiting, the MRU list and interleaved mode all
+ * apply.  fast_xmit() answers through sendpkt_queued(), which passes
+ * the reply to xdp_reply() while a request from a socket is being
+ * processed.  The reply is written over the request in its UMEM frame,
+ * with the addresses and ports swapped.  It goes out on the transmit
+ * ring of the same socket at once, as the transmit timestamp was taken
+ * already, and the frame comes back to the fill ring from the
+ * completion ring.
+ *
+ * Native XDP is tried before generic (SKB) mode, and zero copy before
+ * copy mode.  The generic and copy modes make it work, if more slowly,
+ * on veth pairs and on drivers without AF_XDP support.  The program is
+ * attached through a BPF link, so it goes away with ntpd.
+ */
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include "ntpd.h"
+#include "ntp_io.h"
+#include "ntp_stdlib.h"
+
+#include <stdio.h>
+#include <stddef.h>
+
+#ifdef NTP_XDP
+
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/bpf.h>
+#include <linux/ethtool.h>
+#include <linux/if_link.h>
+#include <linux/if_xdp.h>
+#include <linux/sockios.h>
+
+#define XDP_MAXQ	16	/* receive queues served */
+#define XDP_FRAMES	2048	/* UMEM frames per queue, 2^n */
+#define XDP_FRAMESZ	2048	/* octets per frame, 2^n */
+#define XDP_RINGSZ	1024	/* rx, tx and completion ring entries */
+#define XDP_BATCH	64	/* requests taken off a socket at once */
+#define XDP_MAXADDR	256	/* endpoint addresses steered */
+
+/* what the XDP program lets through */
+#define XDP_ETHLEN	14	/* Ethernet header */
+#define XDP_IP4LEN	20	/* IPv4 header without options */
+#define XDP_IP6LEN	40	/* IPv6 header */
+#define XDP_UDPLEN	8	/* UDP header */
+#define XDP_REQ4LEN	(XDP_ETHLEN + XDP_IP4LEN + XDP_UDPLEN + LEN_PKT_NOMAC)
+#define XDP_REQ6LEN	(XDP_ETHLEN + XDP_IP6LEN + XDP_UDPLEN + LEN_PKT_NOMAC)
+
+/*
+ * A ring shared with the kernel.  cached is our producer index for the
+ * fill and transmit rings and our consumer index for the others.
+ */
+struct xdp_ring {
+	void *		map;
+	size_t		mapsz;
+	u_int32 *	producer;
+	u_int32 *	consumer;
+	u_int32 *	flags;
+	void *		ring;
+	u_int32		mask;
+	u_int32		cached;
+};
+
+/*
+ * An AF_XDP socket with its UMEM, bound to one receive queue
+ */
+struct xdp_queue {
+	struct asyncio_reader *	reader;
+	u_char *	umem;
+	struct xdp_ring	rx;
+	struct xdp_ring	tx;
+	struct xdp_ring	fill;
+	struct xdp_ring	comp;
+	int		txq;		/* replies not yet kicked off */
+};
+
+static struct xdp_queue	xdp_q[XDP_MAXQ];
+static int		xdp_nq;
+static char *		xdp_ifname;
+static u_int		xdp_ifindex;
+static int		xdp_map_fd = -1;
+static int		xdp_addr_fd = -1;
+static int		xdp_prog_fd = -1;
+static int		xdp_link_fd = -1;
+
+/*
+ * The request receive() is working on, see xdp_reply(), and the
+ * transmit timestamp to fill in once its reply is out.
+ */
+static struct xdp_queue *xdp_cur_q;
+static struct xdp_desc	xdp_cur;
+static int		xdp_cur_hlen;
+static int/*BOOL*/	xdp_cur_answered;
+static struct recvbuf	xdp_rb;
+static l_fp *		xdp_sent;
+
+static void	xdp_receive	(struct asyncio_reader *);
+static void	xdp_kick	(struct xdp_queue *);
+
+
+static int
+xdp_bpf(
+	int		cmd,
+	union bpf_attr *attr
+	)
+{
+	return (int)syscall(__NR_bpf, cmd, attr, sizeof(*attr));
+}
+
+
+/*
+ * xdp_load_prog - load the XDP program steering requests to xdp_map_fd
+ *
+ * The program is hand assembled, see linux/bpf.h.  Jump offsets count
+ * the instructions to skip; the numbers in the comments are those of
+ * the instructions.  The destination address is put on the stack as
+ * the key of xdp_addr_fd, IPv4 mapped to IPv6.
+ */
+static int
+xdp_load_prog(void)
+{
+#define XI(code, dst, src, off, imm)	{ (code), (dst), (src), (off), (imm) }
+	struct bpf_insn	prog[] = {
+		/* 0: r6 = ctx, r2 = data, r3 = data_end */
+		XI(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_6, BPF_REG_1, 0, 0),
+		XI(BPF_LDX | BPF_MEM | BPF_W, BPF_REG_2, BPF_REG_6,
+		   offsetof(struct xdp_md, data), 0),
+		XI(BPF_LDX | BPF_MEM | BPF_W, BPF_REG_3, BPF_REG_6,
+		   offsetof(struct xdp_md, data_end), 0),
+		/* 3: pass anything shorter than an IPv4 request */
+		XI(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_4, BPF_REG_2, 0, 0),
+		XI(BPF_ALU64 | BPF_ADD | BPF_K, BPF_REG_4, 0, 0,
+		   XDP_REQ4LEN),
+		XI(BPF_JMP | BPF_JGT | BPF_X, BPF_REG_4, BPF_REG_3, 48, 0),
+		/* 6: Ethernet type, IPv4 goes on at 24 */
+		XI(BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2, 12, 0),
+		XI(BPF_JMP | BPF_JEQ | BPF_K, BPF_REG_5, 0, 16,
+		   htons(0x0800)),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 45,
+		   htons(0x86dd)),
+		/* 9: IPv6, long enough, UDP, port 123, 48 octets */
+		XI(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_4, BPF_REG_2, 0, 0),
+		XI(BPF_ALU64 | BPF_ADD | BPF_K, BPF_REG_4, 0, 0,
+		   XDP_REQ6LEN),
+		XI(BPF_JMP | BPF_JGT | BPF_X, BPF_REG_4, BPF_REG_3, 42, 0),
+		XI(BPF_LDX | BPF_MEM | BPF_B, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + 6, 0),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 40, 17),
+		XI(BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + XDP_IP6LEN + 2, 0),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 38,
+		   htons(NTP_PORT)),
+		XI(BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + XDP_IP6LEN + 4, 0),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 36,
+		   htons(XDP_UDPLEN + LEN_PKT_NOMAC)),
+		/* 18: key = destination address */
+		XI(BPF_LDX | BPF_MEM | BPF_DW, BPF_REG_4, BPF_REG_2,
+		   XDP_ETHLEN + 24, 0),
+		XI(BPF_STX | BPF_MEM | BPF_DW, BPF_REG_10, BPF_REG_4, -16, 0),
+		XI(BPF_LDX | BPF_MEM | BPF_DW, BPF_REG_4, BPF_REG_2,
+		   XDP_ETHLEN + 32, 0),
+		XI(BPF_STX | BPF_MEM | BPF_DW, BPF_REG_10, BPF_REG_4, -8, 0),
+		/* 22: r5 = li_vn_mode, on to the mode check at 40 */
+		XI(BPF_LDX | BPF_MEM | BPF_B, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + XDP_IP6LEN + XDP_UDPLEN, 0),
+		XI(BPF_JMP | BPF_JA, 0, 0, 16, 0),
+		/* 24: IPv4 without options, UDP, unfragmented */
+		XI(BPF_LDX | BPF_MEM | BPF_B, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN, 0),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 28, 0x45),
+		XI(BPF_LDX | BPF_MEM | BPF_B, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + 9, 0),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 26, 17),
+		XI(BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + 6, 0),
+		XI(BPF_ALU64 | BPF_AND | BPF_K, BPF_REG_5, 0, 0,
+		   htons(0x3fff)),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 23, 0),
+		/* 31: port 123, 48 octets */
+		XI(BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + XDP_IP4LEN + 2, 0),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 21,
+		   htons(NTP_PORT)),
+		XI(BPF_LDX | BPF_MEM | BPF_H, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + XDP_IP4LEN + 4, 0),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 19,
+		   htons(XDP_UDPLEN + LEN_PKT_NOMAC)),
+		/* 35: key = ::ffff:destination address */
+		XI(BPF_ST | BPF_MEM | BPF_DW, BPF_REG_10, 0, -16, 0),
+		XI(BPF_ST | BPF_MEM | BPF_W, BPF_REG_10, 0, -8,
+		   htonl(0xffff)),
+		XI(BPF_LDX | BPF_MEM | BPF_W, BPF_REG_4, BPF_REG_2,
+		   XDP_ETHLEN + 16, 0),
+		XI(BPF_STX | BPF_MEM | BPF_W, BPF_REG_10, BPF_REG_4, -4, 0),
+		XI(BPF_LDX | BPF_MEM | BPF_B, BPF_REG_5, BPF_REG_2,
+		   XDP_ETHLEN + XDP_IP4LEN + XDP_UDPLEN, 0),
+		/* 40: mode 3 */
+		XI(BPF_ALU64 | BPF_AND | BPF_K, BPF_REG_5, 0, 0, 7),
+		XI(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 12, MODE_CLIENT),
+		/* 42: pass unless ntpd has an endpoint on the address */
+		XI(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_2, BPF_REG_10, 0, 0),
+		XI(BPF_ALU64 | BPF_ADD | BPF_K, BPF_REG_2, 0, 0, -16),
+		XI(BPF_LD | BPF_DW | BPF_IMM, BPF_REG_1, BPF_PSEUDO_MAP_FD,
+		   0, xdp_addr_fd),
+		XI(0, 0, 0, 0, 0),
+		XI(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_map_lookup_elem),
+		XI(BPF_JMP | BPF_JEQ | BPF_K, BPF_REG_0, 0, 6, 0),
+		/* 48: redirect to the queue's socket, or pass without one */
+		XI(BPF_LDX | BPF_MEM | BPF_W, BPF_REG_2, BPF_REG_6,
+		   offsetof(struct xdp_md, rx_queue_index), 0),
+		XI(BPF_LD | BPF_DW | BPF_IMM, BPF_REG_1, BPF_PSEUDO_MAP_FD,
+		   0, xdp_map_fd),
+		XI(0, 0, 0, 0, 0),
+		XI(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_3, 0, 0, XDP_PASS),
+		XI(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map),
+		XI(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+		/* 54: pass */
+		XI(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_0, 0, 0, XDP_PASS),
+		XI(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+	};
+#undef XI
+	union bpf_attr	attr;
+
+	ZERO(attr);
+	attr.prog_type = BPF_PROG_TYPE_XDP;
+	attr.insns = (u_int64)(uintptr_t)prog;
+	attr.insn_cnt = COUNTOF(prog);
+	attr.license = (u_int64)(uintptr_t)"BSD";
+	strlcpy(attr.prog_name, "ntpd_xdp", sizeof(attr.prog_name));
+
+	return xdp_bpf(BPF_PROG_LOAD, &attr);
+}
+
+
+/*
+ * xdp_addr_key - the key of an address in xdp_addr_fd
+ */
+static void
+xdp_addr_key(
+	const sockaddr_u *	a,
+	u_char *		key
+	)
+{
+	if (IS_IPV4(a)) {
+		memset(key, 0, 10);
+		key[10] = key[11] = 0xff;
+		memcpy(key + 12, &NSRCADR(a), 4);
+	} else {
+		memcpy(key, NSRCADR6(a), 16);
+	}
+}
+
+
+/*
+ * xdp_endpoints - put the addresses ntpd has an endpoint on in the map
+ *		   of those the XDP program steers requests for
+ *
+ * Called after each interface scan.  The map is emptied and filled
+ * again; requests for an address missing meanwhile go to the sockets.
+ */
+void
+xdp_endpoints(void)
+{
+	union bpf_attr	attr;
+	u_char		key[16];
+	u_char		one;
+	endpt *		ep;
+	int		n;
+
+	if (-1 == xdp_addr_fd)
+		return;
+
+	/* the first key each time, until none is left */
+	for (;;) {
+		ZERO(attr);
+		attr.map_fd = xdp_addr_fd;
+		attr.next_key = (u_int64)(uintptr_t)key;
+		if (xdp_bpf(BPF_MAP_GET_NEXT_KEY, &attr) != 0)
+			break;
+		ZERO(attr);
+		attr.map_fd = xdp_addr_fd;
+		attr.key = (u_int64)(uintptr_t)key;
+		if (xdp_bpf(BPF_MAP_DELETE_ELEM, &attr) != 0)
+			break;
+	}
+
+	n = 0;
+	one = 1;
+	for (ep = ep_list; ep != NULL; ep = ep->elink) {
+		if (   ((INT_WILDCARD | INT_MCASTIF) & ep->flags)
+		    || ep->ignore_packets)
+			continue;
+		xdp_addr_key(&ep->sin, key);
+		ZERO(attr);
+		attr.map_fd = xdp_addr_fd;
+		attr.key = (u_int64)(uintptr_t)key;
+		attr.value = (u_int64)(uintptr_t)&one;
+		if (0 == xdp_bpf(BPF_MAP_UPDATE_ELEM, &attr))
+			n++;
+	}
+	DPRINTF(1, ("xdp: steering requests for %d addresses\n", n));
+}
+
+
+/*
+ * xdp_nqueues - the number of receive queues of the interface
+ */
+static int
+xdp_nqueues(
+	int	fd
+	)
+{
+	struct ethtool_channels	ch;
+	struct ifreq		ifr;
+	int			n;
+
+	ZERO(ch);
+	ch.cmd = ETHTOOL_GCHANNELS;
+	ZERO(ifr);
+	strlcpy(ifr.ifr_name, xdp_ifname, sizeof(ifr.ifr_name));
+	ifr.ifr_data = (void *)&ch;
+	if (-1 == ioctl(fd, SIOCETHTOOL, &ifr))
+		return 1;
+	n = max(ch.rx_count, ch.combined_count);
+
+	return min(max(n, 1), XDP_MAXQ);
+}
+
+
+/*
+ * xdp_map_ring - map one of the rings of a socket
+ */
+static int/*BOOL*/
+xdp_map_ring(
+	int				fd,
+	struct xdp_ring *		r,
+	const struct xdp_ring_offset *	off,
+	off_t				pgoff,
+	u_int32				entries,
+	size_t				size
+	)
+{
+	u_char *	p;
+
+	r->mapsz = off->desc + entries * size;
+	p = mmap(NULL, r->mapsz, PROT_READ | PROT_WRITE,
+		 MAP_SHARED | MAP_POPULATE, fd, pgoff);
+	if (MAP_FAILED == p)
+		return FALSE;
+	r->map = p;
+	r->producer = (u_int32 *)(p + off->producer);
+	r->consumer = (u_int32 *)(p + off->consumer);
+	r->flags = (u_int32 *)(p + off->flags);
+	r->ring = p + off->desc;
+	r->mask = entries - 1;
+
+	return TRUE;
+}
+
+
+/*
+ * xdp_fill - give a frame back to the kernel for receiving
+ */
+static inline void
+xdp_fill(
+	struct xdp_queue *	q,
+	u_int64			addr
+	)
+{
+	((u_int64 *)q->fill.ring)[q->fill.cached++ & q->fill.mask] =
+		addr & ~(u_int64)(XDP_FRAMESZ - 1);
+}
+
+
+/*
+ * xdp_queue_open - set up the socket for a receive queue
+ */
+static int/*BOOL*/
+xdp_queue_open(
+	struct xdp_queue *	q,
+	u_int32			qid,
+	int/*BOOL*/		copy
+	)
+{
+	struct xdp_umem_reg	reg;
+	struct xdp_mmap_offsets	off;
+	struct sockaddr_xdp	sxdp;
+	union bpf_attr		attr;
+	socklen_t		optlen;
+	u_int32			n;
+	int			fd;
+
+	fd = socket(AF_XDP, SOCK_RAW, 0);
+	if (-1 == fd)
+		return FALSE;
+	fd = move_fd(fd);
+	q->umem = mmap(NULL, (size_t)XDP_FRAMES * XDP_FRAMESZ,
+		       PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+		       -1, 0);
+	if (MAP_FAILED == q->umem) {
+		q->umem = NULL;
+		goto fail;
+	}
+	ZERO(reg);
+	reg.addr = (u_int64)(uintptr_t)q->umem;
+	reg.len = (u_int64)XDP_FRAMES * XDP_FRAMESZ;
+	reg.chunk_size = XDP_FRAMESZ;
+	if (-1 == setsockopt(fd, SOL_XDP, XDP_UMEM_REG, &reg, sizeof(reg)))
+		goto fail;
+	n = XDP_FRAMES;
+	if (-1 == setsockopt(fd, SOL_XDP, XDP_UMEM_FILL_RING, &n, sizeof(n)))
+		goto fail;
+	n = XDP_RINGSZ;
+	if (   -1 == setsockopt(fd, SOL_XDP, XDP_UMEM_COMPLETION_RING,
+				&n, sizeof(n))
+	    || -1 == setsockopt(fd, SOL_XDP, XDP_RX_RING, &n, sizeof(n))
+	    || -1 == setsockopt(fd, SOL_XDP, XDP_TX_RING, &n, sizeof(n)))
+		goto fail;
+	optlen = sizeof(off);
+	if (-1 == getsockopt(fd, SOL_XDP, XDP_MMAP_OFFSETS, &off, &optlen))
+		goto fail;
+	if (   !xdp_map_ring(fd, &q->rx, &off.rx, XDP_PGOFF_RX_RING,
+			     XDP_RINGSZ, sizeof(struct xdp_desc))
+	    || !xdp_map_ring(fd, &q->tx, &off.tx, XDP_PGOFF_TX_RING,
+			     XDP_RINGSZ, sizeof(struct xdp_desc))
+	    || !xdp_map_ring(fd, &q->fill, &off.fr,
+			     XDP_UMEM_PGOFF_FILL_RING, XDP_FRAMES,
+			     sizeof(u_int64))
+	    || !xdp_map_ring(fd, &q->comp, &off.cr,
+			     XDP_UMEM_PGOFF_COMPLETION_RING, XDP_RINGSZ,
+			     sizeof(u_int64)))
+		goto fail;
+
+	/* all frames start out on the fill ring */
+	q->fill.cached = *q->fill.producer;
+	for (n = 0; n < XDP_FRAMES; n++)
+		xdp_fill(q, (u_int64)n * XDP_FRAMESZ);
+	__atomic_store_n(q->fill.producer, q->fill.cached,
+			 __ATOMIC_RELEASE);
+	q->rx.cached = *q->rx.consumer;
+	q->tx.cached = *q->tx.producer;
+	q->comp.cached = *q->comp.consumer;
+
+	ZERO(sxdp);
+	sxdp.sxdp_family = AF_XDP;
+	sxdp.sxdp_ifindex = xdp_ifindex;
+	sxdp.sxdp_queue_id = qid;
+	sxdp.sxdp_flags = XDP_USE_NEED_WAKEUP | XDP_ZEROCOPY;
+	if (copy || -1 == bind(fd, (struct sockaddr *)&sxdp,
+			       sizeof(sxdp))) {
+		sxdp.sxdp_flags = XDP_USE_NEED_WAKEUP | XDP_COPY;
+		if (-1 == bind(fd, (struct sockaddr *)&sxdp, sizeof(sxdp)))
+			goto fail;
+	}
+
+	ZERO(attr);
+	attr.map_fd = xdp_map_fd;
+	attr.key = (u_int64)(uintptr_t)&qid;
+	attr.value = (u_int64)(uintptr_t)&fd;
+	if (-1 == xdp_bpf(BPF_MAP_UPDATE_ELEM, &attr))
+		goto fail;
+
+	q->reader = new_asyncio_reader();
+	q->reader->fd = fd;
+	q->reader->data = q;
+	q->reader->receiver = &xdp_receive;
+	add_asyncio_reader(q->reader, FD_TYPE_SOCKET);
+	DPRINTF(1, ("xdp: queue %u on fd %d, %s\n", qid, fd,
+		    (sxdp.sxdp_flags & XDP_COPY) ? "copy" : "zero copy"));
+
+	return TRUE;
+
+    fail:
+	msyslog(LOG_ERR, "xdp %s queue %u: %m", xdp_ifname, qid);
+	if (q->rx.map != NULL)
+		munmap(q->rx.map, q->rx.mapsz);
+	if (q->tx.map != NULL)
+		munmap(q->tx.map, q->tx.mapsz);
+	if (q->fill.map != NULL)
+		munmap(q->fill.map, q->fill.mapsz);
+	if (q->comp.map != NULL)
+		munmap(q->comp.map, q->comp.mapsz);
+	if (q->umem != NULL)
+		munmap(q->umem, (size_t)XDP_FRAMES * XDP_FRAMESZ);
+	close(fd);
+	memset(q, 0, sizeof(*q));
+
+	return FALSE;
+}
+
+
+/*
+ * xdp_open - answer client requests on an interface through AF_XDP
+ *
+ * Called for "xdp" in the configuration, once the sockets are open.
+ */
+void
+xdp_open(
+	const char *	ifname
+	)
+{
+	union bpf_attr	attr;
+	const char *	mode;
+	u_int32		qid;
+	int		fd;
+	int		nq;
+
+	if (xdp_ifname != NULL) {
+		if (strcmp(xdp_ifname, ifname))
+			msyslog(LOG_ERR,
+				"xdp %s: already answering on %s",
+				ifname, xdp_ifname);
+		return;
+	}
+	xdp_ifindex = if_nametoindex(ifname);
+	if (0 == xdp_ifindex) {
+		msyslog(LOG_ERR, "xdp %s: %m", ifname);
+		return;
+	}
+	xdp_ifname = estrdup(ifname);
+
+	fd = socket(AF_INET, SOCK_DGRAM, 0);
+	nq = (-1 == fd) ? 1 : xdp_nqueues(fd);
+	if (fd != -1)
+		close(fd);
+
+	ZERO(attr);
+	attr.map_type = BPF_MAP_TYPE_XSKMAP;
+	attr.key_size = sizeof(u_int32);
+	attr.value_size = sizeof(int);
+	attr.max_entries = nq;
+	xdp_map_fd = xdp_bpf(BPF_MAP_CREATE, &attr);
+	if (-1 == xdp_map_fd) {
+		msyslog(LOG_ERR, "xdp %s: XSKMAP: %m", ifname);
+		goto fail;
+	}
+	ZERO(attr);
+	attr.map_type = BPF_MAP_TYPE_HASH;
+	attr.key_size = 16;
+	attr.value_size = 1;
+	attr.max_entries = XDP_MAXADDR;
+	xdp_addr_fd = xdp_bpf(BPF_MAP_CREATE, &attr);
+	if (-1 == xdp_addr_fd) {
+		msyslog(LOG_ERR, "xdp %s: address map: %m", ifname);
+		goto fail;
+	}
+	xdp_endpoints();
+	xdp_prog_fd = xdp_load_prog();
+	if (-1 == xdp_prog_fd) {
+		msyslog(LOG_ERR, "xdp %s: loading the program: %m", ifname);
+		goto fail;
+	}
+	ZERO(attr);
+	attr.link_create.prog_fd = xdp_prog_fd;
+	attr.link_create.target_ifindex = xdp_ifindex;
+	attr.link_create.attach_type = BPF_XDP;
+	attr.link_create.flags = XDP_FLAGS_DRV_MODE;
+	mode = "native";
+	xdp_link_fd = xdp_bpf(BPF_LINK_CREATE, &attr);
+	if (-1 == xdp_link_fd) {
+		attr.link_create.flags = XDP_FLAGS_SKB_MODE;
+		mode = "generic";
+		xdp_link_fd = xdp_bpf(BPF_LINK_CREATE, &attr);
+	}
+	if (-1 == xdp_link_fd) {
+		msyslog(LOG_ERR, "xdp %s: attaching the program: %m",
+			ifname);
+		goto fail;
+	}
+
+	for (qid = 0; qid < (u_int32)nq; qid++)
+		if (xdp_queue_open(&xdp_q[xdp_nq], qid,
+				   XDP_FLAGS_SKB_MODE ==
+				   attr.link_create.flags))
+			xdp_nq++;
+	if (0 == xdp_nq)
+		goto fail;
+	msyslog(LOG_INFO,
+		"xdp: answering client requests on %s, %d of %d queues, %s mode",
+		ifname, xdp_nq, nq, mode);
+
+	return;
+
+    fail:
+	if (xdp_link_fd != -1)
+		close(xdp_link_fd);
+	if (xdp_prog_fd != -1)
+		close(xdp_prog_fd);
+	if (xdp_map_fd != -1)
+		close(xdp_map_fd);
+	if (xdp_addr_fd != -1)
+		close(xdp_addr_fd);
+	xdp_link_fd = xdp_prog_fd = xdp_map_fd = xdp_addr_fd = -1;
+}
+
+
+/*
+ * xdp_bogus_source - would the kernel have dropped a packet from this
+ * source address before it got to a socket?
+ */
+static int/*BOOL*/
+xdp_bogus_source(
+	sockaddr_u *	src
+	)
+{
+	u_int32	a;
+
+	if (IS_IPV4(src)) {
+		a = SRCADR(src);
+		return (0 == (a >> 24) || 127 == (a >> 24) ||
+			IN_CLASSD(a) || a >= 0xf0000000);
+	}
+
+	return (IN6_IS_ADDR_UNSPECIFIED(PSOCK_ADDR6(src)) ||
+		IN6_IS_ADDR_LOOPBACK(PSOCK_ADDR6(src)) ||
+		IN6_IS_ADDR_MULTICAST(PSOCK_ADDR6(src)) ||
+		IN6_IS_ADDR_V4MAPPED(PSOCK_ADDR6(src)));
+}
+
+
+/*
+ * xdp_request - hand a request from a socket on to receive()
+ */
+static void
+xdp_request(
+	struct xdp_queue *	q,
+	const struct xdp_desc *	d,
+	l_fp			ts
+	)
+{
+	sockaddr_u	src;
+	sockaddr_u	dst;
+	const u_char *	frame;
+	const u_char *	udp;
+	endpt *		ep;
+
+	frame = q->umem + d->addr;
+	ZERO(src);
+	ZERO(dst);
+	if (0x08 == frame[12] && 0x00 == frame[13] &&
+	    d->len >= XDP_REQ4LEN) {
+		AF(&src) = AF(&dst) = AF_INET;
+		memcpy(&NSRCADR(&src), frame + XDP_ETHLEN + 12, 4);
+		memcpy(&NSRCADR(&dst), frame + XDP_ETHLEN + 16, 4);
+		xdp_cur_hlen = XDP_ETHLEN + XDP_IP4LEN + XDP_UDPLEN;
+	} else if (d->len >= XDP_REQ6LEN) {
+		AF(&src) = AF(&dst) = AF_INET6;
+		memcpy(NSRCADR6(&src), frame + XDP_ETHLEN + 8, 16);
+		memcpy(NSRCADR6(&dst), frame + XDP_ETHLEN + 24, 16);
+		if (IN6_IS_ADDR_LINKLOCAL(PSOCK_ADDR6(&src)))
+			SET_SCOPE(&src, xdp_ifindex);
+		if (IN6_IS_ADDR_LINKLOCAL(PSOCK_ADDR6(&dst)))
+			SET_SCOPE(&dst, xdp_ifindex);
+		xdp_cur_hlen = XDP_ETHLEN + XDP_IP6LEN + XDP_UDPLEN;
+	} else {
+		xdp_fill(q, d->addr);
+		return;
+	}
+	udp = frame + xdp_cur_hlen - XDP_UDPLEN;
+	memcpy(&NSRCPORT(&src), udp, 2);
+	SET_PORT(&dst, NTP_PORT);
+
+	DPRINTF(3, ("xdp_request: queue %d from %s to %s\n",
+		    (int)(q - xdp_q), sptoa(&src), stoa(&dst)));
+
+	/*
+	 * Only addresses ntpd listens on are answered; the kernel
+	 * would have handed the others to the wildcard socket.  The
+	 * program only steers those, but the map may lag behind.
+	 */
+	ep = getinterface(&dst, INT_WILDCARD);
+	if (NULL == ep || ep->ignore_packets) {
+		packets_ignored++;
+		xdp_fill(q, d->addr);
+		return;
+	}
+	if (xdp_bogus_source(&src)) {
+		packets_dropped++;
+		xdp_fill(q, d->addr);
+		return;
+	}
+
+	memset(&xdp_rb, 0, offsetof(struct recvbuf, recv_space));
+	xdp_rb.recv_srcadr = src;
+	xdp_rb.recv_length = LEN_PKT_NOMAC;
+	memcpy(&xdp_rb.recv_pkt, frame + xdp_cur_hlen, LEN_PKT_NOMAC);
+	xdp_rb.dstadr = ep;
+	xdp_rb.fd = ep->fd;
+	xdp_rb.recv_time = ts;
+	xdp_rb.receiver = receive;
+	CTR_OBJ_INC(ep->received);
+	CTR_INC(CTR_PACKETS_RECEIVED);
+
+	xdp_cur_q = q;
+	xdp_cur = *d;
+	xdp_cur_answered = FALSE;
+	receive(&xdp_rb);
+	xdp_cur_q = NULL;
+	if (xdp_cur_answered)
+		xdp_kick(q);
+	else
+		xdp_fill(q, d->addr);
+}
+
+
+/*
+ * xdp_kick - get the queued reply going and give the kernel the
+ *	      frames back which are done with
+ */
+static void
+xdp_kick(
+	struct xdp_queue *	q
+	)
+{
+	__atomic_store_n(q->fill.producer, q->fill.cached,
+			 __ATOMIC_RELEASE);
+	if (0 == q->txq)
+		return;
+	__atomic_store_n(q->tx.producer, q->tx.cached, __ATOMIC_RELEASE);
+	if (__atomic_load_n(q->tx.flags, __ATOMIC_ACQUIRE) &
+	    XDP_RING_NEED_WAKEUP)
+		sendto(q->reader->fd, NULL, 0, MSG_DONTWAIT, NULL, 0);
+	q->txq = 0;
+	if (xdp_sent != NULL) {
+		get_systime(xdp_sent);
+		xdp_sent = NULL;
+	}
+}
+
+
+/*
+ * xdp_receive - asyncio reader callback for the socket of a queue
+ */
+static void
+xdp_receive(
+	struct asyncio_reader *	reader
+	)
+{
+	struct xdp_queue *	q;
+	struct xdp_desc		d;
+	u_int32			prod;
+	l_fp			ts;
+	int			n;
+
+	q = reader->data;
+
+	/* frames of replies which went out go back on the fill ring */
+	prod = __atomic_load_n(q->comp.producer, __ATOMIC_ACQUIRE);
+	while (q->comp.cached != prod)
+		xdp_fill(q, ((u_int64 *)q->comp.ring)
+				[q->comp.cached++ & q->comp.mask]);
+	__atomic_store_n(q->comp.consumer, q->comp.cached,
+			 __ATOMIC_RELEASE);
+
+	get_systime(&ts);
+	prod = __atomic_load_n(q->rx.producer, __ATOMIC_ACQUIRE);
+	for (n = 0; n < XDP_BATCH && q->rx.cached != prod; n++) {
+		d = ((struct xdp_desc *)q->rx.ring)
+			[q->rx.cached++ & q->rx.mask];
+		xdp_request(q, &d, ts);
+	}
+	__atomic_store_n(q->rx.consumer, q->rx.cached, __ATOMIC_RELEASE);
+	xdp_kick(q);
+}
+
+
+/*
+ * xdp_csum - add octets to a ones' complement sum
+ */
+static u_int32
+xdp_csum(
+	u_int32		sum,
+	const void *	data,
+	size_t		len
+	)
+{
+	const u_char *	p;
+
+	for (p = data; len > 1; p += 2, len -= 2)
+		sum += (p[0] << 8) | p[1];
+	if (len > 0)
+		sum += p[0] << 8;
+
+	return sum;
+}
+
+
+static u_short
+xdp_csum_fold(
+	u_int32	sum
+	)
+{
+	while (sum >> 16)
+		sum = (sum & 0xffff) + (sum >> 16);
+
+	return htons((u_short)~sum);
+}
+
+
+/*
+ * xdp_reply - send a reply to the request being processed in its frame
+ *
+ * Called by sendpkt_queued().  Returns FALSE for anything but the one
+ * reply to that request, or if there is no room for it, so it goes out
+ * through the socket of the endpoint instead.
+ */
+int/*BOOL*/
+xdp_reply(
+	sockaddr_u *	dest,
+	endpt *		ep,
+	struct pkt *	pkt,
+	int		len,
+	l_fp *		sent
+	)
+{
+	struct xdp_queue *	q;
+	struct xdp_desc *	d;
+	u_char *		frame;
+	u_char *		udp;
+	u_char			tmp[16];
+	u_int32			sum;
+	u_short			w;
+
+	q = xdp_cur_q;
+	if (   NULL == q || xdp_cur_answered
+	    || !ADDR_PORT_EQ(dest, &xdp_rb.recv_srcadr)
+	    || len < 0
+	    || (xdp_cur.addr & (XDP_FRAMESZ - 1)) + xdp_cur_hlen + len >
+	       XDP_FRAMESZ
+	    || q->tx.cached - __atomic_load_n(q->tx.consumer,
+					      __ATOMIC_ACQUIRE) > q->tx.mask)
+		return FALSE;
+
+	frame = q->umem + xdp_cur.addr;
+	memcpy(tmp, frame, 6);
+	memmove(frame, frame + 6, 6);
+	memcpy(frame + 6, tmp, 6);
+	udp = frame + xdp_cur_hlen - XDP_UDPLEN;
+	if (IS_IPV4(dest)) {
+		w = htons((u_short)(XDP_IP4LEN + XDP_UDPLEN + len));
+		memcpy(frame + XDP_ETHLEN + 2, &w, 2);	/* length */
+		memset(frame + XDP_ETHLEN + 4, 0, 2);	/* ID */
+		frame[XDP_ETHLEN + 8] = 64;		/* TTL */
+		memset(frame + XDP_ETHLEN + 10, 0, 2);	/* checksum */
+		memcpy(tmp, frame + XDP_ETHLEN + 12, 4);
+		memmove(frame + XDP_ETHLEN + 12, frame + XDP_ETHLEN + 16, 4);
+		memcpy(frame + XDP_ETHLEN + 16, tmp, 4);
+		w = xdp_csum_fold(xdp_csum(0, frame + XDP_ETHLEN,
+					   XDP_IP4LEN));
+		memcpy(frame + XDP_ETHLEN + 10, &w, 2);
+		/* pseudo header: addresses, protocol and UDP length */
+		sum = xdp_csum(0, frame + XDP_ETHLEN + 12, 8);
+	} else {
+		w = htons((u_short)(XDP_UDPLEN + len));
+		memcpy(frame + XDP_ETHLEN + 4, &w, 2);	/* length */
+		frame[XDP_ETHLEN + 7] = 64;		/* hop limit */
+		memcpy(tmp, frame + XDP_ETHLEN + 8, 16);
+		memmove(frame + XDP_ETHLEN + 8, frame + XDP_ETHLEN + 24, 16);
+		memcpy(frame + XDP_ETHLEN + 24, tmp, 16);
+		sum = xdp_csum(0, frame + XDP_ETHLEN + 8, 32);
+	}
+	sum += 17 + XDP_UDPLEN + len;
+	memcpy(tmp, udp, 2);
+	memmove(udp, udp + 2, 2);
+	memcpy(udp + 2, tmp, 2);
+	w = htons((u_short)(XDP_UDPLEN + len));
+	memcpy(udp + 4, &w, 2);
+	memset(udp + 6, 0, 2);
+	memcpy(udp + XDP_UDPLEN, pkt, len);
+	w = xdp_csum_fold(xdp_csum(sum, udp, XDP_UDPLEN + len));
+	if (0 == w)
+		w = 0xffff;
+	memcpy(udp + 6, &w, 2);
+
+	d = &((struct xdp_desc *)q->tx.ring)[q->tx.cached++ & q->tx.mask];
+	d->addr = xdp_cur.addr;
+	d->len = xdp_cur_hlen + len;
+	d->options = 0;
+	q->txq++;
+	xdp_cur_answered = TRUE;
+	CTR_OBJ_INC(ep->sent);
+	CTR_INC(CTR_PACKETS_SENT);
+	if (sent != NULL)
+		L_CLR(sent);
+	xdp_sent = sent;
+	DPRINTF(2, ("xdp_reply: queue %d to %s len %d\n",
+		    (int)(q - xdp_q), sptoa(dest), len));
+
+	return TRUE;
+}
+
+#else	/* !NTP_XDP follows */
+
+void
+xdp_open(
+	const char *	ifname
+	)
+{
+	msyslog(LOG_ERR, "xdp %s: not supported by this build", ifname);
+}
+
+
+void
+xdp_endpoints(void)
+{
+	/* no map to fill */
+}
+
+
+int/*BOOL*/
+xdp_reply(
+	sockaddr_u *	dest,
+	endpt *		ep,
+	struct pkt *	pkt,
+	int		len,
+	l_fp *		sent
+	)
+{
+	return FALSE;
+}
+
+#endif	/* !NTP_XDP */
@@ -228,6 +228,9 @@ static	RETSIGTYPE	lessdebug	(int);
 # else	/* !DEBUG follows */
 static	RETSIGTYPE	no_debug	(int);
 # endif	/* !DEBUG */
+# ifdef SIGWINCH
+static	RETSIGTYPE	trace_signal	(int);
+# endif
 #endif	/* !SIM && !SYS_WINNT */
 
 int	saved_argc;
@@ -852,6 +855,9 @@ ntpdmain(
 	(void) signal_no_reset(MOREDEBUGSIG, no_debug);
 	(void) signal_no_reset(LESSDEBUGSIG, no_debug);
 #  endif	/* DEBUG */
+#  ifdef SIGWINCH
+	(void) signal_no_reset(TRACESIG, trace_signal);
+#  endif
 # endif	/* !SYS_WINNT && !VMS */
 
 	/*
@@ -925,7 +931,9 @@ ntpdmain(
 # endif	/* !HAVE_MLOCKALL */
 	}
 
-	loop_config(LOOP_DRIFTINIT, 0);
+	/* a serving process leaves the clock alone, see ntp_shstate.c */
+	if (shstate_mode != SHSTATE_SERVE)
+		loop_config(LOOP_DRIFTINIT, 0);
 	report_event(EVNT_SYSRESTART, NULL, NULL);
 	initializing = FALSE;
 
@@ -1146,6 +1154,11 @@ int scmp_sc[] = {
 	SCMP_SYS(getitimer),
 	SCMP_SYS(getsockname),
 	SCMP_SYS(ioctl),
+#ifdef NTP_IO_URING
+	SCMP_SYS(io_uring_enter),
+	SCMP_SYS(io_uring_register),
+	SCMP_SYS(io_uring_setup),
+#endif
 	SCMP_SYS(lseek),
 	SCMP_SYS(madvise),
 	SCMP_SYS(mmap),
@@ -1162,6 +1175,8 @@ int scmp_sc[] = {
 	SCMP_SYS(sendto),
 	SCMP_SYS(setitimer),
 	SCMP_SYS(setsid),
+	SCMP_SYS(shmat),
+	SCMP_SYS(shmget),
 	SCMP_SYS(socket),
 	SCMP_SYS(stat),
 	SCMP_SYS(time),
@@ -1181,6 +1196,12 @@ int scmp_sc[] = {
 	SCMP_SYS(fsync),
 	SCMP_SYS(futex),
 	SCMP_SYS(getitimer),
+#ifdef NTP_IO_URING
+	SCMP_SYS(io_uring_enter),
+	SCMP_SYS(io_uring_register),
+	SCMP_SYS(io_uring_setup),
+#endif
+	SCMP_SYS(ipc),
 	SCMP_SYS(madvise),
 	SCMP_SYS(mmap),
 	SCMP_SYS(mmap2),
@@ -1241,6 +1262,10 @@ int scmp_sc[] = {
 		if (signalled)
 			finish_safe(signo);
 #endif		
+#ifndef SIM
+		if (ptrace_signalled)
+			ptrace_signal();
+#endif
 		if (alarm_flag) {	/* alarmed? */
 			was_alarmed = TRUE;
 			alarm_flag = FALSE;
@@ -1331,6 +1356,9 @@ int scmp_sc[] = {
 		}
 # endif
 
+		/* responses the control socket could not write at once */
+		ctlsock_flush();
+
 		/*
 		 * Go around again
 		 */
@@ -1612,4 +1640,19 @@ no_debug(
 	errno = saved_errno;
 }
 # endif	/* !DEBUG */
+
+# ifdef SIGWINCH
+
+/*
+ * trace_signal - have the main loop start the packet trace, or stop
+ *		  and dump it
+ */
+static RETSIGTYPE
+trace_signal(
+	int sig
+	)
+{
+	ptrace_signalled = TRUE;
+}
+# endif	/* SIGWINCH */
 #endif	/* !SIM && !SYS_WINNT */
@@ -170,10 +170,10 @@ ntpsim(
 		(*event_ptr[curr_event->function])(curr_event);
 		free_node(curr_event);
 	}
-	printf("sys_received: %lu\n", sys_received);
+	printf("sys_received: %lu\n", ctr_read(CTR_SYS_RECEIVED));
 	printf("sys_badlength: %lu\n", sys_badlength);
 	printf("sys_declined: %lu\n", sys_declined);
-	printf("sys_restricted: %lu\n", sys_restricted);
+	printf("sys_restricted: %lu\n", ctr_read(CTR_SYS_RESTRICTED));
 	printf("sys_newversion: %lu\n", sys_newversion);
 	printf("sys_oldversion: %lu\n", sys_oldversion);
 	printf("sys_limitrejected: %lu\n", sys_limitrejected);
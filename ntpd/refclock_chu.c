@@ -418,7 +418,9 @@ static	int	chu_dist	(int, int);
 static	double	chu_major	(struct peer *);
 #ifdef HAVE_AUDIO
 static	void	chu_uart	(struct surv *, double);
-static	void	chu_rf		(struct peer *, double);
+static	void	chu_rf		(struct chuunit *, const double *, int,
+				 double *);
+static	void	chu_demod	(struct peer *, double);
 static	void	chu_gain	(struct peer *);
 static	void	chu_audio_receive (struct recvbuf *rbufp);
 #endif /* HAVE_AUDIO */
@@ -656,9 +658,12 @@ chu_audio_receive(
 	struct refclockproc *pp;
 	struct peer *peer;
 
-	double	sample;		/* codec sample */
+	double	sample[AUDIO_BUFSIZ]; /* codec samples */
+	double	lpf[AUDIO_BUFSIZ]; /* baseband samples */
 	u_char	*dpt;		/* buffer pointer */
 	int	bufcnt;		/* buffer counter */
+	int	blkcnt;		/* block counter */
+	int	i;
 	l_fp	ltemp;		/* l_fp temp */
 
 	peer = rbufp->recv_peer;
@@ -666,36 +671,43 @@ chu_audio_receive(
 	up = pp->unitptr;
 
 	/*
-	 * Main loop - read until there ain't no more. Note codec
-	 * samples are bit-inverted.
+	 * Main loop - read until there ain't no more. The buffer is
+	 * filtered in blocks, each ending no later than the next second
+	 * boundary, so the gain is ridden on the same clip count as it
+	 * would be sample by sample. Note codec samples are bit-
+	 * inverted.
 	 */
+	audio_stamp(rbufp->fd, &rbufp->recv_time, rbufp->recv_length);
 	DTOLFP((double)rbufp->recv_length / SECOND, &ltemp);
 	L_SUB(&rbufp->recv_time, &ltemp);
 	up->timestamp = rbufp->recv_time;
 	dpt = rbufp->recv_buffer;
-	for (bufcnt = 0; bufcnt < rbufp->recv_length; bufcnt++) {
-		sample = up->comp[~*dpt++ & 0xff];
+	for (bufcnt = 0; bufcnt < rbufp->recv_length; bufcnt += blkcnt) {
+		blkcnt = rbufp->recv_length - bufcnt;
+		if (blkcnt > AUDIO_BUFSIZ)
+			blkcnt = AUDIO_BUFSIZ;
+		if (blkcnt > SECOND - up->seccnt)
+			blkcnt = SECOND - up->seccnt;
 
 		/*
 		 * Clip noise spikes greater than MAXAMP. If no clips,
 		 * increase the gain a tad; if the clips are too high, 
 		 * decrease a tad.
 		 */
-		if (sample > MAXAMP) {
-			sample = MAXAMP;
-			up->clipcnt++;
-		} else if (sample < -MAXAMP) {
-			sample = -MAXAMP;
-			up->clipcnt++;
+		up->clipcnt += audio_decompand(dpt + bufcnt, blkcnt,
+		    up->comp, MAXAMP, sample);
+		chu_rf(up, sample, blkcnt, lpf);
+		for (i = 0; i < blkcnt; i++) {
+			chu_demod(peer, lpf[i]);
+			L_ADD(&up->timestamp, &up->tick);
 		}
-		chu_rf(peer, sample);
-		L_ADD(&up->timestamp, &up->tick);
 
 		/*
 		 * Once each second ride gain.
 		 */
-		up->seccnt = (up->seccnt + 1) % SECOND;
-		if (up->seccnt == 0) {
+		up->seccnt += blkcnt;
+		if (up->seccnt >= SECOND) {
+			up->seccnt = 0;
 			chu_gain(peer);
 		}
 	}
@@ -723,58 +735,81 @@ chu_audio_receive(
  * decoder samples the baseband signal at eight times the baud rate and
  * detects the start bit of each character.
  *
- * The filters are built for speed, which explains the rather clumsy
- * code. Hopefully, the compiler will efficiently implement the move-
- * and-muiltiply-and-add operations.
+ * The filters run over a block of samples at a time. Each delay line
+ * is copied to the head of a linear array, the block is appended and
+ * the tail copied back at the end, so there is neither shifting nor
+ * index wrapping per sample. Only the recursive half of the bandpass
+ * filter has to run sample by sample; the other stages are independent
+ * for each sample and the compiler can vectorize them. The arithmetic
+ * is done in the same order as it was sample by sample, so the output
+ * is the same to the bit.
  */
 static void
 chu_rf(
-	struct peer *peer,	/* peer structure pointer */
-	double	sample		/* analog sample */
+	struct chuunit *up,	/* unit structure pointer */
+	const double *sample,	/* analog samples */
+	int	len,		/* number of samples */
+	double	*lpf		/* lowpass signal */
 	)
 {
-	struct refclockproc *pp;
-	struct chuunit *up;
-	struct surv *sp;
+	/*
+	 * Raised cosine FIR coefficients, oldest sample first. The
+	 * newest sample has weight 2.538771e-02, which is folded into
+	 * the delay line.
+	 */
+	static const double lpfcoef[26] = {
+		2.538771e-02, 1.084671e-01, 2.003159e-01, 2.985303e-01,
+		4.003697e-01, 5.028552e-01, 6.028795e-01, 6.973249e-01,
+		7.831828e-01, 8.576717e-01, 9.183463e-01, 9.631951e-01,
+		9.907208e-01, 1.000000e+00, 9.907208e-01, 9.631951e-01,
+		9.183463e-01, 8.576717e-01, 7.831828e-01, 6.973249e-01,
+		6.028795e-01, 5.028552e-01, 4.003697e-01, 2.985303e-01,
+		2.003159e-01, 1.084671e-01
+	};
 
 	/*
 	 * Local variables
 	 */
-	double	signal;		/* bandpass signal */
-	double	limit;		/* limiter signal */
+	double	bpf[8 + AUDIO_BUFSIZ]; /* bandpass delay line */
+	double	signal[AUDIO_BUFSIZ]; /* bandpass signal */
+	double	limit[LAG + AUDIO_BUFSIZ]; /* limiter delay line */
+	double	fir[26 + AUDIO_BUFSIZ]; /* lowpass delay line */
 	double	disc;		/* discriminator signal */
-	double	lpf;		/* lowpass signal */
-	double	dist;		/* UART signal distance */
+	double	dtemp;
 	int	i, j;
 
-	pp = peer->procptr;
-	up = pp->unitptr;
-
 	/*
 	 * Bandpass filter. 4th-order elliptic, 500-Hz bandpass centered
 	 * at 2125 Hz. Passband ripple 0.3 dB, stopband ripple 50 dB,
 	 * phase delay 0.24 ms.
 	 */
-	signal = (up->bpf[8] = up->bpf[7]) * 5.844676e-01;
-	signal += (up->bpf[7] = up->bpf[6]) * 4.884860e-01;
-	signal += (up->bpf[6] = up->bpf[5]) * 2.704384e+00;
-	signal += (up->bpf[5] = up->bpf[4]) * 1.645032e+00;
-	signal += (up->bpf[4] = up->bpf[3]) * 4.644557e+00;
-	signal += (up->bpf[3] = up->bpf[2]) * 1.879165e+00;
-	signal += (up->bpf[2] = up->bpf[1]) * 3.522634e+00;
-	signal += (up->bpf[1] = up->bpf[0]) * 7.315738e-01;
-	up->bpf[0] = sample - signal;
-	signal = up->bpf[0] * 6.176213e-03
-	    + up->bpf[1] * 3.156599e-03
-	    + up->bpf[2] * 7.567487e-03
-	    + up->bpf[3] * 4.344580e-03
-	    + up->bpf[4] * 1.190128e-02
-	    + up->bpf[5] * 4.344580e-03
-	    + up->bpf[6] * 7.567487e-03
-	    + up->bpf[7] * 3.156599e-03
-	    + up->bpf[8] * 6.176213e-03;
-
-	up->monitor = signal / 4.;	/* note monitor after filter */
+	for (j = 0; j < 8; j++)
+		bpf[j] = up->bpf[7 - j];
+	for (i = 0; i < len; i++) {
+		dtemp = bpf[i] * 5.844676e-01;
+		dtemp += bpf[i + 1] * 4.884860e-01;
+		dtemp += bpf[i + 2] * 2.704384e+00;
+		dtemp += bpf[i + 3] * 1.645032e+00;
+		dtemp += bpf[i + 4] * 4.644557e+00;
+		dtemp += bpf[i + 5] * 1.879165e+00;
+		dtemp += bpf[i + 6] * 3.522634e+00;
+		dtemp += bpf[i + 7] * 7.315738e-01;
+		bpf[i + 8] = sample[i] - dtemp;
+	}
+	for (i = 0; i < len; i++)
+		signal[i] = bpf[i + 8] * 6.176213e-03
+		    + bpf[i + 7] * 3.156599e-03
+		    + bpf[i + 6] * 7.567487e-03
+		    + bpf[i + 5] * 4.344580e-03
+		    + bpf[i + 4] * 1.190128e-02
+		    + bpf[i + 3] * 4.344580e-03
+		    + bpf[i + 2] * 7.567487e-03
+		    + bpf[i + 1] * 3.156599e-03
+		    + bpf[i] * 6.176213e-03;
+	for (j = 0; j < 9; j++)
+		up->bpf[j] = bpf[len + 7 - j];
+
+	up->monitor = signal[len - 1] / 4.; /* note monitor after filter */
 
 	/*
 	 * Soft limiter/discriminator. The 11-sample discriminator lag
@@ -785,49 +820,63 @@ chu_rf(
 	 * this frequency, so the discriminator output is biased. Life
 	 * at 8000 Hz sucks.
 	 */
-	limit = signal;
-	if (limit > LIMIT)
-		limit = LIMIT;
-	else if (limit < -LIMIT)
-		limit = -LIMIT;
-	disc = up->disc[up->discptr] * -limit;
-	up->disc[up->discptr] = limit;
-	up->discptr = (up->discptr + 1 ) % LAG;
-	if (disc >= 0)
-		disc = SQRT(disc);
-	else
-		disc = -SQRT(-disc);
+	for (j = 0; j < LAG; j++)
+		limit[j] = up->disc[(up->discptr + j) % LAG];
+	for (i = 0; i < len; i++) {
+		dtemp = signal[i] > LIMIT ? LIMIT : signal[i];
+		limit[i + LAG] = dtemp < -LIMIT ? -LIMIT : dtemp;
+	}
+	for (i = 0; i < len; i++) {
+		disc = limit[i] * -limit[i + LAG];
+		if (disc >= 0)
+			disc = SQRT(disc);
+		else
+			disc = -SQRT(-disc);
+		fir[i + 26] = disc * 2.538771e-02;
+	}
+	for (j = 0; j < LAG; j++)
+		up->disc[j] = limit[len + j];
+	up->discptr = 0;
 
 	/*
 	 * Lowpass filter. Raised cosine FIR, Ts = 1 / 300, beta = 0.1.
 	 */
-	lpf = (up->lpf[26] = up->lpf[25]) * 2.538771e-02;
-	lpf += (up->lpf[25] = up->lpf[24]) * 1.084671e-01;
-	lpf += (up->lpf[24] = up->lpf[23]) * 2.003159e-01;
-	lpf += (up->lpf[23] = up->lpf[22]) * 2.985303e-01;
-	lpf += (up->lpf[22] = up->lpf[21]) * 4.003697e-01;
-	lpf += (up->lpf[21] = up->lpf[20]) * 5.028552e-01;
-	lpf += (up->lpf[20] = up->lpf[19]) * 6.028795e-01;
-	lpf += (up->lpf[19] = up->lpf[18]) * 6.973249e-01;
-	lpf += (up->lpf[18] = up->lpf[17]) * 7.831828e-01;
-	lpf += (up->lpf[17] = up->lpf[16]) * 8.576717e-01;
-	lpf += (up->lpf[16] = up->lpf[15]) * 9.183463e-01;
-	lpf += (up->lpf[15] = up->lpf[14]) * 9.631951e-01;
-	lpf += (up->lpf[14] = up->lpf[13]) * 9.907208e-01;
-	lpf += (up->lpf[13] = up->lpf[12]) * 1.000000e+00;
-	lpf += (up->lpf[12] = up->lpf[11]) * 9.907208e-01;
-	lpf += (up->lpf[11] = up->lpf[10]) * 9.631951e-01;
-	lpf += (up->lpf[10] = up->lpf[9]) * 9.183463e-01;
-	lpf += (up->lpf[9] = up->lpf[8]) * 8.576717e-01;
-	lpf += (up->lpf[8] = up->lpf[7]) * 7.831828e-01;
-	lpf += (up->lpf[7] = up->lpf[6]) * 6.973249e-01;
-	lpf += (up->lpf[6] = up->lpf[5]) * 6.028795e-01;
-	lpf += (up->lpf[5] = up->lpf[4]) * 5.028552e-01;
-	lpf += (up->lpf[4] = up->lpf[3]) * 4.003697e-01;
-	lpf += (up->lpf[3] = up->lpf[2]) * 2.985303e-01;
-	lpf += (up->lpf[2] = up->lpf[1]) * 2.003159e-01;
-	lpf += (up->lpf[1] = up->lpf[0]) * 1.084671e-01;
-	lpf += up->lpf[0] = disc * 2.538771e-02;
+	for (j = 0; j < 26; j++)
+		fir[j] = up->lpf[25 - j];
+	for (i = 0; i < len; i++)
+		lpf[i] = fir[i] * lpfcoef[0];
+	for (j = 1; j < 26; j++) {
+		for (i = 0; i < len; i++)
+			lpf[i] += fir[i + j] * lpfcoef[j];
+	}
+	for (i = 0; i < len; i++)
+		lpf[i] += fir[i + 26];
+	for (j = 0; j < 27; j++)
+		up->lpf[j] = fir[len + 25 - j];
+}
+
+
+/*
+ * chu_demod - decode the baseband signal
+ */
+static void
+chu_demod(
+	struct peer *peer,	/* peer structure pointer */
+	double	lpf		/* lowpass signal */
+	)
+{
+	struct refclockproc *pp;
+	struct chuunit *up;
+	struct surv *sp;
+
+	/*
+	 * Local variables
+	 */
+	double	dist;		/* UART signal distance */
+	int	i, j;
+
+	pp = peer->procptr;
+	up = pp->unitptr;
 
 	/*
 	 * Maximum-likelihood decoder. The UART updates each of the
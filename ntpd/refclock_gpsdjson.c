@@ -84,26 +84,9 @@
 #if defined(REFCLOCK) && defined(CLOCK_GPSDJSON) && !defined(SYS_WINNT)
 
 /* =====================================================================
- * Get the little JSMN library directly into our guts. Use the 'parent
- * link' feature for maximum speed.
+ * Get the record scanner directly into our guts.
  */
-#define JSMN_PARENT_LINKS
-#include "../libjsmn/jsmn.c"
-
-/* =====================================================================
- * JSON parsing stuff
- */
-
-#define JSMN_MAXTOK	350
-#define INVALID_TOKEN (-1)
-
-typedef struct json_ctx {
-	char        * buf;
-	int           ntok;
-	jsmntok_t     tok[JSMN_MAXTOK];
-} json_ctx;
-
-typedef int tok_ref;
+#include "gpsd_json.c"
 
 /* Not all targets have 'long long', and not all of them have 'strtoll'.
  * Sigh. We roll our own integer number parser.
@@ -1131,90 +1114,13 @@ strtojint(
 
 /* ------------------------------------------------------------------ */
 
-static tok_ref
-json_token_skip(
-	const json_ctx * ctx,
-	tok_ref          tid)
-{
-	if (tid >= 0 && (u_int)tid < ctx->ntok) {
-		int len = ctx->tok[tid].size;
-		/* For arrays and objects, the size is the number of
-		 * ITEMS in the compound. Thats the number of objects in
-		 * the array, and the number of key/value pairs for
-		 * objects. In theory, the key must be a string, and we
-		 * could simply skip one token before skipping the
-		 * value, which can be anything. We're a bit paranoid
-		 * and lazy at the same time: We simply double the
-		 * number of tokens to skip and fall through into the
-		 * array processing when encountering an object.
-		 */
-		switch (ctx->tok[tid].type) {
-		case JSMN_OBJECT:
-			len *= 2;
-			/* FALLTHROUGH */
-		case JSMN_ARRAY:
-			for (++tid; len; --len)
-				tid = json_token_skip(ctx, tid);
-			break;
-			
-		default:
-			++tid;
-			break;
-		}
-		/* The next condition should never be true, but paranoia
-		 * prevails...
-		 */
-		if (tid < 0 || (u_int)tid > ctx->ntok)
-			tid = ctx->ntok;
-	}
-	return tid;
-}
-
-/* ------------------------------------------------------------------ */
-
-static int
-json_object_lookup(
-	const json_ctx * ctx ,
-	tok_ref          tid ,
-	const char     * key ,
-	int              what)
-{
-	int len;
-
-	if (tid < 0 || tid >= ctx->ntok ||
-	    ctx->tok[tid].type != JSMN_OBJECT)
-		return INVALID_TOKEN;
-	
-	len = ctx->tok[tid].size;
-	for (++tid; len && tid+1 < ctx->ntok; --len) {
-		if (ctx->tok[tid].type != JSMN_STRING) { /* Blooper! */
-			tid = json_token_skip(ctx, tid); /* skip key */
-			tid = json_token_skip(ctx, tid); /* skip val */
-		} else if (strcmp(key, ctx->buf + ctx->tok[tid].start)) {
-			tid = json_token_skip(ctx, tid+1); /* skip key+val */
-		} else if (what < 0 || (u_int)what == ctx->tok[tid+1].type) {
-			return tid + 1;
-		} else {
-			break;
-		}
-		/* if skipping ahead returned an error, bail out here. */
-		if (tid < 0)
-			break;
-	}
-	return INVALID_TOKEN;
-}
-
-/* ------------------------------------------------------------------ */
-
 static const char*
 json_object_lookup_primitive(
 	const json_ctx * ctx,
-	tok_ref          tid,
-	const char     * key)
+	enum json_key    key)
 {
-	tid = json_object_lookup(ctx, tid, key, JSMN_PRIMITIVE);
-	if (INVALID_TOKEN  != tid)
-		return ctx->buf + ctx->tok[tid].start;
+	if (JSON_PRIMITIVE == ctx->typ[key])
+		return ctx->val[key];
 	else
 		return NULL;
 }
@@ -1225,11 +1131,10 @@ json_object_lookup_primitive(
 static int
 json_object_lookup_bool(
 	const json_ctx * ctx,
-	tok_ref          tid,
-	const char     * key)
+	enum json_key    key)
 {
 	const char *cp;
-	cp  = json_object_lookup_primitive(ctx, tid, key);
+	cp  = json_object_lookup_primitive(ctx, key);
 	switch ( cp ? *cp : '\0') {
 	case 't': return  1;
 	case 'f': return  0;
@@ -1242,25 +1147,21 @@ json_object_lookup_bool(
 static const char*
 json_object_lookup_string(
 	const json_ctx * ctx,
-	tok_ref          tid,
-	const char     * key)
+	enum json_key    key)
 {
-	tid = json_object_lookup(ctx, tid, key, JSMN_STRING);
-	if (INVALID_TOKEN != tid)
-		return ctx->buf + ctx->tok[tid].start;
+	if (JSON_STRING == ctx->typ[key])
+		return ctx->val[key];
 	return NULL;
 }
 
 static const char*
 json_object_lookup_string_default(
 	const json_ctx * ctx,
-	tok_ref          tid,
-	const char     * key,
+	enum json_key    key,
 	const char     * def)
 {
-	tid = json_object_lookup(ctx, tid, key, JSMN_STRING);
-	if (INVALID_TOKEN != tid)
-		return ctx->buf + ctx->tok[tid].start;
+	if (JSON_STRING == ctx->typ[key])
+		return ctx->val[key];
 	return def;
 }
 
@@ -1269,14 +1170,13 @@ json_object_lookup_string_default(
 static json_int
 json_object_lookup_int(
 	const json_ctx * ctx,
-	tok_ref          tid,
-	const char     * key)
+	enum json_key    key)
 {
 	json_int     ret;
 	const char * cp;
 	char       * ep;
 
-	cp = json_object_lookup_primitive(ctx, tid, key);
+	cp = json_object_lookup_primitive(ctx, key);
 	if (NULL != cp) {
 		ret = strtojint(cp, &ep);
 		if (cp != ep && '\0' == *ep)
@@ -1290,15 +1190,14 @@ json_object_lookup_int(
 static json_int
 json_object_lookup_int_default(
 	const json_ctx * ctx,
-	tok_ref          tid,
-	const char     * key,
+	enum json_key    key,
 	json_int         def)
 {
 	json_int     ret;
 	const char * cp;
 	char       * ep;
 
-	cp = json_object_lookup_primitive(ctx, tid, key);
+	cp = json_object_lookup_primitive(ctx, key);
 	if (NULL != cp) {
 		ret = strtojint(cp, &ep);
 		if (cp != ep && '\0' == *ep)
@@ -1312,14 +1211,13 @@ json_object_lookup_int_default(
 static double
 json_object_lookup_float(
 	const json_ctx * ctx,
-	tok_ref          tid,
-	const char     * key)
+	enum json_key    key)
 {
 	double       ret;
 	const char * cp;
 	char       * ep;
 
-	cp = json_object_lookup_primitive(ctx, tid, key);
+	cp = json_object_lookup_primitive(ctx, key);
 	if (NULL != cp) {
 		ret = strtod(cp, &ep);
 		if (cp != ep && '\0' == *ep)
@@ -1334,15 +1232,14 @@ json_object_lookup_float(
 static double
 json_object_lookup_float_default(
 	const json_ctx * ctx,
-	tok_ref          tid,
-	const char     * key,
+	enum json_key    key,
 	double           def)
 {
 	double       ret;
 	const char * cp;
 	char       * ep;
 
-	cp = json_object_lookup_primitive(ctx, tid, key);
+	cp = json_object_lookup_primitive(ctx, key);
 	if (NULL != cp) {
 		ret = strtod(cp, &ep);
 		if (cp != ep && '\0' == *ep)
@@ -1351,38 +1248,6 @@ json_object_lookup_float_default(
 	return def;
 }
 
-/* ------------------------------------------------------------------ */
-
-static BOOL
-json_parse_record(
-	json_ctx * ctx,
-	char     * buf,
-	size_t     len)
-{
-	jsmn_parser jsm;
-	int         idx, rc;
-
-	jsmn_init(&jsm);
-	rc = jsmn_parse(&jsm, buf, len, ctx->tok, JSMN_MAXTOK);
-	if (rc <= 0)
-		return FALSE;
-	ctx->buf  = buf;
-	ctx->ntok = rc;
-
-	if (JSMN_OBJECT != ctx->tok[0].type)
-		return FALSE; /* not object!?! */
-
-	/* Make all tokens NUL terminated by overwriting the
-	 * terminator symbol. Makes string compares and number parsing a
-	 * lot easier!
-	 */
-	for (idx = 0; idx < ctx->ntok; ++idx)
-		if (ctx->tok[idx].end > ctx->tok[idx].start)
-			ctx->buf[ctx->tok[idx].end] = '\0';
-	return TRUE;
-}
-
-
 /* =====================================================================
  * static local helpers
  */
@@ -1390,16 +1255,16 @@ static BOOL
 get_binary_time(
 	l_fp       * const dest     ,
 	json_ctx   * const jctx     ,
-	const char * const time_name,
-	const char * const frac_name,
+	enum json_key      time_key ,
+	enum json_key      frac_key ,
 	long               fscale   )
 {
 	BOOL            retv = FALSE;
 	struct timespec ts;
 
 	errno = 0;
-	ts.tv_sec  = (time_t)json_object_lookup_int(jctx, 0, time_name);
-	ts.tv_nsec = (long  )json_object_lookup_int(jctx, 0, frac_name);
+	ts.tv_sec  = (time_t)json_object_lookup_int(jctx, time_key);
+	ts.tv_nsec = (long  )json_object_lookup_int(jctx, frac_key);
 	if (0 == errno) {
 		ts.tv_nsec *= fscale;
 		*dest = tspec_stamp_to_lfp(ts);
@@ -1425,12 +1290,12 @@ process_watch(
 
 	const char * path;
 
-	path = json_object_lookup_string(jctx, 0, "device");
+	path = json_object_lookup_string(jctx, JK_DEVICE);
 	if (NULL == path || strcmp(path, up->device))
 		return;
 
-	if (json_object_lookup_bool(jctx, 0, "enable") > 0 &&
-	    json_object_lookup_bool(jctx, 0, "json"  ) > 0  )
+	if (json_object_lookup_bool(jctx, JK_ENABLE) > 0 &&
+	    json_object_lookup_bool(jctx, JK_JSON  ) > 0  )
 		up->fl_watch = -1;
 	else
 		up->fl_watch = 0;
@@ -1457,12 +1322,12 @@ process_version(
 
 	/* get protocol version number */
 	revision = json_object_lookup_string_default(
-		jctx, 0, "rev", "(unknown)");
+		jctx, JK_REV, "(unknown)");
 	release  = json_object_lookup_string_default(
-		jctx, 0, "release", "(unknown)");
+		jctx, JK_RELEASE, "(unknown)");
 	errno = 0;
-	pvhi = (uint16_t)json_object_lookup_int(jctx, 0, "proto_major");
-	pvlo = (uint16_t)json_object_lookup_int(jctx, 0, "proto_minor");
+	pvhi = (uint16_t)json_object_lookup_int(jctx, JK_PROTO_MAJOR);
+	pvlo = (uint16_t)json_object_lookup_int(jctx, JK_PROTO_MINOR);
 
 	if (0 == errno) {
 		if ( ! up->fl_vers)
@@ -1543,10 +1408,10 @@ process_tpv(
 	int          xlog2;
 
 	gps_mode = (int)json_object_lookup_int_default(
-		jctx, 0, "mode", 0);
+		jctx, JK_MODE, 0);
 
 	gps_time = json_object_lookup_string(
-		jctx, 0, "time");
+		jctx, JK_TIME);
 
 	/* accept time stamps only in 2d or 3d fix */
 	if (gps_mode < 2 || NULL == gps_time) {
@@ -1598,7 +1463,7 @@ process_tpv(
 	 * precision estimation, since it gets the proper value directly
 	 * from GPSD!)
 	 */
-	ept = json_object_lookup_float_default(jctx, 0, "ept", 2.0e-3);
+	ept = json_object_lookup_float_default(jctx, JK_EPT, 2.0e-3);
 	ept = frexp(fabs(ept)*0.70710678, &xlog2); /* ~ sqrt(0.5) */
 	if (ept < 0.25)
 		xlog2 = INT_MIN;
@@ -1635,17 +1500,17 @@ process_pps(
 	 */
 	if (up->pf_nsec) {
 		if ( ! get_binary_time(&up->pps_recvt2, jctx,
-				       "clock_sec", "clock_nsec", 1))
+				       JK_CLOCK_SEC, JK_CLOCK_NSEC, 1))
 			goto fail;
 		if ( ! get_binary_time(&up->pps_stamp2, jctx,
-				       "real_sec", "real_nsec", 1))
+				       JK_REAL_SEC, JK_REAL_NSEC, 1))
 			goto fail;
 	} else {
 		if ( ! get_binary_time(&up->pps_recvt2, jctx,
-				       "clock_sec", "clock_musec", 1000))
+				       JK_CLOCK_SEC, JK_CLOCK_MUSEC, 1000))
 			goto fail;
 		if ( ! get_binary_time(&up->pps_stamp2, jctx,
-				       "real_sec", "real_musec", 1000))
+				       JK_REAL_SEC, JK_REAL_MUSEC, 1000))
 			goto fail;
 	}
 
@@ -1653,7 +1518,7 @@ process_pps(
 	 * not there, take the precision from the serial data.
 	 */
 	xlog2 = json_object_lookup_int_default(
-			jctx, 0, "precision", up->sti_prec);
+			jctx, JK_PRECISION, up->sti_prec);
 	up->pps_prec = clamped_precision(xlog2);
 	
 	/* Get fudged receive times for primary & secondary unit */
@@ -1709,10 +1574,10 @@ process_toff(
 		return;
 
 	if ( ! get_binary_time(&up->sti_recvt, jctx,
-			       "clock_sec", "clock_nsec", 1))
+			       JK_CLOCK_SEC, JK_CLOCK_NSEC, 1))
 			goto fail;
 	if ( ! get_binary_time(&up->sti_stamp, jctx,
-			       "real_sec", "real_nsec", 1))
+			       JK_REAL_SEC, JK_REAL_NSEC, 1))
 			goto fail;
 	L_SUB(&up->sti_recvt, &up->sti_fudge);
 	up->sti_local = *rtime;
@@ -1748,16 +1613,21 @@ gpsd_parse(
                     up->logname, ulfptoa(rtime, 6),
 		    up->buflen, up->buffer));
 
-	/* See if we can grab anything potentially useful. JSMN does not
-	 * need a trailing NUL, but it needs the number of bytes to
-	 * process. */
-	if (!json_parse_record(&up->json_parse, up->buffer, up->buflen)) {
+	/* Drop records of classes we do not process before scanning
+	 * them; GPSD sends a lot of SKY data we never look at.
+	 */
+	if (!json_peek_class(up->buffer))
+		return;
+
+	/* See if we can grab anything potentially useful. The scanner
+	 * works in place and needs the trailing NUL in the buffer. */
+	if (!json_parse_record(&up->json_parse, up->buffer)) {
 		++up->tc_breply;
 		return;
 	}
 	
 	/* Now dispatch over the objects we know */
-	clsid = json_object_lookup_string(&up->json_parse, 0, "class");
+	clsid = json_object_lookup_string(&up->json_parse, JK_CLASS);
 	if (NULL == clsid) {
 		++up->tc_breply;
 		return;
@@ -414,9 +414,12 @@ irig_receive(
 	/*
 	 * Local variables
 	 */
-	double	sample;		/* codec sample */
+	double	sample[AUDIO_BUFSIZ]; /* codec samples */
+	double	dtemp;
 	u_char	*dpt;		/* buffer pointer */
 	int	bufcnt;		/* buffer counter */
+	int	blkcnt;		/* block counter */
+	int	i;
 	l_fp	ltemp;		/* l_fp temp */
 
 	peer = rbufp->recv_peer;
@@ -424,57 +427,65 @@ irig_receive(
 	up = pp->unitptr;
 
 	/*
-	 * Main loop - read until there ain't no more. Note codec
-	 * samples are bit-inverted.
+	 * Main loop - read until there ain't no more. The samples are
+	 * decompanded a block at a time. The rest runs sample by
+	 * sample, since the baseband PLL steers the logical clock from
+	 * within irig_rf(). Note codec samples are bit-inverted.
 	 */
+	audio_stamp(rbufp->fd, &rbufp->recv_time, rbufp->recv_length);
 	DTOLFP((double)rbufp->recv_length / SECOND, &ltemp);
 	L_SUB(&rbufp->recv_time, &ltemp);
 	up->timestamp = rbufp->recv_time;
 	dpt = rbufp->recv_buffer;
-	for (bufcnt = 0; bufcnt < rbufp->recv_length; bufcnt++) {
-		sample = up->comp[~*dpt++ & 0xff];
-
-		/*
-		 * Variable frequency oscillator. The codec oscillator
-		 * runs at the nominal rate of 8000 samples per second,
-		 * or 125 us per sample. A frequency change of one unit
-		 * results in either duplicating or deleting one sample
-		 * per second, which results in a frequency change of
-		 * 125 PPM.
-		 */
-		up->phase += (up->freq + clock_codec) / SECOND;
-		up->phase += pp->fudgetime2 / 1e6;
-		if (up->phase >= .5) {
-			up->phase -= 1.;
-		} else if (up->phase < -.5) {
-			up->phase += 1.;
-			irig_rf(peer, sample);
-			irig_rf(peer, sample);
-		} else {
-			irig_rf(peer, sample);
-		}
-		L_ADD(&up->timestamp, &up->tick);
-		sample = fabs(sample);
-		if (sample > up->signal)
-			up->signal = sample;
-		up->signal += (sample - up->signal) /
-		    1000;
+	for (bufcnt = 0; bufcnt < rbufp->recv_length; bufcnt += blkcnt) {
+		blkcnt = rbufp->recv_length - bufcnt;
+		if (blkcnt > AUDIO_BUFSIZ)
+			blkcnt = AUDIO_BUFSIZ;
+		audio_decompand(dpt + bufcnt, blkcnt, up->comp, 0, sample);
+		for (i = 0; i < blkcnt; i++) {
 
-		/*
-		 * Once each second, determine the IRIG format and gain.
-		 */
-		up->seccnt = (up->seccnt + 1) % SECOND;
-		if (up->seccnt == 0) {
-			if (up->irig_b > up->irig_e) {
-				up->decim = 1;
-				up->fdelay = IRIG_B;
+			/*
+			 * Variable frequency oscillator. The codec
+			 * oscillator runs at the nominal rate of 8000
+			 * samples per second, or 125 us per sample. A
+			 * frequency change of one unit results in
+			 * either duplicating or deleting one sample per
+			 * second, which results in a frequency change
+			 * of 125 PPM.
+			 */
+			up->phase += (up->freq + clock_codec) / SECOND;
+			up->phase += pp->fudgetime2 / 1e6;
+			if (up->phase >= .5) {
+				up->phase -= 1.;
+			} else if (up->phase < -.5) {
+				up->phase += 1.;
+				irig_rf(peer, sample[i]);
+				irig_rf(peer, sample[i]);
 			} else {
-				up->decim = 10;
-				up->fdelay = IRIG_E;
+				irig_rf(peer, sample[i]);
 			}
-			up->irig_b = up->irig_e = 0;
-			irig_gain(peer);
+			L_ADD(&up->timestamp, &up->tick);
+			dtemp = fabs(sample[i]);
+			if (dtemp > up->signal)
+				up->signal = dtemp;
+			up->signal += (dtemp - up->signal) / 1000;
 
+			/*
+			 * Once each second, determine the IRIG format
+			 * and gain.
+			 */
+			up->seccnt = (up->seccnt + 1) % SECOND;
+			if (up->seccnt == 0) {
+				if (up->irig_b > up->irig_e) {
+					up->decim = 1;
+					up->fdelay = IRIG_B;
+				} else {
+					up->decim = 10;
+					up->fdelay = IRIG_E;
+				}
+				up->irig_b = up->irig_e = 0;
+				irig_gain(peer);
+			}
 		}
 	}
 
@@ -869,6 +880,13 @@ irig_decode(
 			up->errflg |= IRIG_ERR_SYNCH;
 		up->frmcnt = 1;
 		up->refstamp = up->prvstamp;
+	} else if (up->frmcnt == 1) {
+
+		/*
+		 * No frame sync where it belongs, so the reference
+		 * timestamp is left over from an earlier second.
+		 */
+		up->errflg |= IRIG_ERR_SYNCH;
 	}
 	up->lastbit = bit;
 	if (up->frmcnt % SUBFLD == 0) {
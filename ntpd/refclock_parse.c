@@ -2381,7 +2381,7 @@ local_input(
 					buf->fd           = rbufp->fd;
 					buf->X_from_where = rbufp->X_from_where;
 					parse->generic->io.recvcount++;
-					packets_received++;
+					CTR_INC(CTR_PACKETS_RECEIVED);
 					add_full_recv_buffer(buf);
 #ifdef HAVE_IO_COMPLETION_PORT
 					SetEvent(WaitableIoEventHandle);
@@ -25,6 +25,7 @@
 #undef fileno
 #include "ntp_stdlib.h"
 #include "ntp_assert.h"
+#include "ntp_shm.h"
 
 #undef fileno
 #include <ctype.h>
@@ -59,6 +60,7 @@
  * Mode flags
  */
 #define SHM_MODE_PRIVATE 0x0001
+#define SHM_MODE_RING	 0x0002	/* map a struct shmRing segment */
 
 /*
  * Function prototypes
@@ -84,32 +86,12 @@ struct  refclock refclock_shm = {
 	shm_timer,              /* once per second */
 };
 
-struct shmTime {
-	int    mode; /* 0 - if valid is set:
-		      *       use values,
-		      *       clear valid
-		      * 1 - if valid is set:
-		      *       if count before and after read of values is equal,
-		      *         use values
-		      *       clear valid
-		      */
-	volatile int    count;
-	time_t		clockTimeStampSec;
-	int		clockTimeStampUSec;
-	time_t		receiveTimeStampSec;
-	int		receiveTimeStampUSec;
-	int		leap;
-	int		precision;
-	int		nsamples;
-	volatile int    valid;
-	unsigned	clockTimeStampNSec;	/* Unsigned ns timestamps */
-	unsigned	receiveTimeStampNSec;	/* Unsigned ns timestamps */
-	int		dummy[8];
-};
-
 struct shmunit {
 	struct shmTime *shm;	/* pointer to shared memory segment */
+	struct shmRing *ring;	/* same segment if it has a sample ring */
 	int forall;		/* access for all UIDs?	*/
+	unsigned next;		/* next ring sample to read */
+	int synced;		/* 'next' has been set from the ring */
 
 	/* debugging/monitoring counters - reset when printed */
 	int ticks;		/* number of attempts to read data*/
@@ -117,16 +99,24 @@ struct shmunit {
 	int notready;		/* number of peeks without data ready */
 	int bad;		/* number of invalid samples */
 	int clash;		/* number of access clashes while reading */
+	int lost;		/* ring samples overwritten before read */
 
 	time_t max_delta;	/* difference limit */
 	time_t max_delay;	/* age/stale limit */
 };
 
 
+/*
+ * getShmTime - attach to the segment of a unit, creating it with the
+ * given size if there is none.  '*segsz' is set to the size of the
+ * segment attached, which may be larger than asked for.
+ */
 static struct shmTime*
 getShmTime(
 	int unit,
-	int/*BOOL*/ forall
+	int/*BOOL*/ forall,
+	size_t size,
+	size_t *segsz
 	)
 {
 	struct shmTime *p = NULL;
@@ -134,12 +124,9 @@ getShmTime(
 #ifndef SYS_WINNT
 
 	int shmid;
+	struct shmid_ds ds;
 
-	/* 0x4e545030 is NTP0.
-	 * Big units will give non-ascii but that's OK
-	 * as long as everybody does it the same way.
-	 */
-	shmid=shmget(0x4e545030 + unit, sizeof (struct shmTime),
+	shmid=shmget(SHM_KEY_BASE + unit, size,
 		      IPC_CREAT | (forall ? 0666 : 0600));
 	if (shmid == -1) { /* error */
 		msyslog(LOG_ERR, "SHM shmget (unit %d): %m", unit);
@@ -150,6 +137,12 @@ getShmTime(
 		msyslog(LOG_ERR, "SHM shmat (unit %d): %m", unit);
 		return NULL;
 	}
+	if (shmctl(shmid, IPC_STAT, &ds) == -1) {
+		msyslog(LOG_ERR, "SHM shmctl (unit %d): %m", unit);
+		shmdt((void *)p);
+		return NULL;
+	}
+	*segsz = ds.shm_segsz;
 
 	return p;
 #else
@@ -183,7 +176,7 @@ getShmTime(
 		psec = &sa;
 	}
 	shmid = CreateFileMapping ((HANDLE)0xffffffff, psec, PAGE_READWRITE,
-				   0, sizeof (struct shmTime), buf);
+				   0, (DWORD)size, buf);
 	if (shmid == NULL) { /*error*/
 		char buf[1000];		
 		FormatMessage (FORMAT_MESSAGE_FROM_SYSTEM,
@@ -192,7 +185,7 @@ getShmTime(
 		return NULL;
 	}
 	p = (struct shmTime *)MapViewOfFile(shmid, FILE_MAP_WRITE, 0, 0,
-					    sizeof (struct shmTime));
+					    size);
 	if (p == NULL) { /*error*/
 		char buf[1000];		
 		FormatMessage (FORMAT_MESSAGE_FROM_SYSTEM,
@@ -200,6 +193,7 @@ getShmTime(
 		msyslog(LOG_ERR,"SHM MapViewOfFile (unit %d): %s", unit, buf);
 		return NULL;
 	}
+	*segsz = size;
 
 	return p;
 #endif
@@ -209,6 +203,47 @@ getShmTime(
 }
 
 
+/*
+ * shm_attach - attach to the segment of a unit, with the sample ring if
+ * asked for in the mode and the segment is large enough to hold it
+ */
+static void
+shm_attach(
+	int unit,
+	struct peer *peer,
+	struct shmunit *up
+	)
+{
+	size_t segsz;
+
+	up->shm = NULL;
+	up->ring = NULL;
+	segsz = 0;
+	if (peer->ttl & SHM_MODE_RING) {
+		/*
+		 * An existing classic segment is too small for the
+		 * ring; take it as it is.
+		 */
+		up->shm = getShmTime(unit, up->forall,
+				     sizeof(struct shmRing), &segsz);
+	}
+	if (NULL == up->shm)
+		up->shm = getShmTime(unit, up->forall,
+				     sizeof(struct shmTime), &segsz);
+	if (NULL == up->shm)
+		return;
+
+	up->synced = FALSE;
+	if (segsz >= sizeof(struct shmRing) && (peer->ttl & SHM_MODE_RING)) {
+		up->ring = (struct shmRing *)up->shm;
+		up->ring->nslots = SHM_RING_SLOTS;
+	} else if (peer->ttl & SHM_MODE_RING)
+		msyslog(LOG_NOTICE,
+			"SHM(%d): no sample ring, using single sample mode",
+			unit);
+}
+
+
 /*
  * shm_start - attach to shared memory
  */
@@ -228,7 +263,7 @@ shm_start(
 
 	up->forall = (unit >= 2) && !(peer->ttl & SHM_MODE_PRIVATE);
 
-	up->shm = getShmTime(unit, up->forall);
+	shm_attach(unit, peer, up);
 
 	/*
 	 * Initialize miscellaneous peer variables
@@ -378,6 +413,9 @@ static inline void memory_barrier(void)
 #endif /* HAVE_ATOMIC_THREAD_FENCE */
 }
 
+static void shm_drain_ring(struct peer *, volatile struct shmRing *);
+static void shm_feed(struct peer *, struct shm_stat_t *);
+
 static enum segstat_t shm_query(volatile struct shmTime *shm_in, struct shm_stat_t *shm_stat)
 /* try to grab a sample from the specified SHM segment */
 {
@@ -523,15 +561,6 @@ shm_timer(
 
 	volatile struct shmTime *shm;
 
-	l_fp tsrcv;
-	l_fp tsref;
-	int c;
-
-	/* for formatting 'a_lastcode': */
-	struct calendar cd;
-	time_t tt;
-	vint64 ts;
-
 	enum segstat_t status;
 	struct shm_stat_t shm_stat;
 
@@ -539,14 +568,21 @@ shm_timer(
 	if ((shm = up->shm) == NULL) {
 		/* try to map again - this may succeed if meanwhile some-
 		body has ipcrm'ed the old (unaccessible) shared mem segment */
-		shm = up->shm = getShmTime(unit, up->forall);
-		if (shm == NULL) {
+		shm_attach(unit, peer, up);
+		if ((shm = up->shm) == NULL) {
 			DPRINTF(1, ("%s: no SHM segment\n",
 				    refnumtoa(&peer->srcadr)));
 			return;
 		}
 	}
 
+	/* a producer filling the sample ring takes precedence */
+	if (up->ring != NULL && SHM_RING_MAGIC == up->ring->ring_magic &&
+	    SHM_RING_SLOTS == up->ring->nslots) {
+		shm_drain_ring(peer, up->ring);
+		return;
+	}
+
 	/* query the segment, atomically */
 	status = shm_query(shm, &shm_stat);
 
@@ -583,6 +619,103 @@ shm_timer(
 	    return;
 	}
 
+	shm_feed(peer, &shm_stat);
+}
+
+
+/*
+ * shm_drain_ring - feed all samples added to the ring since the last
+ *		    call to the median filter
+ */
+static void
+shm_drain_ring(
+	struct peer *peer,
+	volatile struct shmRing *ring
+	)
+{
+	struct refclockproc * const pp = peer->procptr;
+	struct shmunit *      const up = pp->unitptr;
+
+	volatile struct shmSample *slot;
+	struct shmSample sample;
+	struct shm_stat_t shm_stat;
+	unsigned head;
+	unsigned seq;
+	unsigned n;
+	time_t now;
+
+	head = ring->head;
+	memory_barrier();
+
+	/*
+	 * Whatever is in the ring on the first look may be left over
+	 * from an earlier run of the producer, so start with the next
+	 * sample.  After that anything older than one lap of the ring
+	 * has been overwritten.
+	 */
+	if (!up->synced) {
+		up->next = head;
+		up->synced = TRUE;
+	} else if (head - up->next > SHM_RING_SLOTS) {
+		up->lost += head - up->next - SHM_RING_SLOTS;
+		up->next = head - SHM_RING_SLOTS;
+	}
+	if (head == up->next) {
+		DPRINTF(1, ("%s: SHM ring empty\n",
+			    refnumtoa(&peer->srcadr)));
+		up->notready++;
+		return;
+	}
+
+	time(&now);
+	for (n = up->next; n != head; n++) {
+		slot = &ring->slot[n % SHM_RING_SLOTS];
+		seq = slot->seq;
+		memory_barrier();
+		memcpy(&sample, (void *)(uintptr_t)slot, sizeof(sample));
+		memory_barrier();
+		if (seq != 2 * n + 2 || slot->seq != seq) {
+			/* being written or already reused */
+			up->clash++;
+			continue;
+		}
+		ZERO(shm_stat);
+		shm_stat.status = OK;
+		shm_stat.mode = 2;
+		shm_stat.tvc.tv_sec = now;
+		shm_stat.tvt.tv_sec = sample.clockTimeStampSec;
+		shm_stat.tvt.tv_nsec = sample.clockTimeStampNSec;
+		shm_stat.tvr.tv_sec = sample.receiveTimeStampSec;
+		shm_stat.tvr.tv_nsec = sample.receiveTimeStampNSec;
+		shm_stat.leap = sample.leap;
+		shm_stat.precision = sample.precision;
+		shm_feed(peer, &shm_stat);
+	}
+	up->next = head;
+}
+
+
+/*
+ * shm_feed - check a sample and feed it to the median filter
+ */
+static void
+shm_feed(
+	struct peer *peer,
+	struct shm_stat_t *shm_stat_p
+	)
+{
+	struct refclockproc * const pp = peer->procptr;
+	struct shmunit *      const up = pp->unitptr;
+	struct shm_stat_t shm_stat = *shm_stat_p;
+
+	l_fp tsrcv;
+	l_fp tsref;
+	int c;
+
+	/* for formatting 'a_lastcode': */
+	struct calendar cd;
+	time_t tt;
+	vint64 ts;
 
 	/* format the last time code in human-readable form into
 	 * 'pp->a_lastcode'. Someone claimed: "NetBSD has incompatible
@@ -650,12 +783,19 @@ static void shm_clockstats(
 
 	UNUSED_ARG(unit);
 	if (pp->sloppyclockflag & CLK_FLAG4) {
-		mprintf_clock_stats(
-			&peer->srcadr, "%3d %3d %3d %3d %3d",
-			up->ticks, up->good, up->notready,
-			up->bad, up->clash);
+		if (up->ring != NULL)
+			mprintf_clock_stats(
+				&peer->srcadr, "%3d %3d %3d %3d %3d %3d",
+				up->ticks, up->good, up->notready,
+				up->bad, up->clash, up->lost);
+		else
+			mprintf_clock_stats(
+				&peer->srcadr, "%3d %3d %3d %3d %3d",
+				up->ticks, up->good, up->notready,
+				up->bad, up->clash);
 	}
 	up->ticks = up->good = up->notready = up->bad = up->clash = 0;
+	up->lost = 0;
 }
 
 #else
@@ -794,9 +794,11 @@ wwv_receive(
 	/*
 	 * Local variables
 	 */
-	double	sample;		/* codec sample */
+	double	sample[AUDIO_BUFSIZ]; /* codec samples */
 	u_char	*dpt;		/* buffer pointer */
 	int	bufcnt;		/* buffer counter */
+	int	blkcnt;		/* block counter */
+	int	i;
 	l_fp	ltemp;
 
 	peer = rbufp->recv_peer;
@@ -804,48 +806,57 @@ wwv_receive(
 	up = pp->unitptr;
 
 	/*
-	 * Main loop - read until there ain't no more. Note codec
-	 * samples are bit-inverted.
+	 * Main loop - read until there ain't no more. The samples are
+	 * decompanded a block at a time. The rest runs sample by
+	 * sample, since the logical clock and the AGC are steered from
+	 * within wwv_rf(). Note codec samples are bit-inverted.
 	 */
+	audio_stamp(rbufp->fd, &rbufp->recv_time, rbufp->recv_length);
 	DTOLFP((double)rbufp->recv_length / WWV_SEC, &ltemp);
 	L_SUB(&rbufp->recv_time, &ltemp);
 	up->timestamp = rbufp->recv_time;
 	dpt = rbufp->recv_buffer;
-	for (bufcnt = 0; bufcnt < rbufp->recv_length; bufcnt++) {
-		sample = up->comp[~*dpt++ & 0xff];
+	for (bufcnt = 0; bufcnt < rbufp->recv_length; bufcnt += blkcnt) {
+		blkcnt = rbufp->recv_length - bufcnt;
+		if (blkcnt > AUDIO_BUFSIZ)
+			blkcnt = AUDIO_BUFSIZ;
+		audio_decompand(dpt + bufcnt, blkcnt, up->comp, 0, sample);
+		for (i = 0; i < blkcnt; i++) {
 
-		/*
-		 * Clip noise spikes greater than MAXAMP (6000) and
-		 * record the number of clips to be used later by the
-		 * AGC.
-		 */
-		if (sample > MAXAMP) {
-			sample = MAXAMP;
-			up->clipcnt++;
-		} else if (sample < -MAXAMP) {
-			sample = -MAXAMP;
-			up->clipcnt++;
-		}
+			/*
+			 * Clip noise spikes greater than MAXAMP (6000)
+			 * and record the number of clips to be used
+			 * later by the AGC.
+			 */
+			if (sample[i] > MAXAMP) {
+				sample[i] = MAXAMP;
+				up->clipcnt++;
+			} else if (sample[i] < -MAXAMP) {
+				sample[i] = -MAXAMP;
+				up->clipcnt++;
+			}
 
-		/*
-		 * Variable frequency oscillator. The codec oscillator
-		 * runs at the nominal rate of 8000 samples per second,
-		 * or 125 us per sample. A frequency change of one unit
-		 * results in either duplicating or deleting one sample
-		 * per second, which results in a frequency change of
-		 * 125 PPM.
-		 */
-		up->phase += (up->freq + clock_codec) / WWV_SEC;
-		if (up->phase >= .5) {
-			up->phase -= 1.;
-		} else if (up->phase < -.5) {
-			up->phase += 1.;
-			wwv_rf(peer, sample);
-			wwv_rf(peer, sample);
-		} else {
-			wwv_rf(peer, sample);
+			/*
+			 * Variable frequency oscillator. The codec
+			 * oscillator runs at the nominal rate of 8000
+			 * samples per second, or 125 us per sample. A
+			 * frequency change of one unit results in
+			 * either duplicating or deleting one sample per
+			 * second, which results in a frequency change
+			 * of 125 PPM.
+			 */
+			up->phase += (up->freq + clock_codec) / WWV_SEC;
+			if (up->phase >= .5) {
+				up->phase -= 1.;
+			} else if (up->phase < -.5) {
+				up->phase += 1.;
+				wwv_rf(peer, sample[i]);
+				wwv_rf(peer, sample[i]);
+			} else {
+				wwv_rf(peer, sample[i]);
+			}
+			L_ADD(&up->timestamp, &up->tick);
 		}
-		L_ADD(&up->timestamp, &up->tick);
 	}
 
 	/*
@@ -102,8 +102,13 @@ extern int ntpq_get_assoc_clocktype(int assoc_index);
 extern int ntpq_read_assoc_peervars( associd_t associd, char *resultbuf, int maxsize );
 extern int ntpq_read_assoc_clockvars( associd_t associd, char *resultbuf, int maxsize );
 
+/* from ntpq.c */
+extern int nextvar(size_t *, const char **, char **, char **);
+
 /* in libntpq_subs.c */
 extern int ntpq_dogetassoc(void);
 extern char ntpq_decodeaddrtype(sockaddr_u *sock);
 extern int ntpq_doquerylist(struct ntpq_varlist *, int, associd_t, int,
 			    u_short *, size_t *, const char **datap);
+extern int ntpq_read_peers(struct ntpq_varlist *, associd_t, u_short *,
+			   size_t *, const char **);
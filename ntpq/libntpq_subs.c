@@ -50,3 +50,39 @@ ntpq_doquerylist(
 			   rstatus, dsize, datap);
 }
 
+
+/*
+ * ntpq_read_peers - one CTL_OP_READ_PEERS request for the variables in
+ * vlist of the associations from 'first' on.  The response has
+ * assid=, status= and the variables for each association, and ends
+ * with next= if it did not take them all.  Over UDP ntpd wants a
+ * nonce and answers with a single datagram.
+ */
+int
+ntpq_read_peers(
+	struct ntpq_varlist *vlist,
+	associd_t first,
+	u_short *rstatus,
+	size_t *dsize,
+	const char **datap
+	)
+{
+	char	nonce[128];
+	char	qdata[CTL_MAX_DATA_LEN];
+	size_t	qsize;
+	size_t	vsize;
+
+	if (!fetch_nonce(nonce, sizeof(nonce)))
+		return -1;
+	qsize = 0;
+	if (nonce[0] != '\0')
+		qsize = snprintf(qdata, sizeof(qdata), "nonce=%s,", nonce);
+	qsize += snprintf(qdata + qsize, sizeof(qdata) - qsize, "first=%u,",
+			  first);
+	vsize = sizeof(qdata) - qsize;
+	makequerydata((struct varlist *)vlist, &vsize, qdata + qsize);
+	qsize += vsize;
+
+	return doqueryex(CTL_OP_READ_PEERS, 0, FALSE, qsize, qdata,
+			 rstatus, dsize, datap, TRUE);
+}
@@ -68,7 +68,7 @@ extern FILE * option_usage_fp;
 /**
  *  static const strings for ntpq options
  */
-static char const ntpq_opt_strs[1925] =
+static char const ntpq_opt_strs[2013] =
 /*     0 */ "ntpq 4.2.8p6\n"
             "Copyright (C) 1992-2016 The University of Delaware and Network Time Foundation, all rights reserved.\n"
             "This is free software. It is licensed for use, modification and\n"
@@ -116,26 +116,32 @@ static char const ntpq_opt_strs[1925] =
 /*  1442 */ "Display the full 'remote' value\0"
 /*  1474 */ "WIDE\0"
 /*  1479 */ "wide\0"
-/*  1484 */ "display extended usage information and exit\0"
-/*  1528 */ "help\0"
-/*  1533 */ "extended usage information passed thru pager\0"
-/*  1578 */ "more-help\0"
-/*  1588 */ "output version information and exit\0"
-/*  1624 */ "version\0"
-/*  1632 */ "save the option state to a config file\0"
-/*  1671 */ "save-opts\0"
-/*  1681 */ "load options from a config file\0"
-/*  1713 */ "LOAD_OPTS\0"
-/*  1723 */ "no-load-opts\0"
-/*  1736 */ "no\0"
-/*  1739 */ "NTPQ\0"
-/*  1744 */ "ntpq - standard NTP query program - Ver. 4.2.8p6\n"
+/*  1484 */ "Query up to count hosts concurrently\0"
+/*  1521 */ "JOBS\0"
+/*  1526 */ "jobs\0"
+/*  1531 */ "Write per-host results as JSON\0"
+/*  1562 */ "JSON\0"
+/*  1567 */ "json\0"
+/*  1572 */ "display extended usage information and exit\0"
+/*  1616 */ "help\0"
+/*  1621 */ "extended usage information passed thru pager\0"
+/*  1666 */ "more-help\0"
+/*  1676 */ "output version information and exit\0"
+/*  1712 */ "version\0"
+/*  1720 */ "save the option state to a config file\0"
+/*  1759 */ "save-opts\0"
+/*  1769 */ "load options from a config file\0"
+/*  1801 */ "LOAD_OPTS\0"
+/*  1811 */ "no-load-opts\0"
+/*  1824 */ "no\0"
+/*  1827 */ "NTPQ\0"
+/*  1832 */ "ntpq - standard NTP query program - Ver. 4.2.8p6\n"
             "Usage:  %s [ -<flag> [<val>] | --<name>[{=| }<val>] ]... [ host ...]\n\0"
-/*  1863 */ "$HOME\0"
-/*  1869 */ ".\0"
-/*  1871 */ ".ntprc\0"
-/*  1878 */ "http://bugs.ntp.org, bugs@ntp.org\0"
-/*  1912 */ "ntpq 4.2.8p6";
+/*  1951 */ "$HOME\0"
+/*  1957 */ ".\0"
+/*  1959 */ ".ntprc\0"
+/*  1966 */ "http://bugs.ntp.org, bugs@ntp.org\0"
+/*  2000 */ "ntpq 4.2.8p6";
 
 /**
  *  ipv4 option description with
@@ -220,7 +226,9 @@ static int const aIpv6CantList[] = {
 /** Other options that appear in conjunction with the interactive option */
 static int const aInteractiveCantList[] = {
     INDEX_OPT_COMMAND,
-    INDEX_OPT_PEERS, NO_EQUIVALENT };
+    INDEX_OPT_PEERS,
+    INDEX_OPT_JOBS,
+    INDEX_OPT_JSON, NO_EQUIVALENT };
 /** Compiled in flag settings for the interactive option */
 #define INTERACTIVE_FLAGS     (OPTST_DISABLED)
 
@@ -276,14 +284,47 @@ static int const aPeersCantList[] = {
 /** Compiled in flag settings for the wide option */
 #define WIDE_FLAGS     (OPTST_DISABLED)
 
+/**
+ *  jobs option description with
+ *  "Must also have options" and "Incompatible options":
+ */
+/** Descriptive text for the jobs option */
+#define JOBS_DESC      (ntpq_opt_strs+1484)
+/** Upper-cased name for the jobs option */
+#define JOBS_NAME      (ntpq_opt_strs+1521)
+/** Name string for the jobs option */
+#define JOBS_name      (ntpq_opt_strs+1526)
+/** Other options that appear in conjunction with the jobs option */
+static int const aJobsCantList[] = {
+    INDEX_OPT_INTERACTIVE, NO_EQUIVALENT };
+/** Compiled in flag settings for the jobs option */
+#define JOBS_FLAGS     (OPTST_DISABLED \
+        | OPTST_SET_ARGTYPE(OPARG_TYPE_NUMERIC))
+
+/**
+ *  json option description with
+ *  "Must also have options" and "Incompatible options":
+ */
+/** Descriptive text for the json option */
+#define JSON_DESC      (ntpq_opt_strs+1531)
+/** Upper-cased name for the json option */
+#define JSON_NAME      (ntpq_opt_strs+1562)
+/** Name string for the json option */
+#define JSON_name      (ntpq_opt_strs+1567)
+/** Other options that appear in conjunction with the json option */
+static int const aJsonCantList[] = {
+    INDEX_OPT_INTERACTIVE, NO_EQUIVALENT };
+/** Compiled in flag settings for the json option */
+#define JSON_FLAGS     (OPTST_DISABLED)
+
 /*
  *  Help/More_Help/Version option descriptions:
  */
-#define HELP_DESC       (ntpq_opt_strs+1484)
-#define HELP_name       (ntpq_opt_strs+1528)
+#define HELP_DESC       (ntpq_opt_strs+1572)
+#define HELP_name       (ntpq_opt_strs+1616)
 #ifdef HAVE_WORKING_FORK
-#define MORE_HELP_DESC  (ntpq_opt_strs+1533)
-#define MORE_HELP_name  (ntpq_opt_strs+1578)
+#define MORE_HELP_DESC  (ntpq_opt_strs+1621)
+#define MORE_HELP_name  (ntpq_opt_strs+1666)
 #define MORE_HELP_FLAGS (OPTST_IMM | OPTST_NO_INIT)
 #else
 #define MORE_HELP_DESC  HELP_DESC
@@ -296,14 +337,14 @@ static int const aPeersCantList[] = {
 #  define VER_FLAGS     (OPTST_SET_ARGTYPE(OPARG_TYPE_STRING) | \
                          OPTST_ARG_OPTIONAL | OPTST_IMM | OPTST_NO_INIT)
 #endif
-#define VER_DESC        (ntpq_opt_strs+1588)
-#define VER_name        (ntpq_opt_strs+1624)
-#define SAVE_OPTS_DESC  (ntpq_opt_strs+1632)
-#define SAVE_OPTS_name  (ntpq_opt_strs+1671)
-#define LOAD_OPTS_DESC     (ntpq_opt_strs+1681)
-#define LOAD_OPTS_NAME     (ntpq_opt_strs+1713)
-#define NO_LOAD_OPTS_name  (ntpq_opt_strs+1723)
-#define LOAD_OPTS_pfx      (ntpq_opt_strs+1736)
+#define VER_DESC        (ntpq_opt_strs+1676)
+#define VER_name        (ntpq_opt_strs+1712)
+#define SAVE_OPTS_DESC  (ntpq_opt_strs+1720)
+#define SAVE_OPTS_name  (ntpq_opt_strs+1759)
+#define LOAD_OPTS_DESC     (ntpq_opt_strs+1769)
+#define LOAD_OPTS_NAME     (ntpq_opt_strs+1801)
+#define NO_LOAD_OPTS_name  (ntpq_opt_strs+1811)
+#define LOAD_OPTS_pfx      (ntpq_opt_strs+1824)
 #define LOAD_OPTS_name     (NO_LOAD_OPTS_name + 3)
 /**
  *  Declare option callback procedures
@@ -444,6 +485,30 @@ static tOptDesc optDesc[OPTION_CT] = {
      /* desc, NAME, name */ WIDE_DESC, WIDE_NAME, WIDE_name,
      /* disablement strs */ NULL, NULL },
 
+  {  /* entry idx, value */ 10, VALUE_OPT_JOBS,
+     /* equiv idx, value */ 10, VALUE_OPT_JOBS,
+     /* equivalenced to  */ NO_EQUIVALENT,
+     /* min, max, act ct */ 0, 1, 0,
+     /* opt state flags  */ JOBS_FLAGS, 0,
+     /* last opt argumnt */ { NULL }, /* --jobs */
+     /* arg list/cookie  */ NULL,
+     /* must/cannot opts */ NULL, aJobsCantList,
+     /* option proc      */ optionNumericVal,
+     /* desc, NAME, name */ JOBS_DESC, JOBS_NAME, JOBS_name,
+     /* disablement strs */ NULL, NULL },
+
+  {  /* entry idx, value */ 11, VALUE_OPT_JSON,
+     /* equiv idx, value */ 11, VALUE_OPT_JSON,
+     /* equivalenced to  */ NO_EQUIVALENT,
+     /* min, max, act ct */ 0, 1, 0,
+     /* opt state flags  */ JSON_FLAGS, 0,
+     /* last opt argumnt */ { NULL }, /* --json */
+     /* arg list/cookie  */ NULL,
+     /* must/cannot opts */ NULL, aJsonCantList,
+     /* option proc      */ NULL,
+     /* desc, NAME, name */ JSON_DESC, JSON_NAME, JSON_name,
+     /* disablement strs */ NULL, NULL },
+
   {  /* entry idx, value */ INDEX_OPT_VERSION, VALUE_OPT_VERSION,
      /* equiv idx value  */ NO_EQUIVALENT, VALUE_OPT_VERSION,
      /* equivalenced to  */ NO_EQUIVALENT,
@@ -512,24 +577,24 @@ static tOptDesc optDesc[OPTION_CT] = {
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /** Reference to the upper cased version of ntpq. */
-#define zPROGNAME       (ntpq_opt_strs+1739)
+#define zPROGNAME       (ntpq_opt_strs+1827)
 /** Reference to the title line for ntpq usage. */
-#define zUsageTitle     (ntpq_opt_strs+1744)
+#define zUsageTitle     (ntpq_opt_strs+1832)
 /** ntpq configuration file name. */
-#define zRcName         (ntpq_opt_strs+1871)
+#define zRcName         (ntpq_opt_strs+1959)
 /** Directories to search for ntpq config files. */
 static char const * const apzHomeList[3] = {
-    ntpq_opt_strs+1863,
-    ntpq_opt_strs+1869,
+    ntpq_opt_strs+1951,
+    ntpq_opt_strs+1957,
     NULL };
 /** The ntpq program bug email address. */
-#define zBugsAddr       (ntpq_opt_strs+1878)
+#define zBugsAddr       (ntpq_opt_strs+1966)
 /** Clarification/explanation of what ntpq does. */
 #define zExplain        (NULL)
 /** Extra detail explaining what ntpq does. */
 #define zDetail         (NULL)
 /** The full version string for ntpq. */
-#define zFullVersion    (ntpq_opt_strs+1912)
+#define zFullVersion    (ntpq_opt_strs+2000)
 /* extracted from optcode.tlib near line 364 */
 
 #if defined(ENABLE_NLS)
@@ -651,7 +716,7 @@ tOptions ntpqOptions = {
       NO_EQUIVALENT, /* '-#' option index */
       NO_EQUIVALENT /* index of default opt */
     },
-    15 /* full option count */, 10 /* user option count */,
+    17 /* full option count */, 12 /* user option count */,
     ntpq_full_usage, ntpq_short_usage,
     NULL, NULL,
     PKGDATADIR, ntpq_packager_info
@@ -836,6 +901,12 @@ implied warranty.\n"));
   /* referenced via ntpqOptions.pOptDesc->pzText */
   puts(_("Display the full 'remote' value"));
 
+  /* referenced via ntpqOptions.pOptDesc->pzText */
+  puts(_("Query up to count hosts concurrently"));
+
+  /* referenced via ntpqOptions.pOptDesc->pzText */
+  puts(_("Write per-host results as JSON"));
+
   /* referenced via ntpqOptions.pOptDesc->pzText */
   puts(_("display extended usage information and exit"));
 
@@ -74,14 +74,16 @@ typedef enum {
     INDEX_OPT_OLD_RV           =  7,
     INDEX_OPT_PEERS            =  8,
     INDEX_OPT_WIDE             =  9,
-    INDEX_OPT_VERSION          = 10,
-    INDEX_OPT_HELP             = 11,
-    INDEX_OPT_MORE_HELP        = 12,
-    INDEX_OPT_SAVE_OPTS        = 13,
-    INDEX_OPT_LOAD_OPTS        = 14
+    INDEX_OPT_JOBS             = 10,
+    INDEX_OPT_JSON             = 11,
+    INDEX_OPT_VERSION          = 12,
+    INDEX_OPT_HELP             = 13,
+    INDEX_OPT_MORE_HELP        = 14,
+    INDEX_OPT_SAVE_OPTS        = 15,
+    INDEX_OPT_LOAD_OPTS        = 16
 } teOptIndex;
 /** count of all options for ntpq */
-#define OPTION_CT    15
+#define OPTION_CT    17
 /** ntpq version */
 #define NTPQ_VERSION       "4.2.8p6"
 /** Full ntpq version text */
@@ -178,6 +180,14 @@ typedef enum {
 #  warning undefining WIDE due to option name conflict
 #  undef   WIDE
 # endif
+# ifdef    JOBS
+#  warning undefining JOBS due to option name conflict
+#  undef   JOBS
+# endif
+# ifdef    JSON
+#  warning undefining JSON due to option name conflict
+#  undef   JSON
+# endif
 #else  /* NO_OPTION_NAME_WARNINGS */
 # undef IPV4
 # undef IPV6
@@ -189,6 +199,8 @@ typedef enum {
 # undef OLD_RV
 # undef PEERS
 # undef WIDE
+# undef JOBS
+# undef JSON
 #endif  /*  NO_OPTION_NAME_WARNINGS */
 
 /**
@@ -207,12 +219,16 @@ typedef enum {
 #define VALUE_OPT_OLD_RV         0x1001
 #define VALUE_OPT_PEERS          'p'
 #define VALUE_OPT_WIDE           'w'
+#define VALUE_OPT_JOBS           'j'
+
+#define OPT_VALUE_JOBS           (DESC(JOBS).optArg.argInt)
+#define VALUE_OPT_JSON           0x1002
 /** option flag (value) for help-value option */
 #define VALUE_OPT_HELP          '?'
 /** option flag (value) for more-help-value option */
 #define VALUE_OPT_MORE_HELP     '!'
 /** option flag (value) for version-value option */
-#define VALUE_OPT_VERSION       0x1002
+#define VALUE_OPT_VERSION       0x1003
 /** option flag (value) for save-opts-value option */
 #define VALUE_OPT_SAVE_OPTS     '>'
 /** option flag (value) for load-opts-value option */
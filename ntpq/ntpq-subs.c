@@ -58,6 +58,8 @@ static	long	when		(l_fp *, l_fp *, l_fp *);
 static	char *	prettyinterval	(char *, size_t, long);
 static	int	doprintpeers	(struct varlist *, int, int, size_t, const char *, FILE *, int);
 static	int	dogetpeers	(struct varlist *, associd_t, FILE *, int);
+static	void	resolve_peer_names	(size_t, const char *);
+static	int	dogetallpeers	(struct varlist *, int, FILE *, int);
 static	void	dopeers 	(int, FILE *, int);
 static	void	peers		(struct parse *, FILE *);
 static	void	doapeers 	(int, FILE *, int);
@@ -68,6 +70,7 @@ static	void	opeers		(struct parse *, FILE *);
 static	void	lopeers 	(struct parse *, FILE *);
 static	void	config		(struct parse *, FILE *);
 static	void	saveconfig	(struct parse *, FILE *);
+static	void	trace		(struct parse *, FILE *);
 static	void	config_from_file(struct parse *, FILE *);
 static	void	mrulist		(struct parse *, FILE *);
 static	void	ifstats		(struct parse *, FILE *);
@@ -78,6 +81,7 @@ static	void	kerninfo	(struct parse *, FILE *);
 static	void	monstats	(struct parse *, FILE *);
 static	void	iostats		(struct parse *, FILE *);
 static	void	timerstats	(struct parse *, FILE *);
+static	void	memstats	(struct parse *, FILE *);
 
 /*
  * Commands we understand.	Ntpdc imports this.
@@ -206,6 +210,12 @@ struct xcmd opcmds[] = {
 	{ "timerstats", timerstats, { NO, NO, NO, NO },
 	  { "", "", "", "" },
 	  "display interval timer counters" },
+	{ "memstats", memstats, { NO, NO, NO, NO },
+	  { "", "", "", "" },
+	  "display ntpd heap use by subsystem" },
+	{ "trace", trace, { OPT|NTP_STR, NO, NO, NO },
+	  { "start[=records]|stop|dump", "", "", "" },
+	  "control ntpd's packet trace, dump writes it to a file in statsdir" },
 	{ 0,		0,		{ NO, NO, NO, NO },
 	  { "-4|-6", "", "", "" }, "" }
 };
@@ -1400,6 +1410,35 @@ saveconfig(
 }
 
 
+/*
+ *  trace - start, stop or dump the server's packet trace
+ */
+static void
+trace(
+	struct parse *pcmd,
+	FILE *fp
+	)
+{
+	const char *arg;
+	const char *datap;
+	int res;
+	size_t dsize;
+	u_short rstatus;
+
+	arg = (pcmd->nargs > 0) ? pcmd->argval[0].string : "";
+	res = doquery(CTL_OP_TRACE, 0, 1, strlen(arg), arg, &rstatus,
+		      &dsize, &datap);
+
+	if (res != 0)
+		return;
+
+	if (0 == dsize)
+		fprintf(fp, "(no response message, curiously)\n");
+	else
+		fprintf(fp, "%.*s", (int)dsize, datap);
+}
+
+
 #ifdef	UNUSED
 /*
  * radiostatus - print the radio status returned by the server
@@ -1912,6 +1951,202 @@ dogetpeers(
 }
 
 
+/*
+ * resolve_peer_names - look up the names of the srcadr and dstadr
+ *			addresses in a CTL_OP_READ_PEERS response in one
+ *			go before the rows are printed.
+ */
+static void
+resolve_peer_names(
+	size_t		dsize,
+	const char *	datap
+	)
+{
+	sockaddr_u *	addrs;
+	size_t		count;
+	size_t		slots;
+	char *		tag;
+	char *		val;
+
+	addrs = NULL;
+	count = 0;
+	slots = 0;
+	while (nextvar(&dsize, &datap, &tag, &val)) {
+		if (NULL == val ||
+		    (strcmp("srcadr", tag) && strcmp("dstadr", tag)))
+			continue;
+		if (count == slots) {
+			slots += 64;
+			addrs = erealloc(addrs, slots * sizeof(*addrs));
+		}
+		if (decodenetnum(val, &addrs[count]))
+			count++;
+	}
+	resolve_names(addrs, count);
+	free(addrs);
+}
+
+/*
+ * dogetallpeers - read and print the spreadsheet peer variables of all
+ *		   associations with as few CTL_OP_READ_PEERS queries as
+ *		   the server's datagram limit allows.  Over UDP the
+ *		   server wants a nonce for more than one datagram per
+ *		   query, unless it is authenticated.  Returns FALSE
+ *		   without printing anything if the server doesn't
+ *		   support that opcode, so the caller can fall back to
+ *		   one readvar per association.
+ */
+static int
+dogetallpeers(
+	struct varlist *pvl,
+	int showall,
+	FILE *fp,
+	int af
+	)
+{
+	static char	nobulk_host[LENHOSTNAME];
+	static char	dstadr_name[] = "dstadr";
+	const char	frags_fmt[] =	"frags=%u,first=%lu";
+	char		nonce[128];
+	char		qdata[CTL_MAX_DATA_LEN];
+	struct varlist	qvl[MAXLIST];
+	struct varlist *vl;
+	struct varlist *qv;
+	size_t		qsize;
+	size_t		vsize;
+	const char *	datap;
+	const char *	pos;
+	const char *	blk;
+	size_t		dsize;
+	u_short		rstatus;
+	char *		tag;
+	char *		val;
+	u_long		first;
+	u_long		next;
+	u_long		assid;
+	u_long		nassid;
+	u_long		status;
+	u_int		nonce_uses;
+	int		qres;
+	int		rows;
+
+	if (!strcmp(nobulk_host, currenthost))
+		return FALSE;
+
+	/*
+	 * assid is how the response separates associations, it is
+	 * not a server variable.
+	 */
+	ZERO(qvl);
+	qv = qvl;
+	for (vl = pvl; vl->name != NULL; vl++)
+		if (strcmp("assid", vl->name))
+			*qv++ = *vl;
+	/*
+	 * With several hosts doprintpeers() labels each row with the
+	 * local address, which the readvar fallback gets for free.
+	 */
+	if (numhosts > 1) {
+		qv = findlistvar(qvl, dstadr_name);
+		if (qv != NULL && NULL == qv->name)
+			qv->name = dstadr_name;
+	}
+
+	rows = 0;
+	first = 0;
+	nonce_uses = 0;
+	do {
+		if (0 == nonce_uses % 4 &&
+		    !fetch_nonce(nonce, sizeof(nonce)))
+			return (rows > 0);
+		nonce_uses++;
+		qsize = 0;
+		if (nonce[0] != '\0')
+			qsize = snprintf(qdata, sizeof(qdata), "nonce=%s,",
+					 nonce);
+		qsize += snprintf(qdata + qsize, sizeof(qdata) - qsize,
+				  frags_fmt, READ_PEERS_FRAGS_LIMIT, first);
+		qdata[qsize++] = ',';
+		vsize = sizeof(qdata) - qsize;
+		makequerydata(qvl, &vsize, qdata + qsize);
+		qsize += vsize;
+		qres = doqueryex(CTL_OP_READ_PEERS, 0, FALSE, qsize,
+				 qdata, &rstatus, &dsize, &datap, TRUE);
+		if (CERR_BADOP == qres && 0 == rows) {
+			if (debug)
+				fprintf(stderr,
+					"%s lacks CTL_OP_READ_PEERS\n",
+					currenthost);
+			strlcpy(nobulk_host, currenthost,
+				sizeof(nobulk_host));
+			return FALSE;
+		}
+		if (qres) {
+			show_error_msg(qres, 0);
+			return TRUE;
+		}
+		if (showhostnames)
+			resolve_peer_names(dsize, datap);
+
+		/*
+		 * Each association is assid=, status=, then its
+		 * variables up to the next assid= or the end.  Hand
+		 * the variables to doprintpeers() as if they came from
+		 * a readvar for that association.
+		 */
+		next = 0;
+		assid = 0;
+		nassid = 0;
+		status = 0;
+		blk = NULL;
+		pos = datap;
+		while (nextvar(&dsize, &datap, &tag, &val)) {
+			/* doprintpeers() reuses nextvar()'s buffers */
+			if (!strcmp("next", tag)) {
+				decodeuint(val, &next);
+				tag = NULL;
+			} else if (!strcmp("assid", tag)) {
+				decodeuint(val, &nassid);
+				tag = NULL;
+			}
+			if (NULL == tag) {
+				if (blk != NULL) {
+					if (showall ||
+					    (CTL_PEER_STATVAL(status) &
+					     (CTL_PST_CONFIG | CTL_PST_REACH)))
+						doprintpeers(pvl, (int)assid,
+							     (int)status,
+							     (size_t)(pos - blk),
+							     blk, fp, af);
+					rows++;
+					blk = NULL;
+				}
+				assid = nassid;
+			} else if (!strcmp("status", tag)) {
+				if (1 != sscanf(val, "0x%lx", &status))
+					status = 0;
+				blk = datap;
+			}
+			pos = datap;
+		}
+		if (blk != NULL) {
+			if (showall ||
+			    (CTL_PEER_STATVAL(status) &
+			     (CTL_PST_CONFIG | CTL_PST_REACH)))
+				doprintpeers(pvl, (int)assid, (int)status,
+					     (size_t)(datap - blk), blk, fp,
+					     af);
+			rows++;
+		}
+		if (next <= first)
+			break;
+		first = next;
+	} while (TRUE);
+
+	return TRUE;
+}
+
+
 /*
  * peers - print a peer spreadsheet
  */
@@ -1932,7 +2167,12 @@ dopeers(
 		return;
 
 	for (u = 0; u < numhosts; u++) {
-		if (getnetnum(chosts[u].name, &netnum, fullname, af)) {
+		if ('/' == chosts[u].name[0]) {
+			/* a control socket, see openhost() */
+			sl = strlen(chosts[u].name);
+			maxhostlen = max(maxhostlen, sl);
+		} else if (getnetnum(chosts[u].name, &netnum, fullname,
+				     af)) {
 			name_or_num = nntohost(&netnum);
 			sl = strlen(name_or_num);
 			maxhostlen = max(maxhostlen, sl);
@@ -1949,6 +2189,9 @@ dopeers(
 	fprintf(fp,
 		"==============================================================================\n");
 
+	if (dogetallpeers(peervarlist, showall, fp, af))
+		return;
+
 	for (u = 0; u < numassoc; u++) {
 		if (!showall &&
 		    !(CTL_PEER_STATVAL(assoc_cache[u].status)
@@ -1986,7 +2229,12 @@ doapeers(
 		return;
 
 	for (u = 0; u < numhosts; u++) {
-		if (getnetnum(chosts[u].name, &netnum, fullname, af)) {
+		if ('/' == chosts[u].name[0]) {
+			/* a control socket, see openhost() */
+			sl = strlen(chosts[u].name);
+			maxhostlen = max(maxhostlen, sl);
+		} else if (getnetnum(chosts[u].name, &netnum, fullname,
+				     af)) {
 			name_or_num = nntohost(&netnum);
 			sl = strlen(name_or_num);
 			maxhostlen = max(maxhostlen, sl);
@@ -2003,6 +2251,9 @@ doapeers(
 	fprintf(fp,
 		"==============================================================================\n");
 
+	if (dogetallpeers(apeervarlist, showall, fp, af))
+		return;
+
 	for (u = 0; u < numassoc; u++) {
 		if (!showall &&
 		    !(CTL_PEER_STATVAL(assoc_cache[u].status)
@@ -2104,7 +2355,11 @@ doopeers(
 		return;
 
 	for (i = 0; i < numhosts; ++i) {
-		if (getnetnum(chosts[i].name, &netnum, fullname, af))
+		if ('/' == chosts[i].name[0]) {
+			/* a control socket, see openhost() */
+			if (strlen(chosts[i].name) > maxhostlen)
+				maxhostlen = strlen(chosts[i].name);
+		} else if (getnetnum(chosts[i].name, &netnum, fullname, af))
 			if (strlen(fullname) > maxhostlen)
 				maxhostlen = strlen(fullname);
 	}
@@ -2119,6 +2374,9 @@ doopeers(
 	fprintf(fp,
 	    "==============================================================================\n");
 
+	if (dogetallpeers(opeervarlist, showall, fp, af))
+		return;
+
 	for (i = 0; i < numassoc; i++) {
 		if (!showall &&
 		    !(CTL_PEER_STATVAL(assoc_cache[i].status) &
@@ -2324,6 +2582,17 @@ fetch_nonce(
 	const char *	rdata;
 	size_t		chars;
 
+	/*
+	 * The control socket cannot be forged from afar, and ntpd
+	 * ignores the nonce there.
+	 */
+	if (havectlsock) {
+		if (cb_nonce < 1)
+			return FALSE;
+		nonce[0] = '\0';
+		return TRUE;
+	}
+
 	/*
 	 * Retrieve a nonce specific to this client to demonstrate to
 	 * ntpd that we're capable of receiving responses to our source
@@ -3067,6 +3336,7 @@ mrulist(
 	const char *arg;
 	size_t cb;
 	mru **sorted;
+	sockaddr_u *addrs;
 	mru **ppentry;
 	mru *recent;
 	l_fp now;
@@ -3173,6 +3443,14 @@ mrulist(
 		qsort(sorted, mru_count, sizeof(sorted[0]),
 		      mru_qcmp_table[order]);
 
+	if (showhostnames) {
+		addrs = emalloc(mru_count * sizeof(*addrs));
+		for (ppentry = sorted; ppentry < sorted + mru_count; ppentry++)
+			addrs[ppentry - sorted] = (*ppentry)->addr;
+		resolve_names(addrs, mru_count);
+		free(addrs);
+	}
+
 	mrulist_interrupted = FALSE;
 	printf(	"lstint avgint rstr r m v  count rport remote address\n"
 		"==============================================================================\n");
@@ -3819,6 +4097,7 @@ sysstats(
 	VDC_INIT("ss_limited",		"rate limited:         ", NTP_STR),
 	VDC_INIT("ss_kodsent",		"KoD responses:        ", NTP_STR),
 	VDC_INIT("ss_processed",	"processed for time:   ", NTP_STR),
+	VDC_INIT("mem_total",		"tracked heap bytes:   ", NTP_STR),
 	VDC_INIT(NULL,			NULL,			  0)
     };
 
@@ -3964,6 +4243,39 @@ timerstats(
 }
 
 
+/*
+ * memstats - ntpq -c memstats - heap use by subsystem
+ */
+static void
+memstats(
+	struct parse *pcmd,
+	FILE *fp
+	)
+{
+    static vdc memstats_vdc[] = {
+	VDC_INIT("mem_total",		"total bytes:           ", NTP_STR),
+	VDC_INIT("mem_mru",		"mrulist bytes:         ", NTP_STR),
+	VDC_INIT("mem_mru_peak",	"mrulist peak bytes:    ", NTP_STR),
+	VDC_INIT("mem_mru_allocs",	"mrulist allocations:   ", NTP_STR),
+	VDC_INIT("mem_peer",		"peer bytes:            ", NTP_STR),
+	VDC_INIT("mem_peer_peak",	"peer peak bytes:       ", NTP_STR),
+	VDC_INIT("mem_peer_allocs",	"peer allocations:      ", NTP_STR),
+	VDC_INIT("mem_restrict",	"restrict bytes:        ", NTP_STR),
+	VDC_INIT("mem_restrict_peak",	"restrict peak bytes:   ", NTP_STR),
+	VDC_INIT("mem_restrict_allocs",	"restrict allocations:  ", NTP_STR),
+	VDC_INIT("mem_recvbuf",		"recvbuf bytes:         ", NTP_STR),
+	VDC_INIT("mem_recvbuf_peak",	"recvbuf peak bytes:    ", NTP_STR),
+	VDC_INIT("mem_recvbuf_allocs",	"recvbuf allocations:   ", NTP_STR),
+	VDC_INIT("mem_config",		"config bytes:          ", NTP_STR),
+	VDC_INIT("mem_config_peak",	"config peak bytes:     ", NTP_STR),
+	VDC_INIT("mem_config_allocs",	"config allocations:    ", NTP_STR),
+	VDC_INIT(NULL,			NULL,			   0)
+    };
+
+	collect_display_vdc(0, memstats_vdc, FALSE, fp);
+}
+
+
 /*
  * authinfo - implements ntpq -c authinfo
  */
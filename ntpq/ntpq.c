@@ -14,9 +14,23 @@
 #ifdef HAVE_FCNTL_H
 # include <fcntl.h>
 #endif
+#ifdef HAVE_SYS_WAIT_H
+# include <sys/wait.h>
+#endif
+#if defined(HAVE_PTHREADS) && !defined(SYS_WINNT)
+# include <pthread.h>
+# define NAME_THREADS
+#endif
 #ifdef SYS_WINNT
 # include <mswsock.h>
 #endif
+#ifdef HAVE_SYS_UN_H
+# include <sys/un.h>
+#endif
+#if defined(HAVE_WORKING_FORK) && defined(HAVE_POLL_H)
+# include <poll.h>
+# define NTPQ_JOBS		/* --jobs and --json run hosts in children */
+#endif
 #include <isc/net.h>
 #include <isc/result.h>
 
@@ -167,9 +181,12 @@ int		ntpqmain	(int,	char **);
  * Built in command handler declarations
  */
 static	int	openhost	(const char *, int);
+static	int	openctlsock	(const char *);
 static	void	dump_hex_printable(const void *, size_t);
 static	int	sendpkt		(void *, size_t);
 static	int	getresponse	(int, int, u_short *, size_t *, const char **, int);
+static	int	getstreamresponse(int, int, u_short *, size_t *,
+				  const char **, int);
 static	int	sendrequest	(int, associd_t, int, size_t, const char *);
 static	char *	tstflags	(u_long);
 #ifndef BUILD_AS_LIB
@@ -178,6 +195,9 @@ static	void	getcmds		(void);
 static	int	abortcmd	(void);
 #endif	/* SYS_WINNT */
 static	void	docmd		(const char *);
+#ifdef NTPQ_JOBS
+static	void	pollhosts	(int);
+#endif
 static	void	tokenize	(const char *, char **, int *);
 static	int	getarg		(const char *, int, arg_v *);
 #endif	/* BUILD_AS_LIB */
@@ -311,7 +331,6 @@ struct xcmd builtins[] = {
 #define	DEFDELAY	0x51EB852	/* 20 milliseconds, l_fp fraction */
 #define	LENHOSTNAME	256		/* host name is 256 characters long */
 #define	MAXCMDS		100		/* maximum commands on cmd line */
-#define	MAXHOSTS	200		/* maximum hosts on cmd line */
 #define	MAXLINE		512		/* maximum line length */
 #define	MAXTOKENS	(1+MAXARGS+2)	/* maximum number of usable tokens */
 #define	MAXVARLEN	256		/* maximum length of a variable name */
@@ -335,6 +354,7 @@ int ai_fam_templ;				/* address family */
 int ai_fam_default;				/* default address family */
 SOCKET sockfd;					/* fd socket is opened on */
 int havehost = 0;				/* set to 1 when host open */
+int havectlsock = 0;				/* host is ntpd's control socket */
 int s_port = 0;
 struct servent *server_entry = NULL;		/* server entry for ntp */
 
@@ -352,6 +372,12 @@ u_short sequence;
 #define	DATASIZE	(MAXFRAGS*480)	/* maximum amount of data */
 long pktdata[DATASIZE/sizeof(long)];
 
+/*
+ * A response on the control socket comes in one piece of any size.
+ */
+static char *	streamdata;
+static size_t	streamsize;
+
 /*
  * assoc_cache[] is a dynamic array which allows references to
  * associations using &1 ... &N for n associations, avoiding manual
@@ -370,21 +396,46 @@ const char *ccmds[MAXCMDS];
 #define	ADDCMD(cp)	if (numcmds < MAXCMDS) ccmds[numcmds++] = (cp)
 
 /*
- * When multiple hosts are specified.
+ * When multiple hosts are specified.  chosts[] grows as they are added.
  */
 
 u_int numhosts;
 
-chost chosts[MAXHOSTS];
+chost *chosts;
+static u_int chosts_slots;	/* count of allocated chosts[] entries */
 #define	ADDHOST(cp)						\
 	do {							\
-		if (numhosts < MAXHOSTS) {			\
-			chosts[numhosts].name = (cp);		\
-			chosts[numhosts].fam = ai_fam_templ;	\
-			numhosts++;				\
+		if (numhosts >= chosts_slots) {			\
+			chosts_slots += 16;			\
+			chosts = erealloc(chosts, chosts_slots	\
+					  * sizeof(chosts[0]));	\
 		}						\
+		chosts[numhosts].name = (cp);			\
+		chosts[numhosts].fam = ai_fam_templ;		\
+		numhosts++;					\
 	} while (0)
 
+#ifdef NTPQ_JOBS
+/*
+ * With --jobs or --json each host is handled by a child process whose
+ * standard output and standard error go down a pipe.  pollhosts() keeps
+ * up to the requested number of children running and writes out what
+ * each one produced as soon as it is finished.
+ */
+typedef struct hostjob_tag {
+	pid_t		pid;		/* child, 0 if the slot is free */
+	int		fd;		/* read end of the output pipe */
+	u_int		ihost;		/* index into chosts[] */
+	char *		buf;		/* output collected so far */
+	size_t		len;
+	size_t		size;
+	struct timeval	start;		/* when the child was started */
+} hostjob;
+
+int jsonout;			/* write one JSON object per host */
+#endif
+int hosttimedout;		/* a query to this host got no full answer */
+
 /*
  * Macro definitions we use
  */
@@ -571,6 +622,11 @@ ntpqmain(
 	if (numcmds == 0) {
 		(void) openhost(chosts[0].name, chosts[0].fam);
 		getcmds();
+#ifdef NTPQ_JOBS
+	} else if (HAVE_OPT(JOBS) || HAVE_OPT(JSON)) {
+		jsonout = HAVE_OPT(JSON);
+		pollhosts(HAVE_OPT(JOBS) ? OPT_VALUE_JOBS : 1);
+#endif
 	} else {
 		for (ihost = 0; ihost < numhosts; ihost++) {
 			if (openhost(chosts[ihost].name, chosts[ihost].fam))
@@ -585,6 +641,268 @@ ntpqmain(
 }
 #endif /* !BUILD_AS_LIB */
 
+#if !defined(BUILD_AS_LIB) && defined(NTPQ_JOBS)
+/*
+ * startjob - fork a child to run the command line commands on one host
+ */
+static int
+startjob(
+	hostjob *	job,
+	u_int		ihost,
+	hostjob *	jobs,
+	u_int		njobs
+	)
+{
+	int	pfd[2];
+	int	status;
+	u_int	u;
+	int	icmd;
+
+	job->ihost = ihost;
+	job->len = 0;
+	gettimeofday(&job->start, NULL);
+	if (pipe(pfd) == -1) {
+		fprintf(stderr, "%s: pipe: %s\n", chosts[ihost].name,
+			strerror(errno));
+		return 0;
+	}
+	fflush(stdout);
+	fflush(stderr);
+	job->pid = fork();
+	if (-1 == job->pid) {
+		fprintf(stderr, "%s: fork: %s\n", chosts[ihost].name,
+			strerror(errno));
+		job->pid = 0;
+		close(pfd[0]);
+		close(pfd[1]);
+		return 0;
+	}
+	if (job->pid != 0) {
+		close(pfd[1]);
+		job->fd = pfd[0];
+		return 1;
+	}
+
+	/*
+	 * Child.  Drop the pipes of the other running jobs, send both
+	 * streams down our own pipe, line buffered so that errors stay
+	 * in place relative to the normal output, and run the commands.
+	 */
+	for (u = 0; u < njobs; u++)
+		if (jobs[u].pid != 0 && &jobs[u] != job)
+			close(jobs[u].fd);
+	close(pfd[0]);
+	dup2(pfd[1], fileno(stdout));
+	dup2(pfd[1], fileno(stderr));
+	close(pfd[1]);
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	current_output = stdout;
+
+	status = 1;
+	if (openhost(chosts[ihost].name, chosts[ihost].fam)) {
+		for (icmd = 0; icmd < numcmds; icmd++)
+			docmd(ccmds[icmd]);
+		status = (hosttimedout) ? 2 : 0;
+	}
+	fflush(stdout);
+	fflush(stderr);
+	_exit(status);
+}
+
+
+/*
+ * json_string - write a string as a quoted JSON string
+ */
+static void
+json_string(
+	FILE *		fp,
+	const char *	cp,
+	size_t		len
+	)
+{
+	u_char	c;
+
+	putc('"', fp);
+	for (; len > 0; len--, cp++) {
+		c = (u_char)*cp;
+		switch (c) {
+
+		case '"':
+		case '\\':
+			putc('\\', fp);
+			putc(c, fp);
+			break;
+
+		case '\n':
+			fputs("\\n", fp);
+			break;
+
+		case '\t':
+			fputs("\\t", fp);
+			break;
+
+		default:
+			if (c < 0x20 || c == 0x7f)
+				fprintf(fp, "\\u%04x", c);
+			else
+				putc(c, fp);
+		}
+	}
+	putc('"', fp);
+}
+
+
+/*
+ * hostresult - write out the result for one host
+ */
+static void
+hostresult(
+	u_int		ihost,
+	const char *	what,
+	double		elapsed,
+	const char *	buf,
+	size_t		len
+	)
+{
+	if (jsonout) {
+		fputs("{\"host\":", stdout);
+		json_string(stdout, chosts[ihost].name,
+			    strlen(chosts[ihost].name));
+		printf(",\"status\":\"%s\",\"elapsed\":%.3f,\"output\":",
+		       what, elapsed);
+		json_string(stdout, buf, len);
+		fputs("}\n", stdout);
+	} else if (len > 0) {
+		fwrite(buf, 1, len, stdout);
+	}
+	fflush(stdout);
+}
+
+
+/*
+ * endjob - reap a finished child and write out what it produced
+ */
+static void
+endjob(
+	hostjob *	job,
+	int		failed
+	)
+{
+	struct timeval	now;
+	const char *	what;
+	double		elapsed;
+	int		status;
+
+	close(job->fd);
+	while (-1 == waitpid(job->pid, &status, 0))
+		if (errno != EINTR) {
+			status = -1;
+			break;
+		}
+	job->pid = 0;
+	gettimeofday(&now, NULL);
+	elapsed = (now.tv_sec - job->start.tv_sec) +
+		  (now.tv_usec - job->start.tv_usec) / 1e6;
+
+	if (failed || -1 == status || !WIFEXITED(status))
+		what = "failed";
+	else if (1 == WEXITSTATUS(status))
+		what = "unreachable";
+	else if (WEXITSTATUS(status) != 0)
+		what = "timeout";
+	else
+		what = "ok";
+	hostresult(job->ihost, what, elapsed, job->buf, job->len);
+}
+
+
+/*
+ * pollhosts - run the command line commands on all hosts, up to njobs
+ *	       of them at once
+ */
+static void
+pollhosts(
+	int	njobs
+	)
+{
+	hostjob *	jobs;
+	hostjob *	job;
+	struct pollfd *	pfds;
+	u_int		ihost;
+	u_int		active;
+	u_int		u;
+	int		n;
+	ssize_t		got;
+
+	if (njobs < 1)
+		njobs = 1;
+	if ((u_int)njobs > numhosts)
+		njobs = numhosts;
+	jobs = emalloc_zero(njobs * sizeof(*jobs));
+	pfds = emalloc_zero(njobs * sizeof(*pfds));
+	ihost = 0;
+	active = 0;
+
+	while (ihost < numhosts || active > 0) {
+		for (u = 0; u < (u_int)njobs && ihost < numhosts; u++) {
+			job = &jobs[u];
+			if (job->pid != 0)
+				continue;
+			if (startjob(job, ihost, jobs, njobs))
+				active++;
+			else
+				hostresult(ihost, "failed", 0., NULL, 0);
+			ihost++;
+		}
+		if (0 == active)
+			continue;
+
+		/*
+		 * poll() rather than select(): with many jobs the pipe
+		 * descriptors can go beyond FD_SETSIZE.
+		 */
+		for (u = 0; u < (u_int)njobs; u++) {
+			pfds[u].fd = (jobs[u].pid != 0) ? jobs[u].fd : -1;
+			pfds[u].events = POLLIN;
+			pfds[u].revents = 0;
+		}
+		n = poll(pfds, (nfds_t)njobs, -1);
+		if (-1 == n) {
+			if (EINTR == errno)
+				continue;
+			fprintf(stderr, "poll: %s\n", strerror(errno));
+			for (u = 0; u < (u_int)njobs; u++)
+				if (jobs[u].pid != 0)
+					endjob(&jobs[u], TRUE);
+			break;
+		}
+
+		for (u = 0; u < (u_int)njobs; u++) {
+			job = &jobs[u];
+			if (0 == job->pid || 0 == pfds[u].revents)
+				continue;
+			if (job->size - job->len < 512) {
+				job->size += 4096;
+				job->buf = erealloc(job->buf, job->size);
+			}
+			got = read(job->fd, job->buf + job->len,
+				   job->size - job->len);
+			if (got > 0) {
+				job->len += got;
+			} else if (0 == got || errno != EINTR) {
+				endjob(job, got < 0);
+				active--;
+			}
+		}
+	}
+
+	for (u = 0; u < (u_int)njobs; u++)
+		free(jobs[u].buf);
+	free(jobs);
+	free(pfds);
+}
+#endif /* !BUILD_AS_LIB && NTPQ_JOBS */
+
 /*
  * openhost - open a socket to a host
  */
@@ -603,6 +921,12 @@ openhost(
 	register const char *cp;
 	char name[LENHOSTNAME];
 
+	/*
+	 * A path names the control socket of an ntpd on this host.
+	 */
+	if ('/' == *hname)
+		return openctlsock(hname);
+
 	/*
 	 * We need to get by the [] if they were entered
 	 */
@@ -753,12 +1077,71 @@ openhost(
 	}
 	freeaddrinfo(ai);
 	havehost = 1;
+	havectlsock = 0;
 	numassoc = 0;
 
 	return 1;
 }
 
 
+/*
+ * openctlsock - connect to ntpd's control socket
+ *
+ * See ntpd/ntp_ctlsock.c.  Requests and responses on the stream are
+ * the mode 6 packets, each preceded by its length.  A response is
+ * not fragmented, and no key or nonce is needed.
+ */
+static int
+openctlsock(
+	const char *path
+	)
+{
+#ifdef HAVE_SYS_UN_H
+	struct sockaddr_un addr;
+	SOCKET fd;
+
+	ZERO(addr);
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "%s: path too long\n", path);
+		return 0;
+	}
+	strlcpy(addr.sun_path, path, sizeof(addr.sun_path));
+
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd == INVALID_SOCKET) {
+		error("socket");
+		return 0;
+	}
+	if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+		warning("connect to %s failed", path);
+		closesocket(fd);
+		return 0;
+	}
+
+	if (debug > 2)
+		printf("Opening control socket %s\n", path);
+	if (havehost == 1) {
+		if (debug > 2)
+			printf("Closing old host %s\n", currenthost);
+		closesocket(sockfd);
+		havehost = 0;
+	}
+	strlcpy(currenthost, path, sizeof(currenthost));
+	currenthostisnum = TRUE;
+	sockfd = fd;
+	havehost = 1;
+	havectlsock = 1;
+	numassoc = 0;
+
+	return 1;
+#else
+	fprintf(stderr, "%s: control sockets are not supported\n", path);
+	return 0;
+#endif
+}
+
+
 static void
 dump_hex_printable(
 	const void *	data,
@@ -804,10 +1187,24 @@ sendpkt(
 	size_t	xdatalen
 	)
 {
+	u_char	msg[sizeof(u_int32) + sizeof(struct ntp_control)];
+	u_int32	netlen;
+
 	if (debug >= 3)
 		printf("Sending %zu octets\n", xdatalen);
 
-	if (send(sockfd, xdata, xdatalen, 0) == -1) {
+	/* on the control socket the length goes first */
+	if (havectlsock) {
+		INSIST(xdatalen <= sizeof(msg) - sizeof(netlen));
+		netlen = htonl((u_int32)xdatalen);
+		memcpy(msg, &netlen, sizeof(netlen));
+		memcpy(msg + sizeof(netlen), xdata, xdatalen);
+		if (send(sockfd, (void *)msg, sizeof(netlen) + xdatalen,
+			 0) == -1) {
+			warning("write to %s failed", currenthost);
+			return -1;
+		}
+	} else if (send(sockfd, xdata, xdatalen, 0) == -1) {
 		warning("write to %s failed", currenthost);
 		return -1;
 	}
@@ -858,6 +1255,10 @@ getresponse(
 	 * packet in the sequence is received we'll know how much data we
 	 * should have had.  Note we use one long time out, should reconsider.
 	 */
+	if (havectlsock)
+		return getstreamresponse(opcode, associd, rstatus, rsize,
+					 rdata, timeo);
+
 	*rsize = 0;
 	if (rstatus)
 		*rstatus = 0;
@@ -1203,6 +1604,148 @@ getresponse(
 }  /* getresponse() */
 
 
+/*
+ * readstream - read 'len' octets from the control socket, waiting at
+ *		most 'tvo' for each part of them.
+ */
+static int
+readstream(
+	void *			buf,
+	size_t			len,
+	struct sock_timeval	tvo
+	)
+{
+	struct sock_timeval tv;
+	fd_set	fds;
+	char *	p;
+	int	n;
+
+	p = buf;
+	while (len > 0) {
+		tv = tvo;
+		FD_ZERO(&fds);
+		FD_SET(sockfd, &fds);
+		n = select(sockfd + 1, &fds, NULL, NULL, &tv);
+		if (n == -1) {
+			warning("select fails");
+			return -1;
+		}
+		if (n == 0)
+			return ERR_TIMEOUT;
+		n = recv(sockfd, p, len, 0);
+		if (n <= 0) {
+			if (n == -1)
+				warning("read");
+			else
+				fprintf(stderr, "%s: connection closed\n",
+					currenthost);
+			return -1;
+		}
+		p += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+
+/*
+ * getstreamresponse - get a response from the control socket
+ *
+ * Responses to earlier requests which timed out are skipped by their
+ * sequence number, as with datagrams.  A timeout or error in the middle
+ * of a response leaves the stream out of step, so the socket is closed.
+ */
+static int
+getstreamresponse(
+	int opcode,
+	int associd,
+	u_short *rstatus,
+	size_t *rsize,
+	const char **rdata,
+	int timeo
+	)
+{
+	struct ntp_control rpkt;
+	u_int32	netlen;
+	size_t	len;
+	int	res;
+
+	*rsize = 0;
+	if (rstatus)
+		*rstatus = 0;
+
+	for (;;) {
+		res = readstream(&netlen, sizeof(netlen), tvout);
+		if (res == ERR_TIMEOUT) {
+			if (timeo)
+				fprintf(stderr,
+					"%s: timed out, nothing received\n",
+					currenthost);
+			return ERR_TIMEOUT;
+		}
+		len = ntohl(netlen);
+		if (res == 0 && len < CTL_HEADER_LEN) {
+			fprintf(stderr, "%s: short (%zu byte) response\n",
+				currenthost, len);
+			res = -1;
+		}
+		if (res == 0)
+			res = readstream(&rpkt, CTL_HEADER_LEN, tvsout);
+		len -= CTL_HEADER_LEN;
+		if (res == 0 && len + 1 > streamsize) {
+			streamsize = len + 1;
+			streamdata = erealloc(streamdata, streamsize);
+		}
+		if (res == 0)
+			res = readstream(streamdata, len, tvsout);
+		if (res != 0) {
+			if (res == ERR_TIMEOUT)
+				fprintf(stderr,
+					"%s: timed out with incomplete data\n",
+					currenthost);
+			closesocket(sockfd);
+			havehost = 0;
+			havectlsock = 0;
+			return (res == ERR_TIMEOUT) ? ERR_INCOMPLETE : -1;
+		}
+		streamdata[len] = '\0';
+
+		if (debug >= 4) {
+			printf("Response message:\n");
+			dump_hex_printable(&rpkt, CTL_HEADER_LEN);
+			dump_hex_printable(streamdata, len);
+		}
+		if (ntohs(rpkt.sequence) != sequence) {
+			TRACE(1, ("Received sequence number %d, wanted %d\n",
+				  ntohs(rpkt.sequence), sequence));
+			continue;
+		}
+		if (!CTL_ISRESPONSE(rpkt.r_m_e_op)
+		    || CTL_OP(rpkt.r_m_e_op) != opcode) {
+			TRACE(1, ("Received opcode %d, wanted %d\n",
+				  CTL_OP(rpkt.r_m_e_op), opcode));
+			continue;
+		}
+		break;
+	}
+
+	if (CTL_ISERROR(rpkt.r_m_e_op)) {
+		res = (ntohs(rpkt.status) >> 8) & 0xff;
+		return (res == CERR_UNSPEC) ? ERR_UNSPEC : res;
+	}
+	if (ntohs(rpkt.associd) != associd)
+		TRACE(1, ("Association ID %d doesn't match expected %d\n",
+			  ntohs(rpkt.associd), associd));
+	if (rstatus)
+		*rstatus = ntohs(rpkt.status);
+	*rsize = len;
+	*rdata = streamdata;
+
+	return 0;
+}
+
+
 /*
  * sendrequest - format and send a request packet
  */
@@ -1258,9 +1801,10 @@ sendrequest(
 
 	/*
 	 * If it isn't authenticated we can just send it.  Otherwise
-	 * we're going to have to think about it a little.
+	 * we're going to have to think about it a little.  The control
+	 * socket needs no key, its permissions are checked instead.
 	 */
-	if (!auth && !always_auth) {
+	if ((!auth && !always_auth) || havectlsock) {
 		return sendpkt(&qpkt, pktsize);
 	}
 
@@ -1463,6 +2007,9 @@ doqueryex(
 			done = 1;
 			goto again;
 		}
+		/* partial output is not to be taken for the whole */
+		if (res == ERR_TIMEOUT || res == ERR_INCOMPLETE)
+			hosttimedout = 1;
 		if (!quiet)
 			show_error_msg(res, associd);
 
@@ -1890,6 +2437,237 @@ getnetnum(
 }
 
 
+/*
+ * Reverse lookups are kept for the whole session in a small hash table.
+ * resolve_names() fills it for a whole result set at once, with up to
+ * NAME_INFLIGHT lookups running in parallel, so that printing a long
+ * list costs about one DNS round trip rather than one per row.  A
+ * lookup still outstanding when resolve_names() gives up is shown as
+ * the numeric address; its answer lands in the cache for next time.
+ */
+#define	NAME_HASH_SIZE	1024		/* power of 2 */
+#define	NAME_INFLIGHT	32		/* parallel lookups */
+#define	NAME_TIMEOUT	5		/* s without an answer to give up */
+
+#define	NAME_NEW	0		/* nobody has looked it up */
+#define	NAME_BUSY	1		/* queued or being looked up */
+#define	NAME_DONE	2		/* name[] and rc are valid */
+
+typedef struct name_entry_tag name_entry;
+struct name_entry_tag {
+	name_entry *	link;		/* hash chain */
+	name_entry *	qlink;		/* lookup queue */
+	sockaddr_u	addr;
+	int		state;		/* NAME_NEW, NAME_BUSY, NAME_DONE */
+	int		rc;		/* from socktohost_r() */
+	char		name[LIB_BUFLENGTH];
+};
+
+static	name_entry *	name_hash[NAME_HASH_SIZE];
+
+#ifdef NAME_THREADS
+static	pthread_mutex_t	name_mutex = PTHREAD_MUTEX_INITIALIZER;
+static	pthread_cond_t	name_cond = PTHREAD_COND_INITIALIZER;
+static	name_entry *	name_queue;	/* waiting for a thread */
+static	name_entry **	name_qtail = &name_queue;
+static	u_int		name_threads;	/* running lookup threads */
+static	u_int		name_done;	/* bumped by each answer */
+# define NAME_LOCK()	pthread_mutex_lock(&name_mutex)
+# define NAME_UNLOCK()	pthread_mutex_unlock(&name_mutex)
+#else
+# define NAME_LOCK()	do {} while (0)
+# define NAME_UNLOCK()	do {} while (0)
+#endif
+
+
+/*
+ * find_name - look up addr in the name cache, adding a NAME_NEW entry
+ *	       if there is none.  Called with the cache locked.
+ */
+static name_entry *
+find_name(
+	const sockaddr_u *	addr
+	)
+{
+	name_entry *	ne;
+	u_int		hash;
+
+	hash = sock_hash(addr) & (NAME_HASH_SIZE - 1);
+	for (ne = name_hash[hash]; ne != NULL; ne = ne->link)
+		if (SOCK_EQ(&ne->addr, addr))
+			break;
+	if (NULL == ne) {
+		ne = emalloc_zero(sizeof(*ne));
+		ne->addr = *addr;
+		ne->link = name_hash[hash];
+		name_hash[hash] = ne;
+	}
+	return ne;
+}
+
+
+#ifdef NAME_THREADS
+/*
+ * name_worker - lookup thread, runs until the queue is empty
+ */
+static void *
+name_worker(
+	void *	arg
+	)
+{
+	name_entry *	ne;
+	char		name[LIB_BUFLENGTH];
+	int		rc;
+
+	NAME_LOCK();
+	while ((ne = name_queue) != NULL) {
+		name_queue = ne->qlink;
+		if (NULL == name_queue)
+			name_qtail = &name_queue;
+		NAME_UNLOCK();
+		rc = socktohost_r(&ne->addr, name, sizeof(name));
+		NAME_LOCK();
+		ne->rc = rc;
+		memcpy(ne->name, name, sizeof(ne->name));
+		ne->state = NAME_DONE;
+		name_done++;
+		pthread_cond_broadcast(&name_cond);
+	}
+	name_threads--;
+	NAME_UNLOCK();
+
+	return arg;
+}
+#endif	/* NAME_THREADS */
+
+
+/*
+ * resolve_names - look up the names of a set of addresses in parallel
+ *		   ahead of printing them.
+ */
+void
+resolve_names(
+	const sockaddr_u *	addrs,
+	size_t			count
+	)
+{
+#ifdef NAME_THREADS
+	pthread_t	thr;
+	pthread_attr_t	attr;
+	struct timespec	deadline;
+	name_entry *	ne;
+	size_t		i;
+	size_t		queued;
+	u_int		seen;
+	int		rc;
+
+	if (!showhostnames || 0 == count)
+		return;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+	NAME_LOCK();
+	queued = 0;
+	for (i = 0; i < count; i++) {
+		if (SOCK_UNSPEC(&addrs[i]) || ISREFCLOCKADR(&addrs[i]))
+			continue;
+		ne = find_name(&addrs[i]);
+		if (ne->state != NAME_NEW)
+			continue;
+		ne->state = NAME_BUSY;
+		*name_qtail = ne;
+		name_qtail = &ne->qlink;
+		if (name_threads < NAME_INFLIGHT) {
+			rc = pthread_create(&thr, &attr, &name_worker, NULL);
+			if (0 == rc)
+				name_threads++;
+		}
+		queued++;
+	}
+	pthread_attr_destroy(&attr);
+	if (queued > 0 && 0 == name_threads) {
+		/* no threads to be had, leave it to nntohost() */
+		while ((ne = name_queue) != NULL) {
+			name_queue = ne->qlink;
+			ne->state = NAME_NEW;
+		}
+		name_qtail = &name_queue;
+	}
+
+	/*
+	 * Wait for the set to be done, giving up when NAME_TIMEOUT
+	 * seconds pass without any lookup finishing.
+	 */
+	for (i = 0; i < count; i++) {
+		if (SOCK_UNSPEC(&addrs[i]) || ISREFCLOCKADR(&addrs[i]))
+			continue;
+		ne = find_name(&addrs[i]);
+		seen = name_done;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += NAME_TIMEOUT;
+		while (NAME_BUSY == ne->state) {
+			rc = pthread_cond_timedwait(&name_cond, &name_mutex,
+						    &deadline);
+			if (name_done != seen) {
+				seen = name_done;
+				clock_gettime(CLOCK_REALTIME, &deadline);
+				deadline.tv_sec += NAME_TIMEOUT;
+			} else if (ETIMEDOUT == rc) {
+				break;
+			}
+		}
+		if (NAME_BUSY == ne->state)
+			break;
+	}
+	NAME_UNLOCK();
+#else
+	UNUSED_ARG(addrs);
+	UNUSED_ARG(count);
+#endif	/* NAME_THREADS */
+}
+
+
+/*
+ * cached_socktohost - socktohost() through the session name cache
+ */
+static const char *
+cached_socktohost(
+	const sockaddr_u *	addr
+	)
+{
+	name_entry *	ne;
+	char *		buf;
+	int		rc;
+
+	NAME_LOCK();
+	ne = find_name(addr);
+	if (NAME_BUSY == ne->state) {
+		/* still being looked up, don't wait for it */
+		NAME_UNLOCK();
+		return stoa(addr);
+	}
+	if (NAME_NEW == ne->state) {
+		/* only this thread touches NAME_NEW entries */
+		NAME_UNLOCK();
+		rc = socktohost_r(addr, ne->name, sizeof(ne->name));
+		NAME_LOCK();
+		ne->rc = rc;
+		ne->state = NAME_DONE;
+	}
+	rc = ne->rc;
+	LIB_GETBUF(buf);
+	if (rc > 0)
+		strlcpy(buf, ne->name, LIB_BUFLENGTH);
+	else if (0 == rc &&
+		 snprintf(buf, LIB_BUFLENGTH, "%s (%s)", stoa(addr),
+			  ne->name) >= LIB_BUFLENGTH)
+		rc = -1;	/* no room for the unverified name */
+	NAME_UNLOCK();
+
+	return (rc < 0) ? stoa(addr) : buf;
+}
+
+
 /*
  * nntohost - convert network number to host name.  This routine enforces
  *	       the showhostnames setting.
@@ -1929,7 +2707,7 @@ nntohost_col(
 	} else if (ISREFCLOCKADR(addr)) {
 		out = refnumtoa(addr);
 	} else {
-		out = trunc_right(socktohost(addr), width);
+		out = trunc_right(cached_socktohost(addr), width);
 	}
 	return out;
 }
@@ -1951,7 +2729,7 @@ nntohostp(
 	else if (ISREFCLOCKADR(netnum))
 		return refnumtoa(netnum);
 
-	hostn = socktohost(netnum);
+	hostn = cached_socktohost(netnum);
 	LIB_GETBUF(buf);
 	snprintf(buf, LIB_BUFLENGTH, "%s:%u", hostn, SRCPORT(netnum));
 
@@ -122,10 +122,11 @@ struct chost_tag {
 	int 	    fam;
 };
 
-extern chost	chosts[];
+extern chost *	chosts;
 
 extern int	interactive;	/* are we prompting? */
 extern int	old_rv;		/* use old rv behavior? --old-rv */
+extern int	havectlsock;	/* talking to ntpd's control socket? */
 extern u_int	assoc_cache_slots;/* count of allocated array entries */
 extern u_int	numassoc;	/* number of cached associations */
 extern u_int	numhosts;
@@ -143,6 +144,7 @@ extern	int	doqueryex	(int, associd_t, int, size_t, const char *,
 extern	const char * nntohost	(sockaddr_u *);
 extern	const char * nntohost_col (sockaddr_u *, size_t, int);
 extern	const char * nntohostp	(sockaddr_u *);
+extern	void	resolve_names	(const sockaddr_u *, size_t);
 extern	int	decodets	(char *, l_fp *);
 extern	int	decodeuint	(char *, u_long *);
 extern	int	nextvar		(size_t *, const char **, char **, char **);
@@ -9,22 +9,80 @@
  *  master agent process whenever someone queries the corresponding MIB
  *  object. 
  * 
- *  At the moment this triggers a full send/receive procedure for each
- *  queried MIB object, one of the things that are still on my todo list:
- *  a caching mechanism that reduces the number of requests sent to the
- *  ntpd process.
+ *  The callbacks do not query ntpd themselves.  The system variables
+ *  and the variables of all associations are read at most once per
+ *  cache interval and kept split up into name/value pairs, and the
+ *  callbacks look their values up there.  A walk of the MIB thus costs
+ *  ntpd one readvar for the system and one per association.
  *
  ****************************************************************************/
 #include <ntp_snmp.h>
 #include <ctype.h>
+#include <arpa/inet.h>
 #include <ntp.h>
+#include <ntp_control.h>
 #include <libntpq.h>
 
 /* general purpose buffer length definition */
 #define NTPQ_BUFLEN 2048
 
+/* max. number of variables kept from one variable set */
+#define NTP_MAXVARS 128
+
 char ntpvalue[NTPQ_BUFLEN];
 
+/*
+ * A variable set as read from ntpd, split up into name/value pairs
+ * at offsets into text, so a set can be moved by realloc().  Values
+ * have their quotes removed.
+ */
+typedef struct ntp_varset {
+	size_t		count;
+	u_short		name[NTP_MAXVARS];
+	u_short		value[NTP_MAXVARS];
+	size_t		used;		/* bytes of text in use */
+	char		text[2 * NTPQ_BUFLEN];
+} ntp_varset;
+
+typedef struct ntp_assoc {
+	associd_t	assid;
+	ntp_varset	vars;
+} ntp_assoc;
+
+/* seconds a variable set is used before it is read again */
+static int		cache_interval = 5;
+
+static ntp_varset	sys_cache;
+static int		sys_cache_valid;
+static time_t		sys_cache_time;
+
+static ntp_assoc *	assoc_table;
+static size_t		assoc_count;	/* rows in assoc_table */
+static size_t		assoc_alloc;	/* allocated rows */
+static int		assoc_valid;
+static time_t		assoc_time;
+
+/*
+ * The peer variables the MIB tables are filled from, read with one
+ * query per association.
+ */
+static struct ntpq_varlist assoc_vlist[] = {
+	{ "srcadr",	NULL },
+	{ "srchost",	NULL },
+	{ "refid",	NULL },
+	{ "stratum",	NULL },
+	{ "offset",	NULL },
+	{ "jitter",	NULL },
+	{ "delay",	NULL },
+	{ "dispersion",	NULL },
+	{ "received",	NULL },
+	{ "sent",	NULL },
+	{ "badauth",	NULL },
+	{ "bogusorg",	NULL },
+	{ "oldpkt",	NULL },
+	{ NULL,		NULL }
+};
+
 
 /*****************************************************************************
  *
@@ -192,13 +250,286 @@ ntpsnmpd_cut_string(
 }
 
 
+/*****************************************************************************
+ *
+ *  ntpsnmpd_set_cache_interval
+ *
+ *  Sets the number of seconds the variables read from ntpd are used
+ *  before they are read again.  0 reads them for every request.
+ *  
+ ****************************************************************************
+ * Parameters:
+ *	interval	int	The cache interval in seconds
+ ****************************************************************************/
+
+void
+ntpsnmpd_set_cache_interval(
+	int	interval
+	)
+{
+	cache_interval = max(interval, 0);
+	sys_cache_valid = FALSE;
+	assoc_valid = FALSE;
+}
+
+
+/*
+ * cache_expired - is a variable set read at 'when' too old to use?
+ */
+static int
+cache_expired(
+	int	valid,
+	time_t	when,
+	time_t	now
+	)
+{
+	return !valid || now < when || now - when >= cache_interval;
+}
+
+
+/*
+ * parse_varset - split up the variable set ntpd returned
+ */
+static void
+parse_varset(
+	ntp_varset *	vs,
+	const char *	data,
+	size_t		datalen
+	)
+{
+	char *	name;
+	char *	value;
+	char *	cp;
+	size_t	nlen;
+	size_t	vlen;
+
+	vs->count = 0;
+	vs->used = 0;
+	while (vs->count < COUNTOF(vs->name) &&
+	       nextvar(&datalen, &data, &name, &value)) {
+		if (NULL == value)
+			value = "";
+		nlen = strlen(name) + 1;
+		vlen = strlen(value) + 1;
+		if (vs->used + nlen + vlen > sizeof(vs->text))
+			break;
+		cp = vs->text + vs->used;
+		memcpy(cp, name, nlen);
+		vs->name[vs->count] = (u_short)vs->used;
+		cp += nlen;
+		ntpq_stripquotes(cp, value, vlen - 1, vlen);
+		vs->value[vs->count] = (u_short)(vs->used + nlen);
+		vs->used += nlen + strlen(cp) + 1;
+		vs->count++;
+	}
+}
+
+
+/*
+ * varset_get - look up a variable, NULL if it is not there
+ */
+static const char *
+varset_get(
+	const ntp_varset *	vs,
+	const char *		variable
+	)
+{
+	size_t	i;
+
+	for (i = 0; i < vs->count; i++)
+		if (!strcmp(variable, vs->text + vs->name[i]))
+			return vs->text + vs->value[i];
+
+	return NULL;
+}
+
+
+/*
+ * refresh_sysvars - read the system variables if the cached ones are
+ * too old.  Returns FALSE if there are none to be had.
+ */
+static int
+refresh_sysvars(void)
+{
+	char	sv_data[NTPQ_BUFLEN];
+	size_t	sv_len;
+	time_t	now;
+
+	now = time(NULL);
+	if (!cache_expired(sys_cache_valid, sys_cache_time, now))
+		return TRUE;
+
+	sv_len = ntpq_read_sysvars(sv_data, sizeof(sv_data));
+	sys_cache_valid = (sv_len > 0);
+	sys_cache_time = now;
+	if (sys_cache_valid)
+		parse_varset(&sys_cache, sv_data, sv_len);
+
+	return sys_cache_valid;
+}
+
+
+/*
+ * assoc_add - a new row for association 'assid', NULL if out of memory
+ */
+static ntp_assoc *
+assoc_add(
+	associd_t	assid
+	)
+{
+	ntp_assoc *	ap;
+	size_t		alloc;
+
+	if (assoc_count == assoc_alloc) {
+		alloc = max(2 * assoc_alloc, 16);
+		ap = realloc(assoc_table, alloc * sizeof(*ap));
+		if (NULL == ap) {
+			snmp_log(LOG_ERR, "ntpsnmpd: no memory for %lu"
+				 " associations\n", (u_long)alloc);
+			return NULL;
+		}
+		assoc_table = ap;
+		assoc_alloc = alloc;
+	}
+	ap = &assoc_table[assoc_count++];
+	ap->assid = assid;
+	ap->vars.count = 0;
+	ap->vars.used = 0;
+
+	return ap;
+}
+
+
+/*
+ * read_assocs_readvar - one readvar per association, for an ntpd
+ * without CTL_OP_READ_PEERS
+ */
+static void
+read_assocs_readvar(void)
+{
+	static u_short	assids[MAXASSOC];
+	const char *	datap;
+	ntp_assoc *	ap;
+	size_t		dsize;
+	u_short		rstatus;
+	int		n;
+	int		i;
+
+	n = ntpq_read_associations(assids, COUNTOF(assids));
+	n = min(n, (int)COUNTOF(assids));
+	for (i = 0; i < n; i++) {
+		if (ntpq_doquerylist(assoc_vlist, CTL_OP_READVAR, assids[i],
+				     0, &rstatus, &dsize, &datap) != 0 ||
+		    0 == dsize)
+			continue;
+		ap = assoc_add(assids[i]);
+		if (NULL == ap)
+			return;
+		parse_varset(&ap->vars, datap, dsize);
+	}
+}
+
+
+/*
+ * refresh_assocs - read the variables of all associations if the
+ * cached ones are too old.
+ *
+ * CTL_OP_READ_PEERS returns them all in one request on the control
+ * socket.  Over UDP each request gets one datagram, which ends with
+ * next= for the association to continue with.
+ */
+static void
+refresh_assocs(void)
+{
+	static int	no_read_peers;
+	const char *	datap;
+	const char *	blk;
+	const char *	pos;
+	char *		tag;
+	char *		val;
+	ntp_assoc *	ap;
+	size_t		dsize;
+	u_short		rstatus;
+	u_long		first;
+	u_long		next;
+	u_long		assid;
+	time_t		now;
+	int		isnext;
+	int		res;
+
+	now = time(NULL);
+	if (!cache_expired(assoc_valid, assoc_time, now))
+		return;
+	assoc_valid = TRUE;
+	assoc_time = now;
+	assoc_count = 0;
+
+	if (no_read_peers) {
+		read_assocs_readvar();
+		return;
+	}
+
+	first = 0;
+	do {
+		res = ntpq_read_peers(assoc_vlist, (associd_t)first,
+				      &rstatus, &dsize, &datap);
+		if (CERR_BADOP == res && 0 == first) {
+			no_read_peers = TRUE;
+			read_assocs_readvar();
+			return;
+		}
+		if (res != 0)
+			return;
+
+		/*
+		 * Each association is assid=, status=, then its
+		 * variables up to the next assid= or the end.
+		 */
+		next = 0;
+		ap = NULL;
+		blk = NULL;
+		pos = datap;
+		while (nextvar(&dsize, &datap, &tag, &val)) {
+			/* parse_varset() reuses nextvar()'s buffers */
+			isnext = !strcmp("next", tag);
+			if (!isnext && strcmp("assid", tag)) {
+				if (!strcmp("status", tag))
+					blk = datap;
+				pos = datap;
+				continue;
+			}
+			if (NULL == val || 1 != sscanf(val, "%lu", &assid))
+				assid = 0;
+			if (ap != NULL && blk != NULL)
+				parse_varset(&ap->vars, blk,
+					     (size_t)(pos - blk));
+			ap = NULL;
+			blk = NULL;
+			if (isnext) {
+				next = assid;
+			} else {
+				ap = assoc_add((associd_t)assid);
+				if (NULL == ap)
+					return;
+			}
+			pos = datap;
+		}
+		if (ap != NULL && blk != NULL)
+			parse_varset(&ap->vars, blk, (size_t)(datap - blk));
+		if (next <= first)
+			break;
+		first = next;
+	} while (TRUE);
+}
+
+
 /*****************************************************************************
  *
  *  read_ntp_value
  *
- *  This function retrieves the value for a given variable, currently
- *  this only supports sysvars. It starts a full mode 6 send/receive/parse
- *  iteration and needs to be optimized, e.g. by using a caching mechanism
+ *  This function retrieves the value for a given system variable from
+ *  the cached variable set, which is read from ntpd again once it is
+ *  older than the cache interval.
  *  
  ****************************************************************************
  * Parameters:
@@ -218,17 +549,15 @@ read_ntp_value(
 	size_t		valuesize
 	)
 {
-	size_t	sv_len;
-	char	sv_data[NTPQ_BUFLEN];
-	
-	memset(sv_data, 0, sizeof(sv_data));
-	sv_len = ntpq_read_sysvars(sv_data, sizeof(sv_data));
+	const char *	cached;
 
-	if (0 == sv_len)
+	if (!refresh_sysvars())
 		return 0;
-	else
-		return ntpq_getvar(sv_data, sv_len, variable, value,
-				   valuesize);
+	cached = varset_get(&sys_cache, variable);
+	if (NULL == cached || '\0' == cached[0] || valuesize < 1)
+		return 0;
+
+	return min(strlcpy(value, cached, valuesize), valuesize - 1);
 }
 
 
@@ -529,6 +858,352 @@ int get_ntpEntTimeDistance (netsnmp_mib_handler *handler,
 }
 
 
+/*
+ * ntpAssociationTable and ntpAssociationStatisticsTable
+ *
+ * Both tables have one row per association, indexed by the association
+ * ID, and are served by the table iterator from the cached association
+ * variables.  The iterator asks for the rows in turn; the first call
+ * reads the associations from ntpd again if the cache is too old.
+ */
+static netsnmp_variable_list *
+ntpAssoc_next_row(
+	void **			loop_context,
+	void **			data_context,
+	netsnmp_variable_list *	put_index_data,
+	netsnmp_iterator_info *	mydata
+	)
+{
+	size_t		row;
+	u_int32		assid;
+
+	row = (size_t)(uintptr_t)*loop_context;
+	if (row >= assoc_count)
+		return NULL;
+	assid = assoc_table[row].assid;
+	snmp_set_var_typed_value(put_index_data, ASN_UNSIGNED,
+				 (void *)&assid, sizeof(assid));
+	*data_context = &assoc_table[row];
+	*loop_context = (void *)(uintptr_t)(row + 1);
+
+	return put_index_data;
+}
+
+
+static netsnmp_variable_list *
+ntpAssoc_first_row(
+	void **			loop_context,
+	void **			data_context,
+	netsnmp_variable_list *	put_index_data,
+	netsnmp_iterator_info *	mydata
+	)
+{
+	refresh_assocs();
+	*loop_context = (void *)(uintptr_t)0;
+
+	return ntpAssoc_next_row(loop_context, data_context,
+				 put_index_data, mydata);
+}
+
+
+/*
+ * assoc_string - a variable of an association as a string, "N/A" if
+ * ntpd did not provide it.
+ */
+static const char *
+assoc_string(
+	const ntp_assoc *	ap,
+	const char *		variable
+	)
+{
+	const char *	value;
+
+	value = varset_get(&ap->vars, variable);
+	if (NULL == value || '\0' == value[0])
+		return "N/A";
+
+	return value;
+}
+
+
+static u_int32
+assoc_number(
+	const ntp_assoc *	ap,
+	const char *		variable
+	)
+{
+	const char *	value;
+
+	value = varset_get(&ap->vars, variable);
+	if (NULL == value)
+		return 0;
+
+	return (u_int32)strtoul(value, NULL, 10);
+}
+
+
+static void
+set_string(
+	netsnmp_request_info *	request,
+	const char *		value
+	)
+{
+	snmp_set_var_typed_value(request->requestvb, ASN_OCTET_STR,
+				 (const u_char *)value, strlen(value));
+}
+
+
+/*
+ * set_assoc_address - ntpAssocAddressType and ntpAssocAddress.  A
+ * zone index ntpd appends to an IPv6 address is left off.
+ */
+static int
+set_assoc_address(
+	netsnmp_request_info *	request,
+	const ntp_assoc *	ap,
+	int			want_type
+	)
+{
+	char		host[INET6_ADDRSTRLEN];
+	u_char		addr[16];
+	u_int32		type;
+	size_t		len;
+	const char *	srcadr;
+
+	srcadr = varset_get(&ap->vars, "srcadr");
+	if (NULL == srcadr)
+		return FALSE;
+	strlcpy(host, srcadr, sizeof(host));
+	host[strcspn(host, "%")] = '\0';
+	if (1 == inet_pton(AF_INET, host, addr)) {
+		type = 1;	/* ipv4 */
+		len = 4;
+	} else if (1 == inet_pton(AF_INET6, host, addr)) {
+		type = 2;	/* ipv6 */
+		len = 16;
+	} else {
+		return FALSE;
+	}
+
+	if (want_type)
+		snmp_set_var_typed_value(request->requestvb, ASN_INTEGER,
+					 (void *)&type, sizeof(type));
+	else
+		snmp_set_var_typed_value(request->requestvb, ASN_OCTET_STR,
+					 addr, len);
+	return TRUE;
+}
+
+
+/*
+ * assoc_table_mode - TRUE for the request modes the association tables
+ * answer.  For a GETNEXT (and the GETNEXT passes of a GETBULK) the table
+ * iterator has already picked the following row and rewritten the OID
+ * of the request to it, so the handlers fill in its value as for a GET.
+ */
+static int
+assoc_table_mode(
+	int	mode
+	)
+{
+	switch (mode) {
+
+	case MODE_GET:
+	case MODE_GETNEXT:
+		return TRUE;
+
+	default:
+		return FALSE;
+	}
+}
+
+
+int
+get_ntpAssociationTable(
+	netsnmp_mib_handler *		handler,
+	netsnmp_handler_registration *	reginfo,
+	netsnmp_agent_request_info *	reqinfo,
+	netsnmp_request_info *		requests
+	)
+{
+	netsnmp_request_info *		request;
+	netsnmp_table_request_info *	table_info;
+	const ntp_assoc *		ap;
+	const char *			srcadr;
+	char				buf[NTPQ_BUFLEN];
+	u_int32				stratum;
+
+	if (!assoc_table_mode(reqinfo->mode))
+		return SNMP_ERR_GENERR;
+
+	for (request = requests; request != NULL; request = request->next) {
+		if (request->processed)
+			continue;
+		ap = netsnmp_extract_iterator_context(request);
+		table_info = netsnmp_extract_table_info(request);
+		if (NULL == ap || NULL == table_info) {
+			netsnmp_set_request_error(reqinfo, request,
+						  SNMP_NOSUCHINSTANCE);
+			continue;
+		}
+
+		switch (table_info->colnum) {
+
+		case 2:		/* ntpAssocName */
+			if (NULL != varset_get(&ap->vars, "srchost"))
+				set_string(request,
+					   assoc_string(ap, "srchost"));
+			else
+				set_string(request,
+					   assoc_string(ap, "srcadr"));
+			break;
+
+		case 3:		/* ntpAssocRefId */
+			/* the driver ID for a refclock, else the refid */
+			srcadr = assoc_string(ap, "srcadr");
+			if (!strncmp(srcadr, "127.127.", 8))
+				set_string(request, srcadr);
+			else
+				set_string(request, assoc_string(ap, "refid"));
+			break;
+
+		case 4:		/* ntpAssocAddressType */
+		case 5:		/* ntpAssocAddress */
+			if (!set_assoc_address(request, ap,
+					       (4 == table_info->colnum)))
+				netsnmp_set_request_error(reqinfo, request,
+							  SNMP_NOSUCHINSTANCE);
+			break;
+
+		case 6:		/* ntpAssocOffset */
+			snprintf(buf, sizeof(buf), "%s ms",
+				 assoc_string(ap, "offset"));
+			set_string(request, buf);
+			break;
+
+		case 7:		/* ntpAssocStratum */
+			stratum = assoc_number(ap, "stratum");
+			snmp_set_var_typed_value(request->requestvb,
+						 ASN_UNSIGNED,
+						 (void *)&stratum,
+						 sizeof(stratum));
+			break;
+
+		case 8:		/* ntpAssocStatusJitter */
+			set_string(request, assoc_string(ap, "jitter"));
+			break;
+
+		case 9:		/* ntpAssocStatusDelay */
+			set_string(request, assoc_string(ap, "delay"));
+			break;
+
+		case 10:	/* ntpAssocStatusDispersion */
+			set_string(request, assoc_string(ap, "dispersion"));
+			break;
+
+		default:
+			netsnmp_set_request_error(reqinfo, request,
+						  SNMP_NOSUCHOBJECT);
+		}
+	}
+
+	return SNMP_ERR_NOERROR;
+}
+
+
+int
+get_ntpAssociationStatisticsTable(
+	netsnmp_mib_handler *		handler,
+	netsnmp_handler_registration *	reginfo,
+	netsnmp_agent_request_info *	reqinfo,
+	netsnmp_request_info *		requests
+	)
+{
+	netsnmp_request_info *		request;
+	netsnmp_table_request_info *	table_info;
+	const ntp_assoc *		ap;
+	u_int32				count;
+
+	if (!assoc_table_mode(reqinfo->mode))
+		return SNMP_ERR_GENERR;
+
+	for (request = requests; request != NULL; request = request->next) {
+		if (request->processed)
+			continue;
+		ap = netsnmp_extract_iterator_context(request);
+		table_info = netsnmp_extract_table_info(request);
+		if (NULL == ap || NULL == table_info) {
+			netsnmp_set_request_error(reqinfo, request,
+						  SNMP_NOSUCHINSTANCE);
+			continue;
+		}
+
+		switch (table_info->colnum) {
+
+		case 1:		/* ntpAssocStatInPkts */
+			count = assoc_number(ap, "received");
+			break;
+
+		case 2:		/* ntpAssocStatOutPkts */
+			count = assoc_number(ap, "sent");
+			break;
+
+		case 3:		/* ntpAssocStatProtocolError */
+			count = assoc_number(ap, "badauth")
+			      + assoc_number(ap, "bogusorg")
+			      + assoc_number(ap, "oldpkt");
+			break;
+
+		default:
+			netsnmp_set_request_error(reqinfo, request,
+						  SNMP_NOSUCHOBJECT);
+			continue;
+		}
+		snmp_set_var_typed_value(request->requestvb, ASN_COUNTER,
+					 (void *)&count, sizeof(count));
+	}
+
+	return SNMP_ERR_NOERROR;
+}
+
+
+/*
+ * register_assoc_table - register a table indexed by ntpAssocId with
+ * the given columns.
+ */
+static void
+register_assoc_table(
+	const char *		name,
+	Netsnmp_Node_Handler *	handler,
+	const oid *		table_oid,
+	size_t			table_oid_len,
+	u_int			min_column,
+	u_int			max_column
+	)
+{
+	netsnmp_handler_registration *		reg;
+	netsnmp_table_registration_info *	table_info;
+	netsnmp_iterator_info *			iinfo;
+
+	reg = netsnmp_create_handler_registration(name, handler, table_oid,
+						  table_oid_len,
+						  HANDLER_CAN_RONLY);
+	table_info = SNMP_MALLOC_TYPEDEF(netsnmp_table_registration_info);
+	iinfo = SNMP_MALLOC_TYPEDEF(netsnmp_iterator_info);
+	if (NULL == reg || NULL == table_info || NULL == iinfo) {
+		snmp_log(LOG_ERR, "ntpsnmpd: cannot register %s\n", name);
+		return;
+	}
+	netsnmp_table_helper_add_indexes(table_info, ASN_UNSIGNED, 0);
+	table_info->min_column = min_column;
+	table_info->max_column = max_column;
+	iinfo->get_first_data_point = ntpAssoc_first_row;
+	iinfo->get_next_data_point = ntpAssoc_next_row;
+	iinfo->table_reginfo = table_info;
+	netsnmp_register_table_iterator(reg, iinfo);
+}
+
+
 /*
  *
  * Initialize sub agent
@@ -537,6 +1212,11 @@ int get_ntpEntTimeDistance (netsnmp_mib_handler *handler,
 void
 init_ntpSnmpSubagentObject(void)
 {
+	static const oid ntpAssociationTable_oid[] =
+		{ NTPV4_OID, 1, 3, 1 };
+	static const oid ntpAssociationStatisticsTable_oid[] =
+		{ NTPV4_OID, 1, 3, 2 };
+
 	/* Register all MIB objects with the agentx master */
 	NTP_OID_RO( ntpEntSoftwareName,		1, 1, 1, 0);
 	NTP_OID_RO( ntpEntSoftwareVersion,	1, 1, 2, 0);
@@ -545,5 +1225,16 @@ init_ntpSnmpSubagentObject(void)
 	NTP_OID_RO( ntpEntTimeResolution,	1, 1, 5, 0);
 	NTP_OID_RO( ntpEntTimePrecision,	1, 1, 6, 0);
 	NTP_OID_RO( ntpEntTimeDistance,		1, 1, 7, 0);
+
+	/* Section 3, the associations */
+	register_assoc_table("ntpAssociationTable",
+			     get_ntpAssociationTable,
+			     ntpAssociationTable_oid,
+			     OID_LENGTH(ntpAssociationTable_oid), 2, 10);
+	register_assoc_table("ntpAssociationStatisticsTable",
+			     get_ntpAssociationStatisticsTable,
+			     ntpAssociationStatisticsTable_oid,
+			     OID_LENGTH(ntpAssociationStatisticsTable_oid),
+			     1, 3);
 }
 
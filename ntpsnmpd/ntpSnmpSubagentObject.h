@@ -17,6 +17,7 @@ size_t ntpsnmpd_cut_string(const char *string, char *dest, char delim,
 			   int fieldnumber, size_t maxsize);
 size_t read_ntp_value(const char *variable, char *value,
 		      size_t valuesize);
+void ntpsnmpd_set_cache_interval(int interval);
 
 /* Initialization */
 void init_ntpSnmpSubagentObject(void);
@@ -38,6 +39,10 @@ Netsnmp_Node_Handler get_ntpEntStatusActiveRefSourceId;
 Netsnmp_Node_Handler get_ntpEntStatusActiveRefSourceName;
 Netsnmp_Node_Handler get_ntpEntStatusActiveOffset;
 
+/* MIB Section 3 Callback Functions */
+Netsnmp_Node_Handler get_ntpAssociationTable;
+Netsnmp_Node_Handler get_ntpAssociationStatisticsTable;
+
 #define NTPV4_OID 1,3,6,1,2,1,197	/* mib-2 197 */
 
 
@@ -60,7 +60,7 @@ extern FILE * option_usage_fp;
 /**
  *  static const strings for ntpsnmpd options
  */
-static char const ntpsnmpd_opt_strs[1610] =
+static char const ntpsnmpd_opt_strs[1775] =
 /*     0 */ "ntpsnmpd 4.2.8p6\n"
             "Copyright (C) 1992-2016 The University of Delaware and Network Time Foundation, all rights reserved.\n"
             "This is free software. It is licensed for use, modification and\n"
@@ -88,27 +88,34 @@ static char const ntpsnmpd_opt_strs[1610] =
 /*  1125 */ "AGENTXSOCKET\0"
 /*  1138 */ "agentxsocket\0"
 /*  1151 */ "unix:/var/agentx/master\0"
-/*  1175 */ "display extended usage information and exit\0"
-/*  1219 */ "help\0"
-/*  1224 */ "extended usage information passed thru pager\0"
-/*  1269 */ "more-help\0"
-/*  1279 */ "output version information and exit\0"
-/*  1315 */ "version\0"
-/*  1323 */ "save the option state to a config file\0"
-/*  1362 */ "save-opts\0"
-/*  1372 */ "load options from a config file\0"
-/*  1404 */ "LOAD_OPTS\0"
-/*  1414 */ "no-load-opts\0"
-/*  1427 */ "no\0"
-/*  1430 */ "NTPSNMPD\0"
-/*  1439 */ "ntpsnmpd - NTP SNMP MIB agent - Ver. 4.2.8p6\n"
+/*  1175 */ "Seconds between refreshes of the cached ntpd variables\0"
+/*  1230 */ "CACHEINTERVAL\0"
+/*  1244 */ "cacheinterval\0"
+/*  1258 */ "Host name or control socket path of the ntpd to query\0"
+/*  1312 */ "NTPDHOST\0"
+/*  1321 */ "ntpdhost\0"
+/*  1330 */ "localhost\0"
+/*  1340 */ "display extended usage information and exit\0"
+/*  1384 */ "help\0"
+/*  1389 */ "extended usage information passed thru pager\0"
+/*  1434 */ "more-help\0"
+/*  1444 */ "output version information and exit\0"
+/*  1480 */ "version\0"
+/*  1488 */ "save the option state to a config file\0"
+/*  1527 */ "save-opts\0"
+/*  1537 */ "load options from a config file\0"
+/*  1569 */ "LOAD_OPTS\0"
+/*  1579 */ "no-load-opts\0"
+/*  1592 */ "no\0"
+/*  1595 */ "NTPSNMPD\0"
+/*  1604 */ "ntpsnmpd - NTP SNMP MIB agent - Ver. 4.2.8p6\n"
             "Usage:  %s [ -<flag> [<val>] | --<name>[{=| }<val>] ]...\n\0"
-/*  1542 */ "$HOME\0"
-/*  1548 */ ".\0"
-/*  1550 */ ".ntprc\0"
-/*  1557 */ "http://bugs.ntp.org, bugs@ntp.org\0"
-/*  1591 */ "\n\0"
-/*  1593 */ "ntpsnmpd 4.2.8p6";
+/*  1707 */ "$HOME\0"
+/*  1713 */ ".\0"
+/*  1715 */ ".ntprc\0"
+/*  1722 */ "http://bugs.ntp.org, bugs@ntp.org\0"
+/*  1756 */ "\n\0"
+/*  1758 */ "ntpsnmpd 4.2.8p6";
 
 /**
  *  nofork option description:
@@ -149,14 +156,44 @@ static char const ntpsnmpd_opt_strs[1610] =
 #define AGENTXSOCKET_FLAGS     (OPTST_DISABLED \
         | OPTST_SET_ARGTYPE(OPARG_TYPE_STRING))
 
+/**
+ *  cacheInterval option description:
+ */
+/** Descriptive text for the cacheInterval option */
+#define CACHEINTERVAL_DESC      (ntpsnmpd_opt_strs+1175)
+/** Upper-cased name for the cacheInterval option */
+#define CACHEINTERVAL_NAME      (ntpsnmpd_opt_strs+1230)
+/** Name string for the cacheInterval option */
+#define CACHEINTERVAL_name      (ntpsnmpd_opt_strs+1244)
+/** The compiled in default value for the cacheInterval option argument */
+#define CACHEINTERVAL_DFT_ARG   ((char const*)5)
+/** Compiled in flag settings for the cacheInterval option */
+#define CACHEINTERVAL_FLAGS     (OPTST_DISABLED \
+        | OPTST_SET_ARGTYPE(OPARG_TYPE_NUMERIC))
+
+/**
+ *  ntpdHost option description:
+ */
+/** Descriptive text for the ntpdHost option */
+#define NTPDHOST_DESC      (ntpsnmpd_opt_strs+1258)
+/** Upper-cased name for the ntpdHost option */
+#define NTPDHOST_NAME      (ntpsnmpd_opt_strs+1312)
+/** Name string for the ntpdHost option */
+#define NTPDHOST_name      (ntpsnmpd_opt_strs+1321)
+/** The compiled in default value for the ntpdHost option argument */
+#define NTPDHOST_DFT_ARG   (ntpsnmpd_opt_strs+1330)
+/** Compiled in flag settings for the ntpdHost option */
+#define NTPDHOST_FLAGS     (OPTST_DISABLED \
+        | OPTST_SET_ARGTYPE(OPARG_TYPE_STRING))
+
 /*
  *  Help/More_Help/Version option descriptions:
  */
-#define HELP_DESC       (ntpsnmpd_opt_strs+1175)
-#define HELP_name       (ntpsnmpd_opt_strs+1219)
+#define HELP_DESC       (ntpsnmpd_opt_strs+1340)
+#define HELP_name       (ntpsnmpd_opt_strs+1384)
 #ifdef HAVE_WORKING_FORK
-#define MORE_HELP_DESC  (ntpsnmpd_opt_strs+1224)
-#define MORE_HELP_name  (ntpsnmpd_opt_strs+1269)
+#define MORE_HELP_DESC  (ntpsnmpd_opt_strs+1389)
+#define MORE_HELP_name  (ntpsnmpd_opt_strs+1434)
 #define MORE_HELP_FLAGS (OPTST_IMM | OPTST_NO_INIT)
 #else
 #define MORE_HELP_DESC  HELP_DESC
@@ -169,14 +206,14 @@ static char const ntpsnmpd_opt_strs[1610] =
 #  define VER_FLAGS     (OPTST_SET_ARGTYPE(OPARG_TYPE_STRING) | \
                          OPTST_ARG_OPTIONAL | OPTST_IMM | OPTST_NO_INIT)
 #endif
-#define VER_DESC        (ntpsnmpd_opt_strs+1279)
-#define VER_name        (ntpsnmpd_opt_strs+1315)
-#define SAVE_OPTS_DESC  (ntpsnmpd_opt_strs+1323)
-#define SAVE_OPTS_name  (ntpsnmpd_opt_strs+1362)
-#define LOAD_OPTS_DESC     (ntpsnmpd_opt_strs+1372)
-#define LOAD_OPTS_NAME     (ntpsnmpd_opt_strs+1404)
-#define NO_LOAD_OPTS_name  (ntpsnmpd_opt_strs+1414)
-#define LOAD_OPTS_pfx      (ntpsnmpd_opt_strs+1427)
+#define VER_DESC        (ntpsnmpd_opt_strs+1444)
+#define VER_name        (ntpsnmpd_opt_strs+1480)
+#define SAVE_OPTS_DESC  (ntpsnmpd_opt_strs+1488)
+#define SAVE_OPTS_name  (ntpsnmpd_opt_strs+1527)
+#define LOAD_OPTS_DESC     (ntpsnmpd_opt_strs+1537)
+#define LOAD_OPTS_NAME     (ntpsnmpd_opt_strs+1569)
+#define NO_LOAD_OPTS_name  (ntpsnmpd_opt_strs+1579)
+#define LOAD_OPTS_pfx      (ntpsnmpd_opt_strs+1592)
 #define LOAD_OPTS_name     (NO_LOAD_OPTS_name + 3)
 /**
  *  Declare option callback procedures
@@ -233,6 +270,30 @@ static tOptDesc optDesc[OPTION_CT] = {
      /* desc, NAME, name */ AGENTXSOCKET_DESC, AGENTXSOCKET_NAME, AGENTXSOCKET_name,
      /* disablement strs */ NULL, NULL },
 
+  {  /* entry idx, value */ 3, VALUE_OPT_CACHEINTERVAL,
+     /* equiv idx, value */ 3, VALUE_OPT_CACHEINTERVAL,
+     /* equivalenced to  */ NO_EQUIVALENT,
+     /* min, max, act ct */ 0, 1, 0,
+     /* opt state flags  */ CACHEINTERVAL_FLAGS, 0,
+     /* last opt argumnt */ { CACHEINTERVAL_DFT_ARG },
+     /* arg list/cookie  */ NULL,
+     /* must/cannot opts */ NULL, NULL,
+     /* option proc      */ optionNumericVal,
+     /* desc, NAME, name */ CACHEINTERVAL_DESC, CACHEINTERVAL_NAME, CACHEINTERVAL_name,
+     /* disablement strs */ NULL, NULL },
+
+  {  /* entry idx, value */ 4, VALUE_OPT_NTPDHOST,
+     /* equiv idx, value */ 4, VALUE_OPT_NTPDHOST,
+     /* equivalenced to  */ NO_EQUIVALENT,
+     /* min, max, act ct */ 0, 1, 0,
+     /* opt state flags  */ NTPDHOST_FLAGS, 0,
+     /* last opt argumnt */ { NTPDHOST_DFT_ARG },
+     /* arg list/cookie  */ NULL,
+     /* must/cannot opts */ NULL, NULL,
+     /* option proc      */ NULL,
+     /* desc, NAME, name */ NTPDHOST_DESC, NTPDHOST_NAME, NTPDHOST_name,
+     /* disablement strs */ NULL, NULL },
+
   {  /* entry idx, value */ INDEX_OPT_VERSION, VALUE_OPT_VERSION,
      /* equiv idx value  */ NO_EQUIVALENT, VALUE_OPT_VERSION,
      /* equivalenced to  */ NO_EQUIVALENT,
@@ -301,24 +362,24 @@ static tOptDesc optDesc[OPTION_CT] = {
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /** Reference to the upper cased version of ntpsnmpd. */
-#define zPROGNAME       (ntpsnmpd_opt_strs+1430)
+#define zPROGNAME       (ntpsnmpd_opt_strs+1595)
 /** Reference to the title line for ntpsnmpd usage. */
-#define zUsageTitle     (ntpsnmpd_opt_strs+1439)
+#define zUsageTitle     (ntpsnmpd_opt_strs+1604)
 /** ntpsnmpd configuration file name. */
-#define zRcName         (ntpsnmpd_opt_strs+1550)
+#define zRcName         (ntpsnmpd_opt_strs+1715)
 /** Directories to search for ntpsnmpd config files. */
 static char const * const apzHomeList[3] = {
-    ntpsnmpd_opt_strs+1542,
-    ntpsnmpd_opt_strs+1548,
+    ntpsnmpd_opt_strs+1707,
+    ntpsnmpd_opt_strs+1713,
     NULL };
 /** The ntpsnmpd program bug email address. */
-#define zBugsAddr       (ntpsnmpd_opt_strs+1557)
+#define zBugsAddr       (ntpsnmpd_opt_strs+1722)
 /** Clarification/explanation of what ntpsnmpd does. */
-#define zExplain        (ntpsnmpd_opt_strs+1591)
+#define zExplain        (ntpsnmpd_opt_strs+1756)
 /** Extra detail explaining what ntpsnmpd does. */
 #define zDetail         (NULL)
 /** The full version string for ntpsnmpd. */
-#define zFullVersion    (ntpsnmpd_opt_strs+1593)
+#define zFullVersion    (ntpsnmpd_opt_strs+1758)
 /* extracted from optcode.tlib near line 364 */
 
 #if defined(ENABLE_NLS)
@@ -419,7 +480,7 @@ tOptions ntpsnmpdOptions = {
       NO_EQUIVALENT, /* '-#' option index */
       NO_EQUIVALENT /* index of default opt */
     },
-    8 /* full option count */, 3 /* user option count */,
+    10 /* full option count */, 5 /* user option count */,
     ntpsnmpd_full_usage, ntpsnmpd_short_usage,
     NULL, NULL,
     PKGDATADIR, ntpsnmpd_packager_info
@@ -583,6 +644,12 @@ implied warranty.\n"));
   /* referenced via ntpsnmpdOptions.pOptDesc->pzText */
   puts(_("The socket address ntpsnmpd uses to connect to net-snmpd"));
 
+  /* referenced via ntpsnmpdOptions.pOptDesc->pzText */
+  puts(_("Seconds between refreshes of the cached ntpd variables"));
+
+  /* referenced via ntpsnmpdOptions.pOptDesc->pzText */
+  puts(_("Host name or control socket path of the ntpd to query"));
+
   /* referenced via ntpsnmpdOptions.pOptDesc->pzText */
   puts(_("display extended usage information and exit"));
 
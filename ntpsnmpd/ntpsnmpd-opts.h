@@ -64,17 +64,19 @@
  *  Enumeration of each option type for ntpsnmpd
  */
 typedef enum {
-    INDEX_OPT_NOFORK        =  0,
-    INDEX_OPT_SYSLOG        =  1,
-    INDEX_OPT_AGENTXSOCKET  =  2,
-    INDEX_OPT_VERSION       =  3,
-    INDEX_OPT_HELP          =  4,
-    INDEX_OPT_MORE_HELP     =  5,
-    INDEX_OPT_SAVE_OPTS     =  6,
-    INDEX_OPT_LOAD_OPTS     =  7
+    INDEX_OPT_NOFORK         =  0,
+    INDEX_OPT_SYSLOG         =  1,
+    INDEX_OPT_AGENTXSOCKET   =  2,
+    INDEX_OPT_CACHEINTERVAL  =  3,
+    INDEX_OPT_NTPDHOST       =  4,
+    INDEX_OPT_VERSION        =  5,
+    INDEX_OPT_HELP           =  6,
+    INDEX_OPT_MORE_HELP      =  7,
+    INDEX_OPT_SAVE_OPTS      =  8,
+    INDEX_OPT_LOAD_OPTS      =  9
 } teOptIndex;
 /** count of all options for ntpsnmpd */
-#define OPTION_CT    8
+#define OPTION_CT    10
 /** ntpsnmpd version */
 #define NTPSNMPD_VERSION       "4.2.8p6"
 /** Full ntpsnmpd version text */
@@ -143,10 +145,20 @@ typedef enum {
 #  warning undefining AGENTXSOCKET due to option name conflict
 #  undef   AGENTXSOCKET
 # endif
+# ifdef    CACHEINTERVAL
+#  warning undefining CACHEINTERVAL due to option name conflict
+#  undef   CACHEINTERVAL
+# endif
+# ifdef    NTPDHOST
+#  warning undefining NTPDHOST due to option name conflict
+#  undef   NTPDHOST
+# endif
 #else  /* NO_OPTION_NAME_WARNINGS */
 # undef NOFORK
 # undef SYSLOG
 # undef AGENTXSOCKET
+# undef CACHEINTERVAL
+# undef NTPDHOST
 #endif  /*  NO_OPTION_NAME_WARNINGS */
 
 /**
@@ -156,12 +168,16 @@ typedef enum {
 #define VALUE_OPT_NOFORK         'n'
 #define VALUE_OPT_SYSLOG         'p'
 #define VALUE_OPT_AGENTXSOCKET   0x1001
+#define VALUE_OPT_CACHEINTERVAL  0x1002
+
+#define OPT_VALUE_CACHEINTERVAL  (DESC(CACHEINTERVAL).optArg.argInt)
+#define VALUE_OPT_NTPDHOST       0x1003
 /** option flag (value) for help-value option */
 #define VALUE_OPT_HELP          '?'
 /** option flag (value) for more-help-value option */
 #define VALUE_OPT_MORE_HELP     '!'
 /** option flag (value) for version-value option */
-#define VALUE_OPT_VERSION       0x1002
+#define VALUE_OPT_VERSION       0x1004
 /** option flag (value) for save-opts-value option */
 #define VALUE_OPT_SAVE_OPTS     '>'
 /** option flag (value) for load-opts-value option */
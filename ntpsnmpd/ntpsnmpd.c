@@ -85,7 +85,7 @@ main (int argc, char **argv) {
   init_agent("ntpsnmpd");
 
   /* Try to connect to ntpd */
-  if ( ntpq_openhost("localhost", 0) == 0 )
+  if ( ntpq_openhost(OPT_ARG(NTPDHOST), 0) == 0 )
   {
 	fprintf(stderr, "Error: Could not connect to ntpd. Aborting.\n");
 	exit(1);
@@ -93,6 +93,7 @@ main (int argc, char **argv) {
   
 
   /* Register callback functions ...  */
+  ntpsnmpd_set_cache_interval(OPT_VALUE_CACHEINTERVAL);
   init_ntpSnmpSubagentObject();  
   init_snmp("ntpsnmpd");
 
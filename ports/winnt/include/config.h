@@ -409,6 +409,7 @@ typedef int ssize_t;	/* ssize is an int */
 
 # define HAVE_STRUCT_TIMESPEC
 # define HAVE_IO_COMPLETION_PORT
+# define NTP_THREAD_LOCAL		__declspec(thread)
 # define ISC_PLATFORM_NEEDNTOP
 # define ISC_PLATFORM_NEEDPTON
 
@@ -438,6 +438,9 @@ iocompletionthread(void *NotUsed)
 			       THREAD_PRIORITY_ABOVE_NORMAL))
 		msyslog(LOG_ERR, "Can't set thread priority: %m");
 
+	/* count received packets apart from the main thread */
+	ctr_thread_init();
+
 	for(;;) {
 		if (GetQueuedCompletionStatus(
 					hIoCompletionPort, 
@@ -1436,9 +1439,9 @@ OnSocketRecv(
 		INSIST(buff->recv_srcadr_len <= sizeof(buff->recv_srcadr));
 		buff->receiver = &receive; 
 		buff->dstadr   = inter;
-		packets_received++;
-		handler_pkts++;
-		inter->received++;
+		CTR_INC(CTR_PACKETS_RECEIVED);
+		CTR_INC(CTR_HANDLER_PKTS);
+		CTR_OBJ_INC(inter->received);
 		add_full_recv_buffer(buff);
 
 		DPRINTF(2, ("Received %d bytes fd %d in buffer %p from %s\n", 
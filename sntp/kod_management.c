@@ -2,6 +2,15 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+#ifdef HAVE_FCNTL_H
+# include <fcntl.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+# include <sys/mman.h>
+#endif
 
 #include "kod_management.h"
 #include "log.h"
@@ -10,13 +19,330 @@
 #include "ntp_worker.h"
 #include "ntp_debug.h"
 
+/*
+ * The KoD entries are kept in a hash table keyed by hostname.  The db
+ * file keeps its text format, one "timestamp type hostname" line per
+ * entry.  It is mapped when kod_init_kod_db() opens it and indexed on
+ * first use, where a later line for a host replaces an earlier one and
+ * expired lines are dropped.  add_entry() appends to the file, so it is
+ * only rewritten at exit if a deletion happened or it holds at least as
+ * many stale lines as live entries.
+ */
+#define KOD_HASH_INIT	64		/* buckets, a power of 2 */
+
+typedef struct kod_node_tag kod_node;
+struct kod_node_tag {
+	kod_node *		link;	/* hash chain */
+	struct kod_entry	entry;
+};
+
 int kod_init = 0, kod_db_cnt = 0;
 const char *kod_db_file;
-struct kod_entry **kod_db;	/* array of pointers to kod_entry */
+time_t kod_expire = KOD_EXPIRE;
+
+static kod_node **	kod_hash;	/* kod_hash_size chains */
+static u_int		kod_hash_size;
+static int		kod_db_stale;	/* dead lines in the file */
+static int		kod_db_deleted;	/* file needs a rewrite */
+static int		kod_db_readonly;
+static int		kod_db_afd = -1; /* append descriptor */
+static char *		kod_map;	/* file contents to index */
+static size_t		kod_map_len;
+static int		kod_map_mmapped;
+
+static u_int32	kod_hash_name(const char *);
+static kod_node **kod_slot(const char *);
+static void	kod_grow(void);
+static void	kod_index(void);
+static void	kod_unmap(void);
+static void	kod_free_all(void);
+static int	kod_expired(time_t);
+static int	kod_parse_line(const char *, const char *,
+			       struct kod_entry *);
+static int	kod_format_line(char *, size_t, const struct kod_entry *);
+static int	kod_open_append(void);
+static void	kod_append(const struct kod_entry *);
+static int	kod_mkdirs(void);
+static int	kod_name_cmp(const void *, const void *);
+
+
+/*
+ * FNV-1a, the names are short and mostly addresses.
+ */
+static u_int32
+kod_hash_name(
+	const char *	name
+	)
+{
+	const u_char *	cp;
+	u_int32		h;
+
+	h = 2166136261U;
+	for (cp = (const u_char *)name; *cp != '\0'; cp++) {
+		h ^= *cp;
+		h *= 16777619U;
+	}
+
+	return h;
+}
+
+
+/*
+ * kod_slot() returns the link pointing to the node for name, or to the
+ * NULL terminating its chain.
+ */
+static kod_node **
+kod_slot(
+	const char *	name
+	)
+{
+	kod_node **	pp;
+
+	kod_index();
+	pp = &kod_hash[kod_hash_name(name) & (kod_hash_size - 1)];
+	while (*pp != NULL && strcmp((*pp)->entry.hostname, name))
+		pp = &(*pp)->link;
+
+	return pp;
+}
 
 
 /*
- * Search for a KOD entry
+ * kod_grow() doubles the table once the chains average two nodes.
+ */
+static void
+kod_grow(void)
+{
+	kod_node **	old;
+	kod_node *	n;
+	u_int		old_size;
+	u_int		b;
+	u_int32		h;
+
+	if (kod_hash != NULL && (u_int)kod_db_cnt < 2 * kod_hash_size)
+		return;
+	old = kod_hash;
+	old_size = kod_hash_size;
+	kod_hash_size = (old != NULL)
+			    ? 2 * old_size
+			    : KOD_HASH_INIT;
+	kod_hash = eallocarray(kod_hash_size, sizeof(kod_hash[0]));
+	memset(kod_hash, 0, kod_hash_size * sizeof(kod_hash[0]));
+	for (b = 0; b < old_size; b++)
+		while (old[b] != NULL) {
+			n = old[b];
+			old[b] = n->link;
+			h = kod_hash_name(n->entry.hostname);
+			n->link = kod_hash[h & (kod_hash_size - 1)];
+			kod_hash[h & (kod_hash_size - 1)] = n;
+		}
+	free(old);
+}
+
+
+static int
+kod_expired(
+	time_t	timestamp
+	)
+{
+	return kod_expire > 0 && timestamp + kod_expire < time(NULL);
+}
+
+
+/*
+ * kod_parse_line() decodes one line of the db file between cp and eol
+ * into *pke, returning FALSE if it is not "hex-timestamp type name".
+ */
+static int
+kod_parse_line(
+	const char *		cp,
+	const char *		eol,
+	struct kod_entry *	pke
+	)
+{
+	unsigned long long	ull;
+	const char *		tok;
+	size_t			len;
+	int			digit;
+
+	ull = 0;
+	for (tok = cp; cp < eol && ' ' != *cp; cp++) {
+		if (*cp >= '0' && *cp <= '9')
+			digit = *cp - '0';
+		else if (*cp >= 'a' && *cp <= 'f')
+			digit = *cp - 'a' + 10;
+		else if (*cp >= 'A' && *cp <= 'F')
+			digit = *cp - 'A' + 10;
+		else
+			return FALSE;
+		ull = (ull << 4) | digit;
+	}
+	if (cp == tok || cp - tok > 16 || cp == eol)
+		return FALSE;
+	pke->timestamp = (time_t)ull;
+
+	for (tok = ++cp; cp < eol && ' ' != *cp; cp++)
+		/* empty */ ;
+	len = cp - tok;
+	if (0 == len || len >= sizeof(pke->type) || cp == eol)
+		return FALSE;
+	memcpy(pke->type, tok, len);
+	pke->type[len] = '\0';
+
+	for (tok = ++cp; cp < eol && ' ' != *cp && '\r' != *cp; cp++)
+		/* empty */ ;
+	len = cp - tok;
+	if (0 == len || len >= sizeof(pke->hostname))
+		return FALSE;
+	memcpy(pke->hostname, tok, len);
+	pke->hostname[len] = '\0';
+
+	return TRUE;
+}
+
+
+static int
+kod_format_line(
+	char *			buf,
+	size_t			bufsz,
+	const struct kod_entry *pke
+	)
+{
+	return snprintf(buf, bufsz, "%16.16llx %s %s\n",
+			(unsigned long long)pke->timestamp, pke->type,
+			pke->hostname);
+}
+
+
+/*
+ * kod_index() builds the hash table from the mapped db file the first
+ * time an entry is needed.
+ */
+static void
+kod_index(void)
+{
+	struct kod_entry	ke;
+	kod_node **		pp;
+	kod_node *		n;
+	const char *		cp;
+	const char *		eol;
+	const char *		end;
+	int			lineno;
+	int			bad;
+
+	if (kod_hash != NULL)
+		return;
+	kod_grow();
+	if (NULL == kod_map)
+		return;
+
+	TRACE(2, ("Indexing KoD db file %s...\n", kod_db_file));
+	bad = 0;
+	lineno = 0;
+	end = kod_map + kod_map_len;
+	for (cp = kod_map; cp < end; cp = eol + 1) {
+		eol = memchr(cp, '\n', end - cp);
+		if (NULL == eol)
+			eol = end;
+		lineno++;
+		/* ignore blank lines */
+		if (eol == cp)
+			continue;
+		ZERO(ke);
+		if (!kod_parse_line(cp, eol, &ke)) {
+			if (!bad++)
+				msyslog(LOG_DEBUG,
+					"Syntax error in KoD db file %s in line %i",
+					kod_db_file, lineno);
+			kod_db_stale++;
+			continue;
+		}
+		if (kod_expired(ke.timestamp)) {
+			kod_db_stale++;
+			continue;
+		}
+		pp = kod_slot(ke.hostname);
+		if (*pp != NULL) {
+			kod_db_stale++;
+			(*pp)->entry = ke;
+			continue;
+		}
+		n = emalloc_zero(sizeof(*n));
+		n->entry = ke;
+		*pp = n;
+		kod_db_cnt++;
+		kod_grow();
+	}
+	kod_unmap();
+
+	TRACE(2, ("KoD db %s: %d entries, %d stale lines\n",
+		  kod_db_file, kod_db_cnt, kod_db_stale));
+}
+
+
+static void
+kod_unmap(void)
+{
+	if (NULL == kod_map)
+		return;
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+	if (kod_map_mmapped)
+		munmap(kod_map, kod_map_len);
+	else
+#endif
+		free(kod_map);
+	kod_map = NULL;
+	kod_map_len = 0;
+	kod_map_mmapped = FALSE;
+}
+
+
+static void
+kod_free_all(void)
+{
+	kod_node *	n;
+	u_int		b;
+
+	for (b = 0; b < kod_hash_size; b++)
+		while (kod_hash[b] != NULL) {
+			n = kod_hash[b];
+			kod_hash[b] = n->link;
+			free(n);
+		}
+	free(kod_hash);
+	kod_hash = NULL;
+	kod_hash_size = 0;
+	kod_db_cnt = 0;
+	kod_db_stale = 0;
+	kod_db_deleted = FALSE;
+	kod_unmap();
+	if (kod_db_afd != -1) {
+		close(kod_db_afd);
+		kod_db_afd = -1;
+	}
+}
+
+
+/*
+ * Look up the KoD entry of a host.  Expired entries are not found.
+ */
+struct kod_entry *
+lookup_entry(
+	const char *	hostname
+	)
+{
+	kod_node *	n;
+
+	n = *kod_slot(hostname);
+	if (NULL == n || kod_expired(n->entry.timestamp))
+		return NULL;
+
+	return &n->entry;
+}
+
+
+/*
+ * Search for a KOD entry, returning an allocated copy in *dst.
  */
 int
 search_entry(
@@ -24,27 +350,17 @@ search_entry(
 	struct kod_entry **dst
 	)
 {
-	register int a, b, resc = 0;
+	struct kod_entry *	pke;
 
-	for (a = 0; a < kod_db_cnt; a++)
-		if (!strcmp(kod_db[a]->hostname, hostname))
-			resc++;
-
-	if (!resc) {
+	pke = lookup_entry(hostname);
+	if (NULL == pke) {
 		*dst = NULL;
 		return 0;
 	}
+	*dst = emalloc(sizeof(**dst));
+	**dst = *pke;
 
-	*dst = eallocarray(resc, sizeof(**dst));
-
-	b = 0;
-	for (a = 0; a < kod_db_cnt; a++)
-		if (!strcmp(kod_db[a]->hostname, hostname)) {
-			(*dst)[b] = *kod_db[a];
-			b++;
-		}
-
-	return resc;
+	return 1;
 }
 
 
@@ -54,35 +370,26 @@ add_entry(
 	const char *	type	/* 4 bytes not \0 terminated */
 	)
 {
-	int n;
-	struct kod_entry *pke;
-
-	pke = emalloc_zero(sizeof(*pke));
-	pke->timestamp = time(NULL);
-	memcpy(pke->type, type, 4);
-	pke->type[sizeof(pke->type) - 1] = '\0';
-	strlcpy(pke->hostname, hostname, sizeof(pke->hostname));
-
-	/*
-	 * insert in address ("hostname") order to find duplicates
-	 */
-	for (n = 0; n < kod_db_cnt; n++)
-		if (strcmp(kod_db[n]->hostname, pke->hostname) >= 0)
-			break;
-
-	if (n < kod_db_cnt &&
-	    0 == strcmp(kod_db[n]->hostname, pke->hostname)) {
-		kod_db[n]->timestamp = pke->timestamp;
-		free(pke);
-		return;
+	kod_node **	pp;
+	kod_node *	n;
+
+	pp = kod_slot(hostname);
+	n = *pp;
+	if (n != NULL) {
+		/* the line appended below overrides the old one */
+		kod_db_stale++;
+	} else {
+		n = emalloc_zero(sizeof(*n));
+		strlcpy(n->entry.hostname, hostname,
+			sizeof(n->entry.hostname));
+		*pp = n;
+		kod_db_cnt++;
 	}
-
-	kod_db_cnt++;
-	kod_db = erealloc(kod_db, kod_db_cnt * sizeof(kod_db[0]));
-	if (n != kod_db_cnt - 1)
-		memmove(&kod_db[n + 1], &kod_db[n],
-			sizeof(kod_db[0]) * ((kod_db_cnt - 1) - n));
-	kod_db[n] = pke;
+	n->entry.timestamp = time(NULL);
+	memcpy(n->entry.type, type, 4);
+	n->entry.type[sizeof(n->entry.type) - 1] = '\0';
+	kod_append(&n->entry);
+	kod_grow();
 }
 
 
@@ -92,22 +399,69 @@ delete_entry(
 	const char *	type
 	)
 {
-	int a;
-
-	for (a = 0; a < kod_db_cnt; a++)
-		if (!strcmp(kod_db[a]->hostname, hostname)
-		    && !strcmp(kod_db[a]->type, type))
-			break;
+	kod_node **	pp;
+	kod_node *	n;
 
-	if (a == kod_db_cnt)
+	pp = kod_slot(hostname);
+	n = *pp;
+	if (NULL == n || strcmp(n->entry.type, type))
 		return;
 
-	free(kod_db[a]);
+	*pp = n->link;
+	free(n);
 	kod_db_cnt--;
+	kod_db_deleted = TRUE;
+}
+
+
+/*
+ * kod_open_append() opens the db file for kod_append(), creating it
+ * and its directories as needed.
+ */
+static int
+kod_open_append(void)
+{
+	kod_db_afd = open(kod_db_file, O_WRONLY | O_APPEND | O_CREAT, 0644);
+	if (-1 == kod_db_afd && ENOENT == errno && kod_mkdirs())
+		kod_db_afd = open(kod_db_file,
+				  O_WRONLY | O_APPEND | O_CREAT, 0644);
+	if (-1 == kod_db_afd) {
+		msyslog(LOG_WARNING, "Can't open KOD db file %s for writing: %m",
+			kod_db_file);
+		kod_db_readonly = TRUE;
+
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+
+/*
+ * kod_append() adds the line for an entry to the end of the db file.
+ */
+static void
+kod_append(
+	const struct kod_entry *pke
+	)
+{
+	char	line[16 + 1 + 4 + 1 + 255 + 1 + 1];
+	int	len;
 
-	if (a < kod_db_cnt)
-		memmove(&kod_db[a], &kod_db[a + 1],
-			(kod_db_cnt - a) * sizeof(kod_db[0]));
+	if (kod_db_readonly || NULL == kod_db_file)
+		return;
+#ifdef WORK_FORK
+	if (worker_process)
+		return;
+#endif
+	if (-1 == kod_db_afd && !kod_open_append())
+		return;
+	len = kod_format_line(line, sizeof(line), pke);
+	if (len != write(kod_db_afd, line, len)) {
+		msyslog(LOG_WARNING, "Can't append to KOD db file %s: %m",
+			kod_db_file);
+		kod_db_deleted = TRUE;
+	}
 }
 
 
@@ -118,42 +472,81 @@ atexit_write_kod_db(void)
 	if (worker_process)
 		return;
 #endif
-	write_kod_db();
+	if (kod_db_deleted ||
+	    (kod_db_stale > 0 && kod_db_stale >= kod_db_cnt))
+		write_kod_db();
+}
+
+
+/*
+ * If the db file cannot be created, blindly attempt to create each
+ * directory in its path.
+ */
+static int
+kod_mkdirs(void)
+{
+	char *	path;
+	char *	pch;
+	int	dirmode;
+
+	if (!strlen(kod_db_file))
+		return FALSE;
+	dirmode = S_IRUSR | S_IWUSR | S_IXUSR
+		| S_IRGRP | S_IXGRP
+		| S_IROTH | S_IXOTH;
+	path = estrdup(kod_db_file);
+	pch = strchr(path + 1, DIR_SEP);
+	while (NULL != pch) {
+		*pch = '\0';
+		if (-1 == mkdir(path, dirmode) && errno != EEXIST) {
+			msyslog(LOG_ERR, "mkdir(%s) failed: %m", path);
+			free(path);
+			return FALSE;
+		}
+		*pch = DIR_SEP;
+		pch = strchr(pch + 1, DIR_SEP);
+	}
+	free(path);
+
+	return TRUE;
 }
 
 
+static int
+kod_name_cmp(
+	const void *	a,
+	const void *	b
+	)
+{
+	const kod_node * const *	pa = a;
+	const kod_node * const *	pb = b;
+
+	return strcmp((*pa)->entry.hostname, (*pb)->entry.hostname);
+}
+
+
+/*
+ * write_kod_db() rewrites the db file with the live entries in
+ * hostname order.
+ */
 int
 write_kod_db(void)
 {
 	FILE *db_s;
-	char *pch;
-	int dirmode;
-	register int a;
+	kod_node **sorted;
+	kod_node *n;
+	char line[16 + 1 + 4 + 1 + 255 + 1 + 1];
+	u_int b;
+	int a;
 
+	kod_index();
+	if (kod_db_afd != -1) {
+		close(kod_db_afd);
+		kod_db_afd = -1;
+	}
 	db_s = fopen(kod_db_file, "w");
-
-	/*
-	 * If opening fails, blindly attempt to create each directory
-	 * in the path first, then retry the open.
-	 */
-	if (NULL == db_s && strlen(kod_db_file)) {
-		dirmode = S_IRUSR | S_IWUSR | S_IXUSR
-			| S_IRGRP | S_IXGRP
-			| S_IROTH | S_IXOTH;
-		pch = strchr(kod_db_file + 1, DIR_SEP);
-		while (NULL != pch) {
-			*pch = '\0';
-			if (-1 == mkdir(kod_db_file, dirmode)
-			    && errno != EEXIST) {
-				msyslog(LOG_ERR, "mkdir(%s) failed: %m",
-					kod_db_file);
-				return FALSE;
-			}
-			*pch = DIR_SEP;
-			pch = strchr(pch + 1, DIR_SEP);
-		}
+	if (NULL == db_s && kod_mkdirs())
 		db_s = fopen(kod_db_file, "w");
-	}
 
 	if (NULL == db_s) {
 		msyslog(LOG_WARNING, "Can't open KOD db file %s for writing: %m",
@@ -162,14 +555,23 @@ write_kod_db(void)
 		return FALSE;
 	}
 
-	for (a = 0; a < kod_db_cnt; a++) {
-		fprintf(db_s, "%16.16llx %s %s\n", (unsigned long long)
-			kod_db[a]->timestamp, kod_db[a]->type,
-			kod_db[a]->hostname);
+	sorted = eallocarray(kod_db_cnt + 1, sizeof(sorted[0]));
+	a = 0;
+	for (b = 0; b < kod_hash_size; b++)
+		for (n = kod_hash[b]; n != NULL; n = n->link)
+			if (!kod_expired(n->entry.timestamp))
+				sorted[a++] = n;
+	qsort(sorted, a, sizeof(sorted[0]), &kod_name_cmp);
+	for (b = 0; b < (u_int)a; b++) {
+		kod_format_line(line, sizeof(line), &sorted[b]->entry);
+		fputs(line, db_s);
 	}
+	free(sorted);
 
 	fflush(db_s);
 	fclose(db_s);
+	kod_db_stale = 0;
+	kod_db_deleted = FALSE;
 
 	return TRUE;
 }
@@ -181,121 +583,56 @@ kod_init_kod_db(
 	int		readonly
 	)
 {
-	/*
-	 * Max. of 254 characters for hostname, 10 for timestamp, 4 for
-	 * kisscode, 2 for spaces, 1 for \n, and 1 for \0
-	 */
-	char fbuf[254+10+4+2+1+1];
-	FILE *db_s;
-	int a, b, sepc, len;
-	unsigned long long ull;
-	char *str_ptr;
-	char error = 0;
+	struct stat	st;
+	int		fd;
 
 	TRACE(2, ("Initializing KOD DB...\n"));
 
+	if (kod_init)
+		kod_free_all();
+	kod_init = TRUE;
 	kod_db_file = estrdup(db_file);
+	kod_db_readonly = readonly;
 
-	db_s = fopen(db_file, "r");
-
-	if (NULL == db_s) {
+	fd = open(db_file, O_RDONLY);
+	if (-1 == fd) {
 		msyslog(LOG_WARNING, "kod_init_kod_db(): Cannot open KoD db file %s: %m",
 			db_file);
 
 		return;
 	}
-
-	if (debug)
-		printf("Starting to read KoD file %s...\n", db_file);
-	/* First let's see how many entries there are and check for right syntax */
-
-	while (!feof(db_s) && NULL != fgets(fbuf, sizeof(fbuf), db_s)) {
-
-		/* ignore blank lines */
-		if ('\n' == fbuf[0])
-			continue;
-
-		sepc = 0;
-		len = strlen(fbuf);
-		for (a = 0; a < len; a++) {
-			if (' ' == fbuf[a])
-				sepc++;
-
-			if ('\n' == fbuf[a]) {
-				if (sepc != 2) {
-					if (strcmp(db_file, "/dev/null"))
-						msyslog(LOG_DEBUG,
-							"Syntax error in KoD db file %s in line %i (missing space)",
-							db_file,
-							kod_db_cnt + 1);
-					fclose(db_s);
-					return;
-				}
-				sepc = 0;
-				kod_db_cnt++;
+	if (0 == fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0) {
+		kod_map_len = (size_t)st.st_size;
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+		kod_map = mmap(NULL, kod_map_len, PROT_READ, MAP_PRIVATE,
+			       fd, 0);
+		if (MAP_FAILED == kod_map)
+			kod_map = NULL;
+		else
+			kod_map_mmapped = TRUE;
+#endif
+		if (NULL == kod_map) {
+			kod_map = emalloc(kod_map_len);
+			if (read(fd, kod_map, kod_map_len) !=
+			    (ssize_t)kod_map_len) {
+				msyslog(LOG_WARNING,
+					"An error occured while reading the KoD db file %s",
+					db_file);
+				kod_unmap();
 			}
 		}
 	}
+	close(fd);
+	TRACE(2, ("KoD DB %s mapped, %lu octets\n", db_file,
+		  (u_long)kod_map_len));
 
-	if (0 == kod_db_cnt) {
-		TRACE(2, ("KoD DB %s empty.\n", db_file));
-		goto wrapup;
-	}
-
-	TRACE(2, ("KoD DB %s contains %d entries, reading...\n", db_file, kod_db_cnt));
-
-	rewind(db_s);
-
-	kod_db = eallocarray(kod_db_cnt, sizeof(kod_db[0]));
-
-	/* Read contents of file */
-	for (b = 0; 
-	     !feof(db_s) && !ferror(db_s) && b < kod_db_cnt;
-	     b++) {
-
-		str_ptr = fgets(fbuf, sizeof(fbuf), db_s);
-		if (NULL == str_ptr) {
-			error = 1;
-			break;
-		}
-
-		/* ignore blank lines */
-		if ('\n' == fbuf[0]) {
-			b--;
-			continue;
-		}
-
-		kod_db[b] = emalloc(sizeof(*kod_db[b]));
-
-		if (3 != sscanf(fbuf, "%llx %4s %254s", &ull,
-		    kod_db[b]->type, kod_db[b]->hostname)) {
-
-			free(kod_db[b]);
-			kod_db[b] = NULL;
-			error = 1;
-			break;
-		}
-
-		kod_db[b]->timestamp = (time_t)ull;
-	}
-
-	if (ferror(db_s) || error) {
-		kod_db_cnt = b;
-		msyslog(LOG_WARNING, "An error occured while parsing the KoD db file %s",
-			db_file);
-		fclose(db_s);
-
+	if (readonly)
 		return;
-	}
-
-    wrapup:
-	fclose(db_s);
-	for (a = 0; a < kod_db_cnt; a++)
-		TRACE(2, ("KoD entry %d: %s at %llx type %s\n", a,
-			  kod_db[a]->hostname,
-			  (unsigned long long)kod_db[a]->timestamp,
-			  kod_db[a]->type));
-
-	if (!readonly && write_kod_db())
-		atexit(&atexit_write_kod_db);
+	/*
+	 * Opening the file for the appends now tells if it is writable
+	 * at all, as the rewrite done here before did.
+	 */
+	if (!kod_open_append())
+		return;
+	atexit(&atexit_write_kod_db);
 }
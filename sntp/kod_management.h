@@ -9,6 +9,12 @@ struct kod_entry {
 	char type[5];
 };
 
+/* KoD entries older than this many seconds are dropped, 0 keeps all */
+#define KOD_EXPIRE	(7 * 86400)
+
+extern time_t kod_expire;
+
+struct kod_entry *lookup_entry(const char *hostname);
 int search_entry(const char *hostname, struct kod_entry **dst);
 void add_entry(const char *hostname, const char *type);
 void delete_entry(const char *hostname, const char *type);
@@ -38,6 +38,11 @@ struct event *ev_sock4;
 struct event *ev_sock6;
 struct event *ev_worker_timeout;
 struct event *ev_xmt_timer;
+struct event *ev_survey_timer;
+FILE *	survey_fp;		/* --survey hosts not yet started */
+int	survey_active;		/* hosts being surveyed */
+int	survey_inflight;
+int	survey_retries;
 
 struct dns_ctx {
 	const char *	name;
@@ -46,6 +51,7 @@ struct dns_ctx {
 #define CTX_UCST	0x0002
 #define CTX_xCST	0x0003
 #define CTX_CONC	0x0004
+#define CTX_SRVY	0x0008
 #define CTX_unused	0xfffd
 	int		key_id;
 	struct timeval	timeout;
@@ -59,6 +65,7 @@ struct sent_pkt_tag {
 	sockaddr_u		addr;
 	time_t			stime;
 	int			done;
+	int			tries;
 	struct pkt		x_pkt;
 };
 
@@ -119,6 +126,15 @@ int  set_time(double offset);
 void dec_pending_ntp(const char *, sockaddr_u *);
 int  libevent_version_ok(void);
 int  gettimeofday_cached(struct event_base *b, struct timeval *tv);
+void survey_start(const char *file);
+void survey_next(void);
+void survey_timer_cb(evutil_socket_t, short, void *);
+void survey_finish(sent_pkt *);
+void survey_done(struct dns_ctx *);
+void survey_report(const char *hostname, sockaddr_u *host,
+		   const char *status, struct pkt *rpkt,
+		   const char *kod, double offset, double delay);
+void survey_str(const char *);
 
 
 /*
@@ -167,9 +183,20 @@ sntp_main (
 	if (HAVE_OPT(LOGFILE))
 		open_logfile(OPT_ARG(LOGFILE));
 
+	/* a survey writes its records to stdout, keep messages out */
+	if (HAVE_OPT(SURVEY))
+		msyslog_term = FALSE;
+
 	msyslog(LOG_INFO, "%s", sntpVersion);
 
-	if (0 == argc && !HAVE_OPT(BROADCAST) && !HAVE_OPT(CONCURRENT)) {
+	if (HAVE_OPT(SURVEY)) {
+		if (argc > 0) {
+			fprintf(stderr, "%s: hostnames cannot be given with --survey.\n",
+				progname);
+			exit(EX_USAGE);
+		}
+	} else if (0 == argc && !HAVE_OPT(BROADCAST) &&
+		   !HAVE_OPT(CONCURRENT)) {
 		printf("%s: Must supply at least one of -b hostname, -c hostname, or hostname.\n",
 		       progname);
 		exit(EX_USAGE);
@@ -272,6 +299,9 @@ sntp_main (
 	for (i = 0; i < argc; ++i)
 		handle_lookup(argv[i], CTX_UCST);
 
+	if (HAVE_OPT(SURVEY))
+		survey_start(OPT_ARG(SURVEY));
+
 	gettimeofday_cached(base, &start_tv);
 	event_base_dispatch(base);
 	event_base_free(base);
@@ -450,11 +480,17 @@ sntp_name_resolved(
 	u_int			xmt_delay_v6;
 	u_int			xmt_delay;
 	size_t			octets;
+	int			kods;
 
 	xmt_delay_v4 = 0;
 	xmt_delay_v6 = 0;
+	kods = 0;
 	dctx = context;
-	if (rescode) {
+	if (rescode && (CTX_SRVY & dctx->flags)) {
+		survey_report(dctx->name, NULL, "unresolved", NULL, NULL,
+			      0., 0.);
+		survey_done(dctx);
+	} else if (rescode) {
 #ifdef EAI_SYSTEM
 		if (EAI_SYSTEM == rescode) {
 			errno = gai_errno;
@@ -472,8 +508,10 @@ sntp_name_resolved(
 
 		for (ai = addr; ai != NULL; ai = ai->ai_next) {
 
-			if (check_kod(ai))
+			if (check_kod(ai)) {
+				kods++;
 				continue;
+			}
 
 			switch (ai->ai_family) {
 
@@ -499,6 +537,19 @@ sntp_name_resolved(
 				break;
 			}
 
+			/*
+			** A survey queries the first usable address of
+			** each host and counts the host, not the query.
+			*/
+			if (CTX_SRVY & dctx->flags) {
+				spkt = emalloc_zero(sizeof(*spkt));
+				spkt->dctx = dctx;
+				octets = min(ai->ai_addrlen, sizeof(spkt->addr));
+				memcpy(&spkt->addr, ai->ai_addr, octets);
+				queue_xmt(sock, dctx, spkt, 0);
+				break;
+			}
+
 			/*
 			** We're waiting for a response for either unicast
 			** or broadcast, so...
@@ -514,6 +565,12 @@ sntp_name_resolved(
 				queue_xmt(sock, dctx, spkt, xmt_delay);
 			}
 		}
+		if (NULL == ai && (CTX_SRVY & dctx->flags)) {
+			survey_report(dctx->name, NULL,
+				      (kods) ? "prior-kod" : "no-address",
+				      NULL, NULL, 0., 0.);
+			survey_done(dctx);
+		}
 	}
 	/* n_pending_dns really should be >0 here... */
 	--n_pending_dns;
@@ -548,6 +605,15 @@ queue_xmt(
 	/* reject attempts to add address already listed */
 	for (match = *pkt_listp; match != NULL; match = match->link) {
 		if (ADDR_PORT_EQ(&spkt->addr, &match->addr)) {
+			if (CTX_SRVY & dctx->flags) {
+				/* replies could not be told apart */
+				survey_report(dctx->name, dest,
+					      "duplicate", NULL, NULL,
+					      0., 0.);
+				free(spkt);
+				survey_done(dctx);
+				return;
+			}
 			if (strcasecmp(spkt->dctx->name,
 				       match->dctx->name))
 				printf("%s %s duplicate address from %s ignored.\n",
@@ -678,9 +744,14 @@ xmt(
 		memcpy(&spkt->x_pkt, &x_pkt, min(sizeof(spkt->x_pkt),
 		       pkt_len));
 		spkt->stime = tv_xmt.tv_sec - JAN_1970;
+		spkt->tries++;
 
 		TRACE(2, ("xmt: %lx.%6.6u %s %s\n", (u_long)tv_xmt.tv_sec,
 			  (u_int)tv_xmt.tv_usec, dctx->name, stoa(dst)));
+	} else if (CTX_SRVY & dctx->flags) {
+		survey_report(dctx->name, dst, "send-error", NULL, NULL,
+			      0., 0.);
+		survey_finish(spkt);
 	} else {
 		dec_pending_ntp(dctx->name, dst);
 	}
@@ -741,7 +812,8 @@ timeout_queries(void)
 	// Do we care about didsomething?
 	TRACE(3, ("timeout_queries: didsomething is %d, age is %ld\n",
 		  didsomething, (long) (start_cb.tv_sec - start_tv.tv_sec)));
-	if (start_cb.tv_sec - start_tv.tv_sec > response_timeout) {
+	if (!HAVE_OPT(SURVEY) &&
+	    start_cb.tv_sec - start_tv.tv_sec > response_timeout) {
 		TRACE(3, ("timeout_queries: bail!\n"));
 		event_base_loopexit(base, NULL);
 		shutting_down = TRUE;
@@ -770,8 +842,24 @@ void timeout_query(
 	)
 {
 	sockaddr_u *	server;
+	xmt_ctx		xctx;
 	char		xcst;
 
+	if (CTX_SRVY & spkt->dctx->flags) {
+		if (spkt->tries <= survey_retries) {
+			ZERO(xctx);
+			xctx.sock = (IS_IPV6(&spkt->addr))
+					? sock6
+					: sock4;
+			xctx.spkt = spkt;
+			xmt(&xctx);
+			return;
+		}
+		survey_report(spkt->dctx->name, &spkt->addr, "timeout",
+			      NULL, NULL, 0., 0.);
+		survey_finish(spkt);
+		return;
+	}
 
 	switch (spkt->dctx->flags & CTX_xCST) {
 	    case CTX_BCST:
@@ -805,15 +893,14 @@ check_kod(
 	)
 {
 	char *hostname;
-	struct kod_entry *reason;
 
 	/* Is there a KoD on file for this address? */
 	hostname = addrinfo_to_str(ai);
 	TRACE(2, ("check_kod: checking <%s>\n", hostname));
-	if (search_entry(hostname, &reason)) {
-		printf("prior KoD for %s, skipping.\n",
-			hostname);
-		free(reason);
+	if (lookup_entry(hostname) != NULL) {
+		if (!HAVE_OPT(SURVEY))
+			printf("prior KoD for %s, skipping.\n",
+				hostname);
 		free(hostname);
 
 		return 1;
@@ -898,6 +985,18 @@ sock_cb(
 
 	TRACE(2, ("sock_cb: process_pkt returned %d\n", rpktl));
 
+	/*
+	 * A survey waits out unusable packets, a late reply to an
+	 * earlier try among them, and reports anything else.
+	 */
+	if (CTX_SRVY & spkt->dctx->flags) {
+		if (0 == spkt->stime || PACKET_UNUSEABLE == rpktl)
+			return;
+		handle_pkt(rpktl, &r_pkt, &spkt->addr, spkt->dctx->name);
+		survey_finish(spkt);
+		return;
+	}
+
 	/* If this is a Unicast packet, one down ... */
 	if (!spkt->done && (CTX_UCST & spkt->dctx->flags)) {
 		dec_pending_ntp(spkt->dctx->name, &spkt->addr);
@@ -922,6 +1021,16 @@ sock_cb(
 void
 check_exit_conditions(void)
 {
+	if (HAVE_OPT(SURVEY)) {
+		if (NULL == survey_fp && 0 == survey_active) {
+			event_base_loopexit(base, NULL);
+			shutting_down = TRUE;
+		} else {
+			TRACE(2, ("%d hosts being surveyed\n",
+				  survey_active));
+		}
+		return;
+	}
 	if ((0 == n_pending_ntp && 0 == n_pending_dns) ||
 	    (time_derived && !HAVE_OPT(WAIT))) {
 		event_base_loopexit(base, NULL);
@@ -933,6 +1042,244 @@ check_exit_conditions(void)
 }
 
 
+/*
+ * survey_start() opens the --survey list of hosts, one per line with
+ * '#' starting a comment, and starts the first --inflight of them.
+ * The clock is never touched, a record is written for each host as
+ * soon as its query completes and the next host is started.
+ */
+void
+survey_start(
+	const char *	file
+	)
+{
+	if (!strcmp(file, "-"))
+		survey_fp = stdin;
+	else
+		survey_fp = fopen(file, "r");
+	if (NULL == survey_fp) {
+		mfprintf(stderr, "%s: cannot open %s: %m\n", progname,
+			 file);
+		exit(EX_NOINPUT);
+	}
+	survey_inflight = max(1, OPT_VALUE_INFLIGHT);
+	survey_retries = max(0, OPT_VALUE_RETRIES);
+	if (!HAVE_OPT(JSON))
+		printf("host,address,status,offset,delay,stratum,refid,kod\n");
+
+	/* the socket timeouts never fire while replies keep coming */
+	ev_survey_timer = event_new(base, INVALID_SOCKET,
+				    EV_TIMEOUT | EV_PERSIST,
+				    &survey_timer_cb, NULL);
+	if (NULL == ev_survey_timer) {
+		msyslog(LOG_ERR,
+			"survey_start: event_new(base, -1, EV_TIMEOUT) failed!");
+		exit(1);
+	}
+	event_add(ev_survey_timer, &wakeup_tv);
+
+	survey_next();
+	check_exit_conditions();
+}
+
+
+/*
+ * survey_next() starts lookups of the next hosts in the --survey list
+ * until --inflight hosts are active or the list is exhausted.
+ */
+void
+survey_next(void)
+{
+	char	line[256];
+	char *	name;
+	size_t	len;
+	int	c;
+
+	while (survey_fp != NULL && survey_active < survey_inflight) {
+		if (NULL == fgets(line, sizeof(line), survey_fp)) {
+			if (stdin != survey_fp)
+				fclose(survey_fp);
+			survey_fp = NULL;
+			break;
+		}
+		len = strlen(line);
+		if (len > 0 && '\n' != line[len - 1] &&
+		    !feof(survey_fp)) {
+			msyslog(LOG_ERR, "survey: skipping overlong line %.32s...",
+				line);
+			do
+				c = getc(survey_fp);
+			while (c != EOF && c != '\n');
+			continue;
+		}
+		line[strcspn(line, "#")] = '\0';
+		name = line + strspn(line, " \t");
+		name[strcspn(name, " \t\r\n")] = '\0';
+		if ('\0' == *name)
+			continue;
+		survey_active++;
+		handle_lookup(name, CTX_UCST | CTX_SRVY);
+	}
+}
+
+
+void
+survey_timer_cb(
+	evutil_socket_t	fd,
+	short		what,
+	void *		ctx
+	)
+{
+	UNUSED_ARG(fd);
+	UNUSED_ARG(ctx);
+
+	DEBUG_REQUIRE(EV_TIMEOUT & what);
+	timeout_queries();
+}
+
+
+/*
+ * survey_finish() forgets the query of a host which has been reported.
+ */
+void
+survey_finish(
+	sent_pkt *	spkt
+	)
+{
+	struct dns_ctx *	dctx;
+	sent_pkt **		pkt_listp;
+	sent_pkt *		unlinked;
+
+	dctx = spkt->dctx;
+	if (IS_IPV6(&spkt->addr))
+		pkt_listp = &v6_pkts_list;
+	else
+		pkt_listp = &v4_pkts_list;
+	UNLINK_SLIST(unlinked, *pkt_listp, spkt, link, sent_pkt);
+	INSIST(unlinked == spkt);
+	free(spkt);
+	survey_done(dctx);
+}
+
+
+/*
+ * survey_done() makes room for the next host after one was reported.
+ */
+void
+survey_done(
+	struct dns_ctx *	dctx
+	)
+{
+	free(dctx);
+	INSIST(survey_active > 0);
+	survey_active--;
+	survey_next();
+	check_exit_conditions();
+}
+
+
+/*
+ * survey_report() writes the CSV or JSON record of a surveyed host.
+ * rpkt is the server's response if it was usable, the other fields are
+ * left out when they are NULL or without rpkt.
+ */
+void
+survey_report(
+	const char *	hostname,
+	sockaddr_u *	host,
+	const char *	status,
+	struct pkt *	rpkt,
+	const char *	kod,
+	double		offset,
+	double		delay
+	)
+{
+	static const char * const names[] = {
+		"host", "address", "status", "offset", "delay",
+		"stratum", "refid", "kod"
+	};
+	const char *	field[COUNTOF(names)];
+	char		offtxt[32];
+	char		delaytxt[32];
+	char		stratumtxt[8];
+	int		stratum;
+	u_int		i;
+
+	ZERO(field);
+	field[0] = hostname;
+	if (host != NULL)
+		field[1] = stoa(host);
+	field[2] = status;
+	if (rpkt != NULL) {
+		stratum = PKT_TO_STRATUM(rpkt->stratum);
+		snprintf(offtxt, sizeof(offtxt), "%.6f", offset);
+		snprintf(delaytxt, sizeof(delaytxt), "%.6f", delay);
+		snprintf(stratumtxt, sizeof(stratumtxt), "%d", stratum);
+		field[3] = offtxt;
+		field[4] = delaytxt;
+		field[5] = stratumtxt;
+		field[6] = refid_str(rpkt->refid, stratum);
+	}
+	field[7] = kod;
+
+	for (i = 0; i < COUNTOF(names); i++) {
+		if (HAVE_OPT(JSON)) {
+			if (NULL == field[i])
+				continue;
+			printf("%s\"%s\":", (i > 0) ? "," : "{", names[i]);
+		} else if (i > 0) {
+			putchar(',');
+		}
+		if (NULL == field[i])
+			continue;
+		/* offset, delay and stratum are numbers */
+		if (field[i] == offtxt || field[i] == delaytxt ||
+		    field[i] == stratumtxt)
+			fputs(field[i], stdout);
+		else
+			survey_str(field[i]);
+	}
+	fputs((HAVE_OPT(JSON)) ? "}\n" : "\n", stdout);
+	fflush(stdout);
+}
+
+
+/*
+ * survey_str() writes a string field, always quoted for JSON and only
+ * where needed for CSV.
+ */
+void
+survey_str(
+	const char *	str
+	)
+{
+	const u_char *	cp;
+
+	if (HAVE_OPT(JSON)) {
+		putchar('"');
+		for (cp = (const u_char *)str; *cp != '\0'; cp++) {
+			if ('"' == *cp || '\\' == *cp)
+				printf("\\%c", *cp);
+			else if (*cp < 0x20 || *cp >= 0x7f)
+				printf("\\u%04x", *cp);
+			else
+				putchar(*cp);
+		}
+		putchar('"');
+	} else if ('\0' != str[strcspn(str, ",\"\r\n")]) {
+		putchar('"');
+		for (cp = (const u_char *)str; *cp != '\0'; cp++) {
+			if ('"' == *cp)
+				putchar('"');
+			putchar(*cp);
+		}
+		putchar('"');
+	} else {
+		fputs(str, stdout);
+	}
+}
+
+
 /*
  * sntp_addremove_fd() is invoked by the intres blocking worker code
  * to read from a pipe, or to stop same.
@@ -1153,6 +1500,7 @@ handle_pkt(
 	)
 {
 	char		disptxt[32];
+	char		kod[5];
 	const char *	addrtxt;
 	struct timeval	tv_dst;
 	int		cnt;
@@ -1183,6 +1531,9 @@ handle_pkt(
 	switch (sw_case) {
 
 	case SERVER_UNUSEABLE:
+		if (HAVE_OPT(SURVEY))
+			survey_report(hostname, host, "unusable", NULL,
+				      NULL, 0., 0.);
 		return -1;
 		break;
 
@@ -1190,6 +1541,9 @@ handle_pkt(
 		break;
 
 	case SERVER_AUTH_FAIL:
+		if (HAVE_OPT(SURVEY))
+			survey_report(hostname, host, "auth-fail", NULL,
+				      NULL, 0., 0.);
 		break;
 
 	case KOD_DEMOBILIZE:
@@ -1199,6 +1553,12 @@ handle_pkt(
 		add_entry(addrtxt, ref);
 		msyslog(LOG_WARNING, "KOD code %c%c%c%c from %s %s",
 			ref[0], ref[1], ref[2], ref[3], addrtxt, hostname);
+		if (HAVE_OPT(SURVEY)) {
+			memcpy(kod, ref, 4);
+			kod[4] = '\0';
+			survey_report(hostname, host, "kod", NULL, kod,
+				      0., 0.);
+		}
 		break;
 
 	case KOD_RATE:
@@ -1208,6 +1568,9 @@ handle_pkt(
 		** expiration timestamp of several seconds in the future,
 		** and back-off even more if we get more RATE responses.
 		*/
+		if (HAVE_OPT(SURVEY))
+			survey_report(hostname, host, "kod", NULL, "RATE",
+				      0., 0.);
 		break;
 
 	case 1:
@@ -1236,6 +1599,13 @@ handle_pkt(
 				   &precision, &synch_distance);
 		time_derived = TRUE;
 
+		if (HAVE_OPT(SURVEY)) {
+			survey_report(hostname, host, "ok", rpkt, NULL,
+				      offset,
+				      delay_calculation(rpkt, &tv_dst));
+			return EX_OK;
+		}
+
 		for (digits = 0; (precision *= 10.) < 1.; ++digits)
 			/* empty */ ;
 		if (digits > 6)
@@ -1398,6 +1768,36 @@ offset_calculation(
 
 
 
+/*
+ * delay_calculation() returns the round trip delay of the exchange
+ * which brought rpkt, excluding the time spent in the server.
+ */
+double
+delay_calculation(
+	struct pkt *		rpkt,
+	struct timeval *	tv_dst
+	)
+{
+	l_fp	p_org, p_rec, p_xmt, dst, tmp;
+	double	t41, t32;
+
+	NTOHL_FP(&rpkt->org, &p_org);
+	NTOHL_FP(&rpkt->rec, &p_rec);
+	NTOHL_FP(&rpkt->xmt, &p_xmt);
+	TVTOTS(tv_dst, &dst);
+	dst.l_ui += JAN_1970;
+
+	tmp = dst;
+	L_SUB(&tmp, &p_org);
+	LFPTOD(&tmp, t41);
+	tmp = p_xmt;
+	L_SUB(&tmp, &p_rec);
+	LFPTOD(&tmp, t32);
+
+	return t41 - t32;
+}
+
+
 /* Compute the 8 bits for li_vn_mode */
 void
 set_li_vn_mode (
@@ -25,6 +25,7 @@ int	handle_pkt(int rpktl, struct pkt *rpkt, sockaddr_u *host,
 void	offset_calculation(struct pkt *rpkt, int rpktl,
 			   struct timeval *tv_dst, double *offset,
 			   double *precision, double *root_dispersion);
+double	delay_calculation(struct pkt *rpkt, struct timeval *tv_dst);
 int	on_wire(struct addrinfo *host, struct addrinfo *bcastaddr);
 int	set_time(double offset);
 
@@ -69,7 +69,7 @@ extern FILE * option_usage_fp;
 /**
  *  static const strings for sntp options
  */
-static char const sntp_opt_strs[2549] =
+static char const sntp_opt_strs[2758] =
 /*     0 */ "sntp 4.2.8p6\n"
             "Copyright (C) 1992-2016 The University of Delaware and Network Time Foundation, all rights reserved.\n"
             "This is free software. It is licensed for use, modification and\n"
@@ -143,27 +143,39 @@ static char const sntp_opt_strs[2549] =
 /*  2053 */ "WAIT\0"
 /*  2058 */ "no-wait\0"
 /*  2066 */ "no\0"
-/*  2069 */ "display extended usage information and exit\0"
-/*  2113 */ "help\0"
-/*  2118 */ "extended usage information passed thru pager\0"
-/*  2163 */ "more-help\0"
-/*  2173 */ "output version information and exit\0"
-/*  2209 */ "version\0"
-/*  2217 */ "save the option state to a config file\0"
-/*  2256 */ "save-opts\0"
-/*  2266 */ "load options from a config file\0"
-/*  2298 */ "LOAD_OPTS\0"
-/*  2308 */ "no-load-opts\0"
-/*  2321 */ "SNTP\0"
-/*  2326 */ "sntp - standard Simple Network Time Protocol client program - Ver. 4.2.8p6\n"
+/*  2069 */ "Survey the servers listed in a file\0"
+/*  2105 */ "SURVEY\0"
+/*  2112 */ "survey\0"
+/*  2119 */ "Number of hosts to survey at the same time\0"
+/*  2162 */ "INFLIGHT\0"
+/*  2171 */ "inflight\0"
+/*  2180 */ "Times to repeat an unanswered survey query\0"
+/*  2223 */ "RETRIES\0"
+/*  2231 */ "retries\0"
+/*  2239 */ "Write survey records as JSON\0"
+/*  2268 */ "JSON\0"
+/*  2273 */ "json\0"
+/*  2278 */ "display extended usage information and exit\0"
+/*  2322 */ "help\0"
+/*  2327 */ "extended usage information passed thru pager\0"
+/*  2372 */ "more-help\0"
+/*  2382 */ "output version information and exit\0"
+/*  2418 */ "version\0"
+/*  2426 */ "save the option state to a config file\0"
+/*  2465 */ "save-opts\0"
+/*  2475 */ "load options from a config file\0"
+/*  2507 */ "LOAD_OPTS\0"
+/*  2517 */ "no-load-opts\0"
+/*  2530 */ "SNTP\0"
+/*  2535 */ "sntp - standard Simple Network Time Protocol client program - Ver. 4.2.8p6\n"
             "Usage:  %s [ -<flag> [<val>] | --<name>[{=| }<val>] ]... \\\n"
             "\t\t[ hostname-or-IP ...]\n\0"
-/*  2485 */ "$HOME\0"
-/*  2491 */ ".\0"
-/*  2493 */ ".ntprc\0"
-/*  2500 */ "http://bugs.ntp.org, bugs@ntp.org\0"
-/*  2534 */ "\n\0"
-/*  2536 */ "sntp 4.2.8p6";
+/*  2694 */ "$HOME\0"
+/*  2700 */ ".\0"
+/*  2702 */ ".ntprc\0"
+/*  2709 */ "http://bugs.ntp.org, bugs@ntp.org\0"
+/*  2743 */ "\n\0"
+/*  2745 */ "sntp 4.2.8p6";
 
 /**
  *  ipv4 option description with
@@ -412,14 +424,76 @@ static int const aIpv6CantList[] = {
 /** Compiled in flag settings for the wait option */
 #define WAIT_FLAGS     (OPTST_INITENABLED)
 
+/**
+ *  survey option description with
+ *  "Must also have options" and "Incompatible options":
+ */
+/** Descriptive text for the survey option */
+#define SURVEY_DESC      (sntp_opt_strs+2069)
+/** Upper-cased name for the survey option */
+#define SURVEY_NAME      (sntp_opt_strs+2105)
+/** Name string for the survey option */
+#define SURVEY_name      (sntp_opt_strs+2112)
+/** Other options that appear in conjunction with the survey option */
+static int const aSurveyCantList[] = {
+    INDEX_OPT_BROADCAST,
+    INDEX_OPT_CONCURRENT,
+    INDEX_OPT_STEP,
+    INDEX_OPT_SLEW, NO_EQUIVALENT };
+/** Compiled in flag settings for the survey option */
+#define SURVEY_FLAGS     (OPTST_DISABLED \
+        | OPTST_SET_ARGTYPE(OPARG_TYPE_STRING))
+
+/**
+ *  inflight option description:
+ */
+/** Descriptive text for the inflight option */
+#define INFLIGHT_DESC      (sntp_opt_strs+2119)
+/** Upper-cased name for the inflight option */
+#define INFLIGHT_NAME      (sntp_opt_strs+2162)
+/** Name string for the inflight option */
+#define INFLIGHT_name      (sntp_opt_strs+2171)
+/** The compiled in default value for the inflight option argument */
+#define INFLIGHT_DFT_ARG   ((char const*)64)
+/** Compiled in flag settings for the inflight option */
+#define INFLIGHT_FLAGS     (OPTST_DISABLED \
+        | OPTST_SET_ARGTYPE(OPARG_TYPE_NUMERIC))
+
+/**
+ *  retries option description:
+ */
+/** Descriptive text for the retries option */
+#define RETRIES_DESC      (sntp_opt_strs+2180)
+/** Upper-cased name for the retries option */
+#define RETRIES_NAME      (sntp_opt_strs+2223)
+/** Name string for the retries option */
+#define RETRIES_name      (sntp_opt_strs+2231)
+/** The compiled in default value for the retries option argument */
+#define RETRIES_DFT_ARG   ((char const*)2)
+/** Compiled in flag settings for the retries option */
+#define RETRIES_FLAGS     (OPTST_DISABLED \
+        | OPTST_SET_ARGTYPE(OPARG_TYPE_NUMERIC))
+
+/**
+ *  json option description:
+ */
+/** Descriptive text for the json option */
+#define JSON_DESC      (sntp_opt_strs+2239)
+/** Upper-cased name for the json option */
+#define JSON_NAME      (sntp_opt_strs+2268)
+/** Name string for the json option */
+#define JSON_name      (sntp_opt_strs+2273)
+/** Compiled in flag settings for the json option */
+#define JSON_FLAGS     (OPTST_DISABLED)
+
 /*
  *  Help/More_Help/Version option descriptions:
  */
-#define HELP_DESC       (sntp_opt_strs+2069)
-#define HELP_name       (sntp_opt_strs+2113)
+#define HELP_DESC       (sntp_opt_strs+2278)
+#define HELP_name       (sntp_opt_strs+2322)
 #ifdef HAVE_WORKING_FORK
-#define MORE_HELP_DESC  (sntp_opt_strs+2118)
-#define MORE_HELP_name  (sntp_opt_strs+2163)
+#define MORE_HELP_DESC  (sntp_opt_strs+2327)
+#define MORE_HELP_name  (sntp_opt_strs+2372)
 #define MORE_HELP_FLAGS (OPTST_IMM | OPTST_NO_INIT)
 #else
 #define MORE_HELP_DESC  HELP_DESC
@@ -432,13 +506,13 @@ static int const aIpv6CantList[] = {
 #  define VER_FLAGS     (OPTST_SET_ARGTYPE(OPARG_TYPE_STRING) | \
                          OPTST_ARG_OPTIONAL | OPTST_IMM | OPTST_NO_INIT)
 #endif
-#define VER_DESC        (sntp_opt_strs+2173)
-#define VER_name        (sntp_opt_strs+2209)
-#define SAVE_OPTS_DESC  (sntp_opt_strs+2217)
-#define SAVE_OPTS_name  (sntp_opt_strs+2256)
-#define LOAD_OPTS_DESC     (sntp_opt_strs+2266)
-#define LOAD_OPTS_NAME     (sntp_opt_strs+2298)
-#define NO_LOAD_OPTS_name  (sntp_opt_strs+2308)
+#define VER_DESC        (sntp_opt_strs+2382)
+#define VER_name        (sntp_opt_strs+2418)
+#define SAVE_OPTS_DESC  (sntp_opt_strs+2426)
+#define SAVE_OPTS_name  (sntp_opt_strs+2465)
+#define LOAD_OPTS_DESC     (sntp_opt_strs+2475)
+#define LOAD_OPTS_NAME     (sntp_opt_strs+2507)
+#define NO_LOAD_OPTS_name  (sntp_opt_strs+2517)
 #define LOAD_OPTS_pfx      (sntp_opt_strs+2066)
 #define LOAD_OPTS_name     (NO_LOAD_OPTS_name + 3)
 /**
@@ -677,6 +751,54 @@ static tOptDesc optDesc[OPTION_CT] = {
      /* desc, NAME, name */ WAIT_DESC, WAIT_NAME, WAIT_name,
      /* disablement strs */ NOT_WAIT_name, NOT_WAIT_PFX },
 
+  {  /* entry idx, value */ 18, VALUE_OPT_SURVEY,
+     /* equiv idx, value */ 18, VALUE_OPT_SURVEY,
+     /* equivalenced to  */ NO_EQUIVALENT,
+     /* min, max, act ct */ 0, 1, 0,
+     /* opt state flags  */ SURVEY_FLAGS, 0,
+     /* last opt argumnt */ { NULL }, /* --survey */
+     /* arg list/cookie  */ NULL,
+     /* must/cannot opts */ NULL, aSurveyCantList,
+     /* option proc      */ NULL,
+     /* desc, NAME, name */ SURVEY_DESC, SURVEY_NAME, SURVEY_name,
+     /* disablement strs */ NULL, NULL },
+
+  {  /* entry idx, value */ 19, VALUE_OPT_INFLIGHT,
+     /* equiv idx, value */ 19, VALUE_OPT_INFLIGHT,
+     /* equivalenced to  */ NO_EQUIVALENT,
+     /* min, max, act ct */ 0, 1, 0,
+     /* opt state flags  */ INFLIGHT_FLAGS, 0,
+     /* last opt argumnt */ { INFLIGHT_DFT_ARG },
+     /* arg list/cookie  */ NULL,
+     /* must/cannot opts */ NULL, NULL,
+     /* option proc      */ optionNumericVal,
+     /* desc, NAME, name */ INFLIGHT_DESC, INFLIGHT_NAME, INFLIGHT_name,
+     /* disablement strs */ NULL, NULL },
+
+  {  /* entry idx, value */ 20, VALUE_OPT_RETRIES,
+     /* equiv idx, value */ 20, VALUE_OPT_RETRIES,
+     /* equivalenced to  */ NO_EQUIVALENT,
+     /* min, max, act ct */ 0, 1, 0,
+     /* opt state flags  */ RETRIES_FLAGS, 0,
+     /* last opt argumnt */ { RETRIES_DFT_ARG },
+     /* arg list/cookie  */ NULL,
+     /* must/cannot opts */ NULL, NULL,
+     /* option proc      */ optionNumericVal,
+     /* desc, NAME, name */ RETRIES_DESC, RETRIES_NAME, RETRIES_name,
+     /* disablement strs */ NULL, NULL },
+
+  {  /* entry idx, value */ 21, VALUE_OPT_JSON,
+     /* equiv idx, value */ 21, VALUE_OPT_JSON,
+     /* equivalenced to  */ NO_EQUIVALENT,
+     /* min, max, act ct */ 0, 1, 0,
+     /* opt state flags  */ JSON_FLAGS, 0,
+     /* last opt argumnt */ { NULL }, /* --json */
+     /* arg list/cookie  */ NULL,
+     /* must/cannot opts */ NULL, NULL,
+     /* option proc      */ NULL,
+     /* desc, NAME, name */ JSON_DESC, JSON_NAME, JSON_name,
+     /* disablement strs */ NULL, NULL },
+
   {  /* entry idx, value */ INDEX_OPT_VERSION, VALUE_OPT_VERSION,
      /* equiv idx value  */ NO_EQUIVALENT, VALUE_OPT_VERSION,
      /* equivalenced to  */ NO_EQUIVALENT,
@@ -745,24 +867,24 @@ static tOptDesc optDesc[OPTION_CT] = {
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /** Reference to the upper cased version of sntp. */
-#define zPROGNAME       (sntp_opt_strs+2321)
+#define zPROGNAME       (sntp_opt_strs+2530)
 /** Reference to the title line for sntp usage. */
-#define zUsageTitle     (sntp_opt_strs+2326)
+#define zUsageTitle     (sntp_opt_strs+2535)
 /** sntp configuration file name. */
-#define zRcName         (sntp_opt_strs+2493)
+#define zRcName         (sntp_opt_strs+2702)
 /** Directories to search for sntp config files. */
 static char const * const apzHomeList[3] = {
-    sntp_opt_strs+2485,
-    sntp_opt_strs+2491,
+    sntp_opt_strs+2694,
+    sntp_opt_strs+2700,
     NULL };
 /** The sntp program bug email address. */
-#define zBugsAddr       (sntp_opt_strs+2500)
+#define zBugsAddr       (sntp_opt_strs+2709)
 /** Clarification/explanation of what sntp does. */
-#define zExplain        (sntp_opt_strs+2534)
+#define zExplain        (sntp_opt_strs+2743)
 /** Extra detail explaining what sntp does. */
 #define zDetail         (NULL)
 /** The full version string for sntp. */
-#define zFullVersion    (sntp_opt_strs+2536)
+#define zFullVersion    (sntp_opt_strs+2745)
 /* extracted from optcode.tlib near line 364 */
 
 #if defined(ENABLE_NLS)
@@ -1038,7 +1160,7 @@ tOptions sntpOptions = {
       NO_EQUIVALENT, /* '-#' option index */
       NO_EQUIVALENT /* index of default opt */
     },
-    23 /* full option count */, 18 /* user option count */,
+    27 /* full option count */, 22 /* user option count */,
     sntp_full_usage, sntp_short_usage,
     NULL, NULL,
     PKGDATADIR, sntp_packager_info
@@ -1247,6 +1369,18 @@ implied warranty.\n"));
   /* referenced via sntpOptions.pOptDesc->pzText */
   puts(_("Wait for pending replies (if not setting the time)"));
 
+  /* referenced via sntpOptions.pOptDesc->pzText */
+  puts(_("Survey the servers listed in a file"));
+
+  /* referenced via sntpOptions.pOptDesc->pzText */
+  puts(_("Number of hosts to survey at the same time"));
+
+  /* referenced via sntpOptions.pOptDesc->pzText */
+  puts(_("Times to repeat an unanswered survey query"));
+
+  /* referenced via sntpOptions.pOptDesc->pzText */
+  puts(_("Write survey records as JSON"));
+
   /* referenced via sntpOptions.pOptDesc->pzText */
   puts(_("display extended usage information and exit"));
 
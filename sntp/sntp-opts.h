@@ -82,14 +82,18 @@ typedef enum {
     INDEX_OPT_SLEW             = 15,
     INDEX_OPT_TIMEOUT          = 16,
     INDEX_OPT_WAIT             = 17,
-    INDEX_OPT_VERSION          = 18,
-    INDEX_OPT_HELP             = 19,
-    INDEX_OPT_MORE_HELP        = 20,
-    INDEX_OPT_SAVE_OPTS        = 21,
-    INDEX_OPT_LOAD_OPTS        = 22
+    INDEX_OPT_SURVEY           = 18,
+    INDEX_OPT_INFLIGHT         = 19,
+    INDEX_OPT_RETRIES          = 20,
+    INDEX_OPT_JSON             = 21,
+    INDEX_OPT_VERSION          = 22,
+    INDEX_OPT_HELP             = 23,
+    INDEX_OPT_MORE_HELP        = 24,
+    INDEX_OPT_SAVE_OPTS        = 25,
+    INDEX_OPT_LOAD_OPTS        = 26
 } teOptIndex;
 /** count of all options for sntp */
-#define OPTION_CT    23
+#define OPTION_CT    27
 /** sntp version */
 #define SNTP_VERSION       "4.2.8p6"
 /** Full sntp version text */
@@ -218,6 +222,22 @@ typedef enum {
 #  warning undefining WAIT due to option name conflict
 #  undef   WAIT
 # endif
+# ifdef    SURVEY
+#  warning undefining SURVEY due to option name conflict
+#  undef   SURVEY
+# endif
+# ifdef    INFLIGHT
+#  warning undefining INFLIGHT due to option name conflict
+#  undef   INFLIGHT
+# endif
+# ifdef    RETRIES
+#  warning undefining RETRIES due to option name conflict
+#  undef   RETRIES
+# endif
+# ifdef    JSON
+#  warning undefining JSON due to option name conflict
+#  undef   JSON
+# endif
 #else  /* NO_OPTION_NAME_WARNINGS */
 # undef IPV4
 # undef IPV6
@@ -237,6 +257,10 @@ typedef enum {
 # undef SLEW
 # undef TIMEOUT
 # undef WAIT
+# undef SURVEY
+# undef INFLIGHT
+# undef RETRIES
+# undef JSON
 #endif  /*  NO_OPTION_NAME_WARNINGS */
 
 /**
@@ -283,12 +307,20 @@ typedef enum {
         DESC(WAIT).fOptState &= OPTST_PERSISTENT_MASK; \
         DESC(WAIT).fOptState |= OPTST_SET | OPTST_DISABLED; \
         DESC(WAIT).optArg.argString = NULL )
+#define VALUE_OPT_SURVEY         0x1002
+#define VALUE_OPT_INFLIGHT       0x1003
+
+#define OPT_VALUE_INFLIGHT       (DESC(INFLIGHT).optArg.argInt)
+#define VALUE_OPT_RETRIES        0x1004
+
+#define OPT_VALUE_RETRIES        (DESC(RETRIES).optArg.argInt)
+#define VALUE_OPT_JSON           0x1005
 /** option flag (value) for help-value option */
 #define VALUE_OPT_HELP          '?'
 /** option flag (value) for more-help-value option */
 #define VALUE_OPT_MORE_HELP     '!'
 /** option flag (value) for version-value option */
-#define VALUE_OPT_VERSION       0x1002
+#define VALUE_OPT_VERSION       0x1006
 /** option flag (value) for save-opts-value option */
 #define VALUE_OPT_SAVE_OPTS     '>'
 /** option flag (value) for load-opts-value option */
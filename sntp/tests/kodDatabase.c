@@ -16,11 +16,13 @@ void test_MultipleEntryHandling(void);
 void test_NoMatchInSearch(void);
 void test_AddDuplicate(void);
 void test_DeleteEntry(void);
+void test_ExpiredEntry(void);
 
 
 void
 setUp(void) {
 	kod_init_kod_db("/dev/null", TRUE);
+	kod_expire = KOD_EXPIRE;
 	init_lib();
 }
 
@@ -139,3 +141,24 @@ test_DeleteEntry(void) {
 	TEST_ASSERT_EQUAL(1, search_entry(HOST1, &result));
 	free(result);
 }
+
+
+void
+test_ExpiredEntry(void) {
+	const char HOST[] = "192.0.2.4";
+	const char REASON[] = "RATE";
+
+	add_entry(HOST, REASON);
+	TEST_ASSERT_NOT_NULL(lookup_entry(HOST));
+
+	lookup_entry(HOST)->timestamp -= KOD_EXPIRE + 1;
+
+	struct kod_entry* result;
+
+	TEST_ASSERT_NULL(lookup_entry(HOST));
+	TEST_ASSERT_EQUAL(0, search_entry(HOST, &result));
+
+	// No expiry at all keeps it.
+	kod_expire = 0;
+	TEST_ASSERT_NOT_NULL(lookup_entry(HOST));
+}
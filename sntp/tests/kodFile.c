@@ -12,7 +12,6 @@
  * going through the public interface
  */
 extern int kod_db_cnt;
-extern struct kod_entry** kod_db;
 extern char* kod_db_file;
 
 void setUp(void);
@@ -26,16 +25,19 @@ void test_WriteFileWithMultipleEntries(void);
 
 void
 setUp(void) {
-	kod_db_cnt = 0;
-	kod_db = NULL;
+	kod_init_kod_db("/dev/null", TRUE);
+	kod_expire = 0;
 	init_lib();
 }
 
 
 void
 test_ReadEmptyFile(void) {
+	struct kod_entry* res;
+
 	kod_init_kod_db(CreatePath("kod-test-empty", INPUT_DIR), TRUE);
 
+	TEST_ASSERT_EQUAL(0, search_entry("192.0.2.5", &res));
 	TEST_ASSERT_EQUAL(0, kod_db_cnt);
 }
 
@@ -44,8 +46,6 @@ void
 test_ReadCorrectFile(void) {
 	kod_init_kod_db(CreatePath("kod-test-correct", INPUT_DIR), TRUE);
 	
-	TEST_ASSERT_EQUAL(2, kod_db_cnt);
-
 	struct kod_entry* res;
 
 	TEST_ASSERT_EQUAL(1, search_entry("192.0.2.5", &res));
@@ -57,6 +57,9 @@ test_ReadCorrectFile(void) {
 	TEST_ASSERT_EQUAL_STRING("RSTR", res->type);
 	TEST_ASSERT_EQUAL_STRING("192.0.2.100", res->hostname);
 	TEST_ASSERT_EQUAL(0xfff, res->timestamp);
+
+	/* the file is indexed on the first search */
+	TEST_ASSERT_EQUAL(2, kod_db_cnt);
 }
 
 
@@ -64,8 +67,6 @@ void
 test_ReadFileWithBlankLines(void) {
 	kod_init_kod_db(CreatePath("kod-test-blanks", INPUT_DIR), TRUE);
 
-	TEST_ASSERT_EQUAL(3, kod_db_cnt);
-
 	struct kod_entry* res;
 
 	TEST_ASSERT_EQUAL(1, search_entry("192.0.2.5", &res));
@@ -82,6 +83,8 @@ test_ReadFileWithBlankLines(void) {
 	TEST_ASSERT_EQUAL_STRING("DENY", res->type);
 	TEST_ASSERT_EQUAL_STRING("example.com", res->hostname);
 	TEST_ASSERT_EQUAL(0xabcd, res->timestamp);
+
+	TEST_ASSERT_EQUAL(3, kod_db_cnt);
 }
 
 
@@ -108,7 +111,7 @@ test_WriteFileWithSingleEntry(void) {
 	// Here we must manipulate the timestamps, so they match the one in
 	// the expected file.
 
-	kod_db[0]->timestamp = 1;
+	lookup_entry("host1")->timestamp = 1;
 
 	write_kod_db();
 
@@ -136,9 +139,9 @@ test_WriteFileWithMultipleEntries(void) {
 	// Manipulate timestamps. This is a bit of a hack, ideally these
 	// tests should not care about the internal representation.
 	//
-	kod_db[0]->timestamp = 0xabcd;
-	kod_db[1]->timestamp = 0xabcd;
-	kod_db[2]->timestamp = 0xabcd;
+	lookup_entry("example.com")->timestamp = 0xabcd;
+	lookup_entry("192.0.2.1")->timestamp = 0xabcd;
+	lookup_entry("192.0.2.5")->timestamp = 0xabcd;
 
 	write_kod_db();
 
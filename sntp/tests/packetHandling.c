@@ -18,6 +18,7 @@ void test_GenerateUnauthenticatedPacket(void);
 void test_GenerateAuthenticatedPacket(void);
 void test_OffsetCalculationPositiveOffset(void);
 void test_OffsetCalculationNegativeOffset(void);
+void test_DelayCalculation(void);
 void test_HandleUnusableServer(void);
 void test_HandleUnusablePacket(void);
 void test_HandleServerAuthenticationFailure(void);
@@ -203,6 +204,41 @@ test_OffsetCalculationNegativeOffset(void)
 }
 
 
+void
+test_DelayCalculation(void)
+{
+	struct pkt	rpkt;
+	l_fp		tmp;
+	struct timeval	dst;
+
+	ZERO(rpkt);
+
+	/* T1 - Originate timestamp */
+	tmp.l_ui = 1000000000UL;
+	tmp.l_uf = 0UL;
+	HTONL_FP(&tmp, &rpkt.org);
+
+	/* T2 - Receive timestamp */
+	tmp.l_ui = 1000000001UL;
+	tmp.l_uf = 2147483648UL;
+	HTONL_FP(&tmp, &rpkt.rec);
+
+	/* T3 - Transmit timestamp */
+	tmp.l_ui = 1000000002UL;
+	tmp.l_uf = 0UL;
+	HTONL_FP(&tmp, &rpkt.xmt);
+
+	/* T4 - Destination timestamp as standard timeval */
+	tmp.l_ui = 1000000001UL;
+	tmp.l_uf = 0UL;
+	TSTOTV(&tmp, &dst);
+	dst.tv_sec -= JAN_1970;
+
+	/* (T4 - T1) - (T3 - T2) */
+	TEST_ASSERT_EQUAL_DOUBLE(0.5, delay_calculation(&rpkt, &dst));
+}
+
+
 void
 test_HandleUnusableServer(void)
 {
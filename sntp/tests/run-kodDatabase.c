@@ -39,6 +39,7 @@ extern void test_MultipleEntryHandling(void);
 extern void test_NoMatchInSearch(void);
 extern void test_AddDuplicate(void);
 extern void test_DeleteEntry(void);
+extern void test_ExpiredEntry(void);
 
 
 //=======Test Reset Option=====
@@ -62,6 +63,7 @@ int main(int argc, char *argv[])
   RUN_TEST(test_NoMatchInSearch, 16);
   RUN_TEST(test_AddDuplicate, 17);
   RUN_TEST(test_DeleteEntry, 18);
+  RUN_TEST(test_ExpiredEntry, 19);
 
   return (UnityEnd());
 }
@@ -39,6 +39,7 @@ extern void test_GenerateUnauthenticatedPacket(void);
 extern void test_GenerateAuthenticatedPacket(void);
 extern void test_OffsetCalculationPositiveOffset(void);
 extern void test_OffsetCalculationNegativeOffset(void);
+extern void test_DelayCalculation(void);
 extern void test_HandleUnusableServer(void);
 extern void test_HandleUnusablePacket(void);
 extern void test_HandleServerAuthenticationFailure(void);
@@ -67,12 +68,13 @@ int main(int argc, char *argv[])
   RUN_TEST(test_GenerateAuthenticatedPacket, 18);
   RUN_TEST(test_OffsetCalculationPositiveOffset, 19);
   RUN_TEST(test_OffsetCalculationNegativeOffset, 20);
-  RUN_TEST(test_HandleUnusableServer, 21);
-  RUN_TEST(test_HandleUnusablePacket, 22);
-  RUN_TEST(test_HandleServerAuthenticationFailure, 23);
-  RUN_TEST(test_HandleKodDemobilize, 24);
-  RUN_TEST(test_HandleKodRate, 25);
-  RUN_TEST(test_HandleCorrectPacket, 26);
+  RUN_TEST(test_DelayCalculation, 21);
+  RUN_TEST(test_HandleUnusableServer, 22);
+  RUN_TEST(test_HandleUnusablePacket, 23);
+  RUN_TEST(test_HandleServerAuthenticationFailure, 24);
+  RUN_TEST(test_HandleKodDemobilize, 25);
+  RUN_TEST(test_HandleKodRate, 26);
+  RUN_TEST(test_HandleCorrectPacket, 27);
 
   return (UnityEnd());
 }
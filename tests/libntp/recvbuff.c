@@ -1,5 +1,6 @@
 #include "config.h"
 
+#include "ntp_stdlib.h"
 #include "recvbuff.h"
 
 #include "unity.h"
@@ -8,6 +9,7 @@ void setUp(void);
 void test_Initialization(void);
 void test_GetAndFree(void);
 void test_GetAndFill(void);
+void test_HeapAccounting(void);
 
 void
 setUp(void)
@@ -47,3 +49,26 @@ test_GetAndFill(void) {
 	TEST_ASSERT_TRUE(has_full_recv_buffer());
 	TEST_ASSERT_EQUAL_PTR(buf, get_full_recv_buffer());
 }
+
+
+void
+test_HeapAccounting(void) {
+	const mem_stat *ms = &mem_tag_stats[MEM_RECVBUF];
+	u_long before;
+	u_long allocs;
+
+	/* setUp() does not free the buffers of the previous test */
+	before = ms->bytes;
+	init_recvbuff(RECV_INIT);
+	TEST_ASSERT_EQUAL_UINT(before + total_recvbuffs() * sizeof(recvbuf_t),
+			       ms->bytes);
+	TEST_ASSERT_TRUE(ms->peak >= ms->bytes);
+
+	/* a free returns the bytes but keeps the peak */
+	allocs = mem_tag_stats[MEM_CONFIG].allocs;
+	mem_grow(MEM_CONFIG, 100, TRUE);
+	mem_shrink(MEM_CONFIG, 100);
+	TEST_ASSERT_EQUAL_UINT(allocs + 1, mem_tag_stats[MEM_CONFIG].allocs);
+	TEST_ASSERT_EQUAL_UINT(0, mem_tag_stats[MEM_CONFIG].bytes);
+	TEST_ASSERT_TRUE(mem_tag_stats[MEM_CONFIG].peak >= 100);
+}
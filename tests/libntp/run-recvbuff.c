@@ -23,6 +23,7 @@
 #include <setjmp.h>
 #include <stdio.h>
 #include "config.h"
+#include "ntp_stdlib.h"
 #include "recvbuff.h"
 
 //=======External Functions This Runner Calls=====
@@ -31,6 +32,7 @@ extern void tearDown(void);
 extern void test_Initialization(void);
 extern void test_GetAndFree(void);
 extern void test_GetAndFill(void);
+extern void test_HeapAccounting(void);
 
 
 //=======Test Reset Option=====
@@ -49,9 +51,10 @@ int main(int argc, char *argv[])
 {
   progname = argv[0];
   UnityBegin("recvbuff.c");
-  RUN_TEST(test_Initialization, 8);
-  RUN_TEST(test_GetAndFree, 9);
-  RUN_TEST(test_GetAndFill, 10);
+  RUN_TEST(test_Initialization, 9);
+  RUN_TEST(test_GetAndFree, 10);
+  RUN_TEST(test_GetAndFill, 11);
+  RUN_TEST(test_HeapAccounting, 12);
 
   return (UnityEnd());
 }
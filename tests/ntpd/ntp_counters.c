@@ -0,0 +1,133 @@
+#include "config.h"
+
+#include "ntpd.h"
+#include "ntp_counters.h"
+
+#include "unity.h"
+
+#if defined(NTP_THREAD_LOCAL) && defined(HAVE_PTHREADS)
+# include <pthread.h>
+#endif
+
+
+#define BUMPS	100000
+
+extern void setUp(void);
+extern void test_ReadAddsShards(void);
+extern void test_ClearOneCounter(void);
+extern void test_ShardsDoNotShareLines(void);
+extern void test_ObjectReadAddsShards(void);
+extern void test_ThreadsCountApart(void);
+
+
+void
+setUp(void)
+{
+	int	id;
+
+	for (id = 0; id < CTR_COUNT; id++)
+		ctr_clear(id);
+}
+
+
+void
+test_ReadAddsShards(void)
+{
+	CTR_INC(CTR_SYS_RECEIVED);
+	CTR_INC(CTR_SYS_RECEIVED);
+	ctr_shards[CTR_SHARDS - 1].ctr[CTR_SYS_RECEIVED] += 3;
+
+	TEST_ASSERT_EQUAL(2, ctr_shards[0].ctr[CTR_SYS_RECEIVED]);
+	TEST_ASSERT_EQUAL(5, ctr_read(CTR_SYS_RECEIVED));
+	TEST_ASSERT_EQUAL(0, ctr_read(CTR_SYS_PROCESSED));
+}
+
+
+void
+test_ClearOneCounter(void)
+{
+	CTR_INC(CTR_PACKETS_RECEIVED);
+	CTR_INC(CTR_PACKETS_SENT);
+	ctr_shards[1].ctr[CTR_PACKETS_SENT]++;
+	ctr_clear(CTR_PACKETS_SENT);
+
+	TEST_ASSERT_EQUAL(0, ctr_read(CTR_PACKETS_SENT));
+	TEST_ASSERT_EQUAL(1, ctr_read(CTR_PACKETS_RECEIVED));
+}
+
+
+void
+test_ShardsDoNotShareLines(void)
+{
+	const char *	last;
+	const char *	next;
+
+	last = (const char *)&ctr_shards[0].ctr[CTR_COUNT - 1];
+	next = (const char *)&ctr_shards[1].ctr[0];
+	TEST_ASSERT_TRUE(next - (last + sizeof(u_long)) >= CTR_LINE - 1);
+}
+
+
+void
+test_ObjectReadAddsShards(void)
+{
+	ctr_obj	c;
+
+	ZERO(c);
+	CTR_OBJ_INC(c);
+	CTR_OBJ_INC(c);
+	c.n[CTR_SHARDS - 1] += 3;
+
+	TEST_ASSERT_EQUAL(2, c.n[0]);
+	TEST_ASSERT_EQUAL(5, ctr_obj_read(&c));
+}
+
+
+#if defined(NTP_THREAD_LOCAL) && defined(HAVE_PTHREADS)
+
+static void *
+count_apart(
+	void *	arg
+	)
+{
+	int	i;
+
+	ctr_thread_init();
+	*(u_int *)arg = ctr_self;
+	for (i = 0; i < BUMPS; i++)
+		CTR_INC(CTR_SYS_PROCESSED);
+
+	return NULL;
+}
+
+void
+test_ThreadsCountApart(void)
+{
+	pthread_t	thr[2];
+	u_int		self[2];
+	int		i;
+
+	for (i = 0; i < 2; i++)
+		TEST_ASSERT_EQUAL(0, pthread_create(&thr[i], NULL,
+						    &count_apart, &self[i]));
+	for (i = 0; i < BUMPS; i++)
+		CTR_INC(CTR_SYS_PROCESSED);
+	for (i = 0; i < 2; i++)
+		TEST_ASSERT_EQUAL(0, pthread_join(thr[i], NULL));
+
+	TEST_ASSERT_EQUAL(0, ctr_self);
+	TEST_ASSERT_TRUE(self[0] != 0 && self[1] != 0);
+	TEST_ASSERT_TRUE(self[0] != self[1]);
+	TEST_ASSERT_EQUAL(BUMPS, ctr_shards[0].ctr[CTR_SYS_PROCESSED]);
+	TEST_ASSERT_EQUAL(3 * BUMPS, ctr_read(CTR_SYS_PROCESSED));
+}
+
+#else
+
+void
+test_ThreadsCountApart(void)
+{
+	TEST_IGNORE_MESSAGE("needs threads and thread-local storage");
+}
+
+#endif
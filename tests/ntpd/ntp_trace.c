@@ -0,0 +1,195 @@
+#include "config.h"
+
+#include "ntpd.h"
+#include "ntp_stdlib.h"
+#include "ntp_trace.h"
+
+#include "unity.h"
+
+#include <stdio.h>
+#include <unistd.h>
+
+
+static char	dir[64];
+static char	dumped[MAXFILENAME + 32];
+static endpt	ep;
+
+extern void setUp(void);
+extern void tearDown(void);
+
+void
+setUp(void)
+{
+	static int	done;
+
+	if (!done) {
+		init_systime();
+		done = TRUE;
+	}
+	strlcpy(dir, "/tmp/ntp_trace.XXXXXX", sizeof(dir));
+	TEST_ASSERT_NOT_NULL(mkdtemp(dir));
+	snprintf(statsdir, sizeof(statsdir), "%s/", dir);
+	dumped[0] = '\0';
+	ZERO(ep);
+	AF(&ep.sin) = AF_INET;
+	SET_ADDR4N(&ep.sin, htonl(INADDR_LOOPBACK));
+	SET_PORT(&ep.sin, NTP_PORT);
+}
+
+void
+tearDown(void)
+{
+	ptrace_stop();
+	if (dumped[0] != '\0')
+		unlink(dumped);
+	rmdir(dir);
+}
+
+
+/*
+ * Run one client packet with receive time 'sec' through the trace,
+ * bumping the counter 'counter' (if any) the way receive() would.
+ * The sharded counters are bumped in the shard of the main thread.
+ */
+static void
+trace_packet(
+	u_int32		sec,
+	volatile u_long *	counter
+	)
+{
+	struct recvbuf	rb;
+
+	ZERO(rb);
+	AF(&rb.recv_srcadr) = AF_INET;
+	SET_ADDR4N(&rb.recv_srcadr, htonl(0xc0000201));
+	SET_PORT(&rb.recv_srcadr, 40000 + sec);
+	rb.dstadr = &ep;
+	rb.recv_length = LEN_PKT_NOMAC;
+	rb.recv_pkt.li_vn_mode = PKT_LI_VN_MODE(LEAP_NOWARNING, NTP_VERSION,
+						 MODE_CLIENT);
+	get_systime(&rb.recv_time);
+	rb.recv_time.l_ui = sec;
+	ptrace_recv_begin(&rb);
+	if (counter != NULL)
+		(*counter)++;
+	ptrace_recv_end();
+}
+
+/*
+ * Read back a dump, returning the number of records read into 'recs'.
+ */
+static u_int32
+read_dump(
+	struct ptrace_hdr *	hdr,
+	struct ptrace_rec *	recs,
+	u_int32			nrecs
+	)
+{
+	FILE *		fp;
+	u_int32		n;
+
+	fp = fopen(dumped, "rb");
+	TEST_ASSERT_NOT_NULL(fp);
+	TEST_ASSERT_EQUAL(1, fread(hdr, sizeof(*hdr), 1, fp));
+	n = fread(recs, sizeof(*recs), nrecs, fp);
+	fclose(fp);
+
+	return n;
+}
+
+
+extern void test_StartRoundsUp(void);
+extern void test_Verdicts(void);
+extern void test_WrapAndDump(void);
+extern void test_RestartDuringReceive(void);
+
+
+void
+test_StartRoundsUp(void)
+{
+	u_int	size;
+	u_long	count;
+
+	TEST_ASSERT_EQUAL(128, ptrace_start(100));
+	TEST_ASSERT_TRUE(ptrace_on);
+	ptrace_status(&size, &count);
+	TEST_ASSERT_EQUAL(128, size);
+	TEST_ASSERT_EQUAL(0, count);
+	TEST_ASSERT_EQUAL(PTRACE_DEFAULT, ptrace_start(0));
+	ptrace_stop();
+	TEST_ASSERT_FALSE(ptrace_on);
+}
+
+void
+test_Verdicts(void)
+{
+	struct ptrace_hdr	hdr;
+	struct ptrace_rec	recs[4];
+
+	ptrace_start(16);
+	trace_packet(1, NULL);
+	trace_packet(2, &ctr_shards[0].ctr[CTR_SYS_RESTRICTED]);
+	trace_packet(3, &ctr_shards[0].ctr[CTR_SYS_PROCESSED]);
+	/* a KoD also counts as rate limited */
+	sys_limitrejected++;
+	trace_packet(4, &sys_kodsent);
+	ptrace_stop();
+
+	TEST_ASSERT_EQUAL(0, ptrace_dump(dumped, sizeof(dumped)));
+	TEST_ASSERT_EQUAL(4, read_dump(&hdr, recs, 4));
+	TEST_ASSERT_EQUAL(PTRACE_MAGIC, ntohl(hdr.magic));
+	TEST_ASSERT_EQUAL(sizeof(recs[0]), ntohl(hdr.reclen));
+	TEST_ASSERT_EQUAL(PTV_ACCEPTED, recs[0].verdict);
+	TEST_ASSERT_EQUAL(PTV_RESTRICTED, recs[1].verdict);
+	TEST_ASSERT_EQUAL(PTV_PROCESSED, recs[2].verdict);
+	TEST_ASSERT_EQUAL(PTV_KOD, recs[3].verdict);
+	TEST_ASSERT_EQUAL(PT_RX, recs[0].dir);
+	TEST_ASSERT_EQUAL(MODE_CLIENT, recs[0].mode);
+	TEST_ASSERT_EQUAL(4, recs[0].family);
+	TEST_ASSERT_EQUAL(40001, ntohs(recs[0].rport));
+	TEST_ASSERT_EQUAL(NTP_PORT, ntohs(recs[0].lport));
+	TEST_ASSERT_EQUAL(LEN_PKT_NOMAC, ntohs(recs[0].len));
+}
+
+void
+test_WrapAndDump(void)
+{
+	struct ptrace_hdr	hdr;
+	struct ptrace_rec	recs[16];
+	u_int32			i;
+
+	ptrace_start(16);
+	for (i = 0; i < 20; i++)
+		trace_packet(i, NULL);
+
+	/* the oldest four are overwritten, the rest come oldest first */
+	TEST_ASSERT_EQUAL(0, ptrace_dump(dumped, sizeof(dumped)));
+	TEST_ASSERT_EQUAL(16, read_dump(&hdr, recs, 16));
+	TEST_ASSERT_EQUAL(16, ntohl(hdr.count));
+	TEST_ASSERT_EQUAL(4, ntohl(hdr.lost));
+	for (i = 0; i < 16; i++)
+		TEST_ASSERT_EQUAL(i + 4, ntohl(recs[i].ts_ui));
+}
+
+void
+test_RestartDuringReceive(void)
+{
+	struct recvbuf	rb;
+	u_int		size;
+	u_long		count;
+
+	ZERO(rb);
+	AF(&rb.recv_srcadr) = AF_INET;
+	rb.dstadr = &ep;
+	ptrace_start(16);
+	ptrace_recv_begin(&rb);
+	TEST_ASSERT_NOT_NULL(ptrace_cur);
+
+	/* a trace request handled by receive() starts a new ring */
+	ptrace_start(64);
+	TEST_ASSERT_NULL(ptrace_cur);
+	ptrace_recv_end();
+	ptrace_status(&size, &count);
+	TEST_ASSERT_EQUAL(64, size);
+	TEST_ASSERT_EQUAL(0, count);
+}
@@ -0,0 +1,143 @@
+/*
+ * refclock-replay - replay a recording through a refclock driver
+ *
+ * This runs a recorded byte stream (see refclock_replay.h) through the
+ * receive path of a serial refclock driver, prints the samples it
+ * produces and how fast it decodes.  With -v, every event, every byte
+ * the driver writes and every sample is listed.
+ *
+ * usage: refclock-replay [-v] [-a start] [-m mode] [-f flags] [-r rounds]
+ *			 clock file
+ *
+ * 'clock' is the refclock address, e.g. 127.127.20.0; 'mode' is the
+ * mode of the server line and 'flags' the fudge flags as a bit mask
+ * (1 = flag1 ... 8 = flag4).  The recording is replayed 'rounds' times
+ * through a freshly started driver to get stable numbers.  With -a,
+ * 'file' is raw mu-law audio for the WWV, CHU or IRIG driver, its first
+ * sample taken at 'start' seconds since 1970.
+ */
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "ntpd.h"
+#include "ntp_stdlib.h"
+#include "ntp_unixtime.h"
+
+#include "refclock_replay.h"
+
+char const *progname;
+
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+		"usage: %s [-v] [-a start] [-m mode] [-f flags] [-r rounds] clock file\n",
+		progname);
+	exit(1);
+}
+
+int
+main(
+	int	argc,
+	char *	argv[]
+	)
+{
+	replay_data	rd;
+	replay_result	res;
+	struct peer *	peer;
+	double		t0, elapsed;
+	l_fp		start;
+	u_int		mode, flags;
+	long		rounds, n;
+	int		verbose, audio, ch;
+
+	progname = argv[0];
+	mode = flags = 0;
+	rounds = 1;
+	verbose = audio = FALSE;
+	while ((ch = getopt(argc, argv, "a:f:m:r:v")) != -1) {
+		switch (ch) {
+
+		case 'a':
+			if (!atolfp(optarg, &start))
+				usage();
+			start.l_ui += JAN_1970;
+			audio = TRUE;
+			break;
+
+		case 'f':
+			flags = (u_int)strtoul(optarg, NULL, 0);
+			break;
+
+		case 'm':
+			mode = (u_int)strtoul(optarg, NULL, 0);
+			break;
+
+		case 'r':
+			rounds = atol(optarg);
+			break;
+
+		case 'v':
+			verbose = TRUE;
+			break;
+
+		default:
+			usage();
+		}
+	}
+	if (rounds < 1 || argc - optind != 2)
+		usage();
+
+	msyslog_term = TRUE;
+	if (!audio && !replay_load(argv[optind + 1], &rd))
+		return 1;
+
+	elapsed = 0;
+	for (n = 0; n < rounds; n++) {
+		replay_log = (verbose && 0 == n) ? stdout : NULL;
+		if (audio)
+			peer = replay_start_file(argv[optind], argv[optind + 1],
+						 mode, flags);
+		else
+			peer = replay_start(argv[optind], mode, flags);
+		if (NULL == peer) {
+			fprintf(stderr, "%s: cannot start %s\n", progname,
+				argv[optind]);
+			return 1;
+		}
+		t0 = now();
+		if (audio)
+			replay_audio(peer, start, &res);
+		else
+			replay_run(peer, &rd, &res);
+		elapsed += now() - t0;
+		replay_stop(peer);
+	}
+
+	printf("%lu chunks, %lu bytes, %lu polls, %lu bytes sent\n",
+	       res.chunks, res.bytes, res.polls, res.sent);
+	printf("%lu samples", res.samples);
+	if (res.samples)
+		printf(", offset first %.6f last %.6f", res.first, res.last);
+	printf("\nlast timecode: %s\n", res.lastcode);
+	if (res.chunks)
+		printf("%.1f ns/chunk, %.1f MB/s\n",
+		       elapsed * 1e9 / ((double)rounds * res.chunks),
+		       (double)rounds * res.bytes / elapsed * 1e-6);
+	if (!audio)
+		replay_free(&rd);
+	return 0;
+}
@@ -0,0 +1,654 @@
+/*
+ * refclock_replay.c - feed recorded serial data to refclock drivers
+ *
+ * See refclock_replay.h for the recording format.  This is linked with
+ * libntpsim.a, which leaves get_systime() and friends to the caller,
+ * and mocks open() so the driver gets a pseudo tty or a recording
+ * instead of its device.
+ */
+#include "config.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ntpd.h"
+#include "ntp_io.h"
+#include "ntp_refclock.h"
+#include "ntp_stdlib.h"
+#include "recvbuff.h"
+#include "timevalops.h"
+
+#include "refclock_replay.h"
+
+FILE *		replay_log;
+
+#define	REPLAY_RATE	8000	/* audio sample rate (Hz) */
+
+/* from ntpd.c */
+#ifdef HAVE_WORKING_FORK
+int		waitsync_fd_to_close = -1;
+#endif
+
+static l_fp	replay_now;	/* time stamp of the current event */
+static int	replay_running;	/* clock stands between events */
+static int	replay_master = -1;
+static int	replay_slave = -1;
+static int	replay_starting;	/* driver start in progress */
+static int	replay_mapped;		/* device open redirected */
+static const char *replay_file;		/* audio recording, if any */
+static int	replay_seen;		/* last filter slot reported */
+
+
+/*
+ * MOCKED FUNCTIONS
+ */
+
+/*
+ * These are in ntpsim.c for ntpdsim.  Outside of replay_run() the
+ * clock ticks a microsecond per call, or init_proto() would find the
+ * clock stopped while it measures its precision.
+ */
+void
+get_systime(
+	l_fp *	now
+	)
+{
+	if (!replay_running)
+		replay_now.l_uf += 4295;	/* 1 us */
+	*now = replay_now;
+}
+
+int
+adj_systime(
+	double	adj
+	)
+{
+	UNUSED_ARG(adj);
+	return TRUE;
+}
+
+int
+step_systime(
+	double	step
+	)
+{
+	UNUSED_ARG(step);
+	return TRUE;
+}
+
+/*
+ * While a driver is started, its first open() of a device opens the
+ * slave side of our pseudo tty, or the audio recording read-only,
+ * instead and further device opens (PPS, mixer) fail.  The slave stays
+ * open in 'replay_slave' as well, so the pty survives the driver
+ * closing its side.
+ */
+int
+open(
+	const char *	path,
+	int		flags,
+	...
+	)
+{
+	va_list	ap;
+	int	mode;
+
+	mode = 0;
+	if (flags & O_CREAT) {
+		va_start(ap, flags);
+		mode = va_arg(ap, int);
+		va_end(ap);
+	}
+	if (replay_starting && !strncmp(path, "/dev/", 5)) {
+		if (!replay_mapped && replay_file != NULL) {
+			replay_mapped = TRUE;
+			path = replay_file;
+			flags = (flags & ~O_ACCMODE) | O_RDONLY;
+		} else if (!replay_mapped) {
+			replay_mapped = TRUE;
+			path = ptsname(replay_master);
+		} else {
+			errno = ENOENT;
+			return -1;
+		}
+	}
+	return openat(AT_FDCWD, path, flags, mode);
+}
+
+/* END OF MOCKED FUNCTIONS */
+
+
+/*
+ * replay_stamp - the current time in the format of the recording
+ */
+static const char *
+replay_stamp(void)
+{
+	l_fp	stamp;
+
+	stamp = replay_now;
+	stamp.l_ui -= JAN_1970;
+	return ulfptoa(&stamp, 3);
+}
+
+
+static void
+replay_print(
+	const char *	what,
+	const char *	data,
+	size_t		len
+	)
+{
+	const u_char *	cp;
+
+	fprintf(replay_log, "%s %s \"", replay_stamp(), what);
+	for (cp = (const u_char *)data; len; --len, ++cp) {
+		switch (*cp) {
+
+		case '\r':
+			fputs("\\r", replay_log);
+			break;
+
+		case '\n':
+			fputs("\\n", replay_log);
+			break;
+
+		case '\t':
+			fputs("\\t", replay_log);
+			break;
+
+		case '\\':
+		case '"':
+			fprintf(replay_log, "\\%c", *cp);
+			break;
+
+		default:
+			if (*cp < ' ' || *cp > '~')
+				fprintf(replay_log, "\\x%02x", *cp);
+			else
+				fputc(*cp, replay_log);
+		}
+	}
+	fputs("\"\n", replay_log);
+}
+
+
+/*
+ * replay_unescape - decode the quoted data of an event in place and
+ * return its length, or -1 if it is malformed.
+ */
+static int
+replay_unescape(
+	char *	cp
+	)
+{
+	char *	dp;
+	char *	start;
+	u_int	hex;
+	int	n;
+
+	if (*cp++ != '"')
+		return -1;
+	start = dp = cp;
+	while (*cp != '"') {
+		if ('\0' == *cp)
+			return -1;
+		if (*cp != '\\') {
+			*dp++ = *cp++;
+			continue;
+		}
+		switch (*++cp) {
+
+		case 'r':
+			*dp++ = '\r';
+			break;
+
+		case 'n':
+			*dp++ = '\n';
+			break;
+
+		case 't':
+			*dp++ = '\t';
+			break;
+
+		case '\\':
+		case '"':
+			*dp++ = *cp;
+			break;
+
+		case 'x':
+			if (1 != sscanf(cp + 1, "%2x%n", &hex, &n) || n != 2)
+				return -1;
+			*dp++ = (char)hex;
+			cp += 2;
+			break;
+
+		default:
+			return -1;
+		}
+		++cp;
+	}
+	return (int)(dp - start);
+}
+
+
+/*
+ * replay_load - read a recording into memory
+ */
+int
+replay_load(
+	const char *	path,
+	replay_data *	rd
+	)
+{
+	FILE *		fp;
+	char		line[1024];
+	char		stamp[64];
+	char		what[16];
+	replay_event *	ev;
+	size_t		alloc;
+	int		lineno;
+	int		len;
+	int		n;
+
+	ZERO(*rd);
+	fp = fopen(path, "r");
+	if (NULL == fp) {
+		msyslog(LOG_ERR, "replay: %s: %m", path);
+		return FALSE;
+	}
+	alloc = 0;
+	lineno = 0;
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		++lineno;
+		if ('#' == line[0] || 2 != sscanf(line, "%63s %15s%n",
+						  stamp, what, &n))
+			continue;
+		if (rd->count == alloc) {
+			alloc += 1024;
+			rd->ev = erealloc(rd->ev, alloc * sizeof(*rd->ev));
+		}
+		ev = &rd->ev[rd->count];
+		ZERO(*ev);
+		if (!atolfp(stamp, &ev->time))
+			goto bad;
+		ev->time.l_ui += JAN_1970;
+		if (!strcmp(what, "poll")) {
+			ev->poll = TRUE;
+		} else if (!strcmp(what, "data")) {
+			while (' ' == line[n] || '\t' == line[n])
+				++n;
+			len = replay_unescape(line + n);
+			if (len <= 0)
+				goto bad;
+			ev->len = len;
+			ev->data = emalloc(len);
+			memcpy(ev->data, line + n + 1, len);
+			rd->bytes += len;
+		} else {
+			goto bad;
+		}
+		++rd->count;
+	}
+	fclose(fp);
+	return TRUE;
+
+    bad:
+	msyslog(LOG_ERR, "replay: %s line %d: bad event", path, lineno);
+	fclose(fp);
+	replay_free(rd);
+	return FALSE;
+}
+
+
+void
+replay_free(
+	replay_data *	rd
+	)
+{
+	size_t	i;
+
+	for (i = 0; i < rd->count; ++i)
+		free(rd->ev[i].data);
+	free(rd->ev);
+	ZERO(*rd);
+}
+
+
+/*
+ * replay_init - set up what ntpd would have set up by the time the
+ * clocks are configured
+ */
+static void
+replay_init(void)
+{
+	static int	initialized;
+
+	if (initialized)
+		return;
+	init_lib();
+	init_recvbuff(4);
+	init_peer();
+	init_refclock();
+	init_proto();
+	init_loopfilter();
+	ntp_enable = FALSE;	/* hands off the clock */
+	/*
+	 * ntpd always has its sockets in the active set; let stdin
+	 * stand in for them, or the set runs empty when the clock is
+	 * removed.
+	 */
+	maintain_activefds(0, FALSE);
+	initialized = TRUE;
+}
+
+
+/*
+ * replay_config - configure the clock and let its driver open the
+ * device we stand ready with
+ */
+static struct peer *
+replay_config(
+	sockaddr_u *	addr,
+	u_int		mode,
+	u_int		flags
+	)
+{
+	struct peer *	peer;
+	struct refclockstat cs;
+
+	replay_starting = TRUE;
+	replay_mapped = FALSE;
+	peer = peer_config(addr, NULL, NULL, MODE_CLIENT, NTP_VERSION,
+			   NTP_MINDPOLL, NTP_MAXDPOLL, 0, mode, 0, NULL);
+	replay_starting = FALSE;
+	if (NULL == peer || NULL == peer->procptr) {
+		replay_stop(peer);
+		return NULL;
+	}
+	if (flags) {
+		ZERO(cs);
+		cs.haveflags = (flags & (CLK_FLAG1 | CLK_FLAG2 | CLK_FLAG3 |
+					 CLK_FLAG4)) << 4;
+		cs.flags = (u_char)flags;
+		refclock_control(addr, &cs, NULL);
+	}
+	replay_seen = peer->procptr->coderecv;
+	return peer;
+}
+
+
+/*
+ * replay_start - start the driver for the given clock address on a
+ * fresh pseudo tty.  'mode' is the mode keyword of the server line
+ * and 'flags' the fudge flags CLK_FLAG1 ... CLK_FLAG4.
+ */
+struct peer *
+replay_start(
+	const char *	clock,
+	u_int		mode,
+	u_int		flags
+	)
+{
+	sockaddr_u	addr;
+
+	replay_init();
+	if (!decodenetnum(clock, &addr) || !ISREFCLOCKADR(&addr)) {
+		msyslog(LOG_ERR, "replay: %s is not a refclock", clock);
+		return NULL;
+	}
+
+	replay_master = posix_openpt(O_RDWR | O_NOCTTY);
+	if (replay_master < 0 || grantpt(replay_master) ||
+	    unlockpt(replay_master) ||
+	    (replay_slave = openat(AT_FDCWD, ptsname(replay_master),
+				   O_RDWR | O_NOCTTY)) < 0) {
+		msyslog(LOG_ERR, "replay: pseudo tty: %m");
+		replay_stop(NULL);
+		return NULL;
+	}
+	fcntl(replay_master, F_SETFL, O_NONBLOCK);
+	return replay_config(&addr, mode, flags);
+}
+
+
+/*
+ * replay_start_file - start the driver for the given clock address on
+ * an audio recording
+ */
+struct peer *
+replay_start_file(
+	const char *	clock,
+	const char *	file,
+	u_int		mode,
+	u_int		flags
+	)
+{
+	sockaddr_u	addr;
+	struct peer *	peer;
+
+	replay_init();
+	if (!decodenetnum(clock, &addr) || !ISREFCLOCKADR(&addr)) {
+		msyslog(LOG_ERR, "replay: %s is not a refclock", clock);
+		return NULL;
+	}
+	replay_file = file;
+	peer = replay_config(&addr, mode, flags);
+	replay_file = NULL;
+	return peer;
+}
+
+
+void
+replay_stop(
+	struct peer *	peer
+	)
+{
+	if (peer != NULL)
+		unpeer(peer);
+	if (replay_slave >= 0)
+		close(replay_slave);
+	if (replay_master >= 0)
+		close(replay_master);
+	replay_slave = replay_master = -1;
+}
+
+
+/*
+ * replay_collect - note new samples and what the driver sent
+ */
+static void
+replay_collect(
+	struct peer *	peer,
+	replay_result *	res
+	)
+{
+	struct refclockproc * const pp = peer->procptr;
+
+	char	buf[256];
+	double	offset;
+	ssize_t	n;
+
+	while (replay_seen != pp->coderecv) {
+		replay_seen = (replay_seen + 1) % MAXSTAGE;
+		offset = pp->filter[replay_seen];
+		if (0 == res->samples++)
+			res->first = offset;
+		res->last = offset;
+		if (replay_log != NULL)
+			fprintf(replay_log, "%s sample %.6f %s\n",
+				replay_stamp(), offset,
+				pp->a_lastcode);
+	}
+	strlcpy(res->lastcode, pp->a_lastcode, sizeof(res->lastcode));
+
+	while (replay_master >= 0 &&
+	       (n = read(replay_master, buf, sizeof(buf))) > 0) {
+		res->sent += n;
+		if (replay_log != NULL)
+			replay_print("send", buf, (size_t)n);
+	}
+}
+
+
+/*
+ * replay_deliver - hand a buffer to the driver as ntpd's I/O loop and
+ * main loop would
+ */
+static void
+replay_deliver(
+	struct refclockproc *	pp,
+	struct recvbuf *	rb,
+	size_t			len,
+	l_fp			stamp
+	)
+{
+	rb->recv_length = (int)len;
+	rb->recv_peer = pp->io.srcclock;
+	rb->dstadr = NULL;
+	rb->fd = pp->io.fd;
+	rb->recv_time = stamp;
+	rb->receiver = pp->io.clock_recv;
+	if (!indicate_refclock_packet(&pp->io, rb))
+		pp->io.recvcount++;
+
+	while ((rb = get_full_recv_buffer()) != NULL) {
+		if (rb->receiver != NULL)
+			(*rb->receiver)(rb);
+		freerecvbuf(rb);
+	}
+}
+
+
+/*
+ * replay_run - replay a recording through a started driver
+ */
+void
+replay_run(
+	struct peer *		peer,
+	const replay_data *	rd,
+	replay_result *		res
+	)
+{
+	struct refclockproc * const pp = peer->procptr;
+
+	const replay_event *	ev;
+	struct recvbuf *	rb;
+	u_int32			tick;
+	size_t			i;
+	size_t			off;
+	size_t			n;
+
+	ZERO(*res);
+	if (0 == rd->count)
+		return;
+	replay_running = TRUE;
+	tick = rd->ev[0].time.l_ui;
+	for (i = 0; i < rd->count; ++i) {
+		ev = &rd->ev[i];
+
+		/* once-per-second housekeeping up to this event */
+		for (; (int32)(ev->time.l_ui - tick) >= 0; ++tick) {
+			replay_now.l_ui = tick;
+			replay_now.l_uf = 0;
+			current_time++;
+			refclock_timer(peer);
+			replay_collect(peer, res);
+		}
+
+		replay_now = ev->time;
+		if (ev->poll) {
+			if (replay_log != NULL)
+				fprintf(replay_log, "%s poll\n",
+					replay_stamp());
+			res->polls++;
+			refclock_transmit(peer);
+			replay_collect(peer, res);
+			continue;
+		}
+
+		if (replay_log != NULL)
+			replay_print("data", ev->data, ev->len);
+		res->chunks++;
+		res->bytes += ev->len;
+		for (off = 0; off < ev->len; off += n) {
+			rb = get_free_recv_buffer();
+			if (NULL == rb)
+				break;
+			n = min(ev->len - off, sizeof(rb->recv_buffer));
+			memcpy(rb->recv_buffer, ev->data + off, n);
+			replay_deliver(pp, rb, n, ev->time);
+		}
+		replay_collect(peer, res);
+	}
+	replay_running = FALSE;
+}
+
+
+/*
+ * replay_audio - run the audio recording a driver was started on
+ * through it.  'start' is the time of the first sample.
+ */
+void
+replay_audio(
+	struct peer *		peer,
+	l_fp			start,
+	replay_result *		res
+	)
+{
+	struct refclockproc * const pp = peer->procptr;
+
+	struct recvbuf *	rb;
+	l_fp			stamp;
+	l_fp			ltemp;
+	u_long			count;
+	u_int32			tick;
+	u_int32			poll;
+	ssize_t			n;
+
+	ZERO(*res);
+	replay_running = TRUE;
+	tick = start.l_ui;
+	poll = 1U << peer->hpoll;
+	count = 0;
+	while ((rb = get_free_recv_buffer()) != NULL) {
+		n = read(pp->io.fd, rb->recv_buffer, sizeof(rb->recv_buffer));
+		if (n <= 0) {
+			freerecvbuf(rb);
+			break;
+		}
+		count += n;
+		DTOLFP((double)count / REPLAY_RATE, &ltemp);
+		stamp = start;
+		L_ADD(&stamp, &ltemp);
+
+		/* once-per-second housekeeping and polls up to now */
+		for (; (int32)(stamp.l_ui - tick) >= 0; ++tick) {
+			replay_now.l_ui = tick;
+			replay_now.l_uf = 0;
+			current_time++;
+			refclock_timer(peer);
+			if (tick != start.l_ui &&
+			    0 == (tick - start.l_ui) % poll) {
+				if (replay_log != NULL)
+					fprintf(replay_log, "%s poll\n",
+						replay_stamp());
+				res->polls++;
+				refclock_transmit(peer);
+			}
+			replay_collect(peer, res);
+		}
+
+		replay_now = stamp;
+		res->chunks++;
+		res->bytes += n;
+		replay_deliver(pp, rb, (size_t)n, stamp);
+		replay_collect(peer, res);
+	}
+	replay_running = FALSE;
+}
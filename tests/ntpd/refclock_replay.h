@@ -0,0 +1,67 @@
+/*
+ * refclock_replay.h - feed recorded serial data to refclock drivers
+ *
+ * A recording is a text file with one event per line:
+ *
+ *	<time> data <bytes>	the device delivered <bytes> in one read
+ *	<time> poll		ntpd polled the clock
+ *
+ * <time> is the receive time stamp in seconds since 1970 with an
+ * optional fraction.  <bytes> may use the C escapes \r, \n, \t, \\,
+ * \" and \xHH.  Empty lines and lines starting with '#' are ignored.
+ *
+ * The driver is started on a pseudo tty, so its terminal setup works
+ * as on a serial port, but the recorded data is handed to the driver
+ * the same way ntpd's I/O loop does it, with the recorded time stamps.
+ * The driver's once-per-second timer runs as the recorded time
+ * advances, and get_systime() returns the time of the current event.
+ *
+ * The audio drivers are fed a file of raw mu-law samples instead, such
+ * as util/tg2 writes.  The driver opens the file as its audio device,
+ * and replay_audio() reads it the way ntpd's I/O loop would, time
+ * stamping the samples by counting them from a given start time and
+ * polling the driver every 2^hpoll seconds.
+ */
+#ifndef REFCLOCK_REPLAY_H
+#define REFCLOCK_REPLAY_H
+
+#include "ntp_fp.h"
+#include "ntp_refclock.h"
+
+typedef struct replay_event {
+	l_fp		time;
+	int		poll;		/* poll event, no data */
+	size_t		len;
+	char *		data;
+} replay_event;
+
+typedef struct replay_data {
+	replay_event *	ev;
+	size_t		count;
+	size_t		bytes;
+} replay_data;
+
+typedef struct replay_result {
+	u_long		chunks;		/* data events fed */
+	u_long		bytes;		/* data bytes fed */
+	u_long		polls;		/* poll events */
+	u_long		samples;	/* samples the driver produced */
+	u_long		sent;		/* bytes the driver wrote */
+	double		first;		/* offset of first sample */
+	double		last;		/* offset of last sample */
+	char		lastcode[BMAX];	/* last time code */
+} replay_result;
+
+extern FILE *	replay_log;	/* events and samples go here if set */
+
+extern int	replay_load	(const char *, replay_data *);
+extern void	replay_free	(replay_data *);
+extern struct peer *replay_start(const char *, u_int, u_int);
+extern struct peer *replay_start_file(const char *, const char *, u_int,
+				      u_int);
+extern void	replay_run	(struct peer *, const replay_data *,
+				 replay_result *);
+extern void	replay_audio	(struct peer *, l_fp, replay_result *);
+extern void	replay_stop	(struct peer *);
+
+#endif	/* REFCLOCK_REPLAY_H */
@@ -0,0 +1,62 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "config.h"
+#include "ntpd.h"
+#include "ntp_counters.h"
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ReadAddsShards(void);
+extern void test_ClearOneCounter(void);
+extern void test_ShardsDoNotShareLines(void);
+extern void test_ObjectReadAddsShards(void);
+extern void test_ThreadsCountApart(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+char const *progname;
+
+
+//=======MAIN=====
+int main(int argc, char *argv[])
+{
+  progname = argv[0];
+  UnityBegin("ntp_counters.c");
+  RUN_TEST(test_ReadAddsShards, 16);
+  RUN_TEST(test_ClearOneCounter, 17);
+  RUN_TEST(test_ShardsDoNotShareLines, 18);
+  RUN_TEST(test_ObjectReadAddsShards, 19);
+  RUN_TEST(test_ThreadsCountApart, 20);
+
+  return (UnityEnd());
+}
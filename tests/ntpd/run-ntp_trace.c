@@ -0,0 +1,63 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "config.h"
+#include "ntpd.h"
+#include "ntp_stdlib.h"
+#include "ntp_trace.h"
+#include <stdio.h>
+#include <unistd.h>
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_StartRoundsUp(void);
+extern void test_Verdicts(void);
+extern void test_WrapAndDump(void);
+extern void test_RestartDuringReceive(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+char const *progname;
+
+
+//=======MAIN=====
+int main(int argc, char *argv[])
+{
+  progname = argv[0];
+  UnityBegin("ntp_trace.c");
+  RUN_TEST(test_StartRoundsUp, 100);
+  RUN_TEST(test_Verdicts, 101);
+  RUN_TEST(test_WrapAndDump, 102);
+  RUN_TEST(test_RestartDuringReceive, 103);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,67 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "config.h"
+#include "ntp_stdlib.h"
+#include "test-libntp.h"
+#include <string.h>
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_TPVRecord(void);
+extern void test_WhiteSpace(void);
+extern void test_NestedValuesSkipped(void);
+extern void test_FirstValueWins(void);
+extern void test_EmptyObject(void);
+extern void test_Malformed(void);
+extern void test_PeekClass(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+char const *progname;
+
+
+//=======MAIN=====
+int main(int argc, char *argv[])
+{
+  progname = argv[0];
+  UnityBegin("t-gpsd_json.c");
+  RUN_TEST(test_TPVRecord, 25);
+  RUN_TEST(test_WhiteSpace, 43);
+  RUN_TEST(test_NestedValuesSkipped, 54);
+  RUN_TEST(test_FirstValueWins, 66);
+  RUN_TEST(test_EmptyObject, 73);
+  RUN_TEST(test_Malformed, 80);
+  RUN_TEST(test_PeekClass, 93);
+
+  return (UnityEnd());
+}
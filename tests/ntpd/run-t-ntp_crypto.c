@@ -0,0 +1,63 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "config.h"
+#include "ntp_stdlib.h"
+#include "test-libntp.h"
+#include <string.h>
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_VerifyCacheHitNeedsSameKey(void);
+extern void test_VerifyCacheHitNeedsSameSignature(void);
+extern void test_SignCacheHitNeedsSameRequest(void);
+extern void test_SignCacheHitNeedsSameEra(void);
+extern void test_CertCacheHitNeedsSameCertificate(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+char const *progname;
+
+
+//=======MAIN=====
+int main(int argc, char *argv[])
+{
+  progname = argv[0];
+  UnityBegin("t-ntp_crypto.c");
+  RUN_TEST(test_VerifyCacheHitNeedsSameKey, 16);
+  RUN_TEST(test_VerifyCacheHitNeedsSameSignature, 17);
+  RUN_TEST(test_SignCacheHitNeedsSameRequest, 18);
+  RUN_TEST(test_SignCacheHitNeedsSameEra, 19);
+  RUN_TEST(test_CertCacheHitNeedsSameCertificate, 20);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,65 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "config.h"
+#include "ntp_stdlib.h"
+#include "test-libntp.h"
+#include <string.h>
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_FetchCopiesPublishedState(void);
+extern void test_FetchSkipsStateBeingWritten(void);
+extern void test_FetchReadsOnlySeqWhenUnchanged(void);
+extern void test_StaleStateIsUnsynchronized(void);
+extern void test_RetractedStateIsUnsynchronized(void);
+extern void test_OtherVersionIsUnsynchronized(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+char const *progname;
+
+
+//=======MAIN=====
+int main(int argc, char *argv[])
+{
+  progname = argv[0];
+  UnityBegin("t-ntp_shstate.c");
+  RUN_TEST(test_FetchCopiesPublishedState, 15);
+  RUN_TEST(test_FetchSkipsStateBeingWritten, 16);
+  RUN_TEST(test_FetchReadsOnlySeqWhenUnchanged, 17);
+  RUN_TEST(test_StaleStateIsUnsynchronized, 18);
+  RUN_TEST(test_RetractedStateIsUnsynchronized, 19);
+  RUN_TEST(test_OtherVersionIsUnsynchronized, 20);
+
+  return (UnityEnd());
+}
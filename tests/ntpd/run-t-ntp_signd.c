@@ -27,16 +27,22 @@
 #include "ntp_calendar.h"
 #include "ntp_stdlib.h"
 #include "test-libntp.h"
+#include "signd_stub.h"
+#include <signal.h>
 
 //=======External Functions This Runner Calls=====
 extern void setUp(void);
 extern void tearDown(void);
 extern void test_connect_incorrect_socket(void);
 extern void test_connect_correct_socket(void);
-extern void test_write_all(void);
-extern void test_send_packet(void);
-extern void test_recv_packet(void);
-extern void test_send_via_ntp_signd(void);
+extern void test_sign_one(void);
+extern void test_sign_pipelined(void);
+extern void test_sign_refused(void);
+extern void test_sign_wrong_id(void);
+extern void test_pool_full(void);
+extern void test_reconnect(void);
+extern void test_stalled(void);
+extern void test_clearinterface(void);
 
 
 //=======Test Reset Option=====
@@ -55,12 +61,16 @@ int main(int argc, char *argv[])
 {
   progname = argv[0];
   UnityBegin("t-ntp_signd.c");
-  RUN_TEST(test_connect_incorrect_socket, 67);
-  RUN_TEST(test_connect_correct_socket, 68);
-  RUN_TEST(test_write_all, 69);
-  RUN_TEST(test_send_packet, 70);
-  RUN_TEST(test_recv_packet, 71);
-  RUN_TEST(test_send_via_ntp_signd, 72);
+  RUN_TEST(test_connect_incorrect_socket, 148);
+  RUN_TEST(test_connect_correct_socket, 149);
+  RUN_TEST(test_sign_one, 150);
+  RUN_TEST(test_sign_pipelined, 151);
+  RUN_TEST(test_sign_refused, 152);
+  RUN_TEST(test_sign_wrong_id, 153);
+  RUN_TEST(test_pool_full, 154);
+  RUN_TEST(test_reconnect, 155);
+  RUN_TEST(test_stalled, 156);
+  RUN_TEST(test_clearinterface, 157);
 
   return (UnityEnd());
 }
@@ -0,0 +1,70 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+      setUp(); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "config.h"
+#include "ntp_stdlib.h"
+#include "ntp_refclock.h"
+#include "ntp_unixtime.h"
+#include "test-libntp.h"
+#include "refclock_replay.h"
+#include <string.h>
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_Nmea(void);
+extern void test_JjyTristate(void);
+extern void test_Palisade(void);
+extern void test_ParseMeinberg(void);
+extern void test_IrigAudio(void);
+extern void test_WwvAudio(void);
+extern void test_BadRecording(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+char const *progname;
+
+
+//=======MAIN=====
+int main(int argc, char *argv[])
+{
+  progname = argv[0];
+  UnityBegin("t-refclock_replay.c");
+  RUN_TEST(test_Nmea, 77);
+  RUN_TEST(test_JjyTristate, 95);
+  RUN_TEST(test_Palisade, 111);
+  RUN_TEST(test_ParseMeinberg, 128);
+  RUN_TEST(test_IrigAudio, 142);
+  RUN_TEST(test_WwvAudio, 161);
+  RUN_TEST(test_BadRecording, 182);
+
+  return (UnityEnd());
+}
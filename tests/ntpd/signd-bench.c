@@ -0,0 +1,159 @@
+/*
+ * signd-bench - measure MS-SNTP signing throughput through ntp_signd
+ *
+ * This starts a stand-in for Samba's ntp_signd (see signd_stub.h) and
+ * has 'count' packets signed through send_via_ntp_signd(), keeping up
+ * to 'window' requests in flight and running the I/O loop in between,
+ * as ntpd does under load from many clients.  It prints how many
+ * signed replies per second came back and how long each call to
+ * send_via_ntp_signd() kept the caller busy.  With -w 1 every request
+ * waits for the one before, as with one blocking round trip per
+ * packet.
+ *
+ * usage: signd-bench [-n count] [-w window] [-d delay]
+ *
+ * 'delay' is the time in microseconds the stub takes per signature.
+ */
+#include "config.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include "ntpd.h"
+#include "ntp_stdlib.h"
+
+#include "signd_stub.h"
+
+char const *progname;
+
+#ifdef HAVE_NTP_SIGND
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr, "usage: %s [-n count] [-w window] [-d delay]\n",
+		progname);
+	exit(1);
+}
+
+int
+main(
+	int	argc,
+	char *	argv[]
+	)
+{
+	struct recvbuf	rb;
+	struct pkt	xpkt;
+	struct pkt	rpkt;
+	endpt		ep;
+	char		dir[64];
+	char		path[sizeof(dir) + 8];
+	double		t0, t1, busy, elapsed;
+	u_long		count, window, delay, sent, got;
+	pid_t		stub;
+	int		fd, ch, idle;
+
+	progname = argv[0];
+	count = 100000;
+	window = 256;
+	delay = 0;
+	while ((ch = getopt(argc, argv, "d:n:w:")) != -1) {
+		switch (ch) {
+
+		case 'd':
+			delay = strtoul(optarg, NULL, 0);
+			break;
+
+		case 'n':
+			count = strtoul(optarg, NULL, 0);
+			break;
+
+		case 'w':
+			window = strtoul(optarg, NULL, 0);
+			break;
+
+		default:
+			usage();
+		}
+	}
+	if (0 == count || 0 == window || argc != optind)
+		usage();
+
+	msyslog_term = TRUE;
+	signal(SIGPIPE, SIG_IGN);
+	strlcpy(dir, "/tmp/signd-bench.XXXXXX", sizeof(dir));
+	if (NULL == mkdtemp(dir)) {
+		perror(dir);
+		return 1;
+	}
+	ntp_signd_socket = dir;
+	stub = signd_stub_start(dir, delay);
+	ZERO(rb);
+	fd = signd_stub_endpoints(&ep, &rb.recv_srcadr);
+	if (stub <= 0 || fd < 0) {
+		fprintf(stderr, "%s: cannot start the stub\n", progname);
+		return 1;
+	}
+	rb.dstadr = &ep;
+	ZERO(xpkt);
+	xpkt.li_vn_mode = PKT_LI_VN_MODE(LEAP_NOWARNING, NTP_VERSION,
+					 MODE_SERVER);
+
+	busy = 0;
+	sent = got = 0;
+	idle = 0;
+	t0 = now();
+	while (got < count && idle < 100) {
+		while (sent < count && sent - got < window) {
+			t1 = now();
+			send_via_ntp_signd(&rb, MODE_SERVER, 1, 0, &xpkt);
+			busy += now() - t1;
+			sent++;
+		}
+		if (0 == signd_stub_pump(10))
+			idle++;
+		while (recv(fd, &rpkt, sizeof(rpkt), 0) > 0) {
+			idle = 0;
+			got++;
+		}
+	}
+	elapsed = now() - t0;
+
+	signd_stub_stop(stub);
+	snprintf(path, sizeof(path), "%s/socket", dir);
+	unlink(path);
+	rmdir(dir);
+
+	printf("%lu of %lu packets signed in %.3f s, %.0f/s\n", got, count,
+	       elapsed, got / elapsed);
+	printf("%.2f us per send_via_ntp_signd() call\n",
+	       1e6 * busy / sent);
+
+	return (got == count) ? 0 : 1;
+}
+#else	/* !HAVE_NTP_SIGND follows */
+int
+main(
+	int	argc,
+	char *	argv[]
+	)
+{
+	progname = argv[0];
+	fprintf(stderr, "%s: ntpd was configured without --enable-ntp-signd\n",
+		progname);
+
+	return 1;
+}
+#endif	/* !HAVE_NTP_SIGND */
@@ -0,0 +1,364 @@
+/*
+ * signd_stub.c - stand-in for Samba's ntp_signd
+ *
+ * See signd_stub.h.
+ */
+#include "config.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "ntpd.h"
+#include "ntp_io.h"
+#include "ntp_stdlib.h"
+
+#include "signd_stub.h"
+
+#define STUB_CLIENTS	16	/* connections served at once */
+#define STUB_HDRLEN	(3 * sizeof(uint32_t))	/* version, op, ID */
+#define STUB_REQLEN	(STUB_HDRLEN + sizeof(uint32_t) + LEN_PKT_NOMAC)
+#define STUB_REPLEN	(STUB_HDRLEN + LEN_PKT_NOMAC + SIGND_STUB_MACLEN)
+
+typedef struct stub_client {
+	int	fd;
+	size_t	len;			/* bytes in buf */
+	u_char	buf[4 * (sizeof(uint32_t) + STUB_REQLEN)];
+} stub_client;
+
+
+static int
+stub_write(
+	int		fd,
+	const u_char *	buf,
+	size_t		len
+	)
+{
+	ssize_t	n;
+
+	while (len > 0) {
+		n = write(fd, buf, len);
+		if (n < 0 && EINTR == errno)
+			continue;
+		if (n <= 0)
+			return FALSE;
+		buf += n;
+		len -= n;
+	}
+
+	return TRUE;
+}
+
+
+/*
+ * stub_sign - answer one request
+ *
+ * The request starts with version, op, packet ID and the little
+ * endian key ID, followed by the packet.  The reply echoes version
+ * and packet ID and carries the packet with key ID and digest,
+ * except for SIGND_STUB_BADID, which gets a packet ID of all ones.
+ */
+static int
+stub_sign(
+	int		fd,
+	const u_char *	req,
+	uint32_t	len,
+	u_long		delay
+	)
+{
+	u_char		rep[sizeof(uint32_t) + STUB_REPLEN];
+	uint32_t	val;
+	keyid_t		keyid;
+	u_char *	p;
+
+	if (len != STUB_REQLEN)
+		return FALSE;
+	if (delay)
+		usleep(delay);
+
+	memcpy(&keyid, req + STUB_HDRLEN, sizeof(keyid));
+	p = rep;
+	val = htonl(STUB_REPLEN);
+	memcpy(p, &val, sizeof(val));
+	p += sizeof(val);
+	memcpy(p, req, sizeof(uint32_t));		/* version */
+	p += sizeof(uint32_t);
+	val = htonl((ntohl(keyid) == SIGND_STUB_BADKEY) ? 4 : 3);
+	memcpy(p, &val, sizeof(val));
+	p += sizeof(val);
+	memcpy(p, req + 2 * sizeof(uint32_t), sizeof(uint32_t));  /* ID */
+	if (ntohl(keyid) == SIGND_STUB_BADID)
+		memset(p, 0xff, sizeof(uint32_t));
+	p += sizeof(uint32_t);
+	memcpy(p, req + STUB_HDRLEN + sizeof(keyid), LEN_PKT_NOMAC);
+	p += LEN_PKT_NOMAC;
+	memcpy(p, &keyid, sizeof(keyid));
+	p += sizeof(keyid);
+	memset(p, SIGND_STUB_DIGEST, SIGND_STUB_MACLEN - sizeof(keyid));
+
+	/* a refusal carries no packet */
+	if (ntohl(keyid) == SIGND_STUB_BADKEY) {
+		val = htonl(STUB_HDRLEN);
+		memcpy(rep, &val, sizeof(val));
+		return stub_write(fd, rep, sizeof(val) + STUB_HDRLEN);
+	}
+
+	return stub_write(fd, rep, sizeof(rep));
+}
+
+
+/*
+ * stub_input - answer the complete requests a client has sent
+ */
+static int
+stub_input(
+	stub_client *	sc,
+	u_long		delay
+	)
+{
+	u_char *	p;
+	uint32_t	len;
+	ssize_t		n;
+
+	n = read(sc->fd, sc->buf + sc->len, sizeof(sc->buf) - sc->len);
+	if (n < 0 && EINTR == errno)
+		return TRUE;
+	if (n <= 0)
+		return FALSE;
+	sc->len += n;
+
+	p = sc->buf;
+	while (sc->len >= sizeof(len)) {
+		memcpy(&len, p, sizeof(len));
+		len = ntohl(len);
+		if (len > sizeof(sc->buf) - sizeof(len))
+			return FALSE;
+		if (sc->len < sizeof(len) + len)
+			break;
+		if (!stub_sign(sc->fd, p + sizeof(len), len, delay))
+			return FALSE;
+		p += sizeof(len) + len;
+		sc->len -= sizeof(len) + len;
+	}
+	memmove(sc->buf, p, sc->len);
+
+	return TRUE;
+}
+
+
+/*
+ * stub_serve - the child's main loop
+ */
+static void
+stub_serve(
+	int	lfd,
+	u_long	delay
+	)
+{
+	stub_client	sc[STUB_CLIENTS];
+	fd_set		fds;
+	int		maxfd, fd, i;
+
+	for (i = 0; i < STUB_CLIENTS; i++)
+		sc[i].fd = -1;
+
+	for (;;) {
+		FD_ZERO(&fds);
+		FD_SET(lfd, &fds);
+		maxfd = lfd;
+		for (i = 0; i < STUB_CLIENTS; i++) {
+			if (-1 == sc[i].fd)
+				continue;
+			FD_SET(sc[i].fd, &fds);
+			maxfd = max(maxfd, sc[i].fd);
+		}
+		if (select(maxfd + 1, &fds, NULL, NULL, NULL) < 0) {
+			if (EINTR == errno)
+				continue;
+			_exit(1);
+		}
+
+		for (i = 0; i < STUB_CLIENTS; i++) {
+			if (-1 == sc[i].fd || !FD_ISSET(sc[i].fd, &fds))
+				continue;
+			if (!stub_input(&sc[i], delay)) {
+				close(sc[i].fd);
+				sc[i].fd = -1;
+			}
+		}
+
+		if (FD_ISSET(lfd, &fds)) {
+			fd = accept(lfd, NULL, NULL);
+			if (fd < 0)
+				continue;
+			for (i = 0; i < STUB_CLIENTS; i++)
+				if (-1 == sc[i].fd)
+					break;
+			if (STUB_CLIENTS == i) {
+				close(fd);
+				continue;
+			}
+			sc[i].fd = fd;
+			sc[i].len = 0;
+		}
+	}
+}
+
+
+/*
+ * signd_stub_start - start a stub listening on <dir>/socket
+ *
+ * The socket is listening when this returns.  Returns the stub's
+ * process ID or -1.
+ */
+pid_t
+signd_stub_start(
+	const char *	dir,
+	u_long		delay
+	)
+{
+	struct sockaddr_un	addr;
+	pid_t			pid;
+	int			lfd;
+
+	ZERO(addr);
+	addr.sun_family = AF_UNIX;
+	snprintf(addr.sun_path, sizeof(addr.sun_path), "%s/socket", dir);
+	unlink(addr.sun_path);
+
+	lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (lfd < 0)
+		return -1;
+	if (bind(lfd, (struct sockaddr *)&addr, sizeof(addr)) < 0
+	    || listen(lfd, 16) < 0) {
+		close(lfd);
+		return -1;
+	}
+
+	pid = fork();
+	if (0 == pid) {
+		signal(SIGPIPE, SIG_IGN);
+		stub_serve(lfd, delay);
+		_exit(0);
+	}
+	close(lfd);
+
+	return pid;
+}
+
+
+void
+signd_stub_stop(
+	pid_t	pid
+	)
+{
+	if (pid <= 0)
+		return;
+	kill(pid, SIGKILL);
+	waitpid(pid, NULL, 0);
+}
+
+
+/*
+ * signd_stub_pump - wait up to 'msec' for asyncio input and run the
+ * readers that have some.  Returns the number of readers run.
+ */
+int
+signd_stub_pump(
+	int	msec
+	)
+{
+	struct asyncio_reader *	r;
+	struct asyncio_reader *	next;
+	struct timeval		tv;
+	fd_set			fds;
+	int			maxfd, n;
+
+	FD_ZERO(&fds);
+	maxfd = -1;
+	for (r = asyncio_reader_list; r != NULL; r = r->link) {
+		FD_SET(r->fd, &fds);
+		maxfd = max(maxfd, r->fd);
+	}
+	if (-1 == maxfd)
+		return 0;
+
+	tv.tv_sec = msec / 1000;
+	tv.tv_usec = (msec % 1000) * 1000;
+	if (select(maxfd + 1, &fds, NULL, NULL, &tv) <= 0)
+		return 0;
+
+	n = 0;
+	for (r = asyncio_reader_list; r != NULL; r = next) {
+		/* the receiver may unlink and free r */
+		next = r->link;
+		if (FD_ISSET(r->fd, &fds)) {
+			(*r->receiver)(r);
+			n++;
+		}
+	}
+
+	return n;
+}
+
+
+static int
+stub_udp(
+	sockaddr_u *	addr
+	)
+{
+	GETSOCKNAME_SOCKLEN_TYPE len;
+	int	fd;
+
+	ZERO_SOCK(addr);
+	AF(addr) = AF_INET;
+	NSRCADR(addr) = htonl(INADDR_LOOPBACK);
+	fd = socket(AF_INET, SOCK_DGRAM, 0);
+	if (fd < 0)
+		return -1;
+	len = sizeof(*addr);
+	if (bind(fd, &addr->sa, SOCKLEN(addr)) < 0
+	    || getsockname(fd, &addr->sa, &len) < 0) {
+		close(fd);
+		return -1;
+	}
+	make_socket_nonblocking(fd);
+
+	return fd;
+}
+
+
+/*
+ * signd_stub_endpoints - set up a loopback local address for ntpd to
+ * send signed replies from, and a client to send them to.  Returns
+ * the client's socket or -1.  The local address's socket is added to
+ * the I/O loop's descriptors the way ntpd's own sockets are.
+ */
+int
+signd_stub_endpoints(
+	endpt *		ep,
+	sockaddr_u *	client
+	)
+{
+	int	fd;
+
+	ZERO(*ep);
+	ep->fd = stub_udp(&ep->sin);
+	ep->bfd = INVALID_SOCKET;
+	if (-1 == ep->fd)
+		return -1;
+	fd = stub_udp(client);
+	if (-1 == fd) {
+		close(ep->fd);
+		ep->fd = INVALID_SOCKET;
+		return -1;
+	}
+	maintain_activefds(ep->fd, FALSE);
+
+	return fd;
+}
@@ -0,0 +1,32 @@
+/*
+ * signd_stub.h - stand-in for Samba's ntp_signd
+ *
+ * The stub listens on <dir>/socket in a child process and answers
+ * sign requests the way ntp_signd does, in order on each connection.
+ * It appends the key ID and a made-up digest (SIGND_STUB_DIGEST
+ * repeated) to the packet, and refuses to sign for SIGND_STUB_BADKEY.
+ * For SIGND_STUB_BADID it answers with the wrong packet ID.
+ * Each request takes at least 'delay' microseconds, to stand in for
+ * the time Samba needs to look up the key and sign.
+ *
+ * signd_stub_pump() runs ntpd's asyncio readers the way the I/O loop
+ * does, so replies from the stub reach send_via_ntp_signd()'s clients.
+ */
+#ifndef SIGND_STUB_H
+#define SIGND_STUB_H
+
+#include <sys/types.h>
+
+#include "ntp.h"
+
+#define SIGND_STUB_BADKEY	0xdeadbeef
+#define SIGND_STUB_BADID	0xbadc0de
+#define SIGND_STUB_DIGEST	0xa5
+#define SIGND_STUB_MACLEN	(sizeof(keyid_t) + 16)
+
+extern pid_t	signd_stub_start	(const char *, u_long);
+extern void	signd_stub_stop		(pid_t);
+extern int	signd_stub_pump		(int);
+extern int	signd_stub_endpoints	(endpt *, sockaddr_u *);
+
+#endif	/* SIGND_STUB_H */
@@ -0,0 +1,105 @@
+#include "config.h"
+
+#include "ntp_stdlib.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+#include "test-libntp.h"
+
+#include "gpsd_json.c"
+
+
+static json_ctx	ctx;
+static char	buf[1600];
+
+static int
+parse(const char *rec)
+{
+	strlcpy(buf, rec, sizeof(buf));
+	return json_parse_record(&ctx, buf);
+}
+
+void
+test_TPVRecord(void)
+{
+	TEST_ASSERT_TRUE(parse(
+		"{\"class\":\"TPV\",\"device\":\"/dev/gps0\",\"mode\":3,"
+		"\"time\":\"2025-03-01T10:00:01.000Z\",\"ept\":0.005,"
+		"\"lat\":48.137154321}"));
+	TEST_ASSERT_EQUAL(JSON_STRING, ctx.typ[JK_CLASS]);
+	TEST_ASSERT_EQUAL_STRING("TPV", ctx.val[JK_CLASS]);
+	TEST_ASSERT_EQUAL_STRING("/dev/gps0", ctx.val[JK_DEVICE]);
+	TEST_ASSERT_EQUAL(JSON_PRIMITIVE, ctx.typ[JK_MODE]);
+	TEST_ASSERT_EQUAL_STRING("3", ctx.val[JK_MODE]);
+	TEST_ASSERT_EQUAL_STRING("2025-03-01T10:00:01.000Z",
+				 ctx.val[JK_TIME]);
+	TEST_ASSERT_EQUAL_STRING("0.005", ctx.val[JK_EPT]);
+	TEST_ASSERT_EQUAL(JSON_ABSENT, ctx.typ[JK_PRECISION]);
+}
+
+void
+test_WhiteSpace(void)
+{
+	TEST_ASSERT_TRUE(parse(
+		" { \"class\" : \"PPS\" ,\t\"real_sec\" : 1740823201 ,"
+		" \"precision\":-20 } "));
+	TEST_ASSERT_EQUAL_STRING("PPS", ctx.val[JK_CLASS]);
+	TEST_ASSERT_EQUAL_STRING("1740823201", ctx.val[JK_REAL_SEC]);
+	TEST_ASSERT_EQUAL_STRING("-20", ctx.val[JK_PRECISION]);
+}
+
+void
+test_NestedValuesSkipped(void)
+{
+	TEST_ASSERT_TRUE(parse(
+		"{\"class\":\"SKY\",\"satellites\":[{\"PRN\":2,\"mode\":7,"
+		"\"x\":\"}]\\\"\"},{\"PRN\":3}],\"mode\":{\"time\":1},"
+		"\"time\":\"now\"}"));
+	TEST_ASSERT_EQUAL(JSON_COMPOUND, ctx.typ[JK_MODE]);
+	TEST_ASSERT_EQUAL(JSON_STRING, ctx.typ[JK_TIME]);
+	TEST_ASSERT_EQUAL_STRING("now", ctx.val[JK_TIME]);
+}
+
+void
+test_FirstValueWins(void)
+{
+	TEST_ASSERT_TRUE(parse("{\"mode\":2,\"mode\":3}"));
+	TEST_ASSERT_EQUAL_STRING("2", ctx.val[JK_MODE]);
+}
+
+void
+test_EmptyObject(void)
+{
+	TEST_ASSERT_TRUE(parse("{}"));
+	TEST_ASSERT_EQUAL(JSON_ABSENT, ctx.typ[JK_CLASS]);
+}
+
+void
+test_Malformed(void)
+{
+	TEST_ASSERT_FALSE(parse(""));
+	TEST_ASSERT_FALSE(parse("[1,2]"));
+	TEST_ASSERT_FALSE(parse("{\"class\":\"TPV\""));
+	TEST_ASSERT_FALSE(parse("{\"class\":\"TPV\",\"time\":\"2025-03"));
+	TEST_ASSERT_FALSE(parse("{\"class\":\"TPV\",\"x\":[1,{\"a\":2}"));
+	TEST_ASSERT_FALSE(parse("{\"class\" \"TPV\"}"));
+	TEST_ASSERT_FALSE(parse("{\"class\":}"));
+	TEST_ASSERT_FALSE(parse("{\"mode\":3 \"time\":1}"));
+}
+
+void
+test_PeekClass(void)
+{
+	TEST_ASSERT_TRUE(json_peek_class("{\"class\":\"TPV\",\"mode\":3}"));
+	TEST_ASSERT_TRUE(json_peek_class("{\"class\":\"TOFF\"}"));
+	TEST_ASSERT_TRUE(json_peek_class("{\"class\":\"WATCH\"}"));
+	TEST_ASSERT_FALSE(json_peek_class("{\"class\":\"SKY\",\"xdop\":1}"));
+	TEST_ASSERT_FALSE(json_peek_class("{\"class\":\"TPVX\"}"));
+	TEST_ASSERT_FALSE(json_peek_class("{\"class\":\"DEVICES\"}"));
+	/* anything else has to be scanned */
+	TEST_ASSERT_TRUE(json_peek_class("{\"mode\":3,\"class\":\"SKY\"}"));
+	TEST_ASSERT_TRUE(json_peek_class("{ \"class\":\"SKY\"}"));
+	TEST_ASSERT_TRUE(json_peek_class("{\"class\":\"SKY"));
+}
@@ -0,0 +1,291 @@
+#include "config.h"
+
+#include "ntp_stdlib.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+#include "test-libntp.h"
+
+/* ntp_crypto.c is included whole, to get at its caches */
+#include "ntp_crypto.c"
+
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_VerifyCacheHitNeedsSameKey(void);
+extern void test_VerifyCacheHitNeedsSameSignature(void);
+extern void test_SignCacheHitNeedsSameRequest(void);
+extern void test_SignCacheHitNeedsSameEra(void);
+extern void test_CertCacheHitNeedsSameCertificate(void);
+
+#ifdef AUTOKEY
+
+#define T_VALLEN	8		/* bytes of the signed value */
+#define T_ASSOCID	1234
+
+static EVP_PKEY		*key1, *key2;
+static struct peer	t_peer;
+static u_int32		t_ext[256];	/* extension field being verified */
+
+
+/*
+ * make_key - a fresh RSA key, small to keep the test quick
+ */
+static EVP_PKEY *
+make_key(void)
+{
+	EVP_PKEY *	pkey;
+	RSA *		rsa;
+	BIGNUM *	e;
+
+	pkey = EVP_PKEY_new();
+	rsa = RSA_new();
+	e = BN_new();
+	TEST_ASSERT_NOT_NULL(pkey);
+	TEST_ASSERT_NOT_NULL(rsa);
+	TEST_ASSERT_NOT_NULL(e);
+	TEST_ASSERT_EQUAL(1, BN_set_word(e, RSA_F4));
+	TEST_ASSERT_EQUAL(1, RSA_generate_key_ex(rsa, 512, e, NULL));
+	TEST_ASSERT_EQUAL(1, EVP_PKEY_assign_RSA(pkey, rsa));
+	BN_free(e);
+
+	return pkey;
+}
+
+
+/*
+ * make_signed - fill t_ext with an autokey response whose value is
+ *		 signed with the given key, return the extension field
+ */
+static struct exten *
+make_signed(
+	EVP_PKEY *	pkey
+	)
+{
+	struct exten *	ep;
+	EVP_MD_CTX *	ctx;
+	u_int		siglen;
+	u_int		i;
+
+	memset(t_ext, 0, sizeof(t_ext));
+	ep = (struct exten *)t_ext;
+	siglen = EVP_PKEY_size(pkey);
+	ep->opcode = htonl(CRYPTO_AUTO | CRYPTO_RESP |
+			   (VALUE_LEN + T_VALLEN + siglen));
+	ep->associd = htonl(T_ASSOCID);
+	ep->tstamp = htonl(3000000100U);
+	ep->fstamp = htonl(3000000000U);
+	ep->vallen = htonl(T_VALLEN);
+	for (i = 0; i < T_VALLEN; i++)
+		((u_char *)ep->pkt)[i] = (u_char)(0xa0 + i);
+	i = T_VALLEN / 4;
+	ep->pkt[i++] = htonl(siglen);
+
+	ctx = EVP_MD_CTX_new();
+	EVP_SignInit(ctx, EVP_sha1());
+	EVP_SignUpdate(ctx, (u_char *)&ep->tstamp, T_VALLEN + 12);
+	TEST_ASSERT_EQUAL(1, EVP_SignFinal(ctx, (u_char *)&ep->pkt[i],
+					   &siglen, pkey));
+	EVP_MD_CTX_free(ctx);
+
+	return ep;
+}
+
+
+/*
+ * make_request - fill t_ext with a sign request carrying the given
+ *		  bytes, return the extension field
+ */
+static struct exten *
+make_request(
+	const char *	cert
+	)
+{
+	struct exten *	ep;
+	u_int		len;
+
+	memset(t_ext, 0, sizeof(t_ext));
+	ep = (struct exten *)t_ext;
+	len = strlen(cert);
+	ep->opcode = htonl(CRYPTO_SIGN | (VALUE_LEN + ((len + 3) & ~3)));
+	ep->fstamp = htonl(3000000000U);
+	ep->vallen = htonl(len);
+	memcpy(ep->pkt, cert, len);
+
+	return ep;
+}
+
+
+void
+setUp(void)
+{
+	if (NULL == key1) {
+		key1 = make_key();
+		key2 = make_key();
+	}
+	memset(&t_peer, 0, sizeof(t_peer));
+	t_peer.associd = T_ASSOCID;
+	t_peer.digest = EVP_sha1();
+	crypto_flags = 0;
+}
+
+void
+tearDown(void)
+{
+	u_int	i;
+
+	for (i = 0; i < VRFY_CACHE; i++) {
+		if (vrfy_cache[i].pkey != NULL)
+			EVP_PKEY_free(vrfy_cache[i].pkey);
+	}
+	memset(vrfy_cache, 0, sizeof(vrfy_cache));
+	for (i = 0; i < SIGN_CACHE; i++)
+		value_free(&sign_cache[i].cert);
+	memset(sign_cache, 0, sizeof(sign_cache));
+	sign_next = 0;
+	hostval.tstamp = 0;
+}
+
+
+void
+test_VerifyCacheHitNeedsSameKey(void)
+{
+	struct exten *	ep;
+
+	ep = make_signed(key1);
+	t_peer.pkey = key1;
+	TEST_ASSERT_EQUAL(XEVNT_OK, crypto_verify(ep, NULL, &t_peer));
+	/* the repeat is answered by the cache */
+	TEST_ASSERT_EQUAL(XEVNT_OK, crypto_verify(ep, NULL, &t_peer));
+
+	/* the very same value and signature under another key */
+	t_peer.pkey = key2;
+	TEST_ASSERT_EQUAL(XEVNT_SIG, crypto_verify(ep, NULL, &t_peer));
+}
+
+
+void
+test_VerifyCacheHitNeedsSameSignature(void)
+{
+	struct exten *	ep;
+	u_char *	sig;
+
+	ep = make_signed(key1);
+	t_peer.pkey = key1;
+	TEST_ASSERT_EQUAL(XEVNT_OK, crypto_verify(ep, NULL, &t_peer));
+
+	sig = (u_char *)&ep->pkt[T_VALLEN / 4 + 1];
+	sig[7] ^= 0x01;
+	TEST_ASSERT_EQUAL(XEVNT_SIG, crypto_verify(ep, NULL, &t_peer));
+
+	/* and the value, with the signature put back */
+	sig[7] ^= 0x01;
+	((u_char *)ep->pkt)[0] ^= 0x01;
+	TEST_ASSERT_EQUAL(XEVNT_SIG, crypto_verify(ep, NULL, &t_peer));
+}
+
+
+void
+test_SignCacheHitNeedsSameRequest(void)
+{
+	struct value	v;
+	struct value *	vp;
+	u_char		md[CACHE_MDLEN];
+
+	hostval.tstamp = htonl(3000000000U);
+	TEST_ASSERT_NULL(sign_lookup(make_request("certificate A"), md));
+	memset(&v, 0, sizeof(v));
+	v.vallen = htonl(4);
+	v.ptr = emalloc(4);
+	memcpy(v.ptr, "A ok", 4);
+	sign_remember(md, &v);
+
+	vp = sign_lookup(make_request("certificate A"), md);
+	TEST_ASSERT_NOT_NULL(vp);
+	TEST_ASSERT_EQUAL_MEMORY("A ok", vp->ptr, 4);
+
+	TEST_ASSERT_NULL(sign_lookup(make_request("certificate B"), md));
+}
+
+
+void
+test_SignCacheHitNeedsSameEra(void)
+{
+	struct value	v;
+	u_char		md[CACHE_MDLEN];
+
+	hostval.tstamp = htonl(3000000000U);
+	TEST_ASSERT_NULL(sign_lookup(make_request("certificate A"), md));
+	memset(&v, 0, sizeof(v));
+	v.vallen = htonl(4);
+	v.ptr = emalloc(4);
+	memcpy(v.ptr, "A ok", 4);
+	sign_remember(md, &v);
+
+	/* crypto_update() has signed anew since */
+	hostval.tstamp = htonl(3000000100U);
+	TEST_ASSERT_NULL(sign_lookup(make_request("certificate A"), md));
+}
+
+
+void
+test_CertCacheHitNeedsSameCertificate(void)
+{
+	static char		der[] = "not really a certificate";
+	struct cert_info	ci;
+	struct exten *		ep;
+
+	memset(&ci, 0, sizeof(ci));
+	ci.flags = CERT_VALID;
+	ci.cert.fstamp = htonl(3000000000U);
+	ci.cert.vallen = htonl(strlen(der));
+	ci.cert.ptr = (u_char *)der;
+	cinfo = &ci;
+
+	ep = make_request(der);
+	TEST_ASSERT_EQUAL_PTR(&ci, cert_install(ep, &t_peer));
+
+	/* one byte off is parsed, and is no certificate */
+	((u_char *)ep->pkt)[0] ^= 0x01;
+	TEST_ASSERT_NULL(cert_install(ep, &t_peer));
+	TEST_ASSERT_EQUAL_PTR(&ci, cinfo);
+	cinfo = NULL;
+}
+
+#else	/* !AUTOKEY follows */
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void
+test_VerifyCacheHitNeedsSameKey(void)
+{
+	TEST_IGNORE_MESSAGE("needs AUTOKEY");
+}
+
+void
+test_VerifyCacheHitNeedsSameSignature(void)
+{
+	TEST_IGNORE_MESSAGE("needs AUTOKEY");
+}
+
+void
+test_SignCacheHitNeedsSameRequest(void)
+{
+	TEST_IGNORE_MESSAGE("needs AUTOKEY");
+}
+
+void
+test_SignCacheHitNeedsSameEra(void)
+{
+	TEST_IGNORE_MESSAGE("needs AUTOKEY");
+}
+
+void
+test_CertCacheHitNeedsSameCertificate(void)
+{
+	TEST_IGNORE_MESSAGE("needs AUTOKEY");
+}
+
+#endif	/* AUTOKEY */
@@ -0,0 +1,187 @@
+#include "config.h"
+
+#include "ntp_stdlib.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+#include "test-libntp.h"
+
+/* catch the replies of fast_xmit() instead of sending them */
+#define sendpkt_queued	t_sendpkt_queued
+#include "ntp_proto.c"
+
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_BasicReplyToFirstRequest(void);
+extern void test_InterleavedRepliesFollowEachOther(void);
+extern void test_BasicRequestAfterInterleaved(void);
+
+static struct pkt	reply;		/* last reply queued */
+static int		replies;	/* replies queued */
+static u_int32		sent_sec;	/* precise TX time of the next one */
+
+/* from ntpd.c */
+int			listen_to_virtual_ips = TRUE;
+
+static endpt		ep;
+static mon_entry	mon;
+static sockaddr_u	client;
+
+void
+t_sendpkt_queued(
+	sockaddr_u *		dest,
+	struct interface *	ifp,
+	struct pkt *		pkt,
+	int			len,
+	l_fp *			sent
+	)
+{
+	TEST_ASSERT_EQUAL(LEN_PKT_NOMAC, len);
+	TEST_ASSERT_TRUE(SOCK_EQ(dest, &client));
+	UNUSED_ARG(ifp);
+	reply = *pkt;
+	replies++;
+	if (sent != NULL) {
+		sent->l_ui = sent_sec;
+		sent->l_uf = 0x80000000;
+	}
+}
+
+
+void
+setUp(void)
+{
+	ZERO(ep);
+	ZERO(mon);
+	ZERO(reply);
+	ZERO_SOCK(&client);
+	AF(&client) = AF_INET;
+	SET_ADDR4(&client, 0xc0000201);		/* 192.0.2.1 */
+	SET_PORT(&client, NTP_PORT);
+	AF(&ep.sin) = AF_INET;
+	mon.rmtadr = client;
+	replies = 0;
+}
+
+void
+tearDown(void)
+{
+	mon_rx_entry = NULL;
+}
+
+
+/*
+ * exchange - have fast_xmit() answer a client request received at
+ *	      second 'rx' with the given timestamps, the reply sent
+ *	      precisely at second 'tx' and a half
+ */
+static void
+exchange(
+	u_int32	org,
+	u_int32	rec,
+	u_int32	xmt,
+	u_int32	rx,
+	u_int32	tx
+	)
+{
+	struct recvbuf	rb;
+	l_fp		ts;
+
+	ZERO(rb);
+	rb.dstadr = &ep;
+	rb.recv_srcadr = client;
+	rb.recv_length = LEN_PKT_NOMAC;
+	rb.recv_time.l_ui = rx;
+	rb.recv_pkt.li_vn_mode = PKT_LI_VN_MODE(LEAP_NOWARNING, NTP_VERSION,
+						MODE_CLIENT);
+	ts.l_uf = 0;
+	ts.l_ui = org;
+	HTONL_FP(&ts, &rb.recv_pkt.org);
+	ts.l_ui = rec;
+	HTONL_FP(&ts, &rb.recv_pkt.rec);
+	ts.l_ui = xmt;
+	HTONL_FP(&ts, &rb.recv_pkt.xmt);
+
+	mon_rx_entry = &mon;
+	sent_sec = tx;
+	fast_xmit(&rb, MODE_SERVER, 0, 0);
+}
+
+
+static u_int32
+seconds(
+	const l_fp *	wire
+	)
+{
+	l_fp	ts;
+
+	NTOHL_FP(wire, &ts);
+	return ts.l_ui;
+}
+
+
+void
+test_BasicReplyToFirstRequest(void)
+{
+	exchange(0, 0, 1000, 2000, 2001);
+
+	TEST_ASSERT_EQUAL(1, replies);
+	TEST_ASSERT_EQUAL(1000, seconds(&reply.org));
+	TEST_ASSERT_EQUAL(2000, seconds(&reply.rec));
+	TEST_ASSERT_TRUE(2001 != seconds(&reply.xmt));
+}
+
+
+/*
+ * A client in interleaved mode sends the receive timestamp of the
+ * last reply as its origin and its own receive time of that reply as
+ * its receive timestamp.  Every reply after the first must then carry
+ * that receive time as the origin, the receive time of the request
+ * and the precise transmit time of the previous reply.
+ */
+void
+test_InterleavedRepliesFollowEachOther(void)
+{
+	u_int32	srx;
+
+	exchange(0, 0, 1000, 2000, 2001);
+	srx = seconds(&reply.rec);
+
+	/* second reply */
+	exchange(srx, 1002, 1010, 2010, 2011);
+	TEST_ASSERT_EQUAL(2, replies);
+	TEST_ASSERT_EQUAL(1002, seconds(&reply.org));
+	TEST_ASSERT_EQUAL(2010, seconds(&reply.rec));
+	TEST_ASSERT_EQUAL(2001, seconds(&reply.xmt));
+	TEST_ASSERT_EQUAL_HEX32(0x80000000, ntohl(reply.xmt.l_uf));
+	srx = seconds(&reply.rec);
+
+	/* third reply */
+	exchange(srx, 1012, 1020, 2020, 2021);
+	TEST_ASSERT_EQUAL(3, replies);
+	TEST_ASSERT_EQUAL(1012, seconds(&reply.org));
+	TEST_ASSERT_EQUAL(2020, seconds(&reply.rec));
+	TEST_ASSERT_EQUAL(2011, seconds(&reply.xmt));
+}
+
+
+void
+test_BasicRequestAfterInterleaved(void)
+{
+	exchange(0, 0, 1000, 2000, 2001);
+	exchange(2000, 1002, 1010, 2010, 2011);
+	TEST_ASSERT_EQUAL(2001, seconds(&reply.xmt));
+
+	/* a basic client sends our transmit timestamp as origin */
+	exchange(seconds(&reply.xmt), 1012, 1020, 2020, 2021);
+	TEST_ASSERT_EQUAL(1020, seconds(&reply.org));
+	TEST_ASSERT_EQUAL(2020, seconds(&reply.rec));
+
+	/* and a zero origin is always a basic request */
+	mon.xleave_rec.l_ui = 0;
+	mon.xleave_rec.l_uf = 0;
+	exchange(0, 0, 1030, 2030, 2031);
+	TEST_ASSERT_EQUAL(1030, seconds(&reply.org));
+}
@@ -0,0 +1,288 @@
+#include "config.h"
+
+#include "ntp_stdlib.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+#include "test-libntp.h"
+
+#include "ntp_fp.h"
+
+/* the publisher's clock */
+static void	t_get_systime(l_fp *);
+#define get_systime	t_get_systime
+#include "ntp_shstate.c"
+
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_FetchCopiesPublishedState(void);
+extern void test_FetchSkipsStateBeingWritten(void);
+extern void test_FetchReadsOnlySeqWhenUnchanged(void);
+extern void test_StaleStateIsUnsynchronized(void);
+extern void test_RetractedStateIsUnsynchronized(void);
+extern void test_OtherVersionIsUnsynchronized(void);
+
+static u_int32		now_sec = 3000000100U;
+
+static void
+t_get_systime(
+	l_fp *	now
+	)
+{
+	now->l_ui = now_sec;
+	now->l_uf = 0;
+}
+
+#ifdef HAVE_SYS_SHM_H
+
+static volatile struct shmState *seg;	/* private, not the unit's */
+
+
+/*
+ * publish - as the publisher with the given system variables, return
+ *	     the beat of the update
+ */
+static u_int32
+publish(
+	u_char	stratum,
+	u_int32	refid
+	)
+{
+	shstate_mode = SHSTATE_PUBLISH;
+	sys_leap = LEAP_NOWARNING;
+	xmt_leap = LEAP_NOWARNING;
+	sys_stratum = stratum;
+	sys_precision = -20;
+	sys_refid = htonl(refid);
+	sys_reftime.l_ui = 3000000000U;
+	sys_reftime.l_uf = 0x40000000;
+	sys_rootdelay = 0.25;
+	sys_rootdisp = 0.125;
+	shstate_publish();
+	TEST_ASSERT_EQUAL(0, seg->seq & 1);
+
+	return seg->beat;
+}
+
+
+/*
+ * serve - turn into a serving process that has not seen the state
+ */
+static void
+serve(void)
+{
+	shstate_mode = SHSTATE_SERVE;
+	shst_live = FALSE;
+	set_sys_leap(LEAP_NOTINSYNC);
+	sys_stratum = STRATUM_UNSPEC;
+	sys_precision = 0;
+	sys_refid = 0;
+	L_CLR(&sys_reftime);
+	sys_rootdelay = 0;
+	sys_rootdisp = 0;
+}
+
+
+void
+setUp(void)
+{
+	int	shmid;
+
+	shmid = shmget(IPC_PRIVATE, sizeof(struct shmState),
+		       IPC_CREAT | 0600);
+	TEST_ASSERT_TRUE(-1 != shmid);
+	seg = shmat(shmid, NULL, 0);
+	TEST_ASSERT_TRUE((void *)-1 != seg);
+	shmctl(shmid, IPC_RMID, NULL);	/* goes with the last detach */
+
+	shst = seg;
+	shst_pid = (int)getpid();
+	shst_seq = 0;
+	shst_beat = 0;
+	shst_live = FALSE;
+	seg->magic = SHSTATE_MAGIC;
+	seg->version = SHSTATE_VERSION;
+}
+
+void
+tearDown(void)
+{
+	shstate_mode = SHSTATE_OFF;
+	shst = NULL;
+	shmdt((void *)(uintptr_t)seg);
+}
+
+
+void
+test_FetchCopiesPublishedState(void)
+{
+	u_int32	beat;
+
+	beat = publish(3, 0xc0000201);
+	serve();
+	shstate_fetch(beat);
+
+	TEST_ASSERT_TRUE(shst_live);
+	TEST_ASSERT_EQUAL(LEAP_NOWARNING, sys_leap);
+	TEST_ASSERT_EQUAL(LEAP_NOWARNING, xmt_leap);
+	TEST_ASSERT_EQUAL(3, sys_stratum);
+	TEST_ASSERT_EQUAL(-20, sys_precision);
+	TEST_ASSERT_EQUAL_HEX32(0xc0000201, ntohl(sys_refid));
+	TEST_ASSERT_EQUAL_HEX32(3000000000U, sys_reftime.l_ui);
+	TEST_ASSERT_EQUAL_HEX32(0x40000000, sys_reftime.l_uf);
+	TEST_ASSERT_TRUE(0.25 == sys_rootdelay);
+	TEST_ASSERT_TRUE(0.125 == sys_rootdisp);
+}
+
+
+/*
+ * While the publisher writes, seq is odd, and a copy taken then must
+ * not be used.  The serving process keeps what it had and takes the
+ * new state once seq is even again.
+ */
+void
+test_FetchSkipsStateBeingWritten(void)
+{
+	u_int32	beat;
+
+	beat = publish(3, 0xc0000201);
+	serve();
+	shstate_fetch(beat);
+	TEST_ASSERT_EQUAL(3, sys_stratum);
+
+	seg->seq++;
+	seg->stratum = 4;
+	seg->refid = htonl(0xc0000202);
+	shstate_fetch(beat);
+	TEST_ASSERT_EQUAL(3, sys_stratum);
+	TEST_ASSERT_EQUAL_HEX32(0xc0000201, ntohl(sys_refid));
+
+	seg->seq++;
+	shstate_fetch(beat);
+	TEST_ASSERT_EQUAL(4, sys_stratum);
+	TEST_ASSERT_EQUAL_HEX32(0xc0000202, ntohl(sys_refid));
+}
+
+
+void
+test_FetchReadsOnlySeqWhenUnchanged(void)
+{
+	u_int32	beat;
+
+	beat = publish(3, 0xc0000201);
+	serve();
+	shstate_fetch(beat);
+
+	/* an unchanged seq within SHSTATE_MAXAGE copies nothing */
+	seg->stratum = 5;
+	shstate_fetch(beat + SHSTATE_MAXAGE);
+	TEST_ASSERT_EQUAL(3, sys_stratum);
+	TEST_ASSERT_TRUE(shst_live);
+}
+
+
+void
+test_StaleStateIsUnsynchronized(void)
+{
+	u_int32	beat;
+
+	beat = publish(3, 0xc0000201);
+	serve();
+	shstate_fetch(beat + SHSTATE_MAXAGE);
+	TEST_ASSERT_TRUE(shst_live);
+	TEST_ASSERT_EQUAL(3, sys_stratum);
+
+	shstate_fetch(beat + SHSTATE_MAXAGE + 1);
+	TEST_ASSERT_FALSE(shst_live);
+	TEST_ASSERT_EQUAL(LEAP_NOTINSYNC, sys_leap);
+	TEST_ASSERT_EQUAL(STRATUM_UNSPEC, sys_stratum);
+	TEST_ASSERT_EQUAL_MEMORY("INIT", &sys_refid, 4);
+
+	/* and serves again once the publisher updates */
+	seg->seq++;
+	seg->beat = beat + SHSTATE_MAXAGE + 1;
+	seg->seq++;
+	shstate_fetch(beat + SHSTATE_MAXAGE + 1);
+	TEST_ASSERT_TRUE(shst_live);
+	TEST_ASSERT_EQUAL(3, sys_stratum);
+}
+
+
+void
+test_RetractedStateIsUnsynchronized(void)
+{
+	u_int32	beat;
+
+	beat = publish(3, 0xc0000201);
+	serve();
+	shstate_fetch(beat);
+	TEST_ASSERT_TRUE(shst_live);
+
+	shstate_retract();
+	TEST_ASSERT_EQUAL(0, seg->seq & 1);
+	shstate_fetch(beat);
+	TEST_ASSERT_FALSE(shst_live);
+	TEST_ASSERT_EQUAL(LEAP_NOTINSYNC, sys_leap);
+	TEST_ASSERT_EQUAL(STRATUM_UNSPEC, sys_stratum);
+}
+
+
+void
+test_OtherVersionIsUnsynchronized(void)
+{
+	u_int32	beat;
+
+	beat = publish(3, 0xc0000201);
+	seg->seq++;
+	seg->version = SHSTATE_VERSION + 1;
+	seg->seq++;
+	serve();
+	shstate_fetch(beat);
+	TEST_ASSERT_FALSE(shst_live);
+	TEST_ASSERT_EQUAL(STRATUM_UNSPEC, sys_stratum);
+}
+
+#else	/* !HAVE_SYS_SHM_H follows */
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void
+test_FetchCopiesPublishedState(void)
+{
+	TEST_IGNORE_MESSAGE("needs System V shared memory");
+}
+
+void
+test_FetchSkipsStateBeingWritten(void)
+{
+	TEST_IGNORE_MESSAGE("needs System V shared memory");
+}
+
+void
+test_FetchReadsOnlySeqWhenUnchanged(void)
+{
+	TEST_IGNORE_MESSAGE("needs System V shared memory");
+}
+
+void
+test_StaleStateIsUnsynchronized(void)
+{
+	TEST_IGNORE_MESSAGE("needs System V shared memory");
+}
+
+void
+test_RetractedStateIsUnsynchronized(void)
+{
+	TEST_IGNORE_MESSAGE("needs System V shared memory");
+}
+
+void
+test_OtherVersionIsUnsynchronized(void)
+{
+	TEST_IGNORE_MESSAGE("needs System V shared memory");
+}
+
+#endif	/* !HAVE_SYS_SHM_H */
@@ -8,178 +8,322 @@
 
 #include "test-libntp.h"
 
+#include <signal.h>
 
-#define HAVE_NTP_SIGND
+#ifndef HAVE_NTP_SIGND
+# define HAVE_NTP_SIGND
+#endif
 
 #include "ntp_signd.c"
 
+#include "signd_stub.h"
+
 extern int ux_socket_connect(const char *name);
 
 
-//MOCKED FUNCTIONS
+static char		dir[64];
+static pid_t		stub = -1;
+static endpt		ep;
+static sockaddr_u	client;
+static int		client_fd = -1;
+static keyid_t		last_keyid;	/* key ID of the last reply */
 
-//this connect function overrides/mocks connect() from  <sys/socket.h>
-int
-connect(int socket, const struct sockaddr *address, socklen_t address_len)
+extern void setUp(void);
+extern void tearDown(void);
+
+void
+setUp(void)
 {
-	return 1;
+	strlcpy(dir, "/tmp/t-ntp_signd.XXXXXX", sizeof(dir));
+	TEST_ASSERT_NOT_NULL(mkdtemp(dir));
+	ntp_signd_socket = dir;
+	/* as ntpd does, so a dead connection is not fatal */
+	signal(SIGPIPE, SIG_IGN);
+	current_time = 1;
+	signd_retry = 0;
+	stub = signd_stub_start(dir, 0);
+	TEST_ASSERT_TRUE(stub > 0);
+	client_fd = signd_stub_endpoints(&ep, &client);
+	TEST_ASSERT_TRUE(client_fd >= 0);
 }
 
-/*
-** Mocked read() and write() calls.
-**
-** These will only operate 4 bytes at a time.
-**
-** This is so write_all can be properly tested.
-*/
+void
+tearDown(void)
+{
+	char	path[sizeof(dir) + 8];
+	int	i;
+
+	for (i = 0; i < SIGND_CONNS; i++)
+		signd_close(&signd_conn[i], "test done");
+	signd_stub_stop(stub);
+	stub = -1;
+	if (client_fd >= 0)
+		close(client_fd);
+	client_fd = -1;
+	if (ep.fd >= 0)
+		close(ep.fd);
+	snprintf(path, sizeof(path), "%s/socket", dir);
+	unlink(path);
+	rmdir(dir);
+}
 
-static char rw_buf[4];
 
-ssize_t
-write(int fd, void const * buf, size_t len)
+/*
+ * Have a packet signed for the test client.  The org time stamp tells
+ * the replies apart.
+ */
+static void
+sign(
+	u_int32	tag,
+	keyid_t	keyid
+	)
 {
-	REQUIRE(0 <= len);
-	if (len >= 4) len = 4;	/* 4 bytes, max */
-	(void)memcpy(rw_buf, buf, len);
-
-	return len;
+	struct recvbuf	rb;
+	struct pkt	xpkt;
+
+	ZERO(rb);
+	rb.recv_srcadr = client;
+	rb.dstadr = &ep;
+	ZERO(xpkt);
+	xpkt.li_vn_mode = PKT_LI_VN_MODE(LEAP_NOWARNING, NTP_VERSION,
+					 MODE_SERVER);
+	xpkt.org.l_ui = htonl(tag);
+	send_via_ntp_signd(&rb, MODE_SERVER, keyid, 0, &xpkt);
 }
 
-ssize_t
-read(int fd, void * buf, size_t len)
+/*
+ * Run the I/O loop until 'want' replies have come in or nothing
+ * happens for a second, and mark the tags seen.  Returns the number
+ * of replies.
+ */
+static int
+collect(
+	int	want,
+	u_char	seen[],
+	u_int	nseen
+	)
 {
-	REQUIRE(0 <= len);
-	if (len >= 4) len = 4;
-	(void)memcpy(buf, rw_buf, len);
-	return len;
+	struct pkt	rpkt;
+	u_char		digest[SIGND_STUB_MACLEN - sizeof(keyid_t)];
+	ssize_t		n;
+	u_int32		tag;
+	int		got, idle;
+
+	memset(digest, SIGND_STUB_DIGEST, sizeof(digest));
+	got = 0;
+	for (idle = 0; got < want && idle < 100; ) {
+		if (0 == signd_stub_pump(10))
+			idle++;
+		while ((n = recv(client_fd, &rpkt, sizeof(rpkt), 0)) > 0) {
+			idle = 0;
+			TEST_ASSERT_EQUAL(LEN_PKT_NOMAC + SIGND_STUB_MACLEN, n);
+			TEST_ASSERT_EQUAL_MEMORY(digest, (u_char *)&rpkt
+				+ LEN_PKT_NOMAC + sizeof(keyid_t),
+				sizeof(digest));
+			memcpy(&last_keyid, (u_char *)&rpkt + LEN_PKT_NOMAC,
+			       sizeof(last_keyid));
+			tag = ntohl(rpkt.org.l_ui);
+			TEST_ASSERT_TRUE(tag < nseen);
+			TEST_ASSERT_FALSE(seen[tag]);
+			seen[tag] = 1;
+			got++;
+		}
+	}
+
+	return got;
 }
 
-
-//END OF MOCKED FUNCTIONS
-
 static int
-isGE(int a,int b)
-{ 
-	if (a >= b) {return 1;}
-	else {return 0;}
+connections(void)
+{
+	int	i, n;
+
+	for (i = n = 0; i < SIGND_CONNS; i++)
+		if (signd_conn[i].reader != NULL)
+			n++;
+	return n;
 }
 
+
 extern void test_connect_incorrect_socket(void);
 extern void test_connect_correct_socket(void);
-extern void test_write_all(void);
-extern void test_send_packet(void);
-extern void test_recv_packet(void);
-extern void test_send_via_ntp_signd(void);
+extern void test_sign_one(void);
+extern void test_sign_pipelined(void);
+extern void test_sign_refused(void);
+extern void test_sign_wrong_id(void);
+extern void test_pool_full(void);
+extern void test_reconnect(void);
+extern void test_stalled(void);
+extern void test_clearinterface(void);
 
 
-void 
+void
 test_connect_incorrect_socket(void)
 {
 	TEST_ASSERT_EQUAL(-1, ux_socket_connect(NULL));
-
-	return;
+	TEST_ASSERT_EQUAL(-1, ux_socket_connect("/nonexistent/socket"));
 }
 
-void 
+void
 test_connect_correct_socket(void)
 {
-	int temp = ux_socket_connect("/socket");
+	char	path[sizeof(dir) + 8];
+	int	fd;
 
-	//risky, what if something is listening on :123, or localhost isnt 127.0.0.1?
-	//TEST_ASSERT_EQUAL(-1, ux_socket_connect("127.0.0.1:123")); 
-
-	//printf("%d\n",temp);
-	TEST_ASSERT_TRUE(isGE(temp,0));
-
-	//write_all();
-	//char *socketName = "Random_Socket_Name";
-	//int length = strlen(socketName);
-
-	return;
+	snprintf(path, sizeof(path), "%s/socket", dir);
+	fd = ux_socket_connect(path);
+	TEST_ASSERT_TRUE(fd >= 0);
+	close(fd);
 }
 
-
 void
-test_write_all(void)
+test_sign_one(void)
 {
-	int fd = ux_socket_connect("/socket");
-
-	TEST_ASSERT_TRUE(isGE(fd, 0));
-
-	char * str = "TEST123";
-	int temp = write_all(fd, str,strlen(str));
-	TEST_ASSERT_EQUAL(strlen(str), temp);
+	u_char	seen[1] = { 0 };
 
-	(void)close(fd);
-	return;
+	sign(0, 12345);
+	TEST_ASSERT_EQUAL(1, collect(1, seen, sizeof(seen)));
+	TEST_ASSERT_EQUAL(1, connections());
+	/* the key ID goes back as it came in */
+	TEST_ASSERT_EQUAL(12345, ntohl(last_keyid));
 }
 
-
 void
-test_send_packet(void)
+test_sign_pipelined(void)
 {
-	int fd = ux_socket_connect("/socket");
-
-	TEST_ASSERT_TRUE(isGE(fd, 0));
-
-	char * str2 = "PACKET12345";
-	int temp = send_packet(fd, str2, strlen(str2));
-
-	TEST_ASSERT_EQUAL(0,temp);
-
-	(void)close(fd);
-	return;
+	u_char	seen[3 * SIGND_DEPTH];
+	u_int	i;
+
+	/* nothing is read back while the requests go out */
+	memset(seen, 0, sizeof(seen));
+	for (i = 0; i < sizeof(seen); i++)
+		sign(i, i);
+	TEST_ASSERT_EQUAL(SIGND_CONNS, connections());
+	TEST_ASSERT_EQUAL(sizeof(seen), collect(sizeof(seen), seen,
+						sizeof(seen)));
+	for (i = 0; i < SIGND_CONNS; i++)
+		TEST_ASSERT_EQUAL(0, signd_conn[i].count);
 }
 
-
-/*
-** HMS: What's going on here?
-** Looks like this needs more work.
-*/
 void
-test_recv_packet(void)
+test_sign_refused(void)
 {
-#if 0
-	int fd = ux_socket_connect("/socket");
-
-	TEST_ASSERT_TRUE(isGE(fd, 0));
-
-	uint32_t size = 256;	
-	char *str = NULL;
-	int temp = recv_packet(fd, &str, &size);
+	u_char	seen[3];
+
+	memset(seen, 0, sizeof(seen));
+	sign(0, 1);
+	sign(1, SIGND_STUB_BADKEY);
+	sign(2, 2);
+	TEST_ASSERT_EQUAL(2, collect(3, seen, sizeof(seen)));
+	TEST_ASSERT_TRUE(seen[0]);
+	TEST_ASSERT_FALSE(seen[1]);
+	TEST_ASSERT_TRUE(seen[2]);
+	TEST_ASSERT_EQUAL(0, signd_conn[0].count);
+}
 
-	send_packet(fd, str, strlen(str));
-	free(str);
-	TEST_ASSERT_EQUAL(0,temp); //0 because nobody sent us anything (yet!)
+void
+test_sign_wrong_id(void)
+{
+	u_char	seen[SIGND_CONNS + 1];
+	u_int	i;
 
-	(void)close(fd);
-#else
-	TEST_IGNORE_MESSAGE("test_recv_packet() needs work");
-#endif
-	return;
+	/*
+	 * With the stub stopped, 0 and the last request share the
+	 * first connection.  The answer to 0 has the wrong ID and is
+	 * discarded; the answer to the last one writes 0 off.
+	 */
+	kill(stub, SIGSTOP);
+	memset(seen, 0, sizeof(seen));
+	sign(0, SIGND_STUB_BADID);
+	for (i = 1; i < sizeof(seen); i++)
+		sign(i, i);
+	TEST_ASSERT_EQUAL(2, signd_conn[0].count);
+	kill(stub, SIGCONT);
+	TEST_ASSERT_EQUAL(SIGND_CONNS, collect(SIGND_CONNS, seen,
+					       sizeof(seen)));
+	TEST_ASSERT_FALSE(seen[0]);
+	TEST_ASSERT_TRUE(seen[SIGND_CONNS]);
+	for (i = 0; i < SIGND_CONNS; i++)
+		TEST_ASSERT_EQUAL(0, signd_conn[i].count);
+	TEST_ASSERT_EQUAL(SIGND_CONNS, connections());
 }
 
-void 
-test_send_via_ntp_signd(void)
+void
+test_pool_full(void)
 {
-	struct recvbuf *rbufp = (struct recvbuf *) malloc(sizeof(struct recvbuf));
-	int	xmode = 1;
-	keyid_t	xkeyid = 12345; 
-	int	flags = 0;
-	struct pkt  *xpkt = (struct pkt *) malloc(sizeof(struct pkt)); //defined in ntp.h
-
-	TEST_ASSERT_NOT_NULL(rbufp);
-	TEST_ASSERT_NOT_NULL(xpkt);
-	memset(xpkt, 0, sizeof(struct pkt));
+	u_char	seen[SIGND_CONNS * SIGND_DEPTH + 1];
+	u_int	i;
+
+	/* the stub is stopped, so no request is answered */
+	kill(stub, SIGSTOP);
+	memset(seen, 0, sizeof(seen));
+	for (i = 0; i < sizeof(seen); i++)
+		sign(i, i);
+	kill(stub, SIGCONT);
+	TEST_ASSERT_EQUAL(sizeof(seen) - 1, collect(sizeof(seen), seen,
+						    sizeof(seen)));
+	TEST_ASSERT_FALSE(seen[sizeof(seen) - 1]);
+}
 
-	//send_via_ntp_signd(NULL,NULL,NULL,NULL,NULL);	//doesn't work
-	/*
-	** Send the xpkt to Samba, read the response back in rbufp
-	*/
-	send_via_ntp_signd(rbufp,xmode,xkeyid,flags,xpkt);
+void
+test_reconnect(void)
+{
+	u_char	seen[2];
+
+	memset(seen, 0, sizeof(seen));
+	sign(0, 1);
+	TEST_ASSERT_EQUAL(1, collect(1, seen, sizeof(seen)));
+
+	/* Samba goes away */
+	signd_stub_stop(stub);
+	while (connections() > 0)
+		signd_stub_pump(10);
+	sign(1, 1);
+	TEST_ASSERT_EQUAL(0, connections());
+
+	/* and is back, but is not tried again in the same second */
+	stub = signd_stub_start(dir, 0);
+	TEST_ASSERT_TRUE(stub > 0);
+	sign(1, 1);
+	TEST_ASSERT_EQUAL(0, connections());
+	current_time++;
+	sign(1, 1);
+	TEST_ASSERT_EQUAL(1, collect(1, seen, sizeof(seen)));
+}
 
-	free(rbufp);
-	free(xpkt);
+void
+test_stalled(void)
+{
+	u_char	seen[2];
+
+	memset(seen, 0, sizeof(seen));
+	kill(stub, SIGSTOP);
+	sign(0, 1);
+	TEST_ASSERT_EQUAL(1, signd_conn[0].count);
+
+	/* a stuck connection is dropped, the next request gets a new one */
+	current_time += SIGND_TIMEOUT + 1;
+	sign(1, 1);
+	TEST_ASSERT_EQUAL(1, connections());
+	kill(stub, SIGCONT);
+	TEST_ASSERT_EQUAL(1, collect(2, seen, sizeof(seen)));
+	TEST_ASSERT_FALSE(seen[0]);
+	TEST_ASSERT_TRUE(seen[1]);
+}
 
-	return;
+void
+test_clearinterface(void)
+{
+	u_char	seen[2];
+	int	i;
+
+	memset(seen, 0, sizeof(seen));
+	sign(0, 1);
+	sign(1, 1);
+	signd_clearinterface(&ep);
+	TEST_ASSERT_EQUAL(0, collect(2, seen, sizeof(seen)));
+	/* the replies were read and dropped, the connections stay */
+	TEST_ASSERT_EQUAL(2, connections());
+	for (i = 0; i < SIGND_CONNS; i++)
+		TEST_ASSERT_EQUAL(0, signd_conn[i].count);
 }
@@ -0,0 +1,265 @@
+#include "config.h"
+
+#include "ntp_stdlib.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+#include "test-libntp.h"
+
+/* the transfer vector of the driver in libntpd has the same name */
+#define refclock_chu	t_refclock_chu
+#include "refclock_chu.c"
+
+extern void test_DecompandMatchesSampleBySample(void);
+extern void test_BlockFilterMatchesSampleBySample(void);
+
+#if defined(REFCLOCK) && defined(CLOCK_CHU) && defined(HAVE_AUDIO)
+
+#define	SECONDS		10	/* of FSK signal through the filters */
+
+static u_int32	seed;
+
+static double
+noise(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return ((seed >> 8) & 0xffff) / 32768. - 1.;
+}
+
+
+/*
+ * comp_table - the decompanding table as chu_start() makes it
+ */
+static void
+comp_table(
+	double *comp
+	)
+{
+	double	step;
+	int	i;
+
+	comp[0] = comp[OFFSET] = 0.;
+	comp[1] = 1; comp[OFFSET + 1] = -1.;
+	comp[2] = 3; comp[OFFSET + 2] = -3.;
+	step = 2.;
+	for (i = 3; i < OFFSET; i++) {
+		comp[i] = comp[i - 1] + step;
+		comp[OFFSET + i] = -comp[i];
+		if (i % 16 == 0)
+			step *= 2.;
+	}
+}
+
+
+/*
+ * old_rf - the filters of chu_rf() as they were, one sample at a time
+ */
+static double
+old_rf(
+	struct chuunit *up,
+	double	sample
+	)
+{
+	double	signal;
+	double	limit;
+	double	disc;
+	double	lpf;
+
+	signal = (up->bpf[8] = up->bpf[7]) * 5.844676e-01;
+	signal += (up->bpf[7] = up->bpf[6]) * 4.884860e-01;
+	signal += (up->bpf[6] = up->bpf[5]) * 2.704384e+00;
+	signal += (up->bpf[5] = up->bpf[4]) * 1.645032e+00;
+	signal += (up->bpf[4] = up->bpf[3]) * 4.644557e+00;
+	signal += (up->bpf[3] = up->bpf[2]) * 1.879165e+00;
+	signal += (up->bpf[2] = up->bpf[1]) * 3.522634e+00;
+	signal += (up->bpf[1] = up->bpf[0]) * 7.315738e-01;
+	up->bpf[0] = sample - signal;
+	signal = up->bpf[0] * 6.176213e-03
+	    + up->bpf[1] * 3.156599e-03
+	    + up->bpf[2] * 7.567487e-03
+	    + up->bpf[3] * 4.344580e-03
+	    + up->bpf[4] * 1.190128e-02
+	    + up->bpf[5] * 4.344580e-03
+	    + up->bpf[6] * 7.567487e-03
+	    + up->bpf[7] * 3.156599e-03
+	    + up->bpf[8] * 6.176213e-03;
+
+	up->monitor = signal / 4.;
+
+	limit = signal;
+	if (limit > LIMIT)
+		limit = LIMIT;
+	else if (limit < -LIMIT)
+		limit = -LIMIT;
+	disc = up->disc[up->discptr] * -limit;
+	up->disc[up->discptr] = limit;
+	up->discptr = (up->discptr + 1 ) % LAG;
+	if (disc >= 0)
+		disc = SQRT(disc);
+	else
+		disc = -SQRT(-disc);
+
+	lpf = (up->lpf[26] = up->lpf[25]) * 2.538771e-02;
+	lpf += (up->lpf[25] = up->lpf[24]) * 1.084671e-01;
+	lpf += (up->lpf[24] = up->lpf[23]) * 2.003159e-01;
+	lpf += (up->lpf[23] = up->lpf[22]) * 2.985303e-01;
+	lpf += (up->lpf[22] = up->lpf[21]) * 4.003697e-01;
+	lpf += (up->lpf[21] = up->lpf[20]) * 5.028552e-01;
+	lpf += (up->lpf[20] = up->lpf[19]) * 6.028795e-01;
+	lpf += (up->lpf[19] = up->lpf[18]) * 6.973249e-01;
+	lpf += (up->lpf[18] = up->lpf[17]) * 7.831828e-01;
+	lpf += (up->lpf[17] = up->lpf[16]) * 8.576717e-01;
+	lpf += (up->lpf[16] = up->lpf[15]) * 9.183463e-01;
+	lpf += (up->lpf[15] = up->lpf[14]) * 9.631951e-01;
+	lpf += (up->lpf[14] = up->lpf[13]) * 9.907208e-01;
+	lpf += (up->lpf[13] = up->lpf[12]) * 1.000000e+00;
+	lpf += (up->lpf[12] = up->lpf[11]) * 9.907208e-01;
+	lpf += (up->lpf[11] = up->lpf[10]) * 9.631951e-01;
+	lpf += (up->lpf[10] = up->lpf[9]) * 9.183463e-01;
+	lpf += (up->lpf[9] = up->lpf[8]) * 8.576717e-01;
+	lpf += (up->lpf[8] = up->lpf[7]) * 7.831828e-01;
+	lpf += (up->lpf[7] = up->lpf[6]) * 6.973249e-01;
+	lpf += (up->lpf[6] = up->lpf[5]) * 6.028795e-01;
+	lpf += (up->lpf[5] = up->lpf[4]) * 5.028552e-01;
+	lpf += (up->lpf[4] = up->lpf[3]) * 4.003697e-01;
+	lpf += (up->lpf[3] = up->lpf[2]) * 2.985303e-01;
+	lpf += (up->lpf[2] = up->lpf[1]) * 2.003159e-01;
+	lpf += (up->lpf[1] = up->lpf[0]) * 1.084671e-01;
+	lpf += up->lpf[0] = disc * 2.538771e-02;
+
+	return lpf;
+}
+
+
+void
+test_DecompandMatchesSampleBySample(void)
+{
+	double	comp[SIZE];
+	double	block[SIZE];
+	double	sample;
+	u_char	codec[SIZE];
+	int	clipcnt;
+	int	i;
+
+	comp_table(comp);
+	for (i = 0; i < SIZE; i++)
+		codec[i] = (u_char)i;
+
+	TEST_ASSERT_EQUAL(0, audio_decompand(codec, SIZE, comp, 0,
+					     block));
+	for (i = 0; i < SIZE; i++)
+		TEST_ASSERT_TRUE(comp[~codec[i] & 0xff] == block[i]);
+
+	clipcnt = 0;
+	for (i = 0; i < SIZE; i++) {
+		sample = comp[~codec[i] & 0xff];
+		if (sample > MAXAMP) {
+			sample = MAXAMP;
+			clipcnt++;
+		} else if (sample < -MAXAMP) {
+			sample = -MAXAMP;
+			clipcnt++;
+		}
+		codec[i] = (u_char)i;
+		block[i] = sample;
+	}
+	TEST_ASSERT_TRUE(clipcnt > 0);
+	{
+		double	clipped[SIZE];
+
+		TEST_ASSERT_EQUAL(clipcnt,
+				  audio_decompand(codec, SIZE, comp, MAXAMP,
+						  clipped));
+		for (i = 0; i < SIZE; i++)
+			TEST_ASSERT_TRUE(block[i] == clipped[i]);
+	}
+}
+
+
+/*
+ * Run noisy FSK at the two CHU tones through the old filters a sample
+ * at a time and through chu_rf() in blocks of random length, as they
+ * come from the codec.  The arithmetic is done in the same order, so
+ * the results are the same to the bit unless the compiler contracts
+ * multiply and add into FMA, which rounds once instead of twice.
+ */
+void
+test_BlockFilterMatchesSampleBySample(void)
+{
+	struct chuunit *oldup;
+	struct chuunit *newup;
+	double *	x;
+	double		lpf[AUDIO_BUFSIZ];
+	double		phase;
+	double		freq;
+	double		ref;
+	double		diff;
+	double		maxdiff;
+	long		same;
+	int		n, i, len, blk;
+
+	seed = 1;
+	len = SECONDS * SECOND;
+	x = emalloc(len * sizeof(*x));
+	phase = 0;
+	freq = 2025.;
+	for (n = 0; n < len; n++) {
+		if (n % (SECOND / BAUD) == 0)
+			freq = (noise() > 0) ? 2225. : 2025.;
+		phase += 2 * M_PI * freq / SECOND;
+		x[n] = 5000. * sin(phase) + 2000. * noise();
+		if (x[n] > MAXAMP)
+			x[n] = MAXAMP;
+		else if (x[n] < -MAXAMP)
+			x[n] = -MAXAMP;
+	}
+
+	oldup = emalloc_zero(sizeof(*oldup));
+	newup = emalloc_zero(sizeof(*newup));
+	maxdiff = 0;
+	same = 0;
+	for (n = 0; n < len; n += blk) {
+		blk = 1 + (int)((noise() + 1.) / 2. * AUDIO_BUFSIZ);
+		if (blk > AUDIO_BUFSIZ)
+			blk = AUDIO_BUFSIZ;
+		if (blk > len - n)
+			blk = len - n;
+		chu_rf(newup, &x[n], blk, lpf);
+		for (i = 0; i < blk; i++) {
+			ref = old_rf(oldup, x[n + i]);
+			diff = fabs(lpf[i] - ref);
+			if (diff > maxdiff)
+				maxdiff = diff;
+			same += (lpf[i] == ref);
+		}
+		diff = fabs(newup->monitor - oldup->monitor);
+		if (diff > maxdiff)
+			maxdiff = diff;
+	}
+	free(x);
+	free(oldup);
+	free(newup);
+
+	TEST_ASSERT_TRUE(maxdiff < 1e-9);
+#ifndef FP_FAST_FMA
+	TEST_ASSERT_EQUAL(len, same);
+#endif
+}
+
+#else
+
+void
+test_DecompandMatchesSampleBySample(void)
+{
+	TEST_IGNORE_MESSAGE("needs the CHU driver with audio");
+}
+
+void
+test_BlockFilterMatchesSampleBySample(void)
+{
+	TEST_IGNORE_MESSAGE("needs the CHU driver with audio");
+}
+
+#endif
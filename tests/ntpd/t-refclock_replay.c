@@ -0,0 +1,181 @@
+#include "config.h"
+
+#include "ntp_stdlib.h"
+#include "ntp_refclock.h"
+#include "ntp_unixtime.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+#include "test-libntp.h"
+#include "refclock_replay.h"
+
+#ifndef REPLAY_DATADIR
+# define REPLAY_DATADIR	"data"
+#endif
+#ifndef REPLAY_AUDIODIR
+# define REPLAY_AUDIODIR	"."
+#endif
+
+/* tg2 -y 250301100000, 2025-03-01 10:00:00 UTC */
+#define	TG2_START	1740823200
+
+
+static replay_data	rd;
+static replay_result	res;
+
+static int
+replay(
+	const char *	file,
+	const char *	clock,
+	u_int		mode,
+	u_int		flags
+	)
+{
+	struct peer *	peer;
+	char		path[256];
+
+	snprintf(path, sizeof(path), "%s/%s", REPLAY_DATADIR, file);
+	if (!replay_load(path, &rd))
+		return FALSE;
+	peer = replay_start(clock, mode, flags);
+	if (NULL == peer) {
+		replay_free(&rd);
+		return FALSE;
+	}
+	replay_run(peer, &rd, &res);
+	replay_stop(peer);
+	replay_free(&rd);
+	return TRUE;
+}
+
+#ifdef HAVE_AUDIO
+static int
+replay_tg2(
+	const char *	file,
+	const char *	clock
+	)
+{
+	struct peer *	peer;
+	char		path[256];
+	l_fp		start;
+
+	snprintf(path, sizeof(path), "%s/%s", REPLAY_AUDIODIR, file);
+	peer = replay_start_file(clock, path, 0, 0);
+	if (NULL == peer)
+		return FALSE;
+	start.l_ui = TG2_START + JAN_1970;
+	start.l_uf = 0;
+	replay_audio(peer, start, &res);
+	replay_stop(peer);
+	return TRUE;
+}
+#endif
+
+void
+test_Nmea(void)
+{
+#ifdef CLOCK_NMEA
+	/* trust the date, the recording is older than the build */
+	TEST_ASSERT_TRUE(replay("nmea.rec", "127.127.20.0", 0x02000000, 0));
+	TEST_ASSERT_EQUAL(88, res.chunks);
+	TEST_ASSERT_EQUAL(2, res.polls);
+	/* one sample per second */
+	TEST_ASSERT_EQUAL(40, res.samples);
+	TEST_ASSERT_DOUBLE_WITHIN(1e-6, -0.150, res.first);
+	TEST_ASSERT_DOUBLE_WITHIN(1e-6, -0.150, res.last);
+	TEST_ASSERT_EQUAL(0, strncmp(res.lastcode, "$GPZDA,100039.00,", 17));
+#else
+	TEST_IGNORE_MESSAGE("NMEA driver not configured");
+#endif
+}
+
+void
+test_JjyTristate(void)
+{
+#ifdef CLOCK_JJY
+	TEST_ASSERT_TRUE(replay("jjy-tristate.rec", "127.127.40.0", 1, 0));
+	TEST_ASSERT_EQUAL(6, res.polls);
+	TEST_ASSERT_EQUAL(6, res.samples);
+	/* "time", "date" and "stim" for every poll */
+	TEST_ASSERT_EQUAL(6 * 3 * 6, res.sent);
+	TEST_ASSERT_DOUBLE_WITHIN(1e-6, -0.030, res.first);
+	TEST_ASSERT_DOUBLE_WITHIN(1e-6, -0.030, res.last);
+#else
+	TEST_IGNORE_MESSAGE("JJY driver not configured");
+#endif
+}
+
+void
+test_Palisade(void)
+{
+#ifdef CLOCK_PALISADE
+	TEST_ASSERT_TRUE(replay("palisade.rec", "127.127.29.0", 0, CLK_FLAG2));
+	TEST_ASSERT_EQUAL(40, res.chunks);
+	TEST_ASSERT_EQUAL(5, res.polls);
+	/* the first poll meets a bad 8F-0B and is given up */
+	TEST_ASSERT_EQUAL(4, res.samples);
+	TEST_ASSERT_DOUBLE_WITHIN(1e-6, -0.020, res.first);
+	TEST_ASSERT_DOUBLE_WITHIN(1e-6, -0.020, res.last);
+	TEST_ASSERT_EQUAL_STRING("2025 060 10:00:39.000000000", res.lastcode);
+#else
+	TEST_IGNORE_MESSAGE("Palisade driver not configured");
+#endif
+}
+
+void
+test_ParseMeinberg(void)
+{
+#ifdef CLOCK_PARSE
+	TEST_ASSERT_TRUE(replay("meinberg.rec", "127.127.8.0", 0, 0));
+	TEST_ASSERT_EQUAL(40, res.chunks);
+	TEST_ASSERT_EQUAL(40, res.samples);
+	TEST_ASSERT_DOUBLE_WITHIN(1e-6, -0.018032, res.first);
+	TEST_ASSERT_DOUBLE_WITHIN(1e-6, -0.018032, res.last);
+#else
+	TEST_IGNORE_MESSAGE("parse drivers not configured");
+#endif
+}
+
+void
+test_IrigAudio(void)
+{
+#if defined(CLOCK_IRIG) && defined(HAVE_AUDIO)
+	TEST_ASSERT_TRUE(replay_tg2("irig.ulaw", "127.127.6.0"));
+	TEST_ASSERT_EQUAL(150 * 8, res.chunks);
+	TEST_ASSERT_EQUAL(150 * 8000, res.bytes);
+	TEST_ASSERT_EQUAL(2, res.polls);
+	/* the PLL settles for most of the first two minutes */
+	TEST_ASSERT_TRUE(res.samples >= 10);
+	TEST_ASSERT_DOUBLE_WITHIN(0.005, 0., res.first);
+	TEST_ASSERT_DOUBLE_WITHIN(0.005, 0., res.last);
+	TEST_ASSERT_EQUAL(0, strncmp(res.lastcode + 3, "00 060 10:02:28 ", 16));
+#else
+	TEST_IGNORE_MESSAGE("IRIG audio driver not configured");
+#endif
+}
+
+void
+test_WwvAudio(void)
+{
+#if defined(CLOCK_WWV) && defined(HAVE_AUDIO)
+	TEST_ASSERT_TRUE(replay_tg2("wwv.ulaw", "127.127.36.0"));
+	TEST_ASSERT_EQUAL(1200 * 8, res.chunks);
+	TEST_ASSERT_EQUAL(18, res.polls);
+	TEST_ASSERT_EQUAL(6, res.samples);
+	TEST_ASSERT_DOUBLE_WITHIN(0.005, 0., res.first);
+	TEST_ASSERT_DOUBLE_WITHIN(0.005, 0., res.last);
+	TEST_ASSERT_EQUAL(0, strncmp(res.lastcode,
+				     " 0 2025 060 10:19:00  S ", 24));
+#else
+	TEST_IGNORE_MESSAGE("WWV audio driver not configured");
+#endif
+}
+
+void
+test_BadRecording(void)
+{
+	TEST_ASSERT_FALSE(replay_load(REPLAY_DATADIR "/nonexistent.rec", &rd));
+	TEST_ASSERT_EQUAL(0, rd.count);
+}
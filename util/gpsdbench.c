@@ -0,0 +1,301 @@
+/*
+ * This program times the record parsing of the GPSD JSON refclock
+ * over a recorded GPSD stream, one JSON record per line.  It runs the
+ * JSMN tokeniser with linear member lookups the driver used before
+ * and the single pass scanner from ntpd/gpsd_json.c it uses now, and
+ * checks that both find the same values.  gpsd-sample.json is a short
+ * recording of a u-blox receiver with TPV, SKY, TOFF and PPS records;
+ * a live stream can be recorded with
+ *
+ *	gpspipe -w > stream.json
+ *
+ * usage: gpsdbench [-r rounds] [file]
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "ntp_types.h"
+
+#define JSMN_PARENT_LINKS
+#include "../libjsmn/jsmn.c"
+#include "../ntpd/gpsd_json.c"
+
+#define JSMN_MAXTOK	350
+#define MAXREC		10000
+#define MAXLINE		1600
+#define ROUNDS		2000
+
+char *progname;
+
+static char *	rec[MAXREC];
+static size_t	reclen[MAXREC];
+static int	nrec;
+static char	work[MAXLINE];
+static jsmntok_t tok[JSMN_MAXTOK];
+static int	ntok;
+static volatile size_t sink;	/* keeps the optimizer honest */
+
+/* the members each record class is searched for, as in the driver */
+static const enum json_key tpv_keys[] = { JK_MODE, JK_TIME, JK_EPT };
+static const enum json_key pps_keys[] = {
+	JK_CLOCK_SEC, JK_CLOCK_NSEC, JK_REAL_SEC, JK_REAL_NSEC, JK_PRECISION
+};
+static const enum json_key toff_keys[] = {
+	JK_CLOCK_SEC, JK_CLOCK_NSEC, JK_REAL_SEC, JK_REAL_NSEC
+};
+static const enum json_key version_keys[] = {
+	JK_REV, JK_RELEASE, JK_PROTO_MAJOR, JK_PROTO_MINOR
+};
+static const enum json_key watch_keys[] = { JK_DEVICE, JK_ENABLE, JK_JSON };
+
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr, "usage: %s [-r rounds] [file]\n", progname);
+	exit(1);
+}
+
+/* ------------------------------------------------------------------ */
+/* The old way: tokenise everything, then search the token list. */
+
+static int
+tok_skip(
+	int tid)
+{
+	int len;
+
+	if (tid < 0 || tid >= ntok)
+		return ntok;
+	len = tok[tid].size;
+	switch (tok[tid].type) {
+	case JSMN_OBJECT:
+		len *= 2;
+		/* FALLTHROUGH */
+	case JSMN_ARRAY:
+		for (++tid; len; --len)
+			tid = tok_skip(tid);
+		break;
+	default:
+		++tid;
+		break;
+	}
+	return tid;
+}
+
+static const char *
+tok_lookup(
+	const char *	buf,
+	const char *	key
+	)
+{
+	int tid, len;
+
+	len = tok[0].size;
+	for (tid = 1; len && tid + 1 < ntok; --len) {
+		if (tok[tid].type == JSMN_STRING &&
+		    !strcmp(key, buf + tok[tid].start))
+			return buf + tok[tid + 1].start;
+		tid = tok_skip(tok_skip(tid));
+	}
+	return NULL;
+}
+
+static int
+old_parse(
+	char *	buf,
+	size_t	len,
+	const char **val
+	)
+{
+	const enum json_key *keys;
+	jsmn_parser	jsm;
+	const char *	cls;
+	size_t		nkeys, i;
+	int		idx;
+
+	jsmn_init(&jsm);
+	ntok = jsmn_parse(&jsm, buf, len, tok, JSMN_MAXTOK);
+	if (ntok <= 0 || JSMN_OBJECT != tok[0].type)
+		return FALSE;
+	for (idx = 0; idx < ntok; ++idx)
+		if (tok[idx].end > tok[idx].start)
+			buf[tok[idx].end] = '\0';
+
+	for (i = 0; i < JK_COUNT; ++i)
+		val[i] = NULL;
+	val[JK_CLASS] = cls = tok_lookup(buf, "class");
+	if (NULL == cls)
+		return FALSE;
+	if (!strcmp(cls, "TPV")) {
+		keys = tpv_keys;
+		nkeys = COUNTOF(tpv_keys);
+	} else if (!strcmp(cls, "PPS")) {
+		keys = pps_keys;
+		nkeys = COUNTOF(pps_keys);
+	} else if (!strcmp(cls, "TOFF")) {
+		keys = toff_keys;
+		nkeys = COUNTOF(toff_keys);
+	} else if (!strcmp(cls, "VERSION")) {
+		keys = version_keys;
+		nkeys = COUNTOF(version_keys);
+	} else if (!strcmp(cls, "WATCH")) {
+		keys = watch_keys;
+		nkeys = COUNTOF(watch_keys);
+	} else {
+		return TRUE;
+	}
+	for (i = 0; i < nkeys; ++i)
+		val[keys[i]] = tok_lookup(buf, json_keys[keys[i]].name);
+	return TRUE;
+}
+
+/* ------------------------------------------------------------------ */
+/* The new way. */
+
+static int
+new_parse(
+	char *		buf,
+	json_ctx *	ctx
+	)
+{
+	if (!json_peek_class(buf)) {
+		memset(ctx->typ, JSON_ABSENT, sizeof(ctx->typ));
+		return TRUE;
+	}
+	return json_parse_record(ctx, buf);
+}
+
+/* ------------------------------------------------------------------ */
+
+static int
+compare(void)
+{
+	const char *	oval[JK_COUNT];
+	char		copy[MAXLINE];
+	json_ctx	ctx;
+	int		i, k, okok, nwok, bad;
+
+	bad = 0;
+	for (i = 0; i < nrec; ++i) {
+		memcpy(work, rec[i], reclen[i] + 1);
+		memcpy(copy, rec[i], reclen[i] + 1);
+		okok = old_parse(work, reclen[i], oval);
+		nwok = new_parse(copy, &ctx);
+		if (okok != nwok) {
+			printf("record %d: old %d new %d\n", i + 1, okok,
+			       nwok);
+			++bad;
+			continue;
+		}
+		if (!okok || JSON_ABSENT == ctx.typ[JK_CLASS])
+			continue;
+		for (k = 0; k < JK_COUNT; ++k) {
+			if (NULL == oval[k])
+				continue;
+			if (JSON_ABSENT == ctx.typ[k] ||
+			    strcmp(oval[k], ctx.val[k])) {
+				printf("record %d: %s differs\n", i + 1,
+				       json_keys[k].name);
+				++bad;
+			}
+		}
+	}
+	return bad;
+}
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	FILE *		fp;
+	char		line[MAXLINE];
+	const char *	oval[JK_COUNT];
+	json_ctx	ctx;
+	double		t0, ns_old, ns_new;
+	size_t		len;
+	long		rounds, n;
+	int		i, ch;
+
+	progname = argv[0];
+	rounds = ROUNDS;
+	while ((ch = getopt(argc, argv, "r:")) != -1) {
+		switch (ch) {
+
+		case 'r':
+			rounds = atol(optarg);
+			break;
+
+		default:
+			usage();
+		}
+	}
+	if (rounds < 1 || argc - optind > 1)
+		usage();
+	if (optind < argc) {
+		fp = fopen(argv[optind], "r");
+		if (NULL == fp) {
+			perror(argv[optind]);
+			return 1;
+		}
+	} else {
+		fp = stdin;
+	}
+
+	while (nrec < MAXREC && fgets(line, sizeof(line), fp) != NULL) {
+		len = strlen(line);
+		while (len > 0 && line[len - 1] <= ' ')
+			line[--len] = '\0';
+		if (0 == len)
+			continue;
+		rec[nrec] = strdup(line);
+		reclen[nrec] = len;
+		++nrec;
+	}
+	if (0 == nrec) {
+		fprintf(stderr, "%s: no records\n", progname);
+		return 1;
+	}
+
+	if (compare() != 0)
+		return 1;
+
+	t0 = now();
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < nrec; ++i) {
+			memcpy(work, rec[i], reclen[i] + 1);
+			sink += old_parse(work, reclen[i], oval);
+		}
+	ns_old = (now() - t0) * 1e9 / ((double)rounds * nrec);
+
+	t0 = now();
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < nrec; ++i) {
+			memcpy(work, rec[i], reclen[i] + 1);
+			sink += new_parse(work, &ctx);
+		}
+	ns_new = (now() - t0) * 1e9 / ((double)rounds * nrec);
+
+	printf("%d records\n", nrec);
+	printf("jsmn     %8.1f ns/record\n", ns_old);
+	printf("scanner  %8.1f ns/record\n", ns_new);
+	return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * This program times the l_fp primitives in ntp_fp.h.  It runs each
+ * operation over an array of pseudo-random timestamps a number of
+ * times and prints the average cost per operation.  Build it once as
+ * lfpbench (the configured backend) and once as lfpbench64 (native 64
+ * bit backend forced) to compare the two.
+ *
+ * usage: lfpbench [rounds]
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include "ntp_fp.h"
+
+#define NLFP	4096
+#define ROUNDS	2000
+
+char *progname;
+
+static l_fp	va[NLFP];
+static l_fp	vb[NLFP];
+static double	vd[NLFP];
+static volatile u_int32 sink;	/* keeps the optimizer honest */
+
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static void
+report(
+	const char *	what,
+	double		t0,
+	long		rounds
+	)
+{
+	double	ns;
+
+	ns = (now() - t0) * 1e9 / ((double)rounds * NLFP);
+	printf("%-8s %8.3f ns/op\n", what, ns);
+}
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	l_fp	r;
+	double	t0, d;
+	long	rounds, n;
+	int	i, cnt;
+
+	progname = argv[0];
+	rounds = (argc > 1) ? atol(argv[1]) : ROUNDS;
+	if (rounds < 1)
+		rounds = ROUNDS;
+
+	srandom(1);
+	for (i = 0; i < NLFP; i++) {
+		va[i].l_ui = (u_int32)random() << 1 ^ (u_int32)random();
+		va[i].l_uf = (u_int32)random() << 1 ^ (u_int32)random();
+		vb[i].l_ui = (u_int32)random() << 1 ^ (u_int32)random();
+		vb[i].l_uf = (u_int32)random() << 1 ^ (u_int32)random();
+		vd[i] = ((double)random() - RAND_MAX / 2) / 65536.;
+	}
+#if defined(NTP_LFP_NATIVE64) && defined(HAVE_U_INT64)
+	printf("l_fp backend: native 64 bit\n");
+#else
+	printf("l_fp backend: portable 32 bit\n");
+#endif
+
+	t0 = now();
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < NLFP; i++) {
+			r = va[i];
+			L_ADD(&r, &vb[i]);
+			sink ^= r.l_uf;
+		}
+	report("L_ADD", t0, rounds);
+
+	t0 = now();
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < NLFP; i++) {
+			r = va[i];
+			L_SUB(&r, &vb[i]);
+			sink ^= r.l_uf;
+		}
+	report("L_SUB", t0, rounds);
+
+	t0 = now();
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < NLFP; i++) {
+			r = va[i];
+			L_NEG(&r);
+			sink ^= r.l_ui;
+		}
+	report("L_NEG", t0, rounds);
+
+	t0 = now();
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < NLFP; i++) {
+			r = va[i];
+			L_ADDUF(&r, vb[i].l_uf);
+			sink ^= r.l_ui;
+		}
+	report("L_ADDUF", t0, rounds);
+
+	t0 = now();
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < NLFP; i++) {
+			r = va[i];
+			L_RSHIFT(&r);
+			sink ^= r.l_uf;
+		}
+	report("L_RSHIFT", t0, rounds);
+
+	t0 = now();
+	cnt = 0;
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < NLFP; i++)
+			cnt += L_ISGT(&va[i], &vb[i]);
+	sink ^= cnt;
+	report("L_ISGT", t0, rounds);
+
+	t0 = now();
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < NLFP; i++) {
+			DTOLFP(vd[i], &r);
+			sink ^= r.l_uf;
+		}
+	report("DTOLFP", t0, rounds);
+
+	t0 = now();
+	d = 0;
+	for (n = 0; n < rounds; n++)
+		for (i = 0; i < NLFP; i++) {
+			LFPTOD(&va[i], vd[i]);
+			d += vd[i];
+		}
+	sink ^= (u_int32)d;
+	report("LFPTOD", t0, rounds);
+
+	return 0;
+}
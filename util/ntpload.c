@@ -0,0 +1,165 @@
+/*
+ * This program loads an NTP server with mode 3 requests from a single
+ * socket, keeping a window of them outstanding, and prints the rate of
+ * replies, the number of requests lost and the average round trip.
+ * Each request carries its sequence number as transmit timestamp,
+ * which the server returns as origin timestamp.  Run against a local
+ * ntpd it compares the select() and io_uring (see --enable-io-uring)
+ * builds of the daemon; the server must not rate limit the client.
+ *
+ * usage: ntpload [requests [window [address [port]]]]
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#ifdef HAVE_POLL_H
+# include <poll.h>
+#endif
+
+#include "ntp_stdlib.h"
+#include "ntp.h"
+
+#define REQUESTS	100000
+#define WINDOW		16
+#define ADDRESS		"127.0.0.1"
+#define PORT		"123"
+#define TIMEOUT		200	/* ms without a reply to count as lost */
+
+char *progname;
+
+#ifdef HAVE_POLL_H
+
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	struct addrinfo	hints;
+	struct addrinfo *ai;
+	struct pollfd	pfd;
+	struct pkt	req;
+	struct pkt	rpl;
+	double *	sent;
+	double		t0, t, rtt;
+	long		requests, window, next, outstanding, got, seq;
+	int		fd, rc, n;
+
+	progname = argv[0];
+	requests = (argc > 1) ? atol(argv[1]) : REQUESTS;
+	window = (argc > 2) ? atol(argv[2]) : WINDOW;
+	if (requests < 1 || window < 1) {
+		fprintf(stderr,
+			"usage: %s [requests [window [address [port]]]]\n",
+			progname);
+		exit(2);
+	}
+
+	ZERO(hints);
+	hints.ai_socktype = SOCK_DGRAM;
+	rc = getaddrinfo((argc > 3) ? argv[3] : ADDRESS,
+			 (argc > 4) ? argv[4] : PORT, &hints, &ai);
+	if (rc != 0) {
+		fprintf(stderr, "%s: %s\n", progname, gai_strerror(rc));
+		exit(1);
+	}
+	fd = socket(ai->ai_family, SOCK_DGRAM, 0);
+	if (fd < 0 || connect(fd, ai->ai_addr, ai->ai_addrlen) < 0) {
+		perror(progname);
+		exit(1);
+	}
+	freeaddrinfo(ai);
+
+	init_lib();
+	sent = emalloc_zero(requests * sizeof(*sent));
+	ZERO(req);
+	req.li_vn_mode = PKT_LI_VN_MODE(LEAP_NOTINSYNC, NTP_VERSION,
+					MODE_CLIENT);
+	req.ppoll = NTP_MINPOLL;
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+
+	next = outstanding = got = 0;
+	rtt = 0;
+	t0 = now();
+	while (next < requests || outstanding > 0) {
+		while (outstanding < window && next < requests) {
+			req.xmt.l_ui = htonl((u_int32)next + 1);
+			sent[next] = now();
+			if (send(fd, &req, LEN_PKT_NOMAC, 0) < 0) {
+				perror("send");
+				exit(1);
+			}
+			next++;
+			outstanding++;
+		}
+		n = poll(&pfd, 1, TIMEOUT);
+		if (n < 0) {
+			if (EINTR == errno)
+				continue;
+			perror("poll");
+			exit(1);
+		}
+		if (0 == n) {
+			/* whatever is outstanding is lost */
+			outstanding = 0;
+			continue;
+		}
+		while ((int)recv(fd, &rpl, sizeof(rpl), MSG_DONTWAIT) >=
+		       (int)LEN_PKT_NOMAC) {
+			seq = (long)ntohl(rpl.org.l_ui) - 1;
+			if (seq < 0 || seq >= next || 0 == sent[seq])
+				continue;	/* late or bogus */
+			t = now();
+			rtt += t - sent[seq];
+			sent[seq] = 0;
+			got++;
+			if (outstanding > 0)
+				outstanding--;
+		}
+	}
+	t = now() - t0;
+
+	printf("%ld requests, window %ld: %.0f replies/s, %ld lost, %.1f us round trip\n",
+	       requests, window, got / t, requests - got,
+	       (got > 0) ? rtt * 1e6 / got : 0.);
+	free(sent);
+
+	return 0;
+}
+
+#else	/* !HAVE_POLL_H */
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	UNUSED_ARG(argc);
+	progname = argv[0];
+	fprintf(stderr, "%s: needs poll()\n", progname);
+
+	return 1;
+}
+
+#endif
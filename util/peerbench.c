@@ -0,0 +1,299 @@
+/*
+ * This program times the walks ntpd makes over its associations with
+ * struct peer as laid out in include/ntp.h: the peer_list walk of
+ * timer(), the peer_unfit() walk of clock_select() and the peer_hash
+ * probes of findpeer().  The peers are allocated scattered over the
+ * heap and linked in random order, and the caches are flushed before
+ * each walk, as they are when ntpd wakes up once a second with
+ * thousands of associations.  It also prints how many cache lines of
+ * each peer every walk touches.  Build it in trees with different
+ * struct peer layouts to compare them.
+ *
+ * usage: peerbench [peers [rounds]]
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "ntp_stdlib.h"
+#include "ntp.h"
+#include "ntp_control.h"
+
+#define PEERS		5000
+#define ROUNDS		200
+#define LINE		64
+#define FLUSH_SIZE	(32 * 1024 * 1024)	/* beyond the last level cache */
+
+char *progname;
+
+static struct peer *	peer_list;
+static struct peer *	peer_hash[NTP_HASH_SIZE];
+static u_char *		flush_buf;
+static volatile u_long	sink;		/* keeps the optimizer honest */
+
+/*
+ * The members each walk reads, as (offset, size) pairs.
+ */
+typedef struct member_tag {
+	size_t	off;
+	size_t	size;
+} member;
+
+#define M(f)	{ offsetof(struct peer, f), sizeof(((struct peer *)0)->f) }
+
+static const member timer_members[] = {
+	M(p_link), M(flags), M(nextdate), M(throttle)
+};
+
+static const member select_members[] = {
+	M(p_link), M(flags), M(dstadr), M(leap), M(stratum), M(precision),
+	M(hpoll), M(refid), M(rootdelay), M(rootdisp), M(update),
+	M(new_status), M(reach), M(flash), M(delay), M(jitter)
+};
+
+static const member hash_members[] = {
+	M(adr_link), M(srcadr), M(hmode)
+};
+
+
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+
+/*
+ * lines - cache lines of a peer the members fall on, with the peer
+ *	   starting on a line boundary
+ */
+static int
+lines(
+	const member *	m,
+	size_t		count
+	)
+{
+	u_char	seen[(sizeof(struct peer) + LINE - 1) / LINE];
+	size_t	i;
+	size_t	l;
+	int	n;
+
+	ZERO(seen);
+	for (i = 0; i < count; i++)
+		for (l = m[i].off / LINE;
+		     l <= (m[i].off + m[i].size - 1) / LINE; l++)
+			seen[l] = 1;
+	n = 0;
+	for (l = 0; l < COUNTOF(seen); l++)
+		n += seen[l];
+
+	return n;
+}
+
+
+/*
+ * flush - evict the peers from the caches
+ */
+static void
+flush(void)
+{
+	size_t	i;
+
+	for (i = 0; i < FLUSH_SIZE; i += LINE)
+		flush_buf[i]++;
+}
+
+
+/*
+ * timer_walk - what timer() reads of each peer, see ntp_timer.c
+ */
+static void
+timer_walk(void)
+{
+	struct peer *	p;
+	u_long		n;
+
+	n = 0;
+	for (p = peer_list; p != NULL; p = p->p_link) {
+		if (p->throttle > 0)
+			p->throttle--;
+		if (p->nextdate <= 1 && !(FLAG_REFCLOCK & p->flags))
+			n++;
+	}
+	sink += n;
+}
+
+
+/*
+ * select_walk - what clock_select() and peer_unfit() read of each
+ *		 peer, see ntp_proto.c
+ */
+static void
+select_walk(void)
+{
+	struct peer *	p;
+	double		dist;
+	u_long		n;
+	int		rval;
+
+	n = 0;
+	for (p = peer_list; p != NULL; p = p->p_link) {
+		p->new_status = CTL_PST_SEL_REJECT;
+		rval = 0;
+		if (p->leap == LEAP_NOTINSYNC || p->stratum >= STRATUM_UNSPEC)
+			rval |= TEST10;
+		dist = (p->delay + p->rootdelay) / 2 + LOGTOD(p->precision)
+		       + 15e-6 * p->update + p->rootdisp + p->jitter;
+		if (!(p->flags & FLAG_REFCLOCK) &&
+		    dist >= 1.5 + 15e-6 * ULOGTOD(p->hpoll))
+			rval |= TEST11;
+		if (p->stratum > 1 && p->dstadr != NULL &&
+		    p->refid == p->dstadr->addr_refid)
+			rval |= TEST12;
+		if (!p->reach || (p->flags & FLAG_NOSELECT))
+			rval |= TEST13;
+		p->flash &= ~PEER_TEST_MASK;
+		p->flash |= rval;
+		if (!rval)
+			n++;
+	}
+	sink += n;
+}
+
+
+/*
+ * hash_probe - what findpeer() reads to match a server packet, see
+ *		ntp_peer.c
+ */
+static void
+hash_probe(
+	sockaddr_u *	addrs,
+	size_t		count
+	)
+{
+	struct peer *	p;
+	size_t		i;
+	u_long		n;
+
+	n = 0;
+	for (i = 0; i < count; i++)
+		for (p = peer_hash[NTP_HASH_ADDR(&addrs[i])];
+		     p != NULL; p = p->adr_link)
+			if (ADDR_PORT_EQ(&addrs[i], &p->srcadr) &&
+			    MODE_CLIENT == p->hmode) {
+				n++;
+				break;
+			}
+	sink += n;
+}
+
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	struct peer **	peers;
+	struct peer *	p;
+	sockaddr_u *	addrs;
+	void **		filler;
+	double		t0, t_timer, t_select, t_hash;
+	long		npeers, rounds, n, r;
+	size_t		h;
+
+	progname = argv[0];
+	npeers = (argc > 1) ? atol(argv[1]) : PEERS;
+	rounds = (argc > 2) ? atol(argv[2]) : ROUNDS;
+	if (npeers < 1 || rounds < 1) {
+		fprintf(stderr, "usage: %s [peers [rounds]]\n", progname);
+		exit(2);
+	}
+
+	init_lib();
+	srandom(1);
+	flush_buf = emalloc_zero(FLUSH_SIZE);
+
+	/*
+	 * Allocate the peers between blocks of other sizes, as the
+	 * heap of a running ntpd is, so they do not sit in sequence.
+	 */
+	peers = emalloc(npeers * sizeof(*peers));
+	filler = emalloc(npeers * sizeof(*filler));
+	addrs = emalloc_zero(npeers * sizeof(*addrs));
+	for (n = 0; n < npeers; n++) {
+		filler[n] = emalloc(16 + random() % 1024);
+		p = emalloc_zero(sizeof(*p));
+		AF(&p->srcadr) = AF_INET;
+		SET_ADDR4(&p->srcadr, 0x0a000000 | (u_int32)n);
+		SET_PORT(&p->srcadr, NTP_PORT);
+		p->hmode = MODE_CLIENT;
+		p->leap = LEAP_NOWARNING;
+		p->stratum = 2;
+		p->precision = -20;
+		p->hpoll = NTP_MINDPOLL;
+		p->reach = 0xff;
+		p->nextdate = random() % 64;
+		p->throttle = random() % 2;
+		p->delay = p->rootdelay = p->rootdisp = 1e-3;
+		p->jitter = 1e-4;
+		peers[n] = p;
+		addrs[n] = p->srcadr;
+	}
+
+	/* link them in random order, as associations come and go */
+	for (n = npeers - 1; n > 0; n--) {
+		r = random() % (n + 1);
+		p = peers[n];
+		peers[n] = peers[r];
+		peers[r] = p;
+	}
+	for (n = 0; n < npeers; n++) {
+		p = peers[n];
+		LINK_SLIST(peer_list, p, p_link);
+		h = NTP_HASH_ADDR(&p->srcadr);
+		LINK_SLIST(peer_hash[h], p, adr_link);
+	}
+
+	t_timer = t_select = t_hash = 0;
+	for (r = 0; r < rounds; r++) {
+		flush();
+		t0 = now();
+		timer_walk();
+		t_timer += now() - t0;
+
+		flush();
+		t0 = now();
+		select_walk();
+		t_select += now() - t0;
+
+		flush();
+		t0 = now();
+		hash_probe(addrs, npeers);
+		t_hash += now() - t0;
+	}
+
+	printf("%ld peers of %lu octets, %ld rounds with cold caches\n",
+	       npeers, (u_long)sizeof(struct peer), rounds);
+	printf("timer() walk    %9.1f us  %d lines/peer\n",
+	       t_timer * 1e6 / rounds,
+	       lines(timer_members, COUNTOF(timer_members)));
+	printf("clock_select()  %9.1f us  %d lines/peer\n",
+	       t_select * 1e6 / rounds,
+	       lines(select_members, COUNTOF(select_members)));
+	printf("findpeer() x%ld %9.1f us  %d lines/peer\n",
+	       npeers, t_hash * 1e6 / rounds,
+	       lines(hash_members, COUNTOF(hash_members)));
+
+	return 0;
+}
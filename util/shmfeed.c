@@ -0,0 +1,184 @@
+/*
+ * This program feeds the SHM refclock (type 28) from the system clock,
+ * for testing the driver without a GPS.  It writes the classic single
+ * sample interface and, unless -c is given, the sample ring used by
+ * units configured with mode 2, at the given rate.  The reference time
+ * stamp is the system time plus the given offset.
+ *
+ * usage: shmfeed [-c] [-o offset] [-r rate] [-n count] [unit]
+ *
+ *	-c	classic single sample interface only
+ *	-o	offset of the fake reference clock in seconds (0)
+ *	-r	samples per second (10)
+ *	-n	stop after this many samples (run forever)
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#ifdef HAVE_STDATOMIC_H
+# include <stdatomic.h>
+#endif
+
+#include "ntp_shm.h"
+
+char *progname;
+
+static inline void
+memory_barrier(void)
+{
+#ifdef HAVE_ATOMIC_THREAD_FENCE
+	atomic_thread_fence(memory_order_seq_cst);
+#endif
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+		"usage: %s [-c] [-o offset] [-r rate] [-n count] [unit]\n",
+		progname);
+	exit(1);
+}
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	struct shmRing *	ring;
+	struct shmTime *	shm;
+	struct shmSample *	slot;
+	struct timespec		rcv;
+	struct timespec		ref;
+	struct timespec		nap;
+	double			offset;
+	double			rate;
+	long			count;
+	long			i;
+	size_t			size;
+	unsigned		n;
+	int			classic;
+	int			unit;
+	int			shmid;
+	int			ch;
+
+	progname = argv[0];
+	classic = 0;
+	offset = 0.;
+	rate = 10.;
+	count = -1;
+	n = 0;
+	while ((ch = getopt(argc, argv, "co:r:n:")) != -1) {
+		switch (ch) {
+
+		case 'c':
+			classic = 1;
+			break;
+
+		case 'o':
+			offset = atof(optarg);
+			break;
+
+		case 'r':
+			rate = atof(optarg);
+			break;
+
+		case 'n':
+			count = atol(optarg);
+			break;
+
+		default:
+			usage();
+		}
+	}
+	if (rate <= 0. || argc - optind > 1)
+		usage();
+	unit = (optind < argc) ? atoi(argv[optind]) : 0;
+
+	/*
+	 * ntpd may already have made the segment; a classic one is
+	 * too small for the ring.
+	 */
+	size = (classic) ? sizeof(struct shmTime) : sizeof(struct shmRing);
+	shmid = shmget(SHM_KEY_BASE + unit, size, IPC_CREAT | 0600);
+	if (-1 == shmid) {
+		perror("shmget");
+		return 1;
+	}
+	shm = shmat(shmid, NULL, 0);
+	if ((void *)-1 == shm) {
+		perror("shmat");
+		return 1;
+	}
+	ring = (classic) ? NULL : (struct shmRing *)shm;
+	if (ring != NULL) {
+		ring->nslots = SHM_RING_SLOTS;
+		n = ring->head;
+		memory_barrier();
+		ring->ring_magic = SHM_RING_MAGIC;
+	}
+	shm->mode = 1;
+
+	nap.tv_sec = (time_t)(1. / rate);
+	nap.tv_nsec = (long)((1. / rate - nap.tv_sec) * 1e9);
+	for (i = 0; count < 0 || i < count; i++) {
+		clock_gettime(CLOCK_REALTIME, &rcv);
+		ref = rcv;
+		ref.tv_sec += (time_t)offset;
+		ref.tv_nsec += (long)((offset - (time_t)offset) * 1e9);
+		while (ref.tv_nsec >= 1000000000) {
+			ref.tv_nsec -= 1000000000;
+			ref.tv_sec++;
+		}
+		while (ref.tv_nsec < 0) {
+			ref.tv_nsec += 1000000000;
+			ref.tv_sec--;
+		}
+
+		if (ring != NULL) {
+			slot = &ring->slot[n % SHM_RING_SLOTS];
+			slot->seq = 2 * n + 1;
+			memory_barrier();
+			slot->clockTimeStampSec = ref.tv_sec;
+			slot->clockTimeStampNSec = ref.tv_nsec;
+			slot->receiveTimeStampSec = rcv.tv_sec;
+			slot->receiveTimeStampNSec = rcv.tv_nsec;
+			slot->leap = 0;
+			slot->precision = -20;
+			memory_barrier();
+			slot->seq = 2 * n + 2;
+			memory_barrier();
+			ring->head = ++n;
+		}
+
+		shm->valid = 0;
+		shm->count++;
+		memory_barrier();
+		shm->clockTimeStampSec = ref.tv_sec;
+		shm->clockTimeStampUSec = ref.tv_nsec / 1000;
+		shm->clockTimeStampNSec = ref.tv_nsec;
+		shm->receiveTimeStampSec = rcv.tv_sec;
+		shm->receiveTimeStampUSec = rcv.tv_nsec / 1000;
+		shm->receiveTimeStampNSec = rcv.tv_nsec;
+		shm->leap = 0;
+		shm->precision = -20;
+		memory_barrier();
+		shm->count++;
+		shm->valid = 1;
+
+		nanosleep(&nap, NULL);
+	}
+
+	shmdt(shm);
+	return 0;
+}
@@ -20,7 +20,11 @@
  *
  * The default is to route generated signals to the line output
  * jack; the s option on the command line routes these signals to the
- * internal speaker as well. The v option controls the speaker volume
+ * internal speaker as well. The a option can name a regular file or a
+ * FIFO instead of the audio device. A file gets the raw mu-law samples
+ * as fast as they can be generated, for the replay tests of the audio
+ * drivers. A FIFO is paced to the system clock, so it can feed a
+ * driver in real time as its idev in /etc/ntp.audio. The v option controls the speaker volume
  * over the range 0-255. The signal generator by default uses WWV
  * format; the h option switches to WWVH format and the i option
  * switches to IRIG-B format.
@@ -243,6 +247,7 @@
 #define	OFF		(0)				/* zero amplitude */
 #define	LOW		(1)				/* low amplitude */
 #define	HIGH	(2)				/* high amplitude */
+#define	IRIGLOW	(3)				/* IRIG low amplitude, 10:3 */
 #define	DATA0	(200)			/* WWV/H 0 pulse */
 #define	DATA1	(500)			/* WWV/H 1 pulse */
 #define PI		(800)			/* WWV/H PI pulse */
@@ -279,6 +284,18 @@ int u3000[] = {
     119, 119, 119, 119, 119, 119, 119, 119, 119, 119,	/* 60-69 */
     119, 119, 119, 119, 119, 119, 119, 119, 119, 119}; 	/* 70-79 */
 
+/*
+ * Companded sine table amplitude 1800 units, the IRIG low level
+ */
+int c1800[] = {1, 37, 51, 60, 66, 70, 74, 78, 81, 82,	/* 0-9 */
+     84,  85,  87,  88,  89,  90,  91,  91,  92,  92,	/* 10-19 */
+     92,  92,  92,  91,  91,  90,  89,  88,  87,  85,	/* 20-29 */
+     84,  82,  81,  78,  74,  70,  66,  60,  51,  37,	/* 30-39 */
+    129, 165, 179, 188, 194, 198, 202, 206, 209, 210,	/* 40-49 */
+    212, 213, 215, 216, 217, 218, 219, 219, 220, 220,	/* 50-59 */
+    220, 220, 220, 219, 219, 218, 217, 216, 215, 213,	/* 60-69 */
+    212, 210, 209, 206, 202, 198, 194, 188, 179, 165};	/* 70-79 */
+
 /*
  * Companded sine table amplitude 3000 units
  */
@@ -497,6 +514,7 @@ void	digit(int);		/* encode digit */
 void	peep(int, int, int);	/* send cycles */
 void	poop(int, int, int, int); /* Generate unmodulated from similar tables */
 void	delay(int);		/* delay samples */
+void	Output(char *, int);	/* write samples */
 int		ConvertMonthDayToDayOfYear (int, int, int);	/* Calc day of year from year month & day */
 void	Help (void);	/* Usage message */
 void	ReverseString(char *);
@@ -512,6 +530,10 @@ void	ReverseString(char *);
 char	buffer[BUFLNG];		/* output buffer */
 int	bufcnt = 0;		/* buffer counter */
 int	fd;			/* audio codec file descriptor */
+int	Pace = FALSE;		/* pace output to the system clock */
+int	DeviceNamed = FALSE;	/* -a named the output */
+struct timeval PaceStart;	/* system clock at first output */
+double	SamplesSent = 0;	/* samples written */
 int	tone = 1000;		/* WWV sync frequency */
 int HourTone = 1500;	/* WWV hour on-time frequency */
 int	encode = IRIG;		/* encoder select */
@@ -568,6 +590,7 @@ main(
 #define	RUNNING_STABILITY_BAND		( 5)	// When running, stability is defined as difference within +/- this value.
 
 	struct	tm		*TimeStructure = NULL;	/* Structure returned by gmtime */
+	struct	stat	 FileStatus;			/* Device, FIFO or file */
 	char	device[200];	/* audio device */
 	char	code[200];	/* timecode */
 	int	temp;
@@ -701,6 +724,7 @@ main(
 
 		case 'a':	/* specify audio device (/dev/audio) */
 			strlcpy(device, optarg, sizeof(device));
+			DeviceNamed = TRUE;
 			break;
 
 		case 'b':	/* Remove (delete) a leap second at the end of the specified minute. */
@@ -971,82 +995,108 @@ main(
 	/*
 	 * Open audio device and set options
 	 */
-	fd = open(device, O_WRONLY);
+	/*
+	 * Only a file named with -a outside /dev is created, so a
+	 * machine without a sound device does not get a /dev/audio file.
+	 */
+	if (DeviceNamed && strncmp(device, "/dev/", 5) != 0)
+		fd = open(device, O_WRONLY | O_CREAT, 0644);
+	else
+		fd = open(device, O_WRONLY);
 	if (fd <= 0) {
 		printf("Unable to open audio device \"%s\", aborting: %s\n", device, strerror(errno));
 		exit(1);
 	}
 
+	/*
+	 * A FIFO is paced to the system clock; a regular file is written
+	 * as fast as possible, so there is no clock to correct the rate
+	 * against.
+	 */
+	if (fstat(fd, &FileStatus) == 0 && !S_ISCHR(FileStatus.st_mode)) {
+		if (S_ISFIFO(FileStatus.st_mode)) {
+			Pace = TRUE;
+		} else {
+			if (ftruncate(fd, 0) == -1) {
+				printf("Unable to truncate \"%s\", aborting: %s\n", device, strerror(errno));
+				exit(1);
+			}
+			EnableRateCorrection = FALSE;
+		}
+		printf("Writing to %s \"%s\"\n", Pace ? "FIFO" : "file", device);
+	} else {
+
 #ifdef  HAVE_SYS_SOUNDCARD_H
-	/* First set coding type */
-	AudioFormat = AFMT_MU_LAW;
-	if (ioctl(fd, SNDCTL_DSP_SETFMT, &AudioFormat)==-1)
-	{ /* Fatal error */
-	printf ("\nUnable to set output format, aborting...\n\n");
-	exit(-1);
-	}
+		/* First set coding type */
+		AudioFormat = AFMT_MU_LAW;
+		if (ioctl(fd, SNDCTL_DSP_SETFMT, &AudioFormat)==-1)
+		{ /* Fatal error */
+		printf ("\nUnable to set output format, aborting...\n\n");
+		exit(-1);
+		}
 
-	if  (AudioFormat != AFMT_MU_LAW)
-	{
-	printf ("\nUnable to set output format for mu law, aborting...\n\n");
-	exit(-1);
-	}
+		if  (AudioFormat != AFMT_MU_LAW)
+		{
+		printf ("\nUnable to set output format for mu law, aborting...\n\n");
+		exit(-1);
+		}
 
-	/* Next set number of channels */
-	MonoStereo = MONO;	/* Mono */
-	if (ioctl(fd, SNDCTL_DSP_STEREO, &MonoStereo)==-1)
-	{ /* Fatal error */
-	printf ("\nUnable to set mono/stereo, aborting...\n\n");
-	exit(-1);
-	}
+		/* Next set number of channels */
+		MonoStereo = MONO;	/* Mono */
+		if (ioctl(fd, SNDCTL_DSP_STEREO, &MonoStereo)==-1)
+		{ /* Fatal error */
+		printf ("\nUnable to set mono/stereo, aborting...\n\n");
+		exit(-1);
+		}
 
-	if (MonoStereo != MONO)
-	{
-	printf ("\nUnable to set mono/stereo for mono, aborting...\n\n");
-	exit(-1);
-	}
+		if (MonoStereo != MONO)
+		{
+		printf ("\nUnable to set mono/stereo for mono, aborting...\n\n");
+		exit(-1);
+		}
 
-	/* Now set sample rate */
-	SampleRate = SetSampleRate;
-	if (ioctl(fd, SNDCTL_DSP_SPEED, &SampleRate)==-1)
-	{ /* Fatal error */
-	printf ("\nUnable to set sample rate to %d, returned %d, aborting...\n\n", SetSampleRate, SampleRate);
-	exit(-1);
-	}
+		/* Now set sample rate */
+		SampleRate = SetSampleRate;
+		if (ioctl(fd, SNDCTL_DSP_SPEED, &SampleRate)==-1)
+		{ /* Fatal error */
+		printf ("\nUnable to set sample rate to %d, returned %d, aborting...\n\n", SetSampleRate, SampleRate);
+		exit(-1);
+		}
 
-	SampleRateDifference = SampleRate - SetSampleRate;
+		SampleRateDifference = SampleRate - SetSampleRate;
 
-	if  (SampleRateDifference < 0)
-		SampleRateDifference = - SampleRateDifference;
+		if  (SampleRateDifference < 0)
+			SampleRateDifference = - SampleRateDifference;
 
-	/* Fixed allowable sample rate error 0.1% */
-	if (SampleRateDifference > (SetSampleRate/1000))
-	{
-	printf ("\nUnable to set sample rate to %d, result was %d, more than 0.1 percent, aborting...\n\n", SetSampleRate, SampleRate);
-	exit(-1);
-	}
-	else
-	{
-	/* printf ("\nAttempt to set sample rate to %d, actual %d...\n\n", SetSampleRate, SampleRate); */
-	}
+		/* Fixed allowable sample rate error 0.1% */
+		if (SampleRateDifference > (SetSampleRate/1000))
+		{
+		printf ("\nUnable to set sample rate to %d, result was %d, more than 0.1 percent, aborting...\n\n", SetSampleRate, SampleRate);
+		exit(-1);
+		}
+		else
+		{
+		/* printf ("\nAttempt to set sample rate to %d, actual %d...\n\n", SetSampleRate, SampleRate); */
+		}
 #else
-	rval = ioctl(fd, AUDIO_GETINFO, &info);
-	if (rval < 0) {
-		printf("\naudio control %s", strerror(errno));
-		exit(0);
-	}
-	info.play.port = port;
-	info.play.gain = level;
-	info.play.sample_rate = SetSampleRate;
-	info.play.channels = 1;
-	info.play.precision = 8;
-	info.play.encoding = AUDIO_ENCODING_ULAW;
-	printf("\nport %d gain %d rate %d chan %d prec %d encode %d\n",
-	    info.play.port, info.play.gain, info.play.sample_rate,
-	    info.play.channels, info.play.precision,
-	    info.play.encoding);
-	ioctl(fd, AUDIO_SETINFO, &info);
+		rval = ioctl(fd, AUDIO_GETINFO, &info);
+		if (rval < 0) {
+			printf("\naudio control %s", strerror(errno));
+			exit(0);
+		}
+		info.play.port = port;
+		info.play.gain = level;
+		info.play.sample_rate = SetSampleRate;
+		info.play.channels = 1;
+		info.play.precision = 8;
+		info.play.encoding = AUDIO_ENCODING_ULAW;
+		printf("\nport %d gain %d rate %d chan %d prec %d encode %d\n",
+		    info.play.port, info.play.gain, info.play.sample_rate,
+		    info.play.channels, info.play.precision,
+		    info.play.encoding);
+		ioctl(fd, AUDIO_SETINFO, &info);
 #endif
+	}
 
  	/*
 	 * Unless specified otherwise, read the system clock and
@@ -1060,6 +1110,29 @@ main(
 	if	(utc)
 		{
 		DayOfYear = ConvertMonthDayToDayOfYear (Year, Month, DayOfMonth);
+
+		/*
+		 * The generator steps to the next second before sending
+		 * each one, so start a second early to send the -y time
+		 * first.
+		 */
+		if  (--Second < 0)
+			{
+			Second = 59;
+			if  (--Minute < 0)
+				{
+				Minute = 59;
+				if  (--Hour < 0)
+					{
+					Hour = 23;
+					if  (--DayOfYear < 1)
+						{
+						Year = (Year + 99) % 100;
+						DayOfYear = Year & 0x3 ? 365 : 366;
+						}
+					}
+				}
+			}
 		}
 	else
 		{
@@ -1623,7 +1696,7 @@ main(
 								else
 									{
 									peep(M5, 1000, HIGH);
-									peep(M5-1, 1000, LOW);
+									peep(M5-1, 1000, IRIGLOW);
 
 									TotalCyclesRemoved += 1;
 									}
@@ -1641,7 +1714,7 @@ main(
 								else
 									{
 									peep(M2, 1000, HIGH);
-									peep(M8-1, 1000, LOW);
+									peep(M8-1, 1000, IRIGLOW);
 
 									TotalCyclesRemoved += 1;
 									}
@@ -1664,7 +1737,7 @@ main(
 									else
 										{
 										peep(M5, 1000, HIGH);
-										peep(M5+1, 1000, LOW);
+										peep(M5+1, 1000, IRIGLOW);
 
 										TotalCyclesAdded += 1;
 										}
@@ -1682,7 +1755,7 @@ main(
 									else
 										{
 										peep(M2, 1000, HIGH);
-										peep(M8+1, 1000, LOW);
+										peep(M8+1, 1000, IRIGLOW);
 
 										TotalCyclesAdded += 1;
 										}
@@ -1702,7 +1775,7 @@ main(
 									else
 										{
 										peep(M5, 1000, HIGH);
-										peep(M5, 1000, LOW);
+										peep(M5, 1000, IRIGLOW);
 										}
 									strlcat(OutputDataString, "1", OUTPUT_DATA_STRING_LENGTH);
 									}
@@ -1716,7 +1789,7 @@ main(
 									else
 										{
 										peep(M2, 1000, HIGH);
-										peep(M8, 1000, LOW);
+										peep(M8, 1000, IRIGLOW);
 										}
 									strlcat(OutputDataString, "0", OUTPUT_DATA_STRING_LENGTH);
 									}
@@ -1735,7 +1808,7 @@ main(
 							else
 								{
 								peep(M5, 1000, HIGH);
-								peep(M5, 1000, LOW);
+								peep(M5, 1000, IRIGLOW);
 								}
 							strlcat(OutputDataString, "1", OUTPUT_DATA_STRING_LENGTH);
 							}
@@ -1749,7 +1822,7 @@ main(
 							else
 								{
 								peep(M2, 1000, HIGH);
-								peep(M8, 1000, LOW);
+								peep(M8, 1000, IRIGLOW);
 								}
 							strlcat(OutputDataString, "0", OUTPUT_DATA_STRING_LENGTH);
 							}
@@ -1766,7 +1839,7 @@ main(
 					else
 						{
 						peep(M2, 1000, HIGH);
-						peep(M8, 1000, LOW);
+						peep(M8, 1000, IRIGLOW);
 						}
 					strlcat(OutputDataString, "-", OUTPUT_DATA_STRING_LENGTH);
 					break;
@@ -1783,7 +1856,7 @@ main(
 					else
 						{
 						peep(arg,      1000, HIGH);
-						peep(10 - arg, 1000, LOW);
+						peep(10 - arg, 1000, IRIGLOW);
 						}
 					strlcat(OutputDataString, ".", OUTPUT_DATA_STRING_LENGTH);
 					break;
@@ -2183,6 +2256,8 @@ main(
 	}
 	
 	
+if  (bufcnt > 0)
+	Output(buffer, bufcnt);
 printf ("\n\n>> Completed %d seconds, exiting...\n\n", SecondsToSend);
 return (0);
 }
@@ -2311,11 +2386,15 @@ void peep(
 			buffer[bufcnt++] = ~c3000[j];
 			break;
 
+		case IRIGLOW:
+			buffer[bufcnt++] = ~c1800[j];
+			break;
+
 		default:
 			buffer[bufcnt++] = ~0;
 		}
 		if (bufcnt >= BUFLNG) {
-			write(fd, buffer, BUFLNG);
+			Output(buffer, BUFLNG);
 			bufcnt = 0;
 		}
 		j = (j + increm) % 80;
@@ -2362,7 +2441,7 @@ void poop(
 			buffer[bufcnt++] = ~0;
 		}
 		if (bufcnt >= BUFLNG) {
-			write(fd, buffer, BUFLNG);
+			Output(buffer, BUFLNG);
 			bufcnt = 0;
 		}
 		j = (j + increm) % 80;
@@ -2381,10 +2460,37 @@ void delay (
 	samples = Delay;
 	memset(buffer, 0, BUFLNG);
 	while (samples >= BUFLNG) {
-		write(fd, buffer, BUFLNG);
+		Output(buffer, BUFLNG);
 		samples -= BUFLNG;
 	}
-		write(fd, buffer, samples);
+		Output(buffer, samples);
+}
+
+
+/*
+ * Write samples, pacing them to the system clock if required.
+ */
+void
+Output(
+	char	*buf,		/* samples */
+	int	len		/* number of samples */
+	)
+{
+	struct timeval	Now;
+	double	Ahead;		/* seconds ahead of the system clock */
+
+	if  (Pace)
+		{
+		gettimeofday(&Now, NULL);
+		if  (SamplesSent == 0)
+			PaceStart = Now;
+		Ahead = SamplesSent / SECOND - (Now.tv_sec - PaceStart.tv_sec) -
+		    (Now.tv_usec - PaceStart.tv_usec) / 1e6;
+		if  (Ahead > 0)
+			usleep((useconds_t)(Ahead * 1e6));
+		}
+	write(fd, buf, len);
+	SamplesSent += len;
 }
 
 
@@ -2453,7 +2559,7 @@ Help ( void )
 	printf ("\n\nRCS Info:");
 	printf (  "\n  $Header: /home/dmw/src/IRIG_generation/ntp-4.2.2p3/util/RCS/tg.c,v 1.28 2007/02/12 23:57:45 dmw Exp $");
 	printf ("\n\nUsage: %s [option]*", CommandName);
-	printf ("\n\nOptions: -a device_name                 Output audio device name (default /dev/audio)");
+	printf ("\n\nOptions: -a device_name                 Output audio device, FIFO or file name (default /dev/audio)");
 	printf (  "\n         -b yymmddhhmm                  Remove leap second at end of minute specified");
 	printf (  "\n         -c seconds_to_send             Number of seconds to send (default 0 = forever)");
 	printf (  "\n         -d                             Start with IEEE 1344 DST active");
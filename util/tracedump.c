@@ -0,0 +1,172 @@
+/*
+ * This program prints the packet trace files written by ntpd, see
+ * ntpd/ntp_trace.c, one line per packet:
+ *
+ *	time dir remote local mode version stratum verdict match rflags
+ *	length wait proc
+ *
+ * The time is UTC, wait is the time from reception of the request to
+ * receive() picking it up or to the reply being sent, and proc is the
+ * time spent in receive(), both in microseconds.
+ *
+ * usage: tracedump file ...
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ntp_fp.h"
+#include "ntp_net.h"
+#include "ntp_stdlib.h"
+#include "ntp_unixtime.h"
+#include "ntp_trace.h"
+
+char *progname;
+
+static const char * const verdicts[] = {
+	"accepted",		/* PTV_ACCEPTED */
+	"restricted",		/* PTV_RESTRICTED */
+	"badlength",		/* PTV_BADLENGTH */
+	"declined",		/* PTV_DECLINED */
+	"badauth",		/* PTV_BADAUTH */
+	"limited",		/* PTV_LIMITED */
+	"kod",			/* PTV_KOD */
+	"processed",		/* PTV_PROCESSED */
+	"sent",			/* PTV_SENT */
+	"signd"			/* PTV_SIGND */
+};
+
+/*
+ * Convert a duration in units of 2^-32 s to microseconds
+ */
+static u_long
+frac_us(
+	u_int32	frac
+	)
+{
+	return (u_long)(((unsigned long long)frac * 1000000) >> 32);
+}
+
+static void
+print_addr(
+	char *			buf,
+	size_t			len,
+	int			family,
+	const u_char *		addr,
+	u_short			port
+	)
+{
+	char	host[INET6_ADDRSTRLEN];
+
+	if (6 == family) {
+		inet_ntop(AF_INET6, addr, host, sizeof(host));
+		snprintf(buf, len, "[%s]:%u", host, port);
+	} else {
+		inet_ntop(AF_INET, addr, host, sizeof(host));
+		snprintf(buf, len, "%s:%u", host, port);
+	}
+}
+
+static int
+dump(
+	const char *	name
+	)
+{
+	struct ptrace_hdr	hdr;
+	struct ptrace_rec	tr;
+	char			stamp[32];
+	char			raddr[INET6_ADDRSTRLEN + 16];
+	char			laddr[INET6_ADDRSTRLEN + 16];
+	char			vbuf[16];
+	const char *		verdict;
+	struct tm *		tm;
+	time_t			secs;
+	u_int32			i, count, reclen;
+	FILE *			fp;
+
+	fp = fopen(name, "rb");
+	if (NULL == fp) {
+		perror(name);
+		return 1;
+	}
+	if (1 != fread(&hdr, sizeof(hdr), 1, fp)
+	    || PTRACE_MAGIC != ntohl(hdr.magic)) {
+		fprintf(stderr, "%s: not a packet trace\n", name);
+		fclose(fp);
+		return 1;
+	}
+	reclen = ntohl(hdr.reclen);
+	if (PTRACE_VERSION != ntohl(hdr.version) || reclen != sizeof(tr)) {
+		fprintf(stderr, "%s: trace version %u not supported\n",
+			name, ntohl(hdr.version));
+		fclose(fp);
+		return 1;
+	}
+	count = ntohl(hdr.count);
+	printf("# %s: %u packets, %u earlier ones overwritten\n",
+	       name, count, ntohl(hdr.lost));
+
+	for (i = 0; i < count; i++) {
+		if (1 != fread(&tr, sizeof(tr), 1, fp)) {
+			fprintf(stderr, "%s: truncated after %u packets\n",
+				name, i);
+			fclose(fp);
+			return 1;
+		}
+		secs = (time_t)(ntohl(tr.ts_ui) - JAN_1970);
+		tm = gmtime(&secs);
+		if (NULL == tm)
+			strlcpy(stamp, "-", sizeof(stamp));
+		else
+			strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S",
+				 tm);
+		print_addr(raddr, sizeof(raddr), tr.family, tr.raddr,
+			   ntohs(tr.rport));
+		print_addr(laddr, sizeof(laddr), tr.family, tr.laddr,
+			   ntohs(tr.lport));
+		if (tr.verdict < COUNTOF(verdicts)) {
+			verdict = verdicts[tr.verdict];
+		} else {
+			snprintf(vbuf, sizeof(vbuf), "#%u", tr.verdict);
+			verdict = vbuf;
+		}
+		printf("%s.%06lu %s %s %s mode %u v%u st %u %s am %d "
+		       "rflags %04x len %u wait %lu proc %lu\n",
+		       stamp, frac_us(ntohl(tr.ts_uf)),
+		       (PT_TX == tr.dir) ? "tx" : "rx",
+		       raddr, laddr, tr.mode, tr.version, tr.stratum,
+		       verdict, (signed char)tr.match, ntohs(tr.rflags),
+		       ntohs(tr.len), frac_us(ntohl(tr.wait)),
+		       frac_us(ntohl(tr.proc)));
+	}
+	fclose(fp);
+
+	return 0;
+}
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	int	i;
+	int	rc;
+
+	progname = argv[0];
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s file ...\n", progname);
+		exit(1);
+	}
+	rc = 0;
+	for (i = 1; i < argc; i++)
+		rc |= dump(argv[i]);
+
+	return rc;
+}
@@ -0,0 +1,184 @@
+/*
+ * This program times the round trip of a request through a blocking
+ * worker, see libntp/ntp_worker.c, with BLOCKING_ECHO requests which
+ * the worker just sends back.  It queues a burst of requests at once,
+ * waits for all responses and prints the average time per request.
+ * A burst of 1 gives the latency of a single request on an idle
+ * worker, larger bursts show the throughput.
+ *
+ * usage: workbench [requests [burst [size]]]
+ */
+
+#ifdef HAVE_CONFIG_H
+# include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#ifdef HAVE_POLL_H
+# include <poll.h>
+#endif
+
+#include "ntp_stdlib.h"
+#include "ntp_intres.h"
+#include "ntp_worker.h"
+
+#define REQUESTS	20000
+#define BURST		1
+#define SIZE		64
+
+char *progname;
+
+#if defined(WORKER) && defined(HAVE_POLL_H) && \
+    (defined(WORK_FORK) || defined(WORK_PIPE))
+
+static size_t	done;
+static size_t	size;
+
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+/*
+ * The worker idle timer is ntpd's and sntp's business.
+ */
+void
+intres_timeout_req(
+	u_int	seconds
+	)
+{
+	UNUSED_ARG(seconds);
+}
+
+#ifdef WORK_FORK
+/* called by the forked worker, there is nothing to close */
+void
+kill_asyncio(
+	int	startfd
+	)
+{
+	UNUSED_ARG(startfd);
+}
+#endif
+
+static void
+no_io_fd(
+	int	fd,
+	int	is_pipe,
+	int	remove_it
+	)
+{
+	UNUSED_ARG(fd);
+	UNUSED_ARG(is_pipe);
+	UNUSED_ARG(remove_it);
+}
+
+static void
+echoed(
+	blocking_work_req	rtype,
+	void *			context,
+	size_t			respsize,
+	void *			resp
+	)
+{
+	UNUSED_ARG(rtype);
+	UNUSED_ARG(context);
+	UNUSED_ARG(resp);
+	if (respsize != size) {
+		fprintf(stderr, "%s: echo of %lu octets for %lu\n",
+			progname, (u_long)respsize, (u_long)size);
+		exit(1);
+	}
+	done++;
+}
+
+/*
+ * Wait for the responses of the child to the requests queued so far.
+ */
+static void
+collect(
+	size_t	queued
+	)
+{
+	blocking_child *	c;
+	struct pollfd		pfd;
+
+	c = blocking_children[0];
+	while (done < queued) {
+		pfd.fd = c->resp_read_pipe;
+		pfd.events = POLLIN;
+		if (poll(&pfd, 1, -1) < 0)
+			continue;
+		process_blocking_resp(c);
+	}
+}
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	char *	req;
+	double	t0, us;
+	long	requests, burst, n, b;
+
+	progname = argv[0];
+	requests = (argc > 1) ? atol(argv[1]) : REQUESTS;
+	burst = (argc > 2) ? atol(argv[2]) : BURST;
+	size = (argc > 3) ? (size_t)atol(argv[3]) : SIZE;
+	if (requests < 1 || burst < 1 || size < 1) {
+		fprintf(stderr, "usage: %s [requests [burst [size]]]\n",
+			progname);
+		exit(2);
+	}
+
+	init_lib();
+	addremove_io_fd = &no_io_fd;
+	req = emalloc_zero(size);
+
+	/* start the worker, out of the timing */
+	queue_blocking_request(BLOCKING_ECHO, req, size, &echoed, NULL);
+	collect(1);
+
+	done = 0;
+	t0 = now();
+	for (n = 0; n < requests; n += burst) {
+		for (b = 0; b < burst && n + b < requests; b++)
+			queue_blocking_request(BLOCKING_ECHO, req, size,
+					       &echoed, NULL);
+		collect(n + b);
+	}
+	us = (now() - t0) * 1e6 / requests;
+
+	printf("%ld requests of %lu octets in bursts of %ld: %.3f us/request\n",
+	       requests, (u_long)size, burst, us);
+	free(req);
+
+	return 0;
+}
+
+#else	/* no blocking workers with a response fd */
+
+int
+main(
+	int argc,
+	char *argv[]
+	)
+{
+	UNUSED_ARG(argc);
+	progname = argv[0];
+	fprintf(stderr, "%s: needs blocking workers signalling through a pipe\n",
+		progname);
+
+	return 1;
+}
+
+#endif